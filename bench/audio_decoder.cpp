@@ -0,0 +1,166 @@
+/*
+ * This file is part of EasyRPG Player.
+ *
+ * EasyRPG Player is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * EasyRPG Player is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with EasyRPG Player. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * Measures the decoding (including resampling) and mixing throughput of
+ * the audio decoders on local files:
+ *
+ *   bench_audio_decoder [-s SECONDS] FILE...
+ *
+ * Every file is decoded to 44.1 kHz S16 stereo like GenericAudio does,
+ * at most SECONDS (default 60) of audio. Afterwards seeking to the middle
+ * of the decoded part and a loop restart (rewind) are timed, both include
+ * decoding the first chunk at the new position. The result is printed as one
+ * tab separated line per file, the exit code is non-zero when a file
+ * could not be decoded.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+#include "audio_decoder.h"
+#include "audio_mixer.h"
+#include "filefinder.h"
+
+namespace {
+	const int frequency = 44100;
+	const int channels = 2;
+	const int chunk_size = 4096;
+
+	typedef std::chrono::steady_clock Clock;
+
+	double Elapsed(Clock::time_point start) {
+		return std::chrono::duration<double>(Clock::now() - start).count();
+	}
+
+	bool Benchmark(const std::string& filename, int max_seconds) {
+		FILE* file = FileFinder::fopenUTF8(filename, "rb");
+		if (!file) {
+			fprintf(stderr, "%s: not readable\n", filename.c_str());
+			return false;
+		}
+
+		auto start = Clock::now();
+		std::unique_ptr<AudioDecoder> decoder = AudioDecoder::Create(file, filename);
+		if (!decoder || !decoder->Open(file)) {
+			fprintf(stderr, "%s: unsupported format%s%s\n", filename.c_str(),
+				decoder ? ": " : "", decoder ? decoder->GetError().c_str() : "");
+			if (!decoder) {
+				fclose(file);
+			}
+			return false;
+		}
+		int native_frequency;
+		AudioDecoder::Format native_format;
+		int native_channels;
+		decoder->GetFormat(native_frequency, native_format, native_channels);
+
+		decoder->SetFormat(frequency, AudioDecoder::Format::S16, channels);
+		double open_time = Elapsed(start);
+
+		// Decode
+		size_t max_size = (size_t)max_seconds * frequency * channels * sizeof(int16_t);
+		std::vector<uint8_t> samples;
+		samples.reserve(max_size);
+		start = Clock::now();
+		while (!decoder->IsFinished() && samples.size() < max_size) {
+			size_t pos = samples.size();
+			samples.resize(pos + chunk_size);
+			int res = decoder->Decode(&samples[pos], chunk_size);
+			if (res <= 0) {
+				samples.resize(pos);
+				break;
+			}
+			samples.resize(pos + res);
+		}
+		double decode_time = Elapsed(start);
+
+		// Mix like GenericAudio does for one channel
+		int frames = (int)(samples.size() / (channels * sizeof(int16_t)));
+		std::vector<float> mix(chunk_size / sizeof(int16_t));
+		std::vector<int16_t> output(mix.size());
+		int chunk_frames = (int)mix.size() / channels;
+		AudioMixer::MixFunction mix_function = AudioMixer::GetMixFunction(AudioDecoder::Format::S16);
+		start = Clock::now();
+		for (int i = 0; i < frames; i += chunk_frames) {
+			int count = std::min(chunk_frames, frames - i);
+			std::fill(mix.begin(), mix.end(), 0.0f);
+			mix_function(mix.data(), &samples[i * channels * sizeof(int16_t)], count, channels, 0.8f);
+			AudioMixer::PackS16(output.data(), mix.data(), count * channels, 0.8f);
+		}
+		double mix_time = Elapsed(start);
+
+		double seconds = (double)frames / frequency;
+
+		// Seek like a resumed BGM and restart like a loop
+		std::vector<uint8_t> chunk(chunk_size);
+		start = Clock::now();
+		bool seeked = decoder->SeekTime((int)(seconds * 500.0));
+		if (seeked) {
+			decoder->Decode(chunk.data(), chunk_size);
+		}
+		double seek_time = Elapsed(start);
+		start = Clock::now();
+		decoder->Rewind();
+		decoder->Decode(chunk.data(), chunk_size);
+		double rewind_time = Elapsed(start);
+
+		char seek_info[32] = "seek n/a";
+		if (seeked) {
+			snprintf(seek_info, sizeof(seek_info), "seek %.2f ms", seek_time * 1000.0);
+		}
+
+		printf("%s\t%s\t%d Hz %d ch\t%.2f s\topen %.2f ms\tdecode %.2f ms (%.1fx)\tmix %.2f ms (%.1fx)\t%s\trewind %.2f ms\n",
+			filename.c_str(), decoder->GetType().c_str(), native_frequency, native_channels, seconds,
+			open_time * 1000.0,
+			decode_time * 1000.0, decode_time > 0 ? seconds / decode_time : 0.0,
+			mix_time * 1000.0, mix_time > 0 ? seconds / mix_time : 0.0,
+			seek_info, rewind_time * 1000.0);
+
+		return frames > 0;
+	}
+}
+
+extern "C" int main(int argc, char** argv) {
+	int max_seconds = 60;
+	std::vector<std::string> files;
+
+	for (int i = 1; i < argc; ++i) {
+		if (!strcmp(argv[i], "-s") && i + 1 < argc) {
+			max_seconds = std::max(atoi(argv[++i]), 1);
+		} else {
+			files.push_back(argv[i]);
+		}
+	}
+
+	if (files.empty()) {
+		fprintf(stderr, "Usage: %s [-s SECONDS] FILE...\n", argv[0]);
+		return EXIT_FAILURE;
+	}
+
+	bool success = true;
+	for (const auto& file : files) {
+		success = Benchmark(file, max_seconds) && success;
+	}
+
+	return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,228 @@
+#! /usr/bin/env python3
+
+# Generates ../../src/rtp_table.cpp from rtp_2000.txt and rtp_2003.txt
+#
+# Every table is a minimal perfect hash ("hash, displace and compress"):
+# a key is hashed with seed 0 to find its seed, hashing it again with that
+# seed gives its slot. Negative seeds store the slot directly.
+# Keys are compared case insensitive (ASCII only).
+
+import os
+
+here = os.path.dirname(os.path.abspath(__file__))
+cpp = os.path.join(here, '..', '..', 'src', 'rtp_table.cpp')
+
+header = '''/*
+ * This file is part of EasyRPG Player.
+ *
+ * EasyRPG Player is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * EasyRPG Player is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with EasyRPG Player. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Generated by resources/rtp_table/gen_rtp_table.py, do not edit.
+// The names are listed in resources/rtp_table/rtp_2000.txt and rtp_2003.txt
+
+// Headers
+#include <cstdint>
+#include "rtp_table.h"
+
+namespace {
+	struct Entry {
+		const char* folder;
+		const char* name;
+		const char* translation;
+	};
+
+	struct Table {
+		const Entry* entries;
+		const int32_t* seeds;
+		uint32_t size;
+	};
+
+	/** FNV-1a of "folder/name", must match gen_rtp_table.py */
+	uint32_t Hash(uint32_t seed, const std::string& folder, const std::string& name) {
+		uint32_t hash = 2166136261u ^ seed;
+		auto add = [&hash](unsigned char c) {
+			if (c >= 'A' && c <= 'Z') {
+				c += 'a' - 'A';
+			}
+			hash = (hash ^ c) * 16777619u;
+		};
+
+		for (unsigned char c : folder) {
+			add(c);
+		}
+		add('/');
+		for (unsigned char c : name) {
+			add(c);
+		}
+		return hash;
+	}
+
+	bool EqualsIgnoreCase(const char* a, const std::string& b) {
+		auto lower = [](unsigned char c) {
+			return (c >= 'A' && c <= 'Z') ? c + 'a' - 'A' : c;
+		};
+
+		size_t i = 0;
+		for (; a[i] != '\\0'; ++i) {
+			if (i == b.size() || lower(a[i]) != lower(b[i])) {
+				return false;
+			}
+		}
+		return i == b.size();
+	}
+
+	const char* Lookup(const Table& table, const std::string& folder, const std::string& name) {
+		int32_t seed = table.seeds[Hash(0, folder, name) % table.size];
+		uint32_t slot = seed < 0 ? -(seed + 1) : Hash(seed, folder, name) % table.size;
+
+		const Entry& entry = table.entries[slot];
+		if (EqualsIgnoreCase(entry.folder, folder) && EqualsIgnoreCase(entry.name, name)) {
+			return entry.translation;
+		}
+		return nullptr;
+	}
+'''
+
+footer = '''}
+
+const char* RTP::FindJapaneseName(bool rpg2k, const std::string& folder, const std::string& name) {
+	return Lookup(rpg2k ? table_2000_japanese : table_2003_japanese, folder, name);
+}
+
+const char* RTP::FindEnglishName(bool rpg2k, const std::string& folder, const std::string& name) {
+	return Lookup(rpg2k ? table_2000_english : table_2003_english, folder, name);
+}
+'''
+
+
+def fold(s):
+    return ''.join(c.lower() if 'A' <= c <= 'Z' else c for c in s)
+
+
+def fnv(seed, folder, name):
+    h = 2166136261 ^ seed
+    for c in (folder + '/' + name).encode('utf-8'):
+        if ord('A') <= c <= ord('Z'):
+            c += ord('a') - ord('A')
+        h = ((h ^ c) * 16777619) & 0xffffffff
+    return h
+
+
+def read_table(filename):
+    """ Returns [(folder, english, japanese)] in file order """
+    entries = []
+    folder = None
+    with open(os.path.join(here, filename), encoding='utf-8') as f:
+        for line in f:
+            line = line.rstrip('\n')
+            if not line or line.startswith('#'):
+                continue
+            if line.startswith('['):
+                folder = line[1:-1]
+                continue
+            fields = line.split('\t')
+            entries.append((folder, fields[0], fields[1]))
+    return entries
+
+
+def english_to_japanese(entries):
+    # The first entry of a name wins. Before the keys were case insensitive
+    # only lower case names were found, they win over the first entry.
+    result = {}
+    for folder, english, japanese in entries:
+        key = (folder, fold(english))
+        if key not in result or (english == fold(english) and result[key][0] != fold(result[key][0])):
+            result[key] = (english, japanese)
+    return [(folder, english, japanese) for (folder, _), (english, japanese) in result.items()]
+
+
+def japanese_to_english(entries):
+    # Same result as the previous linear search: the smallest English name
+    # (byte order) of the Japanese name, lower case Japanese names win.
+    first = {}
+    for folder, english, japanese in entries:
+        first.setdefault((folder, english), japanese)
+
+    result = {}
+    for (folder, english), japanese in sorted(first.items(), key=lambda e: (e[0][0], e[0][1].encode('utf-8'))):
+        key = (folder, fold(japanese))
+        exact = japanese == fold(japanese)
+        if key not in result or (exact and not result[key][1]):
+            result[key] = (english, exact, japanese)
+    return [(folder, japanese, english) for (folder, _), (english, _, japanese) in result.items()]
+
+
+def perfect_hash(entries):
+    """ Returns (slots, seeds) for [(folder, name, translation)] """
+    size = len(entries)
+    buckets = [[] for _ in range(size)]
+    for entry in entries:
+        buckets[fnv(0, entry[0], entry[1]) % size].append(entry)
+    buckets.sort(key=len, reverse=True)
+
+    seeds = [0] * size
+    slots = [None] * size
+
+    for bucket in buckets:
+        if len(bucket) <= 1:
+            break
+        seed = 1
+        placed = []
+        while len(placed) < len(bucket):
+            slot = fnv(seed, bucket[len(placed)][0], bucket[len(placed)][1]) % size
+            if slots[slot] is not None or slot in placed:
+                seed += 1
+                placed = []
+            else:
+                placed.append(slot)
+        seeds[fnv(0, bucket[0][0], bucket[0][1]) % size] = seed
+        for slot, entry in zip(placed, bucket):
+            slots[slot] = entry
+
+    free = [i for i, entry in enumerate(slots) if entry is None]
+    for bucket in buckets:
+        if len(bucket) != 1:
+            continue
+        slot = free.pop()
+        seeds[fnv(0, bucket[0][0], bucket[0][1]) % size] = -slot - 1
+        slots[slot] = bucket[0]
+
+    return slots, seeds
+
+
+def write_table(fw, name, entries):
+    slots, seeds = perfect_hash(entries)
+
+    fw.write('\n\tconst Entry entries_%s[%d] = {\n' % (name, len(slots)))
+    for folder, key, translation in slots:
+        fw.write('\t\t{ "%s", "%s", "%s" },\n' % (folder, key, translation))
+    fw.write('\t};\n')
+
+    fw.write('\n\tconst int32_t seeds_%s[%d] = {\n' % (name, len(seeds)))
+    for i in range(0, len(seeds), 16):
+        fw.write('\t\t%s,\n' % ', '.join(str(s) for s in seeds[i:i + 16]))
+    fw.write('\t};\n')
+
+    fw.write('\n\tconst Table table_%s = { entries_%s, seeds_%s, %d };\n' % (name, name, name, len(slots)))
+
+
+if __name__ == '__main__':
+    with open(cpp, 'w', encoding='utf-8') as fw:
+        fw.write(header)
+        for version in ('2000', '2003'):
+            entries = read_table('rtp_%s.txt' % version)
+            write_table(fw, version + '_japanese', english_to_japanese(entries))
+            write_table(fw, version + '_english', japanese_to_english(entries))
+        fw.write(footer)
@@ -33,6 +33,8 @@ AudioInterface& Audio() {
 
 void EmptyAudio::BGM_Play(std::string const&, int, int, int) {
 	bgm_starttick = Player::GetFrames();
+	bgm_seektick = bgm_starttick;
+	bgm_seekposition = 0;
 	playing = true;
 }
 
@@ -49,6 +51,19 @@ unsigned EmptyAudio::BGM_GetTicks() const {
 	return (Player::GetFrames() - bgm_starttick + 1) / Graphics::GetDefaultFps();
 }
 
+int EmptyAudio::BGM_GetPosition() const {
+	if (!playing) {
+		return -1;
+	}
+
+	return bgm_seekposition + (Player::GetFrames() - bgm_seektick) * 1000 / Graphics::GetDefaultFps();
+}
+
+void EmptyAudio::BGM_Seek(int ms) {
+	bgm_seektick = Player::GetFrames();
+	bgm_seekposition = ms;
+}
+
 bool EmptyAudio::BGM_PlayedOnce() const {
 	// 5 seconds, arbitrary
 	return BGM_GetTicks() > (Graphics::GetDefaultFps() * 5);
@@ -42,6 +42,14 @@ struct AudioInterface {
 	 */
 	virtual void BGM_Play(std::string const& file, int volume, int pitch, int fadein) = 0;
 
+	/**
+	 * Opens a background music in advance, so a later BGM_Play of the same
+	 * file starts faster. Does nothing when not supported.
+	 *
+	 * @param file file to open.
+	 */
+	virtual void BGM_Prefetch(std::string const& file) { (void)file; }
+
 	/**
 	 * Stops the currently playing background music.
 	 */
@@ -65,6 +73,21 @@ struct AudioInterface {
 	 */
 	virtual unsigned BGM_GetTicks() const = 0;
 
+	/**
+	 * Returns the playback position of the background music.
+	 *
+	 * @return position in milliseconds, -1 when not supported
+	 */
+	virtual int BGM_GetPosition() const { return -1; }
+
+	/**
+	 * Continues the current background music at a position returned by
+	 * BGM_GetPosition. Does nothing when not supported.
+	 *
+	 * @param ms position in milliseconds
+	 */
+	virtual void BGM_Seek(int ms) { (void)ms; }
+
 	/**
 	 * Does a fade out of the background music.
 	 *
@@ -105,6 +128,24 @@ struct AudioInterface {
 	 */
 	virtual void SE_Play(std::string const& file, int volume, int pitch) = 0;
 
+	/**
+	 * Decodes a sound effect in advance and keeps it in memory, so playing
+	 * it never waits for the decoder. Does nothing when not supported.
+	 *
+	 * @param file file to decode.
+	 * @param pitch pitch.
+	 */
+	virtual void SE_Prefetch(std::string const& file, int pitch) { (void)file; (void)pitch; }
+
+	/**
+	 * Releases a sound effect decoded by SE_Prefetch, it can be removed from
+	 * memory again. Every call releases one SE_Prefetch call.
+	 *
+	 * @param file file passed to SE_Prefetch.
+	 * @param pitch pitch passed to SE_Prefetch.
+	 */
+	virtual void SE_Unpin(std::string const& file, int pitch) { (void)file; (void)pitch; }
+
 	/**
 	 * Stops the currently playing sound effect.
 	 */
@@ -120,6 +161,8 @@ public:
 	bool BGM_PlayedOnce() const override;
 	bool BGM_IsPlaying() const override { return false; }
 	unsigned BGM_GetTicks() const override;
+	int BGM_GetPosition() const override;
+	void BGM_Seek(int ms) override;
 	void BGM_Fade(int) override {}
 	void BGM_Volume(int) override {}
 	void BGM_Pitch(int) override {};
@@ -129,6 +172,9 @@ public:
 
 private:
 	unsigned bgm_starttick = 0;
+	/** Frame and position of the last BGM_Play or BGM_Seek */
+	unsigned bgm_seektick = 0;
+	int bgm_seekposition = 0;
 
 	bool playing = false;
 };
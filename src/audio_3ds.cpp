@@ -182,16 +182,18 @@ void CtrAudio::SE_Play(std::string const& file, int volume, int pitch) {
 		return;
 	}
 
-	std::unique_ptr<AudioSeCache> cache = AudioSeCache::Create(file);
+	std::unique_ptr<AudioSeCache> cache = AudioSeCache::Create(file, pitch);
 	if (!cache) {
 		Output::Warning("Couldn't play SE %s: Format not supported", file.c_str());
 		return;
 	}
 
-	cache->SetPitch(pitch);
 	cache->SetFormat(samplerate, AudioDecoder::Format::S16, 2);
 
 	AudioSeRef se_ref = cache->Decode();
+	if (!se_ref) {
+		return;
+	}
 
 	if (se_buf[se_channel].data_pcm16 != nullptr) {
 		linearFree(se_buf[se_channel].data_pcm16);
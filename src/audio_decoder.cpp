@@ -343,7 +343,8 @@ int AudioDecoder::GetVolume() const {
 }
 
 void AudioDecoder::Rewind() {
-	if (!Seek(0, Origin::Begin)) {
+	// SeekTime uses the seek index of the decoder
+	if (!SeekTime(0) && !Seek(0, Origin::Begin)) {
 		// The libs guarantee that Rewind works
 		assert(false && "Rewind");
 	}
@@ -393,6 +394,18 @@ size_t AudioDecoder::Tell() const {
 	return -1;
 }
 
+bool AudioDecoder::SeekTime(int ms) {
+	if (ms == 0) {
+		return Seek(0, Origin::Begin);
+	}
+
+	return false;
+}
+
+int AudioDecoder::TellTime() const {
+	return -1;
+}
+
 int AudioDecoder::GetTicks() const {
 	return 0;
 }
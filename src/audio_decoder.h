@@ -274,6 +274,24 @@ public:
 	 */
 	virtual size_t Tell() const;
 
+	/**
+	 * Seeks to a playback position of the audio stream. Unlike Seek the
+	 * position is format independent, decoders that support it locate it
+	 * through an index instead of decoding from the beginning.
+	 * The default implementation only supports rewinding.
+	 *
+	 * @param ms Position in milliseconds, relative to the normal pitch
+	 * @return Whether seek was successful
+	 */
+	virtual bool SeekTime(int ms);
+
+	/**
+	 * Tells the current playback position of the audio stream.
+	 *
+	 * @return Position in milliseconds or -1 when not supported
+	 */
+	virtual int TellTime() const;
+
 	/**
 	 * Returns a value suitable for the GetMidiTicks command.
 	 * For MIDI this is the amount of MIDI ticks, for other
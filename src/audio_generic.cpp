@@ -17,30 +17,41 @@
 
 #include "system.h"
 
+#include <algorithm>
 #include <cstring>
 #include <cassert>
 #include "audio_generic.h"
+#include "audio_mixer.h"
 #include "filefinder.h"
 #include "output.h"
+#include "player.h"
 
 GenericAudio::BgmChannel GenericAudio::BGM_Channels[nr_of_bgm_channels];
-GenericAudio::SeChannel GenericAudio::SE_Channels[nr_of_se_channels];
-bool GenericAudio::BGM_PlayedOnceIndicator;
+std::vector<GenericAudio::SeChannel> GenericAudio::SE_Channels;
 bool GenericAudio::Muted = false;
 
-std::vector<int16_t> GenericAudio::sample_buffer;
+SpscQueue<GenericAudio::Command, 64> GenericAudio::commands;
+SpscQueue<GenericAudio::Command, 64> GenericAudio::worker_commands;
+SpscQueue<std::shared_ptr<AudioStream>, 16> GenericAudio::retired_streams;
+
+std::atomic<int> GenericAudio::bgm_played_once_id(-1);
+std::atomic<unsigned> GenericAudio::bgm_ticks(0);
+std::atomic<int> GenericAudio::bgm_position(-1);
+std::atomic<int> GenericAudio::se_dropped(0);
+
 std::vector<uint8_t> GenericAudio::scrap_buffer;
 unsigned GenericAudio::scrap_buffer_size = 0;
 std::vector<float> GenericAudio::mixer_buffer;
 
 GenericAudio::GenericAudio() {
 	for (unsigned i = 0; i < nr_of_bgm_channels; i++) {
-		BGM_Channels[i].decoder.reset();
-	}
-	for (unsigned i = 0; i < nr_of_se_channels; i++) {
-		SE_Channels[i].se.reset();
+		BGM_Channels[i].stream.reset();
 	}
-	BGM_PlayedOnceIndicator = false;
+	SE_Channels.clear();
+	SE_Channels.reserve(AUDIO_SE_MAX_VOICES);
+	bgm_played_once_id = -1;
+	bgm_ticks = 0;
+	bgm_position = -1;
 
 	// Initialize to some arbitrary (low-quality) format to prevent crashes
 	// when the inheriting class doesn't call SetFormat
@@ -48,129 +59,194 @@ GenericAudio::GenericAudio() {
 }
 
 GenericAudio::~GenericAudio() {
+	Stop();
 }
 
 void GenericAudio::BGM_Play(const std::string& file, int volume, int pitch, int fadein) {
-	bool bgm_set = false;
-	for (unsigned i = 0; i < nr_of_bgm_channels; i++) {
-		BGM_Channels[i].stopped = true; //Stop all running background music
-		if (!BGM_Channels[i].decoder && !bgm_set) {
-			//If there is an unused bgm channel
-			bgm_set = true;
-			LockMutex();
-			BGM_PlayedOnceIndicator = false;
-			UnlockMutex();
-			PlayOnChannel(BGM_Channels[i], file, volume, pitch, fadein);
+	Command cmd;
+	cmd.type = Command_BgmPlay;
+	cmd.id = ++bgm_id;
+	cmd.stream = std::make_shared<AudioStream>(Player::audio_buffer_ms);
+
+	// The audio thread plays silence until the stream is ready
+	std::shared_ptr<AudioStream> stream = cmd.stream;
+	stream_worker.Add(stream);
+	stream_worker.Post([this, stream, file, volume, pitch, fadein]() {
+		if (stream->IsStopped()) {
+			// Replaced by another BGM before it was opened
+			return;
 		}
-	}
+
+		std::unique_ptr<AudioDecoder> decoder = TakePrefetchedBgm(file);
+		if (!decoder) {
+			decoder = OpenBgm(file);
+		}
+		if (decoder) {
+			decoder->SetPitch(pitch);
+			decoder->SetFade(0, volume, fadein);
+		}
+		stream->Open(std::move(decoder));
+	});
+
+	// Like RPG_RT a BGM which failed to open still counts as playing
+	bgm_playing = true;
+	bgm_stream = stream;
+	bgm_ticks = 0;
+	bgm_position = -1;
+
+	PushCommand(std::move(cmd));
 }
 
-void GenericAudio::BGM_Pause() {
-	for (unsigned i = 0; i < nr_of_bgm_channels; i++) {
-		if (BGM_Channels[i].decoder) {
-			BGM_Channels[i].paused = true;
+void GenericAudio::BGM_Prefetch(const std::string& file) {
+	stream_worker.Post([this, file]() {
+		for (auto& prefetched : prefetched_bgm) {
+			if (prefetched.first == file) {
+				return;
+			}
 		}
-	}
+
+		std::unique_ptr<AudioDecoder> decoder = OpenBgm(file);
+		if (!decoder) {
+			return;
+		}
+
+		if (prefetched_bgm.size() >= max_prefetched_bgm) {
+			prefetched_bgm.erase(prefetched_bgm.begin());
+		}
+		prefetched_bgm.emplace_back(file, std::move(decoder));
+	});
+}
+
+void GenericAudio::BGM_Pause() {
+	Command cmd;
+	cmd.type = Command_BgmPause;
+	PushCommand(std::move(cmd));
 }
 
 void GenericAudio::BGM_Resume() {
-	for (unsigned i = 0; i < nr_of_bgm_channels; i++) {
-		if (BGM_Channels[i].decoder) {
-			BGM_Channels[i].paused = false;
-		}
-	}
+	Command cmd;
+	cmd.type = Command_BgmResume;
+	PushCommand(std::move(cmd));
 }
 
 void GenericAudio::BGM_Stop() {
-	for (unsigned i = 0; i < nr_of_bgm_channels; i++) {
-		BGM_Channels[i].stopped = true; //Stop all running background music
-		LockMutex();
-		if (Muted) {
-			// If the audio is muted the audio thread doesn't perform the deletion (it isn't running)
-			// Do the cleanup on our own.
-			BGM_Channels[i].decoder.reset();
-		}
-		UnlockMutex();
-	}
+	bgm_playing = false;
+	bgm_stream.reset();
+
+	Command cmd;
+	cmd.type = Command_BgmStop;
+	PushCommand(std::move(cmd));
 }
 
 bool GenericAudio::BGM_PlayedOnce() const {
-	return BGM_PlayedOnceIndicator;
+	return bgm_played_once_id.load(std::memory_order_relaxed) == bgm_id;
 }
 
 bool GenericAudio::BGM_IsPlaying() const {
-	for (unsigned i = 0; i < nr_of_bgm_channels; i++) {
-		if (!BGM_Channels[i].stopped) {
-			return true;
-		};
-	}
-	return false;
+	return bgm_playing;
 }
 
 unsigned GenericAudio::BGM_GetTicks() const {
-	unsigned ticks = 0;
-	LockMutex();
-	for (unsigned i = 0; i < nr_of_bgm_channels; i++) {
-		if (BGM_Channels[i].decoder) {
-			ticks = BGM_Channels[i].decoder->GetTicks();
-			break;
-		}
+	return bgm_ticks.load(std::memory_order_relaxed);
+}
+
+int GenericAudio::BGM_GetPosition() const {
+	return bgm_position.load(std::memory_order_relaxed);
+}
+
+void GenericAudio::BGM_Seek(int ms) {
+	// Applied by the worker before it decodes the next samples
+	if (bgm_stream) {
+		bgm_stream->Seek(ms);
 	}
-	UnlockMutex();
-	return ticks;
 }
 
 void GenericAudio::BGM_Fade(int fade) {
-	LockMutex();
-	for (unsigned i = 0; i < nr_of_bgm_channels; i++) {
-		if (BGM_Channels[i].decoder) {
-			BGM_Channels[i].decoder->SetFade(BGM_Channels[i].decoder->GetVolume(), 0, fade);
-		}
-	}
-	UnlockMutex();
+	Command cmd;
+	cmd.type = Command_BgmFade;
+	cmd.value = fade;
+	PushCommand(std::move(cmd));
 }
 
 void GenericAudio::BGM_Volume(int volume) {
-	LockMutex();
-	for (unsigned i = 0; i < nr_of_bgm_channels; i++) {
-		if (BGM_Channels[i].decoder) {
-			BGM_Channels[i].decoder->SetVolume(volume);
-		}
-	}
-	UnlockMutex();
+	Command cmd;
+	cmd.type = Command_BgmVolume;
+	cmd.value = volume;
+	PushCommand(std::move(cmd));
 }
 
 void GenericAudio::BGM_Pitch(int pitch) {
-	LockMutex();
-	for (unsigned i = 0; i < nr_of_bgm_channels; i++) {
-		if (BGM_Channels[i].decoder) {
-			BGM_Channels[i].decoder->SetPitch(pitch);
-		}
-	}
-	UnlockMutex();
+	Command cmd;
+	cmd.type = Command_BgmPitch;
+	cmd.value = pitch;
+	PushCommand(std::move(cmd));
 }
 
 void GenericAudio::SE_Play(std::string const &file, int volume, int pitch) {
 	if (Muted) return;
-	for (unsigned i = 0; i < nr_of_se_channels; i++) {
-		if (!SE_Channels[i].se) {
-			//If there is an unused se channel
-			PlayOnChannel(SE_Channels[i], file, volume, pitch);
-			return;
+
+	// SE commands are sent by the worker to keep them in order. Urgent,
+	// the SE must not wait for BGM opens and prefetches.
+	stream_worker.Post([this, file, volume, pitch]() {
+		Command cmd;
+		cmd.type = Command_SePlay;
+		cmd.se = OpenSe(file, pitch);
+		cmd.value = volume;
+
+		if (cmd.se) {
+			PushWorkerCommand(std::move(cmd));
 		}
-	}
+	}, true);
+}
+
+void GenericAudio::SE_Prefetch(std::string const &file, int pitch) {
+	stream_worker.Post([this, file, pitch]() {
+		OpenSe(file, pitch, true);
+	});
+}
 
-	Output::Warning("Couldn't play %s SE. No free channel available", FileFinder::GetPathInsideGamePath(file).c_str());
+void GenericAudio::SE_Unpin(std::string const &file, int pitch) {
+	// Posted as well, runs after the SE_Prefetch
+	stream_worker.Post([file, pitch]() {
+		AudioSeCache::Unpin(file, pitch);
+	});
 }
 
 void GenericAudio::SE_Stop() {
-	for (unsigned i = 0; i < nr_of_se_channels; i++) {
-		SE_Channels[i].stopped = true; //Stop all running sound effects
-	}
+	stream_worker.Post([this]() {
+		Command cmd;
+		cmd.type = Command_SeStop;
+		PushWorkerCommand(std::move(cmd));
+	}, true);
 }
 
 void GenericAudio::Update() {
-	// no-op, handled by the Decode function called through a thread
+	// Decoding is handled by the stream worker and mixing by the Decode
+	// function called through a thread. Only release the streams the audio
+	// thread is done with. Without threads the worker runs here.
+	stream_worker.Update();
+
+	std::shared_ptr<AudioStream> stream;
+	while (retired_streams.Pop(stream)) {
+		stream.reset();
+	}
+
+	for (auto& warning : stream_worker.TakeWarnings()) {
+		Output::WarningStr(warning);
+	}
+
+	int dropped = se_dropped.exchange(0);
+	if (dropped > 0) {
+		Output::Warning("Couldn't play %d SE. No free channel available", dropped);
+	}
+}
+
+void GenericAudio::SyncStreams() {
+	stream_worker.Sync();
+}
+
+void GenericAudio::Stop() {
+	stream_worker.Stop();
 }
 
 void GenericAudio::SetFormat(int frequency, AudioDecoder::Format format, int channels) {
@@ -179,54 +255,210 @@ void GenericAudio::SetFormat(int frequency, AudioDecoder::Format format, int cha
 	output_format.channels = channels;
 }
 
-bool GenericAudio::PlayOnChannel(BgmChannel& chan, const std::string& file, int volume, int pitch, int fadein) {
-	chan.paused = true; // Pause channel so the audio thread doesn't work on it
-	chan.stopped = false; // Unstop channel so the audio thread doesn't delete it
-
+std::unique_ptr<AudioDecoder> GenericAudio::OpenBgm(const std::string& file) {
 	FILE* filehandle = FileFinder::fopenUTF8(file, "rb");
 	if (!filehandle) {
-		Output::Warning("BGM file not readable: %s", FileFinder::GetPathInsideGamePath(file).c_str());
-		return false;
+		stream_worker.PostWarning("BGM file not readable: " + FileFinder::GetPathInsideGamePath(file));
+		return nullptr;
 	}
 
-	chan.decoder = AudioDecoder::Create(filehandle, file);
-	if (chan.decoder && chan.decoder->Open(filehandle)) {
-		chan.decoder->SetPitch(pitch);
-		chan.decoder->SetFormat(output_format.frequency, output_format.format, output_format.channels);
-		chan.decoder->SetFade(0, volume, fadein);
-		chan.decoder->SetLooping(true);
-		chan.paused = false; // Unpause channel -> Play it.
+	std::unique_ptr<AudioDecoder> decoder = AudioDecoder::Create(filehandle, file);
+	if (decoder && decoder->Open(filehandle)) {
+		decoder->SetFormat(output_format.frequency, output_format.format, output_format.channels);
+		decoder->SetLooping(true);
 
-		return true;
+		return decoder;
 	} else {
-		Output::Warning("Couldn't play BGM %s. Format not supported", FileFinder::GetPathInsideGamePath(file).c_str());
-		chan.decoder.reset();
+		stream_worker.PostWarning("Couldn't play BGM " + FileFinder::GetPathInsideGamePath(file) + ". Format not supported");
 		fclose(filehandle);
 	}
 
-	return false;
+	return nullptr;
 }
 
-bool GenericAudio::PlayOnChannel(SeChannel& chan, const std::string& file, int volume, int pitch) {
-	chan.paused = true; // Pause channel so the audio thread doesn't work on it
-	chan.stopped = false; // Unstop channel so the audio thread doesn't delete it
+std::unique_ptr<AudioDecoder> GenericAudio::TakePrefetchedBgm(const std::string& file) {
+	for (auto it = prefetched_bgm.begin(); it != prefetched_bgm.end(); ++it) {
+		if (it->first == file) {
+			std::unique_ptr<AudioDecoder> decoder = std::move(it->second);
+			prefetched_bgm.erase(it);
+			return decoder;
+		}
+	}
 
-	std::unique_ptr<AudioSeCache> cache = AudioSeCache::Create(file);
+	return nullptr;
+}
+
+AudioSeRef GenericAudio::OpenSe(const std::string& file, int pitch, bool pinned) {
+	std::unique_ptr<AudioSeCache> cache = AudioSeCache::Create(file, pitch);
 	if (cache) {
-		cache->SetPitch(pitch);
+		cache->SetPinned(pinned);
 		cache->SetFormat(output_format.frequency, output_format.format, output_format.channels);
 
-		chan.se = cache->Decode();
-		chan.buffer_pos = 0;
-		chan.volume = volume;
-		chan.paused = false; // Unpause channel -> Play it.
+		return cache->Decode();
+	} else {
+		stream_worker.PostWarning("Couldn't play SE " + FileFinder::GetPathInsideGamePath(file) + ". Format not supported");
+	}
+
+	return nullptr;
+}
+
+void GenericAudio::PushCommand(Command&& cmd) {
+	if (!Muted && commands.Push(std::move(cmd))) {
+		return;
+	}
 
-		return true;
+	// The audio thread is not running or does not drain the queue anymore
+	// (e.g. the device is paused). Holding the mutex makes the game thread
+	// the consumer, so the commands are applied here.
+	LockMutex();
+	ProcessCommands();
+	ProcessCommand(cmd);
+	UnlockMutex();
+}
+
+void GenericAudio::PushWorkerCommand(Command&& cmd) {
+	if (!Muted && worker_commands.Push(std::move(cmd))) {
+		return;
+	}
+
+	// Same fallback as PushCommand
+	LockMutex();
+	ProcessCommands();
+	ProcessCommand(cmd);
+	UnlockMutex();
+}
+
+void GenericAudio::ProcessCommands() {
+	Command cmd;
+	while (commands.Pop(cmd)) {
+		ProcessCommand(cmd);
+	}
+	while (worker_commands.Pop(cmd)) {
+		ProcessCommand(cmd);
+	}
+}
+
+void GenericAudio::ProcessCommand(Command& cmd) {
+	switch (cmd.type) {
+		case Command_BgmPlay:
+			for (unsigned i = 0; i < nr_of_bgm_channels; i++) {
+				RetireStream(BGM_Channels[i].stream);
+			}
+			if (cmd.stream) {
+				BGM_Channels[0].stream = std::move(cmd.stream);
+				BGM_Channels[0].paused = false;
+				BGM_Channels[0].id = cmd.id;
+				BGM_Channels[0].pending_volume = -1;
+				BGM_Channels[0].pending_fade = -1;
+			}
+			bgm_ticks = 0;
+			break;
+		case Command_BgmPause:
+		case Command_BgmResume:
+			for (unsigned i = 0; i < nr_of_bgm_channels; i++) {
+				BGM_Channels[i].paused = cmd.type == Command_BgmPause;
+			}
+			break;
+		case Command_BgmStop:
+			for (unsigned i = 0; i < nr_of_bgm_channels; i++) {
+				RetireStream(BGM_Channels[i].stream);
+			}
+			bgm_ticks = 0;
+			break;
+		case Command_BgmFade:
+		case Command_BgmVolume:
+		case Command_BgmPitch:
+			for (unsigned i = 0; i < nr_of_bgm_channels; i++) {
+				AudioStream* stream = BGM_Channels[i].stream.get();
+				if (!stream) {
+					continue;
+				}
+				if (cmd.type == Command_BgmPitch) {
+					stream->SetPitch(cmd.value);
+				} else if (!stream->IsReady()) {
+					// The decoder is not opened yet, applied by Decode
+					if (cmd.type == Command_BgmFade) {
+						BGM_Channels[i].pending_fade = cmd.value;
+					} else {
+						BGM_Channels[i].pending_volume = cmd.value;
+					}
+				} else if (cmd.type == Command_BgmFade) {
+					stream->GetDecoder().SetFade(stream->GetDecoder().GetVolume(), 0, cmd.value);
+				} else {
+					stream->GetDecoder().SetVolume(cmd.value);
+				}
+			}
+			break;
+		case Command_SePlay:
+			PlaySe(cmd.se, cmd.value);
+			break;
+		case Command_SeStop:
+			SE_Channels.clear();
+			break;
+	}
+}
+
+void GenericAudio::PlaySe(AudioSeRef& se, int volume) {
+	SeChannel* oldest = nullptr;
+	int instances = 0;
+	for (auto& channel : SE_Channels) {
+		if (channel.se != se) {
+			continue;
+		}
+
+		if (channel.buffer_pos == 0) {
+			// Played again before it was mixed (e.g. several hits in the
+			// same frame): Louder is enough, stacking only distorts
+			channel.volume = std::max(channel.volume, volume);
+			return;
+		}
+		if (!oldest || channel.buffer_pos > oldest->buffer_pos) {
+			oldest = &channel;
+		}
+		++instances;
+	}
+
+	SeChannel* target = nullptr;
+	if (instances >= AUDIO_SE_MAX_INSTANCES) {
+		target = oldest;
+	} else if (SE_Channels.size() < SE_Channels.capacity()) {
+		SE_Channels.emplace_back();
+		target = &SE_Channels.back();
 	} else {
-		Output::Warning("Couldn't play SE %s. Format not supported", FileFinder::GetPathInsideGamePath(file).c_str());
+		// Replace the quietest voice, of equally loud ones the voice closest to its end
+		SeChannel* victim = nullptr;
+		size_t victim_left = 0;
+		for (auto& channel : SE_Channels) {
+			size_t left = channel.se->buffer.size() - channel.buffer_pos;
+			if (!victim || channel.volume < victim->volume ||
+				(channel.volume == victim->volume && left < victim_left)) {
+				victim = &channel;
+				victim_left = left;
+			}
+		}
+
+		if (victim->volume > volume) {
+			se_dropped.fetch_add(1, std::memory_order_relaxed);
+			return;
+		}
+		target = victim;
 	}
 
-	return false;
+	target->se = std::move(se);
+	target->buffer_pos = 0;
+	target->volume = volume;
+}
+
+void GenericAudio::RetireStream(std::shared_ptr<AudioStream>& stream) {
+	if (!stream) {
+		return;
+	}
+
+	stream->Stop();
+	if (!retired_streams.Push(std::move(stream))) {
+		// Queue full: The game thread is not collecting them
+		stream.reset();
+	}
 }
 
 void GenericAudio::Decode(uint8_t* output_buffer, int buffer_length) {
@@ -236,192 +468,102 @@ void GenericAudio::Decode(uint8_t* output_buffer, int buffer_length) {
 
 	assert(buffer_length > 0);
 
-	if (sample_buffer.size() != (size_t)buffer_length) {
-		sample_buffer.resize(buffer_length);
-	}
-	if (mixer_buffer.size() != (size_t)buffer_length) {
-		mixer_buffer.resize(buffer_length);
+	if (mixer_buffer.size() != (size_t)(samples_per_frame * 2)) {
+		mixer_buffer.resize(samples_per_frame * 2);
 	}
+	std::fill(mixer_buffer.begin(), mixer_buffer.end(), 0.0f);
 	scrap_buffer_size = samples_per_frame * output_format.channels * sizeof(uint32_t);
 	if (scrap_buffer.size() != scrap_buffer_size) {
 		scrap_buffer.resize(scrap_buffer_size);
 	}
 
-	for (unsigned i = 0; i < nr_of_bgm_channels + nr_of_se_channels; i++) {
-		int read_bytes = 0;
-		int channels = 0;
-		int samplesize = 0;
-		int frequency = 0;
-		AudioDecoder::Format sampleformat;
-		float volume;
-
-		// Mix BGM and SE together;
-		bool is_bgm_channel = i < nr_of_bgm_channels;
-		bool channel_used = false;
-
-		if (is_bgm_channel) {
-			BgmChannel& currently_mixed_channel = BGM_Channels[i];
-			float current_master_volume = 1.0;
-
-			if (currently_mixed_channel.decoder && !currently_mixed_channel.paused) {
-				if (currently_mixed_channel.stopped) {
-					currently_mixed_channel.decoder.reset();
-				} else {
-					currently_mixed_channel.decoder->Update(1000 / 60);
-					volume = current_master_volume * (currently_mixed_channel.decoder->GetVolume() / 100.0);
-					currently_mixed_channel.decoder->GetFormat(frequency, sampleformat, channels);
-					samplesize = AudioDecoder::GetSamplesizeForFormat(sampleformat);
-
-					total_volume += volume;
-
-					// determine how much data has to be read from this channel (but cap at the bounds of the scrap buffer)
-					unsigned bytes_to_read = (samplesize * channels * samples_per_frame);
-					bytes_to_read = (bytes_to_read < scrap_buffer_size) ? bytes_to_read : scrap_buffer_size;
+	ProcessCommands();
 
-					read_bytes = currently_mixed_channel.decoder->Decode(scrap_buffer.data(), bytes_to_read);
+	for (unsigned i = 0; i < nr_of_bgm_channels; i++) {
+		BgmChannel& currently_mixed_channel = BGM_Channels[i];
+		float current_master_volume = 1.0;
 
-					if (read_bytes < 0) {
-						// An error occured when reading - the channel is faulty - discard
-						currently_mixed_channel.decoder.reset();
-						continue; // skip this loop run - there is nothing to mix
-					}
+		if (!currently_mixed_channel.stream || currently_mixed_channel.paused ||
+			!currently_mixed_channel.stream->IsReady()) {
+			continue;
+		}
+		AudioStream& stream = *currently_mixed_channel.stream;
 
-					if (!currently_mixed_channel.stopped) {
-						BGM_PlayedOnceIndicator = currently_mixed_channel.decoder->GetLoopCount() > 0;
-					}
+		if (stream.IsDone()) {
+			// An error occured when decoding - the channel is faulty - discard
+			RetireStream(currently_mixed_channel.stream);
+			continue; // skip this loop run - there is nothing to mix
+		}
 
-					channel_used = true;
-				}
-			}
-		} else {
-			SeChannel& currently_mixed_channel = SE_Channels[i - nr_of_bgm_channels];
-			float current_master_volume = 1.0;
+		// Volume and fade are not part of the decoding state used by the worker
+		if (currently_mixed_channel.pending_volume >= 0) {
+			stream.GetDecoder().SetVolume(currently_mixed_channel.pending_volume);
+			currently_mixed_channel.pending_volume = -1;
+		}
+		if (currently_mixed_channel.pending_fade >= 0) {
+			stream.GetDecoder().SetFade(stream.GetDecoder().GetVolume(), 0, currently_mixed_channel.pending_fade);
+			currently_mixed_channel.pending_fade = -1;
+		}
+		stream.GetDecoder().Update(1000 / 60);
+		float volume = current_master_volume * (stream.GetDecoder().GetVolume() / 100.0);
+		int channels = stream.channels;
+		int samplesize = AudioDecoder::GetSamplesizeForFormat(stream.format);
 
-			if (currently_mixed_channel.se && !currently_mixed_channel.paused) {
-				if (currently_mixed_channel.stopped) {
-					currently_mixed_channel.se.reset();
-				} else {
-					volume = current_master_volume * (currently_mixed_channel.volume / 100.0);
-					channels = currently_mixed_channel.se->channels;
-					sampleformat = currently_mixed_channel.se->format;
-					samplesize = AudioDecoder::GetSamplesizeForFormat(sampleformat);
+		total_volume += volume;
 
-					total_volume += volume;
+		// determine how much data has to be read from this channel (but cap at the bounds of the scrap buffer)
+		unsigned bytes_to_read = (samplesize * channels * samples_per_frame);
+		bytes_to_read = (bytes_to_read < scrap_buffer_size) ? bytes_to_read : scrap_buffer_size;
 
-					// determine how much data has to be read from this channel (but cap at the bounds of the scrap buffer)
-					unsigned bytes_to_read = (samplesize * channels * samples_per_frame);
-					bytes_to_read = (bytes_to_read < scrap_buffer_size) ? bytes_to_read : scrap_buffer_size;
+		// On an underrun the missing samples are silence
+		int read_bytes = stream.Read(scrap_buffer.data(), bytes_to_read);
 
-					if (currently_mixed_channel.buffer_pos + bytes_to_read >
-						currently_mixed_channel.se->buffer.size()) {
-						bytes_to_read = currently_mixed_channel.se->buffer.size() - currently_mixed_channel.buffer_pos;
-					}
+		if (stream.IsPlayedOnce()) {
+			bgm_played_once_id.store(currently_mixed_channel.id, std::memory_order_relaxed);
+		}
+		bgm_ticks.store(stream.GetTicks(), std::memory_order_relaxed);
+		bgm_position.store(stream.GetPosition(), std::memory_order_relaxed);
 
-					memcpy(scrap_buffer.data(),
-						   &currently_mixed_channel.se->buffer[currently_mixed_channel.buffer_pos],
-						   bytes_to_read);
+		AudioMixer::MixFunction mix = AudioMixer::GetMixFunction(stream.format);
+		mix(mixer_buffer.data(), scrap_buffer.data(), read_bytes / (samplesize * channels), channels, volume);
+		channel_active = true;
+	}
 
-					currently_mixed_channel.buffer_pos += bytes_to_read;
+	// Only playing voices are in the list, finished ones are swapped with the last
+	for (size_t i = 0; i < SE_Channels.size(); ) {
+		SeChannel& currently_mixed_channel = SE_Channels[i];
+		const AudioSeData& se = *currently_mixed_channel.se;
+		float current_master_volume = 1.0;
 
-					read_bytes = bytes_to_read;
+		float volume = current_master_volume * (currently_mixed_channel.volume / 100.0);
+		int samplesize = AudioDecoder::GetSamplesizeForFormat(se.format);
 
-					// Now decide what to do when a channel has reached its end
-					if (currently_mixed_channel.buffer_pos >= currently_mixed_channel.se->buffer.size()) {
-						// SE are only played once so free the se if finished
-						currently_mixed_channel.se.reset();
-					}
+		total_volume += volume;
 
-					channel_used = true;
-				}
-			}
-		}
+		// The cached sample is in the output format and mixed in place
+		size_t bytes_to_read = std::min<size_t>(samplesize * se.channels * samples_per_frame,
+			se.buffer.size() - currently_mixed_channel.buffer_pos);
 
-		//--------------------------------------------------------------------------------------------------------------------//
-		// From here downwards the currently_mixed_channel decoder may already be freed - so don't use it below this comment. //
-		//--------------------------------------------------------------------------------------------------------------------//
-
-		if (channel_used) {
-			for (unsigned ii = 0; ii < (unsigned)(read_bytes / (samplesize * channels)); ii++) {
-
-				float vall = volume;
-				float valr = vall;
-
-				// Convert to floating point
-				switch (sampleformat) {
-					case AudioDecoder::Format::S8:
-						vall *= (((int8_t *) scrap_buffer.data())[ii * channels] / 128.0);
-						valr *= (((int8_t *) scrap_buffer.data())[ii * channels + 1] / 128.0);
-						break;
-					case AudioDecoder::Format::U8:
-						vall *= (((uint8_t *) scrap_buffer.data())[ii * channels] / 128.0 - 1.0);
-						valr *= (((uint8_t *) scrap_buffer.data())[ii * channels + 1] / 128.0 - 1.0);
-						break;
-					case AudioDecoder::Format::S16:
-						vall *= (((int16_t *) scrap_buffer.data())[ii * channels] / 32768.0);
-						valr *= (((int16_t *) scrap_buffer.data())[ii * channels + 1] / 32768.0);
-						break;
-					case AudioDecoder::Format::U16:
-						vall *= (((uint16_t *) scrap_buffer.data())[ii * channels] / 32768.0 - 1.0);
-						valr *= (((uint16_t *) scrap_buffer.data())[ii * channels + 1] / 32768.0 - 1.0);
-						break;
-					case AudioDecoder::Format::S32:
-						vall *= (((int32_t *) scrap_buffer.data())[ii * channels] / 2147483648.0);
-						valr *= (((int32_t *) scrap_buffer.data())[ii * channels + 1] / 2147483648.0);
-						break;
-					case AudioDecoder::Format::U32:
-						vall *= (((uint32_t *) scrap_buffer.data())[ii * channels] / 2147483648.0 - 1.0);
-						valr *= (((uint32_t *) scrap_buffer.data())[ii * channels + 1] / 2147483648.0 - 1.0);
-						break;
-					case AudioDecoder::Format::F32:
-						vall *= (((float *) scrap_buffer.data())[ii * channels]);
-						valr *= (((float *) scrap_buffer.data())[ii * channels + 1]);
-						break;
-				}
+		AudioMixer::MixFunction mix = AudioMixer::GetMixFunction(se.format);
+		mix(mixer_buffer.data(), &se.buffer[currently_mixed_channel.buffer_pos],
+			(int)(bytes_to_read / (samplesize * se.channels)), se.channels, volume);
+		channel_active = true;
 
-				if (!channel_active) {
-					// first channel
-					mixer_buffer[ii * output_format.channels] = vall;
-					if (channels > 1) {
-						mixer_buffer[ii * output_format.channels + 1] = valr;
-					} else {
-						mixer_buffer[ii * output_format.channels + 1] = mixer_buffer[ii * output_format.channels];
-					}
-				} else {
-					mixer_buffer[ii * output_format.channels] += vall;
-					if (channels > 1) {
-						mixer_buffer[ii * output_format.channels + 1] += valr;
-					} else {
-						mixer_buffer[ii * output_format.channels + 1] = mixer_buffer[ii * output_format.channels];
-					}
-				}
+		currently_mixed_channel.buffer_pos += bytes_to_read;
 
+		if (currently_mixed_channel.buffer_pos >= se.buffer.size()) {
+			// SE are only played once so free the se if finished
+			if (i + 1 < SE_Channels.size()) {
+				currently_mixed_channel = std::move(SE_Channels.back());
 			}
-			channel_active = true;
+			SE_Channels.pop_back();
+		} else {
+			++i;
 		}
 	}
 
 	if (channel_active) {
-		if (total_volume > 1.0) {
-			float threshold = 0.8;
-			for (unsigned i = 0; i < (unsigned)(samples_per_frame * 2); i++) {
-				float sample = mixer_buffer[i];
-				float sign = (sample < 0) ? -1.0 : 1.0;
-				sample /= sign;
-				//dynamic range compression
-				if (sample > threshold) {
-					sample_buffer[i] = sign * 32768.0 * (threshold + (1.0 - threshold) * (sample - threshold) / (total_volume - threshold));
-				} else {
-					sample_buffer[i] = sign * sample * 32768.0;
-				}
-			}
-		} else {
-			//No dynamic range compression necessary
-			for (unsigned i = 0; i < (unsigned)(samples_per_frame * 2); i++) {
-				sample_buffer[i] = mixer_buffer[i] * 32768.0;
-			}
-		}
-
-		memcpy(output_buffer, sample_buffer.data(), buffer_length);
+		AudioMixer::PackS16(reinterpret_cast<int16_t*>(output_buffer), mixer_buffer.data(), samples_per_frame * 2, total_volume);
 	} else {
 		memset(output_buffer, '\0', buffer_length);
 	}
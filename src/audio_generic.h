@@ -18,14 +18,36 @@
 #ifndef EP_AUDIO_GENERIC_H
 #define EP_AUDIO_GENERIC_H
 
+#include <atomic>
+#include <string>
+#include <utility>
+#include <vector>
 #include "audio.h"
 #include "audio_decoder.h"
 #include "audio_secache.h"
+#include "audio_stream.h"
+#include "spsc_queue.h"
 
 /**
  * A software implementation for handling EasyRPG Audio utilizing the
  * AudioDecoder for BGM and AudioSeCache for fast SE playback.
  *
+ * The BGM and SE functions only open the decoders and send commands
+ * through a lock-free queue to the audio thread, which applies them at the
+ * start of every Decode call. The channels are owned by the audio thread,
+ * the BGM status is published back through atomics.
+ *
+ * BGM are decoded ahead of playback by a worker thread into a ring buffer
+ * per channel (see AudioStream), the Decode function only copies and mixes
+ * the samples. Opening BGM and SE happens on a second worker thread (task
+ * thread), so the play functions return immediately, the audio starts when
+ * it is ready and a slow open never delays the decoding of the playing BGM.
+ *
+ * SE voices are kept in a list which only contains the playing voices and
+ * is allocated once for AUDIO_SE_MAX_VOICES. The same SE played again
+ * before it started is merged, at most AUDIO_SE_MAX_INSTANCES instances of
+ * a SE play at once and a full list replaces its quietest voice.
+ *
  * Inheriting implementations have to:
  * 1. Init the audio system in the constructor (and deinit in destructor)
  * 2. Start a thread (or a callback) which invokes the Decode function to
@@ -33,8 +55,10 @@
  *    target platform.
  * 3. Initialize the "output_format" (must match the format of the hardware)
  * 4. Implement LockMutex and UnlockMutex. Locking and Unlocking when
- *    calling Decode must be done manually.
- * 5. Implement update function (optional)
+ *    calling Decode must be done manually. The mutex is only taken by the
+ *    game thread when the audio thread stops draining the command queue.
+ * 5. Implement update function (optional, must call GenericAudio::Update)
+ * 6. Call Stop first in the destructor, before the audio system is deinit
  */
 struct GenericAudio : public AudioInterface {
 public:
@@ -42,16 +66,21 @@ public:
 	virtual ~GenericAudio();
 
 	void BGM_Play(std::string const& file, int volume, int pitch, int fadein) override;
+	void BGM_Prefetch(std::string const& file) override;
 	void BGM_Pause() override;
 	void BGM_Resume() override;
 	void BGM_Stop() override;
 	bool BGM_PlayedOnce() const override;
 	bool BGM_IsPlaying() const override;
 	unsigned BGM_GetTicks() const override;
+	int BGM_GetPosition() const override;
+	void BGM_Seek(int ms) override;
 	void BGM_Fade(int fade) override;
 	void BGM_Volume(int volume) override;
 	void BGM_Pitch(int pitch) override;
 	void SE_Play(std::string const& file, int volume, int pitch) override;
+	void SE_Prefetch(std::string const& file, int pitch) override;
+	void SE_Unpin(std::string const& file, int pitch) override;
 	void SE_Stop() override;
 	virtual void Update() override;
 
@@ -62,19 +91,34 @@ public:
 
 	void Decode(uint8_t* output_buffer, int buffer_length);
 
+	/**
+	 * Waits until the worker opened all requested BGM and SE and filled the
+	 * BGM buffers. For implementations calling Decode faster than realtime.
+	 */
+	void SyncStreams();
+
+protected:
+	/**
+	 * Discards the queued BGM and SE requests and stops the worker thread.
+	 * The worker uses the implementation (LockMutex), so it must be stopped
+	 * before the destructor of the implementation runs.
+	 */
+	void Stop();
+
 private:
 	struct BgmChannel {
-		std::unique_ptr<AudioDecoder> decoder;
+		std::shared_ptr<AudioStream> stream;
 		bool paused;
-		bool stopped;
+		/** Play request the stream belongs to */
+		int id;
+		/** Volume and fade requested before the stream was ready, -1 if none */
+		int pending_volume;
+		int pending_fade;
 	};
 	struct SeChannel {
 		AudioSeRef se;
 		size_t buffer_pos;
 		int volume;
-		bool paused;
-		bool stopped;
-		bool finished;
 	};
 	struct Format {
 		int frequency;
@@ -83,18 +127,76 @@ private:
 	};
 	Format output_format = {0};
 
-	bool PlayOnChannel(BgmChannel& chan,std::string const& file, int volume, int pitch, int fadein);
-	bool PlayOnChannel(SeChannel& chan,std::string const& file, int volume, int pitch);
+	enum CommandType {
+		Command_BgmPlay,
+		Command_BgmPause,
+		Command_BgmResume,
+		Command_BgmStop,
+		Command_BgmFade,
+		Command_BgmVolume,
+		Command_BgmPitch,
+		Command_SePlay,
+		Command_SeStop
+	};
+	struct Command {
+		CommandType type = Command_BgmStop;
+		std::shared_ptr<AudioStream> stream;
+		AudioSeRef se;
+		/** Volume, fade time or pitch depending on the type */
+		int value = 0;
+		/** Play request id of Command_BgmPlay */
+		int id = 0;
+	};
+
+	/** Opens a decoder in the output format (task thread) */
+	std::unique_ptr<AudioDecoder> OpenBgm(std::string const& file);
+	/** Takes a decoder opened by BGM_Prefetch (task thread) */
+	std::unique_ptr<AudioDecoder> TakePrefetchedBgm(std::string const& file);
+	/** Decodes a SE in the output format (task thread) */
+	AudioSeRef OpenSe(std::string const& file, int pitch, bool pinned = false);
+
+	/** Sends a command to the audio thread (game thread) */
+	void PushCommand(Command&& cmd);
+	/** Sends a command to the audio thread (task thread) */
+	void PushWorkerCommand(Command&& cmd);
+	/** Applies all queued commands (audio thread or with the mutex held) */
+	static void ProcessCommands();
+	static void ProcessCommand(Command& cmd);
+	/** Starts a SE voice (audio thread or with the mutex held) */
+	static void PlaySe(AudioSeRef& se, int volume);
+	/** Stops a stream and hands it to the game thread for destruction */
+	static void RetireStream(std::shared_ptr<AudioStream>& stream);
 
-	static const unsigned nr_of_se_channels=31;
 	static const unsigned nr_of_bgm_channels=2;
 
 	static BgmChannel BGM_Channels[nr_of_bgm_channels];
-	static SeChannel SE_Channels[nr_of_se_channels];
-	static bool BGM_PlayedOnceIndicator;
+	/** Playing SE voices, the capacity is reserved once */
+	static std::vector<SeChannel> SE_Channels;
 	static bool Muted;
 
-	static std::vector<int16_t> sample_buffer;
+	static SpscQueue<Command, 64> commands;
+	static SpscQueue<Command, 64> worker_commands;
+	static SpscQueue<std::shared_ptr<AudioStream>, 16> retired_streams;
+
+	// Only used by the task thread
+	static const size_t max_prefetched_bgm = 2;
+	std::vector<std::pair<std::string, std::unique_ptr<AudioDecoder>>> prefetched_bgm;
+
+	// Written by the game thread
+	int bgm_id = 0;
+	bool bgm_playing = false;
+	/** Stream of the last BGM_Play, for BGM_Seek */
+	std::shared_ptr<AudioStream> bgm_stream;
+
+	// Last member: Destroyed first, its tasks use the other members
+	AudioStreamWorker stream_worker;
+
+	// Written by the audio thread
+	static std::atomic<int> bgm_played_once_id;
+	static std::atomic<unsigned> bgm_ticks;
+	static std::atomic<int> bgm_position;
+	static std::atomic<int> se_dropped;
+
 	static std::vector<uint8_t> scrap_buffer;
 	static unsigned scrap_buffer_size;
 	static std::vector<float> mixer_buffer;
@@ -0,0 +1,435 @@
+/*
+ * This file is part of EasyRPG Player.
+ *
+ * EasyRPG Player is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * EasyRPG Player is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with EasyRPG Player. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "system.h"
+
+#ifdef WANT_FMMIDI
+
+// Headers
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstdio>
+#include <cstring>
+#include <deque>
+#include <list>
+#include <map>
+#include <mutex>
+#include <thread>
+#include "audio_midicache.h"
+#include "decoder_fmmidi.h"
+#include "filefinder.h"
+
+namespace {
+	// IMA ADPCM, 4 bit per sample. A block starts with the predictor and
+	// step index of both channels, followed by one byte per frame
+	// (left sample in the low nibble).
+	const int block_header_size = 8;
+	const int block_size = block_header_size + AudioMidiCache::block_frames;
+
+	const int index_table[8] = { -1, -1, -1, -1, 2, 4, 6, 8 };
+
+	const int step_table[89] = {
+		7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 19, 21, 23, 25, 28, 31,
+		34, 37, 41, 45, 50, 55, 60, 66, 73, 80, 88, 97, 107, 118, 130, 143,
+		157, 173, 190, 209, 230, 253, 279, 307, 337, 371, 408, 449, 494, 544, 598, 658,
+		724, 796, 876, 963, 1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066, 2272, 2499, 2749, 3024,
+		3327, 3660, 4026, 4428, 4871, 5358, 5894, 6484, 7132, 7845, 8630, 9493, 10442, 11487, 12635, 13899,
+		15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794, 32767
+	};
+
+	using AudioMidiCache::AdpcmState;
+
+	void Step(AdpcmState& state, int code) {
+		int step = step_table[state.index];
+		int diff = step >> 3;
+		if (code & 4) diff += step;
+		if (code & 2) diff += step >> 1;
+		if (code & 1) diff += step >> 2;
+
+		state.predictor += (code & 8) ? -diff : diff;
+		state.predictor = std::min(std::max(state.predictor, -32768), 32767);
+		state.index = std::min(std::max(state.index + index_table[code & 7], 0), 88);
+	}
+
+	int Encode(AdpcmState& state, int sample) {
+		int step = step_table[state.index];
+		int diff = sample - state.predictor;
+		int code = 0;
+		if (diff < 0) {
+			code = 8;
+			diff = -diff;
+		}
+		if (diff >= step) {
+			code |= 4;
+			diff -= step;
+		}
+		if (diff >= step >> 1) {
+			code |= 2;
+			diff -= step >> 1;
+		}
+		if (diff >= step >> 2) {
+			code |= 1;
+		}
+
+		// Track the state exactly like the decoder does
+		Step(state, code);
+		return code;
+	}
+
+	// Refuse to render broken files with an absurd length (30 minutes)
+	const int max_minutes = 30;
+
+	// Compressed size kept in memory
+	const size_t cache_limit = 32 * 1024 * 1024;
+
+	struct CacheEntry {
+		std::shared_ptr<const AudioMidiCache::Track> track;
+		std::list<AudioMidiCache::Key>::iterator lru_it;
+	};
+
+	struct Job {
+		AudioMidiCache::Key key;
+		std::vector<uint8_t> midi;
+	};
+
+	class Renderer {
+	public:
+		~Renderer();
+
+		void Run();
+		std::shared_ptr<AudioMidiCache::Track> Render(const Job& job);
+		std::shared_ptr<AudioMidiCache::Track> Load(const AudioMidiCache::Key& key);
+		void Store(const AudioMidiCache::Key& key, const AudioMidiCache::Track& track);
+		void Insert(const AudioMidiCache::Key& key, std::shared_ptr<const AudioMidiCache::Track> track);
+
+		std::mutex mutex;
+		std::condition_variable cv;
+		std::thread thread;
+		std::deque<Job> jobs;
+		std::atomic<bool> quit{false};
+
+		std::map<AudioMidiCache::Key, CacheEntry> cache;
+		// Most recently used track first
+		std::list<AudioMidiCache::Key> lru;
+		size_t cache_size = 0;
+		std::string directory;
+	};
+
+	Renderer renderer;
+
+	std::string GetFilename(const std::string& directory, const AudioMidiCache::Key& key) {
+		char name[64];
+		snprintf(name, sizeof(name), "%016llx_%d_%d.fmc", (unsigned long long)key.hash, key.frequency, key.pitch);
+		return FileFinder::MakePath(directory, name);
+	}
+
+	void WriteU32(uint8_t* data, uint32_t value) {
+		for (int i = 0; i < 4; ++i) {
+			data[i] = (value >> (i * 8)) & 0xFF;
+		}
+	}
+
+	uint32_t ReadU32(const uint8_t* data) {
+		return data[0] | (data[1] << 8) | (data[2] << 16) | ((uint32_t)data[3] << 24);
+	}
+
+	const char file_magic[4] = { 'E', 'P', 'F', 'M' };
+	const int file_version = 1;
+	const int file_header_size = 16;
+}
+
+Renderer::~Renderer() {
+	if (thread.joinable()) {
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			quit = true;
+		}
+		cv.notify_one();
+		thread.join();
+	}
+}
+
+void Renderer::Run() {
+	std::unique_lock<std::mutex> lock(mutex);
+	while (!quit) {
+		if (jobs.empty()) {
+			cv.wait(lock);
+			continue;
+		}
+
+		Job job = std::move(jobs.front());
+		jobs.pop_front();
+		lock.unlock();
+
+		std::shared_ptr<AudioMidiCache::Track> track = Load(job.key);
+		if (!track) {
+			track = Render(job);
+			if (track) {
+				Store(job.key, *track);
+			}
+		}
+
+		lock.lock();
+		if (track) {
+			Insert(job.key, track);
+		} else {
+			// Keep the entry, so a broken file is not rendered again
+			Insert(job.key, std::make_shared<AudioMidiCache::Track>());
+		}
+	}
+}
+
+std::shared_ptr<AudioMidiCache::Track> Renderer::Render(const Job& job) {
+	FmMidiDecoder decoder;
+	if (!decoder.OpenMemory(job.midi)) {
+		return nullptr;
+	}
+	decoder.SetFormat(job.key.frequency, AudioDecoder::Format::S16, 2);
+	decoder.SetPitch(job.key.pitch);
+
+	std::shared_ptr<AudioMidiCache::Track> track = std::make_shared<AudioMidiCache::Track>();
+	std::vector<int16_t> samples(AudioMidiCache::block_frames * 2);
+	AdpcmState state[2];
+	int max_frames = job.key.frequency * 60 * max_minutes;
+
+	while (!decoder.IsFinished()) {
+		if (quit || track->frames > max_frames) {
+			return nullptr;
+		}
+
+		int read = decoder.Decode(reinterpret_cast<uint8_t*>(samples.data()), samples.size() * sizeof(int16_t));
+		if (read <= 0) {
+			break;
+		}
+
+		AudioMidiCache::EncodeBlock(samples.data(), state, track->data);
+		track->frames += read / (2 * sizeof(int16_t));
+	}
+
+	return track;
+}
+
+std::shared_ptr<AudioMidiCache::Track> Renderer::Load(const AudioMidiCache::Key& key) {
+	std::string dir;
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		dir = directory;
+	}
+	if (dir.empty()) {
+		return nullptr;
+	}
+
+	FILE* file = FileFinder::fopenUTF8(GetFilename(dir, key), "rb");
+	if (!file) {
+		return nullptr;
+	}
+
+	std::shared_ptr<AudioMidiCache::Track> track = std::make_shared<AudioMidiCache::Track>();
+	uint8_t header[file_header_size];
+	bool valid = fread(header, 1, sizeof(header), file) == sizeof(header) &&
+		memcmp(header, file_magic, sizeof(file_magic)) == 0 &&
+		ReadU32(&header[4]) == file_version &&
+		ReadU32(&header[8]) == AudioMidiCache::block_frames;
+
+	if (valid) {
+		track->frames = ReadU32(&header[12]);
+		track->data.resize(track->GetBlockCount() * block_size);
+		valid = fread(track->data.data(), 1, track->data.size(), file) == track->data.size();
+	}
+	fclose(file);
+
+	return valid ? track : nullptr;
+}
+
+void Renderer::Store(const AudioMidiCache::Key& key, const AudioMidiCache::Track& track) {
+	std::string dir;
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		dir = directory;
+	}
+	if (dir.empty()) {
+		return;
+	}
+
+	// Written to a temporary file first, a partial file is never loaded
+	std::string filename = GetFilename(dir, key);
+	std::string tmp_filename = filename + ".tmp";
+	FILE* file = FileFinder::fopenUTF8(tmp_filename, "wb");
+	if (!file) {
+		return;
+	}
+
+	uint8_t header[file_header_size];
+	memcpy(header, file_magic, sizeof(file_magic));
+	WriteU32(&header[4], file_version);
+	WriteU32(&header[8], AudioMidiCache::block_frames);
+	WriteU32(&header[12], track.frames);
+
+	bool success = fwrite(header, 1, sizeof(header), file) == sizeof(header) &&
+		fwrite(track.data.data(), 1, track.data.size(), file) == track.data.size();
+	success = fclose(file) == 0 && success;
+
+	if (success) {
+		remove(filename.c_str());
+		success = rename(tmp_filename.c_str(), filename.c_str()) == 0;
+	}
+	if (!success) {
+		remove(tmp_filename.c_str());
+	}
+}
+
+void Renderer::Insert(const AudioMidiCache::Key& key, std::shared_ptr<const AudioMidiCache::Track> track) {
+	auto it = cache.find(key);
+	if (it == cache.end()) {
+		return;
+	}
+
+	it->second.track = track;
+	cache_size += track->data.size();
+
+	// Tracks still in use stay alive through their shared_ptr
+	auto inserted = it->second.lru_it;
+	auto lru_it = lru.end();
+	while (cache_size > cache_limit && lru_it != lru.begin()) {
+		--lru_it;
+
+		auto entry = cache.find(*lru_it);
+		if (lru_it == inserted || !entry->second.track) {
+			// Just rendered or still rendering
+			continue;
+		}
+		cache_size -= entry->second.track->data.size();
+		cache.erase(entry);
+		lru_it = lru.erase(lru_it);
+	}
+}
+
+void AudioMidiCache::EncodeBlock(const int16_t* samples, AdpcmState (&state)[2], std::vector<uint8_t>& data) {
+	size_t pos = data.size();
+	data.resize(pos + block_size);
+	uint8_t* block_data = &data[pos];
+
+	for (int c = 0; c < 2; ++c) {
+		block_data[c * 4] = state[c].predictor & 0xFF;
+		block_data[c * 4 + 1] = (state[c].predictor >> 8) & 0xFF;
+		block_data[c * 4 + 2] = state[c].index;
+		block_data[c * 4 + 3] = 0;
+	}
+
+	for (int i = 0; i < block_frames; ++i) {
+		int left = Encode(state[0], samples[i * 2]);
+		int right = Encode(state[1], samples[i * 2 + 1]);
+		block_data[block_header_size + i] = left | (right << 4);
+	}
+}
+
+int AudioMidiCache::Track::GetBlockCount() const {
+	return (frames + block_frames - 1) / block_frames;
+}
+
+void AudioMidiCache::Track::DecodeBlock(int block, int16_t* output) const {
+	const uint8_t* block_data = &data[block * block_size];
+
+	AdpcmState state[2];
+	for (int c = 0; c < 2; ++c) {
+		state[c].predictor = (int16_t)(block_data[c * 4] | (block_data[c * 4 + 1] << 8));
+		state[c].index = block_data[c * 4 + 2];
+	}
+
+	for (int i = 0; i < block_frames; ++i) {
+		uint8_t codes = block_data[block_header_size + i];
+		Step(state[0], codes & 0x0F);
+		Step(state[1], codes >> 4);
+		output[i * 2] = state[0].predictor;
+		output[i * 2 + 1] = state[1].predictor;
+	}
+}
+
+bool AudioMidiCache::Key::operator<(const Key& other) const {
+	if (hash != other.hash) {
+		return hash < other.hash;
+	}
+	if (frequency != other.frequency) {
+		return frequency < other.frequency;
+	}
+	return pitch < other.pitch;
+}
+
+uint64_t AudioMidiCache::Hash(const std::vector<uint8_t>& data) {
+	// FNV-1a
+	uint64_t hash = 14695981039346656037ULL;
+	for (uint8_t byte : data) {
+		hash ^= byte;
+		hash *= 1099511628211ULL;
+	}
+	return hash;
+}
+
+std::shared_ptr<const AudioMidiCache::Track> AudioMidiCache::Get(const Key& key, const std::vector<uint8_t>& midi) {
+	std::lock_guard<std::mutex> lock(renderer.mutex);
+
+	auto it = renderer.cache.find(key);
+	if (it != renderer.cache.end()) {
+		renderer.lru.splice(renderer.lru.begin(), renderer.lru, it->second.lru_it);
+
+		const auto& track = it->second.track;
+		// Broken files are cached as empty tracks
+		return (track && track->frames > 0) ? track : nullptr;
+	}
+
+	// Reserve the entry, the track is added when the job finished
+	renderer.lru.push_front(key);
+	CacheEntry& entry = renderer.cache[key];
+	entry.lru_it = renderer.lru.begin();
+
+	Job job;
+	job.key = key;
+	job.midi = midi;
+	renderer.jobs.push_back(std::move(job));
+
+	if (!renderer.thread.joinable()) {
+		renderer.thread = std::thread(&Renderer::Run, &renderer);
+	}
+	renderer.cv.notify_one();
+
+	return nullptr;
+}
+
+void AudioMidiCache::SetDirectory(const std::string& path) {
+	std::lock_guard<std::mutex> lock(renderer.mutex);
+
+	renderer.directory = path;
+}
+
+void AudioMidiCache::Clear() {
+	std::lock_guard<std::mutex> lock(renderer.mutex);
+
+	// Entries of pending jobs are kept, the jobs insert into them
+	for (auto it = renderer.lru.begin(); it != renderer.lru.end(); ) {
+		auto& entry = renderer.cache[*it];
+		if (entry.track) {
+			renderer.cache_size -= entry.track->data.size();
+			renderer.cache.erase(*it);
+			it = renderer.lru.erase(it);
+		} else {
+			++it;
+		}
+	}
+}
+
+#endif
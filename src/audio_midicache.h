@@ -0,0 +1,114 @@
+/*
+ * This file is part of EasyRPG Player.
+ *
+ * EasyRPG Player is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * EasyRPG Player is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with EasyRPG Player. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef EP_AUDIO_MIDICACHE_H
+#define EP_AUDIO_MIDICACHE_H
+
+// Headers
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+/**
+ * Cache of MIDI tracks pre-rendered by the FM synthesizer.
+ *
+ * A track is rendered once per file, output frequency and pitch on a
+ * background thread and stored IMA ADPCM compressed in memory and, when a
+ * directory is set, on disk. The FmMidiDecoder streams from the rendered
+ * track once it is available and synthesizes live until then.
+ */
+namespace AudioMidiCache {
+	/** Frames per compressed block, blocks can be decoded independently */
+	constexpr int block_frames = 1024;
+
+	/** Rendered track, stereo S16 samples */
+	struct Track {
+		/** Number of frames */
+		int frames = 0;
+		/** Compressed blocks */
+		std::vector<uint8_t> data;
+
+		/** @return number of blocks */
+		int GetBlockCount() const;
+
+		/**
+		 * Decompresses a block.
+		 *
+		 * @param block block index
+		 * @param output receives block_frames * 2 samples
+		 */
+		void DecodeBlock(int block, int16_t* output) const;
+	};
+
+	/** IMA ADPCM state of one channel */
+	struct AdpcmState {
+		int predictor = 0;
+		int index = 0;
+	};
+
+	/**
+	 * Compresses a block and appends it to the data of a track.
+	 *
+	 * @param samples block_frames * 2 samples
+	 * @param state encoder state of both channels, updated
+	 * @param data receives the block
+	 */
+	void EncodeBlock(const int16_t* samples, AdpcmState (&state)[2], std::vector<uint8_t>& data);
+
+	/** Identifies a rendering of a MIDI file */
+	struct Key {
+		/** Hash of the MIDI data */
+		uint64_t hash;
+		int frequency;
+		int pitch;
+
+		bool operator<(const Key& other) const;
+	};
+
+	/**
+	 * Hashes MIDI data for use in a Key.
+	 *
+	 * @param data MIDI file data
+	 * @return hash
+	 */
+	uint64_t Hash(const std::vector<uint8_t>& data);
+
+	/**
+	 * Gets a rendered track. When the track is not cached yet it is loaded
+	 * from disk or rendered in the background.
+	 *
+	 * @param key track to get
+	 * @param midi MIDI file data, copied when the track must be rendered
+	 * @return the track or null while it is not available
+	 */
+	std::shared_ptr<const Track> Get(const Key& key, const std::vector<uint8_t>& midi);
+
+	/**
+	 * Sets the directory where rendered tracks are stored.
+	 *
+	 * @param path directory, empty to only cache in memory
+	 */
+	void SetDirectory(const std::string& path);
+
+	/**
+	 * Removes all tracks from memory.
+	 */
+	void Clear();
+}
+
+#endif
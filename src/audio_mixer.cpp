@@ -0,0 +1,256 @@
+/*
+ * This file is part of EasyRPG Player.
+ *
+ * EasyRPG Player is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * EasyRPG Player is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with EasyRPG Player. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Headers
+#include <algorithm>
+#include <cmath>
+#include "audio_mixer.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#  define EP_MIXER_SSE2
+#  include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#  define EP_MIXER_NEON
+#  include <arm_neon.h>
+#endif
+
+namespace {
+	// A sample is converted to float by "sample * Scale + Offset"
+	template <typename T> inline float Scale();
+	template <typename T> inline float Offset() { return 0.0f; }
+
+	template <> inline float Scale<int8_t>() { return 1.0f / 128.0f; }
+	template <> inline float Scale<uint8_t>() { return 1.0f / 128.0f; }
+	template <> inline float Scale<int16_t>() { return 1.0f / 32768.0f; }
+	template <> inline float Scale<uint16_t>() { return 1.0f / 32768.0f; }
+	template <> inline float Scale<int32_t>() { return 1.0f / 2147483648.0f; }
+	template <> inline float Scale<uint32_t>() { return 1.0f / 2147483648.0f; }
+	template <> inline float Scale<float>() { return 1.0f; }
+
+	template <> inline float Offset<uint8_t>() { return -1.0f; }
+	template <> inline float Offset<uint16_t>() { return -1.0f; }
+	template <> inline float Offset<uint32_t>() { return -1.0f; }
+
+	template <typename T>
+	void MixRange(float* mix, const T* src, int begin, int end, int channels, float volume) {
+		const float gain = Scale<T>() * volume;
+		const float bias = Offset<T>() * volume;
+
+		if (channels == 1) {
+			for (int i = begin; i < end; ++i) {
+				float val = src[i] * gain + bias;
+				mix[i * 2] += val;
+				mix[i * 2 + 1] += val;
+			}
+		} else {
+			for (int i = begin; i < end; ++i) {
+				mix[i * 2] += src[i * channels] * gain + bias;
+				mix[i * 2 + 1] += src[i * channels + 1] * gain + bias;
+			}
+		}
+	}
+
+	template <typename T>
+	void MixGeneric(float* mix, const uint8_t* samples, int frames, int channels, float volume) {
+		MixRange(mix, reinterpret_cast<const T*>(samples), 0, frames, channels, volume);
+	}
+
+	void MixS16(float* mix, const uint8_t* samples, int frames, int channels, float volume) {
+		const int16_t* src = reinterpret_cast<const int16_t*>(samples);
+		int i = 0;
+
+#if defined(EP_MIXER_SSE2)
+		const __m128 gain = _mm_set1_ps(volume * Scale<int16_t>());
+
+		if (channels == 2) {
+			for (; i + 4 <= frames; i += 4) {
+				__m128i s = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i * 2));
+				__m128 lo = _mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpacklo_epi16(s, s), 16));
+				__m128 hi = _mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpackhi_epi16(s, s), 16));
+				float* out = mix + i * 2;
+				_mm_storeu_ps(out, _mm_add_ps(_mm_loadu_ps(out), _mm_mul_ps(lo, gain)));
+				_mm_storeu_ps(out + 4, _mm_add_ps(_mm_loadu_ps(out + 4), _mm_mul_ps(hi, gain)));
+			}
+		} else if (channels == 1) {
+			for (; i + 8 <= frames; i += 8) {
+				__m128i s = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+				__m128 lo = _mm_mul_ps(_mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpacklo_epi16(s, s), 16)), gain);
+				__m128 hi = _mm_mul_ps(_mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpackhi_epi16(s, s), 16)), gain);
+				float* out = mix + i * 2;
+				_mm_storeu_ps(out, _mm_add_ps(_mm_loadu_ps(out), _mm_unpacklo_ps(lo, lo)));
+				_mm_storeu_ps(out + 4, _mm_add_ps(_mm_loadu_ps(out + 4), _mm_unpackhi_ps(lo, lo)));
+				_mm_storeu_ps(out + 8, _mm_add_ps(_mm_loadu_ps(out + 8), _mm_unpacklo_ps(hi, hi)));
+				_mm_storeu_ps(out + 12, _mm_add_ps(_mm_loadu_ps(out + 12), _mm_unpackhi_ps(hi, hi)));
+			}
+		}
+#elif defined(EP_MIXER_NEON)
+		const float32x4_t gain = vdupq_n_f32(volume * Scale<int16_t>());
+
+		if (channels == 2) {
+			for (; i + 4 <= frames; i += 4) {
+				int16x8_t s = vld1q_s16(src + i * 2);
+				float32x4_t lo = vcvtq_f32_s32(vmovl_s16(vget_low_s16(s)));
+				float32x4_t hi = vcvtq_f32_s32(vmovl_s16(vget_high_s16(s)));
+				float* out = mix + i * 2;
+				vst1q_f32(out, vmlaq_f32(vld1q_f32(out), lo, gain));
+				vst1q_f32(out + 4, vmlaq_f32(vld1q_f32(out + 4), hi, gain));
+			}
+		} else if (channels == 1) {
+			for (; i + 4 <= frames; i += 4) {
+				float32x4_t v = vmulq_f32(vcvtq_f32_s32(vmovl_s16(vld1_s16(src + i))), gain);
+				float32x4x2_t d = vzipq_f32(v, v);
+				float* out = mix + i * 2;
+				vst1q_f32(out, vaddq_f32(vld1q_f32(out), d.val[0]));
+				vst1q_f32(out + 4, vaddq_f32(vld1q_f32(out + 4), d.val[1]));
+			}
+		}
+#endif
+
+		MixRange(mix, src, i, frames, channels, volume);
+	}
+
+	void MixF32(float* mix, const uint8_t* samples, int frames, int channels, float volume) {
+		const float* src = reinterpret_cast<const float*>(samples);
+		int i = 0;
+
+#if defined(EP_MIXER_SSE2)
+		const __m128 gain = _mm_set1_ps(volume);
+
+		if (channels == 2) {
+			for (; i + 2 <= frames; i += 2) {
+				float* out = mix + i * 2;
+				_mm_storeu_ps(out, _mm_add_ps(_mm_loadu_ps(out), _mm_mul_ps(_mm_loadu_ps(src + i * 2), gain)));
+			}
+		} else if (channels == 1) {
+			for (; i + 4 <= frames; i += 4) {
+				__m128 v = _mm_mul_ps(_mm_loadu_ps(src + i), gain);
+				float* out = mix + i * 2;
+				_mm_storeu_ps(out, _mm_add_ps(_mm_loadu_ps(out), _mm_unpacklo_ps(v, v)));
+				_mm_storeu_ps(out + 4, _mm_add_ps(_mm_loadu_ps(out + 4), _mm_unpackhi_ps(v, v)));
+			}
+		}
+#elif defined(EP_MIXER_NEON)
+		const float32x4_t gain = vdupq_n_f32(volume);
+
+		if (channels == 2) {
+			for (; i + 2 <= frames; i += 2) {
+				float* out = mix + i * 2;
+				vst1q_f32(out, vmlaq_f32(vld1q_f32(out), vld1q_f32(src + i * 2), gain));
+			}
+		} else if (channels == 1) {
+			for (; i + 4 <= frames; i += 4) {
+				float32x4_t v = vmulq_f32(vld1q_f32(src + i), gain);
+				float32x4x2_t d = vzipq_f32(v, v);
+				float* out = mix + i * 2;
+				vst1q_f32(out, vaddq_f32(vld1q_f32(out), d.val[0]));
+				vst1q_f32(out + 4, vaddq_f32(vld1q_f32(out + 4), d.val[1]));
+			}
+		}
+#endif
+
+		MixRange(mix, src, i, frames, channels, volume);
+	}
+
+	void MixNone(float*, const uint8_t*, int, int, float) {
+	}
+}
+
+AudioMixer::MixFunction AudioMixer::GetMixFunction(AudioDecoder::Format format) {
+	switch (format) {
+		case AudioDecoder::Format::S8:
+			return MixGeneric<int8_t>;
+		case AudioDecoder::Format::U8:
+			return MixGeneric<uint8_t>;
+		case AudioDecoder::Format::S16:
+			return MixS16;
+		case AudioDecoder::Format::U16:
+			return MixGeneric<uint16_t>;
+		case AudioDecoder::Format::S32:
+			return MixGeneric<int32_t>;
+		case AudioDecoder::Format::U32:
+			return MixGeneric<uint32_t>;
+		case AudioDecoder::Format::F32:
+			return MixF32;
+	}
+
+	return MixNone;
+}
+
+void AudioMixer::PackS16(int16_t* output, const float* mix, int samples, float total_volume) {
+	// Samples above the threshold are compressed into the remaining range.
+	// A ratio of 1.0 leaves the samples unchanged.
+	const float threshold = 0.8f;
+	const float ratio = total_volume > 1.0f ? (1.0f - threshold) / (total_volume - threshold) : 1.0f;
+	const float scale = 32768.0f;
+	int i = 0;
+
+#if defined(EP_MIXER_SSE2)
+	const __m128 sign_mask = _mm_set1_ps(-0.0f);
+	const __m128 vthreshold = _mm_set1_ps(threshold);
+	const __m128 vratio = _mm_set1_ps(ratio);
+	const __m128 vscale = _mm_set1_ps(scale);
+	const __m128 vmin = _mm_set1_ps(-32768.0f);
+	const __m128 vmax = _mm_set1_ps(32767.0f);
+
+	auto compress = [&](__m128 s) {
+		__m128 sign = _mm_and_ps(s, sign_mask);
+		__m128 a = _mm_andnot_ps(sign_mask, s);
+		__m128 c = _mm_add_ps(vthreshold, _mm_mul_ps(_mm_sub_ps(a, vthreshold), vratio));
+		__m128 m = _mm_cmpgt_ps(a, vthreshold);
+		a = _mm_or_ps(_mm_and_ps(m, c), _mm_andnot_ps(m, a));
+		__m128 v = _mm_mul_ps(_mm_or_ps(a, sign), vscale);
+		return _mm_cvttps_epi32(_mm_max_ps(vmin, _mm_min_ps(vmax, v)));
+	};
+
+	for (; i + 8 <= samples; i += 8) {
+		__m128i lo = compress(_mm_loadu_ps(mix + i));
+		__m128i hi = compress(_mm_loadu_ps(mix + i + 4));
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(output + i), _mm_packs_epi32(lo, hi));
+	}
+#elif defined(EP_MIXER_NEON)
+	const uint32x4_t sign_mask = vdupq_n_u32(0x80000000u);
+	const float32x4_t vthreshold = vdupq_n_f32(threshold);
+	const float32x4_t vratio = vdupq_n_f32(ratio);
+	const float32x4_t vscale = vdupq_n_f32(scale);
+	const float32x4_t vmin = vdupq_n_f32(-32768.0f);
+	const float32x4_t vmax = vdupq_n_f32(32767.0f);
+
+	auto compress = [&](float32x4_t s) {
+		float32x4_t a = vabsq_f32(s);
+		float32x4_t c = vmlaq_f32(vthreshold, vsubq_f32(a, vthreshold), vratio);
+		a = vbslq_f32(vcgtq_f32(a, vthreshold), c, a);
+		float32x4_t v = vmulq_f32(vbslq_f32(sign_mask, s, a), vscale);
+		return vqmovn_s32(vcvtq_s32_f32(vmaxq_f32(vmin, vminq_f32(vmax, v))));
+	};
+
+	for (; i + 8 <= samples; i += 8) {
+		int16x4_t lo = compress(vld1q_f32(mix + i));
+		int16x4_t hi = compress(vld1q_f32(mix + i + 4));
+		vst1q_s16(output + i, vcombine_s16(lo, hi));
+	}
+#endif
+
+	for (; i < samples; ++i) {
+		float sample = mix[i];
+		float a = std::fabs(sample);
+		if (a > threshold) {
+			a = threshold + (a - threshold) * ratio;
+		}
+		float val = (sample < 0 ? -a : a) * scale;
+		output[i] = static_cast<int16_t>(std::max(-32768.0f, std::min(32767.0f, val)));
+	}
+}
@@ -0,0 +1,67 @@
+/*
+ * This file is part of EasyRPG Player.
+ *
+ * EasyRPG Player is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * EasyRPG Player is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with EasyRPG Player. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef EP_AUDIO_MIXER_H
+#define EP_AUDIO_MIXER_H
+
+// Headers
+#include <cstdint>
+#include "audio_decoder.h"
+
+/**
+ * Mixing kernels used by GenericAudio.
+ *
+ * The mix buffer contains interleaved stereo float samples. Every channel
+ * is converted and added to it with a kernel specialized for its sample
+ * format, which is selected once per channel and callback. The common
+ * formats (S16 and F32) use SSE2 or NEON when available.
+ */
+namespace AudioMixer {
+	/**
+	 * Converts samples to float, applies the volume and adds them to the
+	 * stereo mix buffer. Mono samples are added to both sides, from
+	 * samples with more than two channels only the first two are used.
+	 *
+	 * @param mix stereo mix buffer (2 * frames floats)
+	 * @param samples interleaved samples
+	 * @param frames number of sample frames
+	 * @param channels number of channels of the samples
+	 * @param volume volume (1.0 is full volume)
+	 */
+	typedef void (*MixFunction)(float* mix, const uint8_t* samples, int frames, int channels, float volume);
+
+	/**
+	 * Gets the mixing kernel for a sample format.
+	 *
+	 * @param format sample format
+	 * @return mixing kernel
+	 */
+	MixFunction GetMixFunction(AudioDecoder::Format format);
+
+	/**
+	 * Compresses the dynamic range of the mix when the sum of the channel
+	 * volumes exceeds 1.0 and converts it to saturated S16 samples.
+	 *
+	 * @param output output buffer
+	 * @param mix mix buffer
+	 * @param samples number of samples (frames * channels)
+	 * @param total_volume sum of the volumes of all mixed channels
+	 */
+	void PackS16(int16_t* output, const float* mix, int samples, float total_volume);
+}
+
+#endif
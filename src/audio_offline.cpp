@@ -0,0 +1,134 @@
+/*
+ * This file is part of EasyRPG Player.
+ *
+ * EasyRPG Player is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * EasyRPG Player is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with EasyRPG Player. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Headers
+#include <cstring>
+#include "audio_offline.h"
+#include "filefinder.h"
+#include "graphics.h"
+#include "output.h"
+#include "player.h"
+#include "utils.h"
+
+namespace {
+	const int frequency = 44100;
+	const int channels = 2;
+	const int wav_header_size = 44;
+
+	void WriteU16(uint8_t* data, uint16_t value) {
+		Utils::SwapByteOrder(value);
+		memcpy(data, &value, sizeof(value));
+	}
+
+	void WriteU32(uint8_t* data, uint32_t value) {
+		Utils::SwapByteOrder(value);
+		memcpy(data, &value, sizeof(value));
+	}
+}
+
+OfflineAudio::OfflineAudio(const std::string& wav_path) :
+	GenericAudio()
+{
+	SetFormat(frequency, AudioDecoder::Format::S16, channels);
+	last_frame = Player::GetFrames();
+
+	if (!wav_path.empty()) {
+		file = FileFinder::fopenUTF8(wav_path, "wb");
+		if (!file) {
+			Output::Warning("Couldn't open audio output file %s", wav_path.c_str());
+			return;
+		}
+		// The sizes are filled in when the file is closed
+		WriteHeader();
+	}
+}
+
+OfflineAudio::~OfflineAudio() {
+	Stop();
+
+	if (file) {
+		fseek(file, 0, SEEK_SET);
+		WriteHeader();
+		fclose(file);
+	}
+}
+
+void OfflineAudio::Update() {
+	int frame = Player::GetFrames();
+	int elapsed = frame - last_frame;
+	last_frame = frame;
+
+	if (elapsed > 0) {
+		// Samples of the elapsed frames, the fraction is carried over
+		int fps = Graphics::GetDefaultFps();
+		remainder += elapsed * frequency;
+		int samples = remainder / fps;
+		remainder %= fps;
+
+		if (samples > 0) {
+			// Decoding runs ahead of the game clock like it does in realtime
+			SyncStreams();
+
+			buffer.resize(samples * channels * sizeof(int16_t));
+			LockMutex();
+			Decode(buffer.data(), (int)buffer.size());
+			UnlockMutex();
+
+			if (file) {
+				if (Utils::IsBigEndian()) {
+					uint16_t* data = reinterpret_cast<uint16_t*>(buffer.data());
+					for (size_t i = 0; i < buffer.size() / 2; ++i) {
+						Utils::SwapByteOrder(data[i]);
+					}
+				}
+				data_size += (uint32_t)fwrite(buffer.data(), 1, buffer.size(), file);
+			}
+		}
+	}
+
+	GenericAudio::Update();
+}
+
+void OfflineAudio::LockMutex() const {
+	mutex.lock();
+}
+
+void OfflineAudio::UnlockMutex() const {
+	mutex.unlock();
+}
+
+void OfflineAudio::WriteHeader() {
+	uint8_t header[wav_header_size];
+	int block_align = channels * sizeof(int16_t);
+
+	memcpy(&header[0], "RIFF", 4);
+	WriteU32(&header[4], wav_header_size - 8 + data_size);
+	memcpy(&header[8], "WAVE", 4);
+	memcpy(&header[12], "fmt ", 4);
+	WriteU32(&header[16], 16);
+	// PCM
+	WriteU16(&header[20], 1);
+	WriteU16(&header[22], channels);
+	WriteU32(&header[24], frequency);
+	WriteU32(&header[28], frequency * block_align);
+	WriteU16(&header[32], block_align);
+	WriteU16(&header[34], 16);
+	memcpy(&header[36], "data", 4);
+	WriteU32(&header[40], data_size);
+
+	fwrite(header, 1, sizeof(header), file);
+}
@@ -0,0 +1,62 @@
+/*
+ * This file is part of EasyRPG Player.
+ *
+ * EasyRPG Player is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * EasyRPG Player is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with EasyRPG Player. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef EP_AUDIO_OFFLINE_H
+#define EP_AUDIO_OFFLINE_H
+
+// Headers
+#include <cstdio>
+#include <mutex>
+#include <string>
+#include <vector>
+#include "audio_generic.h"
+
+/**
+ * GenericAudio without an audio device.
+ *
+ * The output is mixed on the game thread in Update, as many samples as the
+ * game frames since the last call last. It is either discarded or written
+ * to a WAV file. Decoding and mixing cost the same as with a device, which
+ * makes this usable for measurements on machines without sound hardware.
+ */
+class OfflineAudio : public GenericAudio {
+public:
+	/**
+	 * @param wav_path file the output is written to, empty to discard it
+	 */
+	explicit OfflineAudio(const std::string& wav_path);
+	~OfflineAudio();
+
+	void Update() override;
+
+	void LockMutex() const override;
+	void UnlockMutex() const override;
+
+private:
+	void WriteHeader();
+
+	FILE* file = nullptr;
+	uint32_t data_size = 0;
+
+	std::vector<uint8_t> buffer;
+	int last_frame = 0;
+	int remainder = 0;
+
+	mutable std::mutex mutex;
+};
+
+#endif
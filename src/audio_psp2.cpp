@@ -78,6 +78,8 @@ Psp2Audio::Psp2Audio() :
 }
 
 Psp2Audio::~Psp2Audio() {
+	Stop();
+
 	// Closing streaming thread
 	termStream = true;
 	sceKernelWaitThreadEnd(audio_thread, NULL, NULL);
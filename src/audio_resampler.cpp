@@ -279,15 +279,7 @@ bool AudioResampler::Open(FILE* file) {
 
 bool AudioResampler::Seek(size_t offset, Origin origin) {
 	if (wrapped_decoder->Seek(offset, origin)) {
-		//reset conversion data
-		conversion_data.input_frames = 0;
-		conversion_data.input_frames_used = 0;
-		finished = wrapped_decoder->IsFinished();
-		#if defined(HAVE_LIBSPEEXDSP)
-			speex_resampler_reset_mem(conversion_state);
-		#elif defined(HAVE_LIBSAMPLERATE)
-			src_reset(conversion_state);
-		#endif
+		ResetConversion();
 		return true;
 	}
 	return false;
@@ -298,6 +290,30 @@ size_t AudioResampler::Tell() const {
 	return wrapped_decoder->Tell();
 }
 
+bool AudioResampler::SeekTime(int ms) {
+	if (wrapped_decoder->SeekTime(ms)) {
+		ResetConversion();
+		return true;
+	}
+	return false;
+}
+
+int AudioResampler::TellTime() const {
+	return wrapped_decoder->TellTime();
+}
+
+void AudioResampler::ResetConversion() {
+	//reset conversion data
+	conversion_data.input_frames = 0;
+	conversion_data.input_frames_used = 0;
+	finished = wrapped_decoder->IsFinished();
+	#if defined(HAVE_LIBSPEEXDSP)
+		speex_resampler_reset_mem(conversion_state);
+	#elif defined(HAVE_LIBSAMPLERATE)
+		src_reset(conversion_state);
+	#endif
+}
+
 int AudioResampler::GetTicks() const {
 	return wrapped_decoder->GetTicks();
 }
@@ -94,6 +94,21 @@ public:
 	 */
 	size_t Tell() const override;
 
+	/**
+	 * Wraps the SeekTime function of the contained decoder
+	 *
+	 * @param ms Position in milliseconds
+	 * @return Whether seek was successful
+	 */
+	bool SeekTime(int ms) override;
+
+	/**
+	 * Wraps the TellTime function of the contained decoder
+	 *
+	 * @return Position in milliseconds or -1 when not supported
+	 */
+	int TellTime() const override;
+
 	/**
 	 * Wraps the GetTicks Function of the contained decoder
 	 *
@@ -169,6 +184,11 @@ private:
 	 * Internally used by the FillBuffer function if resampling is necessary
 	 */
 	int FillBufferDifferentRate(uint8_t* buffer, int length);
+
+	/**
+	 * Discards the buffered resampler state after the wrapped decoder seeked
+	 */
+	void ResetConversion();
 	
 	std::unique_ptr<AudioDecoder> wrapped_decoder;
 	bool pitch_handled_by_decoder;
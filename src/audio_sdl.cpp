@@ -102,6 +102,8 @@ SdlAudio::SdlAudio() :
 }
 
 SdlAudio::~SdlAudio() {
+	Stop();
+
 #if SDL_MAJOR_VERSION >= 2
 	SDL_CloseAudioDevice(audio_dev_id);
 #else
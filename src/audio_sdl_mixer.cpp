@@ -577,7 +577,7 @@ void SdlMixerAudio::BGS_Volume(int volume) {
 }
 
 void SdlMixerAudio::SE_Play(std::string const& file, int volume, int pitch) {
-	std::unique_ptr<AudioSeCache> cache = AudioSeCache::Create(file);
+	std::unique_ptr<AudioSeCache> cache = AudioSeCache::Create(file, pitch);
 	std::shared_ptr<Mix_Chunk> sound;
 	AudioSeRef se_ref = nullptr;
 
@@ -593,11 +593,12 @@ void SdlMixerAudio::SE_Play(std::string const& file, int volume, int pitch) {
 
 		// When this fails the resampler is probably not compiled in and output will be garbage, just use SDL
 		if (cache->SetFormat(audio_rate, audio_format, audio_channels)) {
-			cache->SetPitch(pitch);
-
 			se_ref = cache->Decode();
 
-			sound.reset(Mix_QuickLoad_RAW(se_ref->buffer.data(), se_ref->buffer.size()), &Mix_FreeChunk);
+			if (se_ref) {
+				// Only wraps the cached samples, they are not copied
+				sound.reset(Mix_QuickLoad_RAW(se_ref->buffer.data(), se_ref->buffer.size()), &Mix_FreeChunk);
+			}
 
 			if (!sound) {
 				Output::Warning("Couldn't load %s SE. %s", FileFinder::GetPathInsideGamePath(file).c_str(), Mix_GetError());
@@ -18,56 +18,115 @@
 // Headers
 #include <cassert>
 #include <cstring>
+#include <list>
 #include <map>
-#include <set>
+#include <mutex>
 #include "audio_resampler.h"
 #include "audio_secache.h"
-#include "baseui.h"
 #include "filefinder.h"
 #include "output.h"
 
 namespace {
-	typedef std::map<std::string, AudioSeRef> cache_type;
+	// Filename and pitch
+	typedef std::pair<std::string, int> cache_key;
+
+	struct CacheEntry {
+		AudioSeRef se;
+		std::list<cache_key>::iterator lru_it;
+		/** Pinned decodes not released by Unpin yet */
+		int pins;
+	};
+
+	typedef std::map<cache_key, CacheEntry> cache_type;
 
 	cache_type cache;
+	// Most recently used entry first
+	std::list<cache_key> lru;
+
+	// SE are decoded on the audio worker thread, the cache is cleared by
+	// the game thread
+	std::mutex cache_mutex;
+
+	size_t cache_limit = 4 * 1024 * 1024;
+	size_t cache_size = 0;
+	AudioSeCache::Stats stats;
+
+	// All functions below must be called with the cache_mutex held
 
-	const int cache_limit = 1 * 1024 * 1024;
-	int cache_size = 0;
+	AudioSeRef FindEntry(const cache_key& key, bool pin) {
+		cache_type::iterator it = cache.find(key);
+		if (it == cache.end()) {
+			return AudioSeRef();
+		}
+
+		lru.splice(lru.begin(), lru, it->second.lru_it);
+		if (pin) {
+			++it->second.pins;
+		}
+		return it->second.se;
+	}
 
 	void FreeCacheMemory() {
-		int32_t cur_ticks = DisplayUi->GetTicks();
+		auto it = lru.end();
+		while (cache_size > cache_limit && it != lru.begin()) {
+			--it;
 
-		for (auto it = cache.begin(); it != cache.end(); ) {
-			if (it->second.use_count() > 1) {
+			CacheEntry& entry = cache[*it];
+			if (entry.pins > 0 || entry.se.use_count() > 1) {
 				// Somebody uses this SE right now
-				++it;
 				continue;
 			}
 
-			if (cur_ticks - it->second->last_access < 5000) {
-				// Last access < 5s
-				++it;
-				continue;
-			}
+			cache_size -= entry.se->buffer.size();
+			++stats.evictions;
+
+			cache.erase(*it);
+			it = lru.erase(it);
+		}
+	}
+
+	AudioSeRef InsertEntry(const cache_key& key, AudioSeRef se, bool pin) {
+		AudioSeRef cached = FindEntry(key, pin);
+		if (cached) {
+			// Decoded by another thread in the meantime
+			return cached;
+		}
 
-			//Output::Debug("SE: Freeing memory of %s", it->first.c_str());
+		lru.push_front(key);
+		CacheEntry& entry = cache[key];
+		entry.se = se;
+		entry.lru_it = lru.begin();
+		entry.pins = pin ? 1 : 0;
 
-			cache_size -= it->second->buffer.size();
+		cache_size += se->buffer.size();
+		FreeCacheMemory();
 
-			it = cache.erase(it);
+		return se;
+	}
+
+	/**
+	 * Finds the entry Decode uses: The SE with the requested pitch or the
+	 * SE with pitch 100 it is resampled from.
+	 */
+	AudioSeRef FindCached(const std::string& filename, int pitch) {
+		std::lock_guard<std::mutex> lock(cache_mutex);
+
+		cache_type::const_iterator it = cache.find(cache_key(filename, pitch));
+		if (it == cache.end() && pitch != 100) {
+			it = cache.find(cache_key(filename, 100));
 		}
+		return it != cache.end() ? it->second.se : AudioSeRef();
 	}
 }
 
-std::unique_ptr<AudioSeCache> AudioSeCache::Create(const std::string& filename) {
+std::unique_ptr<AudioSeCache> AudioSeCache::Create(const std::string& filename, int pitch) {
 	std::unique_ptr<AudioSeCache> se;
 
-	cache_type::iterator const it = cache.find(filename);
-
 	se.reset(new AudioSeCache());
 	se->filename = filename;
+	se->SetPitch(pitch);
 
-	if (it == cache.end()) {
+	if (!FindCached(filename, se->GetPitch())) {
 		// Not in cache
 
 		FILE *f = FileFinder::fopenUTF8(filename, "rb");
@@ -124,6 +183,9 @@ bool AudioSeCache::SetFormat(int frequency, AudioDecoder::Format format, int cha
 					format == cformat &&
 					channels == cchannels;
 		}
+
+		// Removed from the cache by Clear after Create
+		return false;
 	}
 
 	bool success = audio_decoder->SetFormat(frequency, format, channels);
@@ -154,17 +216,21 @@ bool AudioSeCache::SetPitch(int pitch) {
 #endif
 }
 
+void AudioSeCache::SetPinned(bool pinned) {
+	this->pinned = pinned;
+}
+
 bool AudioSeCache::IsCached() const {
-	return cache.find(filename) != cache.end();
+	return FindCached(filename, GetPitch()) != nullptr;
 }
 
 bool AudioSeCache::GetCachedFormat(int& frequency, AudioDecoder::Format& format, int& channels) const {
-	cache_type::const_iterator it = cache.find(filename);
+	AudioSeRef cached = FindCached(filename, GetPitch());
 
-	if (it != cache.end()) {
-		frequency = (*it).second->frequency;
-		format = (*it).second->format;
-		channels = (*it).second->channels;
+	if (cached) {
+		frequency = cached->frequency;
+		format = cached->format;
+		channels = cached->channels;
 
 		return true;
 	}
@@ -212,103 +278,137 @@ private:
 	size_t offset = 0;
 };
 
-AudioSeRef AudioSeCache::Decode() {
-	// Writes a SE with pitch = 100 to the cache if it is not cached yet,
-	// otherwise returns the cached result
-	// For pitch != 100 the cached result is pitch-adjusted and returned.
-
-	AudioSeRef se;
-
-	if (IsCached()) {
-		se = cache.find(filename)->second;
-		se->last_access = DisplayUi->GetTicks();
+namespace {
+	AudioSeRef DecodeAll(AudioDecoder& decoder, bool mono_to_stereo_resample) {
+		AudioSeRef se(new AudioSeData());
+		decoder.GetFormat(se->frequency, se->format, se->channels);
+
+		const int buffer_size = 8192;
+		se->buffer.resize(buffer_size);
+
+		while (!decoder.IsFinished()) {
+			int read = decoder.Decode(se->buffer.data() + se->buffer.size() - buffer_size, buffer_size);
+			if (read < 8192) {
+				se->buffer.resize(se->buffer.size() - (buffer_size - read));
+				break;
+			}
 
-		if (GetPitch() == 100) {
-			// Nothing extra to do
-			return se;
+			se->buffer.resize(se->buffer.size() + buffer_size);
 		}
 
-#ifdef USE_AUDIO_RESAMPLER
-		// Code path is only taken with a resampler, otherwise pitch is always 100 here
-		// Falls through to the decoding logic but does not overwrite the cache
+		if (mono_to_stereo_resample) {
+			se->channels = 2;
+			se->buffer.resize(se->buffer.size() * 2);
 
-		// Don't overwrite our real cached entry
-		se.reset(new AudioSeData());
-		GetCachedFormat(se->frequency, se->format, se->channels);
+			int sample_size = AudioDecoder::GetSamplesizeForFormat(se->format);
 
-		audio_decoder.reset(new AudioResampler(std::unique_ptr<AudioDecoder>(new MemoryPitchResampler(cache.find(filename)->second))));
-		audio_decoder->Open(nullptr);
-#else
-		assert(false && "SeCache: Unexpected code path taken");
-#endif
-	}
+			// Duplicate data from the back, allows writing to the buffer directly
+			for (size_t i = se->buffer.size() / 2 - sample_size; i > 0; i -= sample_size) {
+				// left channel
+				memcpy(&se->buffer[i * 2 - sample_size * 2], &se->buffer[i], sample_size);
+				// right channel
+				memcpy(&se->buffer[i * 2 - sample_size], &se->buffer[i], sample_size);
+			}
+		}
 
-	if (!se) {
-		se.reset(new AudioSeData());
+		return se;
 	}
+}
 
-	GetFormat(se->frequency, se->format, se->channels);
-
-	if (IsCached()) {
-		audio_decoder->SetPitch(GetPitch());
-	} else {
-		audio_decoder->SetPitch(100);
-	}
+AudioSeRef AudioSeCache::Decode() {
+	// The SE is decoded with pitch = 100 and written to the cache if it is
+	// not cached yet. For pitch != 100 the cached result is resampled and
+	// cached as well.
 
-	const int buffer_size = 8192;
-	se->buffer.resize(buffer_size);
+	{
+		std::lock_guard<std::mutex> lock(cache_mutex);
 
-	while (!audio_decoder->IsFinished()) {
-		int read = audio_decoder->Decode(se->buffer.data() + se->buffer.size() - buffer_size, buffer_size);
-		if (read < 8192) {
-			se->buffer.resize(se->buffer.size() - (buffer_size - read));
-			break;
+		AudioSeRef se = FindEntry(cache_key(filename, GetPitch()), pinned);
+		if (se) {
+			++stats.hits;
+			return se;
 		}
+		++stats.misses;
+	}
 
-		se->buffer.resize(se->buffer.size() + buffer_size);
+	AudioSeRef base;
+	{
+		std::lock_guard<std::mutex> lock(cache_mutex);
+		base = FindEntry(cache_key(filename, 100), pinned && GetPitch() == 100);
 	}
 
-	if (mono_to_stereo_resample) {
-		se->buffer.resize(se->buffer.size() * 2);
+	if (!base) {
+		if (!audio_decoder) {
+			// Removed from the cache by Clear after Create
+			return nullptr;
+		}
 
-		int sample_size = AudioDecoder::GetSamplesizeForFormat(se->format);
+		audio_decoder->SetPitch(100);
+		base = DecodeAll(*audio_decoder, mono_to_stereo_resample);
 
-		// Duplicate data from the back, allows writing to the buffer directly
-		for (size_t i = se->buffer.size() / 2 - sample_size; i > 0; i -= sample_size) {
-			// left channel
-			memcpy(&se->buffer[i * 2 - sample_size * 2], &se->buffer[i], sample_size);
-			// right channel
-			memcpy(&se->buffer[i * 2 - sample_size], &se->buffer[i], sample_size);
-		}
+		std::lock_guard<std::mutex> lock(cache_mutex);
+		base = InsertEntry(cache_key(filename, 100), base, pinned && GetPitch() == 100);
 	}
 
-	if (!IsCached()) {
-		// Write normal pitched sample to cache
-		// This codepath is only taken the first time upon cache miss
-		cache.insert(std::make_pair(filename, se));
+	if (GetPitch() == 100) {
+		return base;
+	}
 
-		se->last_access = DisplayUi->GetTicks();
+#ifdef USE_AUDIO_RESAMPLER
+	// Code path is only taken with a resampler, otherwise pitch is always 100 here
+	AudioResampler resampler(std::unique_ptr<AudioDecoder>(new MemoryPitchResampler(base)));
+	resampler.Open(nullptr);
+	resampler.SetPitch(GetPitch());
 
-		cache_size += se->buffer.size();
+	AudioSeRef se = DecodeAll(resampler, false);
 
-		if (cache_size > cache_limit) {
-			FreeCacheMemory();
-		}
+	std::lock_guard<std::mutex> lock(cache_mutex);
+	return InsertEntry(cache_key(filename, GetPitch()), se, pinned);
+#else
+	assert(false && "SeCache: Unexpected code path taken");
+	return base;
+#endif
+}
 
-		//Output::Debug("cache %f", cache_size / 1024.0f / 1024.0f);
+void AudioSeCache::Unpin(const std::string& filename, int pitch) {
+	std::lock_guard<std::mutex> lock(cache_mutex);
 
-		if (GetPitch() != 100) {
-			// Also handle a requested resampling
-			// Takes the "IsCached" codepath now
-			mono_to_stereo_resample = false;
-			return Decode();
-		}
+	cache_type::iterator it = cache.find(cache_key(filename, pitch));
+	if (it == cache.end() || it->second.pins == 0) {
+		// Removed by Clear
+		return;
 	}
 
-	return se;
+	--it->second.pins;
+	FreeCacheMemory();
 }
 
 void AudioSeCache::Clear() {
+	std::lock_guard<std::mutex> lock(cache_mutex);
+
+	if (stats.hits + stats.misses > 0) {
+		Output::Debug("SE cache: %u hits, %u misses, %u evictions, %.2f MB in %u entries",
+			stats.hits, stats.misses, stats.evictions, cache_size / 1024.0 / 1024.0, (unsigned)cache.size());
+	}
+
 	cache_size = 0;
 	cache.clear();
+	lru.clear();
+	stats = Stats();
+}
+
+void AudioSeCache::SetBudget(size_t bytes) {
+	std::lock_guard<std::mutex> lock(cache_mutex);
+
+	cache_limit = bytes;
+	FreeCacheMemory();
+}
+
+AudioSeCache::Stats AudioSeCache::GetStats() {
+	std::lock_guard<std::mutex> lock(cache_mutex);
+
+	Stats result = stats;
+	result.size = cache_size;
+	result.entries = cache.size();
+	return result;
 }
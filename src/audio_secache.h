@@ -37,7 +37,6 @@ public:
 	int frequency;
 	AudioDecoder::Format format;
 	int channels;
-	int last_access;
 };
 
 typedef std::shared_ptr<AudioSeData> AudioSeRef;
@@ -45,20 +44,39 @@ typedef std::shared_ptr<AudioSeData> AudioSeRef;
 /**
  * AudioSeCache provides an interface for accessing sound effects.
  * It also provides an automatic cache management, any SE is only decoded
- * once, otherwise returned from the cache.
- * The cache is flushed from recently (>10 seconds by default) unused
- * samples when it reaches the memory limit (5 MB by default).
+ * once per pitch, otherwise returned from the cache. The entries are
+ * stored in the format requested by SetFormat, so the mixer can use them
+ * directly.
+ * When the cache exceeds its budget (4 MB by default) the least recently
+ * used entries which are neither playing nor pinned are removed.
  * Uses an internal AudioDecoder for handling the decoding.
+ * The cache can be used from several threads.
  */
 class AudioSeCache {
 public:
+	struct Stats {
+		/** Decode calls answered from the cache */
+		unsigned hits = 0;
+		/** Decode calls which had to decode or resample */
+		unsigned misses = 0;
+		/** Entries removed to stay within the budget */
+		unsigned evictions = 0;
+		/** Bytes of sample data in the cache */
+		size_t size = 0;
+		/** Number of cached (file, pitch) pairs */
+		size_t entries = 0;
+	};
+
 	/**
 	 * Opens the passed filename with the internal audio decoder.
+	 * The file is not opened when the SE is already cached with this pitch
+	 * or with pitch 100.
 	 *
 	 * @param filename Path to the file
+	 * @param pitch Pitch multiplier, see SetPitch
 	 * @return An AudioSeCache instance when the format was detected, otherwise null
 	 */
-	static std::unique_ptr<AudioSeCache> Create(const std::string& filename);
+	static std::unique_ptr<AudioSeCache> Create(const std::string& filename, int pitch = 100);
 
 	/**
 	 * Retrieves the format of the internal audio decoder.
@@ -101,6 +119,15 @@ public:
 	 */
 	bool SetPitch(int pitch);
 
+	/**
+	 * Marks the result of Decode as pinned, it is not evicted until Unpin
+	 * was called as often as it was pinned or the cache is cleared.
+	 * Used for SE which are played very often.
+	 *
+	 * @param pinned whether to pin the SE
+	 */
+	void SetPinned(bool pinned);
+
 	/**
 	 * Tells if Decode will have a cache hit when executed.
 	 * SetFormat will fail when this returns true.
@@ -128,13 +155,38 @@ public:
 	 * In case of a cache hit the decoding is skipped.
 	 * Calling Decode multiple times with different settings is supported.
 	 *
-	 * @return Decoded sound effect
+	 * @return Decoded sound effect, null when the file was removed from
+	 *         the cache by Clear after Create
 	 */
 	AudioSeRef Decode();
 
+	/**
+	 * Releases one pin of an entry, it is evicted again when no pins are left.
+	 *
+	 * @param filename Path to the file
+	 * @param pitch pitch of the pinned entry
+	 */
+	static void Unpin(const std::string& filename, int pitch);
+
+	/**
+	 * Removes all entries, including the pinned ones.
+	 */
 	static void Clear();
+
+	/**
+	 * Sets the maximal size of the cached sample data.
+	 *
+	 * @param bytes budget in bytes
+	 */
+	static void SetBudget(size_t bytes);
+
+	/**
+	 * @return cache statistics since the last Clear
+	 */
+	static Stats GetStats();
 private:
 	int pitch = 100;
+	bool pinned = false;
 
 	std::unique_ptr<AudioDecoder> audio_decoder;
 
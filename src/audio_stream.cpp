@@ -0,0 +1,409 @@
+/*
+ * This file is part of EasyRPG Player.
+ *
+ * EasyRPG Player is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * EasyRPG Player is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with EasyRPG Player. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Headers
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include "audio_stream.h"
+
+namespace {
+	// Frames decoded per Decode call of the worker
+	const int chunk_frames = 1024;
+
+	// Time between two fills of all streams
+	const int fill_interval_ms = 10;
+
+	size_t GetRingCapacity(const AudioDecoder& decoder, int buffer_ms) {
+		int frequency, channels;
+		AudioDecoder::Format format;
+		decoder.GetFormat(frequency, format, channels);
+		size_t frame_size = AudioDecoder::GetSamplesizeForFormat(format) * channels;
+
+		size_t capacity = (size_t)std::max(buffer_ms, 1) * frequency / 1000 * frame_size;
+		return std::max<size_t>(capacity, chunk_frames * frame_size);
+	}
+}
+
+AudioRingBuffer::AudioRingBuffer(size_t capacity) {
+	Resize(capacity);
+}
+
+void AudioRingBuffer::Resize(size_t capacity) {
+	size_t size = 1;
+	while (size < capacity) {
+		size <<= 1;
+	}
+	buffer.resize(size);
+	mask = size - 1;
+	read_pos = 0;
+	write_pos = 0;
+}
+
+size_t AudioRingBuffer::Write(const uint8_t* data, size_t size) {
+	size_t w = write_pos.load(std::memory_order_relaxed);
+	size_t r = read_pos.load(std::memory_order_acquire);
+	size = std::min(size, buffer.size() - (w - r));
+
+	size_t offset = w & mask;
+	size_t first = std::min(size, buffer.size() - offset);
+	memcpy(&buffer[offset], data, first);
+	memcpy(&buffer[0], data + first, size - first);
+
+	write_pos.store(w + size, std::memory_order_release);
+	return size;
+}
+
+size_t AudioRingBuffer::Read(uint8_t* data, size_t size) {
+	size_t r = read_pos.load(std::memory_order_relaxed);
+	size_t w = write_pos.load(std::memory_order_acquire);
+	size = std::min(size, w - r);
+
+	size_t offset = r & mask;
+	size_t first = std::min(size, buffer.size() - offset);
+	memcpy(data, &buffer[offset], first);
+	memcpy(data + first, &buffer[0], size - first);
+
+	read_pos.store(r + size, std::memory_order_release);
+	return size;
+}
+
+size_t AudioRingBuffer::GetAvailable() const {
+	return write_pos.load(std::memory_order_acquire) - read_pos.load(std::memory_order_acquire);
+}
+
+size_t AudioRingBuffer::GetFree() const {
+	return buffer.size() - GetAvailable();
+}
+
+AudioStream::AudioStream(int buffer_ms) :
+	ring(0),
+	buffer_ms(buffer_ms) {
+}
+
+void AudioStream::Open(std::unique_ptr<AudioDecoder> decoder) {
+	if (decoder) {
+		this->decoder = std::move(decoder);
+		this->decoder->GetFormat(frequency, format, channels);
+		frame_size = AudioDecoder::GetSamplesizeForFormat(format) * channels;
+		ring.Resize(GetRingCapacity(*this->decoder, buffer_ms));
+		chunk.resize(chunk_frames * frame_size);
+
+		// Playback starts without an underrun
+		Fill();
+	} else {
+		failed.store(true, std::memory_order_relaxed);
+	}
+
+	ready.store(true, std::memory_order_release);
+}
+
+bool AudioStream::IsReady() const {
+	return ready.load(std::memory_order_acquire);
+}
+
+int AudioStream::Read(uint8_t* buffer, int size) {
+	size -= size % frame_size;
+
+	// Drop the samples decoded before a seek
+	uint64_t skip = skip_until.load(std::memory_order_acquire);
+	while (read < skip) {
+		size_t skipped = ring.Read(buffer, (size_t)std::min<uint64_t>(size, skip - read));
+		if (skipped == 0) {
+			break;
+		}
+		read += skipped;
+	}
+
+	int res = (int)ring.Read(buffer, size);
+	read += res;
+
+	// Apply the decoder state of all chunks the playback reached
+	for (;;) {
+		if (!has_next_mark && !marks.Pop(next_mark)) {
+			break;
+		}
+		has_next_mark = true;
+		if (next_mark.pos > read) {
+			break;
+		}
+		ticks = next_mark.ticks;
+		position = next_mark.position;
+		played_once = played_once || next_mark.looped;
+		has_next_mark = false;
+	}
+
+	return res;
+}
+
+bool AudioStream::Fill() {
+	if (!decoder || failed.load(std::memory_order_relaxed)) {
+		return false;
+	}
+
+	int pitch = pending_pitch.exchange(0);
+	if (pitch > 0) {
+		decoder->SetPitch(pitch);
+	}
+
+	int seek = pending_seek.exchange(-1);
+	if (seek >= 0 && decoder->SeekTime(seek)) {
+		skip_until.store(written, std::memory_order_release);
+	}
+
+	bool decoded = false;
+	while (!IsStopped()) {
+		size_t size = std::min(ring.GetFree(), chunk.size());
+		size -= size % frame_size;
+		if (size == 0) {
+			break;
+		}
+
+		// Decode zero fills the rest of the buffer and handles the looping,
+		// so the whole chunk is written like the callback used to mix it.
+		if (decoder->Decode(chunk.data(), (int)size) < 0) {
+			failed.store(true, std::memory_order_release);
+			break;
+		}
+		ring.Write(chunk.data(), size);
+		written += size;
+		decoded = true;
+
+		Mark mark;
+		mark.pos = written;
+		mark.ticks = decoder->GetTicks();
+		mark.position = decoder->TellTime();
+		mark.looped = decoder->GetLoopCount() > 0;
+		// When the queue is full the state arrives with a later chunk
+		marks.Push(std::move(mark));
+	}
+
+	return decoded;
+}
+
+void AudioStream::SetPitch(int pitch) {
+	pending_pitch.store(pitch);
+}
+
+void AudioStream::Seek(int ms) {
+	pending_seek.store(ms);
+}
+
+void AudioStream::Stop() {
+	stopped.store(true, std::memory_order_relaxed);
+}
+
+bool AudioStream::IsStopped() const {
+	return stopped.load(std::memory_order_relaxed);
+}
+
+bool AudioStream::IsDone() const {
+	return failed.load(std::memory_order_acquire) && ring.GetAvailable() == 0;
+}
+
+bool AudioStream::IsPlayedOnce() const {
+	return played_once;
+}
+
+int AudioStream::GetTicks() const {
+	return ticks;
+}
+
+int AudioStream::GetPosition() const {
+	return position;
+}
+
+AudioDecoder& AudioStream::GetDecoder() {
+	return *decoder;
+}
+
+AudioStreamWorker::AudioStreamWorker() {
+}
+
+AudioStreamWorker::~AudioStreamWorker() {
+	Stop();
+}
+
+void AudioStreamWorker::Add(std::shared_ptr<AudioStream> stream) {
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		streams.push_back(std::move(stream));
+	}
+
+	StartThreads();
+}
+
+void AudioStreamWorker::Post(std::function<void()> task, bool urgent) {
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		if (quit) {
+			return;
+		}
+		(urgent ? urgent_tasks : tasks).push_back(std::move(task));
+		++posted_tasks;
+	}
+	cv_tasks.notify_one();
+
+	StartThreads();
+}
+
+void AudioStreamWorker::PostWarning(std::string msg) {
+	std::lock_guard<std::mutex> lock(mutex);
+	warnings.push_back(std::move(msg));
+}
+
+std::vector<std::string> AudioStreamWorker::TakeWarnings() {
+	std::vector<std::string> result;
+
+	std::lock_guard<std::mutex> lock(mutex);
+	result.swap(warnings);
+	return result;
+}
+
+void AudioStreamWorker::Sync() {
+#ifdef EMSCRIPTEN
+	Update();
+#else
+	std::unique_lock<std::mutex> lock(mutex);
+	if (!fill_thread.joinable()) {
+		return;
+	}
+
+	uint64_t task_target = posted_tasks;
+	cv_done.wait(lock, [&] { return quit || finished_tasks >= task_target; });
+
+	// The current run of the fills may have started before the tasks finished
+	uint64_t fill_target = fill_iterations + 2;
+	++sync_requests;
+	cv_fills.notify_one();
+	cv_done.wait(lock, [&] { return quit || fill_iterations >= fill_target; });
+	--sync_requests;
+#endif
+}
+
+void AudioStreamWorker::Update() {
+#ifdef EMSCRIPTEN
+	// No worker threads, the audio callback runs on this thread as well
+	std::function<void()> task;
+	while (TakeTask(task)) {
+		task();
+		task = nullptr;
+	}
+	Fill();
+#endif
+}
+
+void AudioStreamWorker::Stop() {
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		quit = true;
+		tasks.clear();
+		urgent_tasks.clear();
+	}
+	cv_tasks.notify_one();
+	cv_fills.notify_one();
+	cv_done.notify_all();
+
+	if (task_thread.joinable()) {
+		task_thread.join();
+	}
+	if (fill_thread.joinable()) {
+		fill_thread.join();
+	}
+}
+
+void AudioStreamWorker::StartThreads() {
+#ifndef EMSCRIPTEN
+	// Only the game thread starts and stops the threads
+	if (!quit && !fill_thread.joinable()) {
+		fill_thread = std::thread(&AudioStreamWorker::RunFills, this);
+		task_thread = std::thread(&AudioStreamWorker::RunTasks, this);
+	}
+#endif
+}
+
+void AudioStreamWorker::RunTasks() {
+	std::function<void()> task;
+	for (;;) {
+		{
+			std::unique_lock<std::mutex> lock(mutex);
+			cv_tasks.wait(lock, [this] { return quit || !tasks.empty() || !urgent_tasks.empty(); });
+		}
+		if (!TakeTask(task)) {
+			return;
+		}
+
+		task();
+		// Captured streams and decoders are released here, not under the lock
+		task = nullptr;
+
+		std::lock_guard<std::mutex> lock(mutex);
+		++finished_tasks;
+		cv_done.notify_all();
+	}
+}
+
+void AudioStreamWorker::RunFills() {
+	std::unique_lock<std::mutex> lock(mutex);
+	while (!quit) {
+		lock.unlock();
+		Fill();
+		lock.lock();
+
+		++fill_iterations;
+		cv_done.notify_all();
+
+		cv_fills.wait_for(lock, std::chrono::milliseconds(fill_interval_ms), [this] { return quit || sync_requests > 0; });
+	}
+}
+
+bool AudioStreamWorker::TakeTask(std::function<void()>& task) {
+	std::lock_guard<std::mutex> lock(mutex);
+	if (quit) {
+		return false;
+	}
+
+	std::deque<std::function<void()>>& queue = urgent_tasks.empty() ? tasks : urgent_tasks;
+	if (queue.empty()) {
+		return false;
+	}
+	task = std::move(queue.front());
+	queue.pop_front();
+	return true;
+}
+
+void AudioStreamWorker::Fill() {
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		if (quit) {
+			return;
+		}
+		streams.erase(std::remove_if(streams.begin(), streams.end(), [](const std::shared_ptr<AudioStream>& stream) {
+			return stream->IsStopped();
+		}), streams.end());
+		filled_streams = streams;
+	}
+
+	for (auto& stream : filled_streams) {
+		// Streams are opened on the task thread, they own the decoder until then
+		if (stream->IsReady()) {
+			stream->Fill();
+		}
+	}
+	// Streams already released by the other threads are destroyed here
+	filled_streams.clear();
+}
@@ -0,0 +1,298 @@
+/*
+ * This file is part of EasyRPG Player.
+ *
+ * EasyRPG Player is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * EasyRPG Player is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with EasyRPG Player. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef EP_AUDIO_STREAM_H
+#define EP_AUDIO_STREAM_H
+
+// Headers
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "audio_decoder.h"
+#include "spsc_queue.h"
+
+/**
+ * Lock-free byte ring buffer for one producer and one consumer thread.
+ */
+class AudioRingBuffer {
+public:
+	/**
+	 * @param capacity minimal capacity in bytes, rounded up to a power of two
+	 */
+	explicit AudioRingBuffer(size_t capacity);
+
+	/**
+	 * Changes the capacity and discards all data. Only allowed while no
+	 * other thread uses the buffer.
+	 *
+	 * @param capacity minimal capacity in bytes, rounded up to a power of two
+	 */
+	void Resize(size_t capacity);
+
+	/**
+	 * Appends data (producer).
+	 *
+	 * @param data data to append
+	 * @param size number of bytes
+	 * @return number of bytes appended
+	 */
+	size_t Write(const uint8_t* data, size_t size);
+
+	/**
+	 * Removes data (consumer).
+	 *
+	 * @param data receives the data
+	 * @param size maximal number of bytes
+	 * @return number of bytes removed
+	 */
+	size_t Read(uint8_t* data, size_t size);
+
+	/** @return number of bytes that can be read */
+	size_t GetAvailable() const;
+
+	/** @return number of bytes that can be written */
+	size_t GetFree() const;
+
+private:
+	std::vector<uint8_t> buffer;
+	size_t mask;
+	std::atomic<size_t> read_pos{0};
+	std::atomic<size_t> write_pos{0};
+};
+
+/**
+ * A BGM decoded ahead of playback by the AudioStreamWorker.
+ *
+ * The stream is created empty and the decoder is opened on the worker.
+ * Once the stream is ready the worker owns the decoding state of the
+ * decoder (Decode, SetPitch, looping), the audio thread only reads the
+ * ring buffer and uses the volume and fade functions of the decoder,
+ * which don't touch the decoding state.
+ */
+class AudioStream {
+public:
+	/**
+	 * @param buffer_ms how far ahead of playback the stream is decoded
+	 */
+	explicit AudioStream(int buffer_ms);
+
+	/**
+	 * Attaches the decoder and decodes the first samples, then marks the
+	 * stream as ready (worker thread).
+	 *
+	 * @param decoder opened decoder set to the output format, null when
+	 *                opening failed
+	 */
+	void Open(std::unique_ptr<AudioDecoder> decoder);
+
+	/** @return whether Open was called, all other functions need this */
+	bool IsReady() const;
+
+	/**
+	 * Reads decoded samples (audio thread).
+	 *
+	 * @param buffer receives the samples
+	 * @param size maximal number of bytes
+	 * @return number of bytes read, a multiple of the frame size
+	 */
+	int Read(uint8_t* buffer, int size);
+
+	/**
+	 * Decodes until the ring buffer is full (worker thread).
+	 *
+	 * @return whether anything was decoded
+	 */
+	bool Fill();
+
+	/**
+	 * Requests a pitch change, applied by the worker to the samples which
+	 * are not decoded yet (audio thread).
+	 *
+	 * @param pitch new pitch
+	 */
+	void SetPitch(int pitch);
+
+	/**
+	 * Requests continuing at a position, applied by the worker. Samples
+	 * decoded before the seek are skipped (game thread).
+	 *
+	 * @param ms position in milliseconds
+	 */
+	void Seek(int ms);
+
+	/** Marks the stream as unused, the worker drops it */
+	void Stop();
+
+	/** @return whether the stream was stopped */
+	bool IsStopped() const;
+
+	/** @return whether decoding failed and all decoded samples were read */
+	bool IsDone() const;
+
+	/** @return whether the playback reached the first loop point (audio thread) */
+	bool IsPlayedOnce() const;
+
+	/** @return ticks of the decoder at the playback position (audio thread) */
+	int GetTicks() const;
+
+	/** @return playback position in milliseconds, -1 if unknown (audio thread) */
+	int GetPosition() const;
+
+	/** Decoder, see the class description for the usable functions */
+	AudioDecoder& GetDecoder();
+
+	/** Format of the samples, valid once the stream is ready */
+	int frequency = 0;
+	AudioDecoder::Format format = AudioDecoder::Format::S16;
+	int channels = 0;
+
+private:
+	/** Decoder state after a decoded chunk, consumed when playback reaches it */
+	struct Mark {
+		uint64_t pos = 0;
+		int ticks = 0;
+		int position = -1;
+		bool looped = false;
+	};
+
+	std::unique_ptr<AudioDecoder> decoder;
+	AudioRingBuffer ring;
+	SpscQueue<Mark, 64> marks;
+	int buffer_ms = 0;
+	int frame_size = 1;
+
+	// Written by the worker
+	std::vector<uint8_t> chunk;
+	uint64_t written = 0;
+	/** Bytes before this position were decoded before a seek */
+	std::atomic<uint64_t> skip_until{0};
+	std::atomic<bool> failed{false};
+	std::atomic<bool> ready{false};
+
+	// Written by the audio thread
+	uint64_t read = 0;
+	Mark next_mark;
+	bool has_next_mark = false;
+	int ticks = 0;
+	int position = -1;
+	bool played_once = false;
+	std::atomic<int> pending_pitch{0};
+	std::atomic<int> pending_seek{-1};
+	std::atomic<bool> stopped{false};
+};
+
+/**
+ * Background threads keeping the ring buffers of all AudioStreams filled.
+ *
+ * Tasks like opening decoders run on a second thread, so a slow task never
+ * delays the fills of the playing streams. Tasks run in the order they were
+ * posted, urgent tasks before the others.
+ *
+ * Without threads (Emscripten) the tasks and fills run in Update.
+ */
+class AudioStreamWorker {
+public:
+	AudioStreamWorker();
+	~AudioStreamWorker();
+
+	/**
+	 * Adds a stream, it is filled once it is ready.
+	 *
+	 * @param stream stream to fill
+	 */
+	void Add(std::shared_ptr<AudioStream> stream);
+
+	/**
+	 * Runs a task on the task thread.
+	 *
+	 * @param task task to run
+	 * @param urgent run before the tasks which are not urgent, e.g. to
+	 *               start an SE without waiting for a BGM to open
+	 */
+	void Post(std::function<void()> task, bool urgent = false);
+
+	/**
+	 * Queues a warning from a task, Output is only used by the game thread.
+	 *
+	 * @param msg warning message
+	 */
+	void PostWarning(std::string msg);
+
+	/**
+	 * @return warnings queued since the last call (game thread)
+	 */
+	std::vector<std::string> TakeWarnings();
+
+	/**
+	 * Waits until all tasks posted before the call ran and all streams
+	 * were filled afterwards.
+	 */
+	void Sync();
+
+	/**
+	 * Runs the posted tasks and fills the streams on the calling thread
+	 * when the platform has no threads, does nothing otherwise (game thread).
+	 */
+	void Update();
+
+	/**
+	 * Discards the tasks which did not run yet and waits for the threads.
+	 * Nothing runs on the worker afterwards.
+	 */
+	void Stop();
+
+private:
+	void StartThreads();
+	void RunTasks();
+	void RunFills();
+	/**
+	 * Takes the next task, urgent tasks first.
+	 *
+	 * @return whether a task was taken
+	 */
+	bool TakeTask(std::function<void()>& task);
+	/** Fills all ready streams */
+	void Fill();
+
+	std::thread task_thread;
+	std::thread fill_thread;
+	std::mutex mutex;
+	std::condition_variable cv_tasks;
+	std::condition_variable cv_fills;
+	/** Signaled after every task and every run of the fills */
+	std::condition_variable cv_done;
+	uint64_t posted_tasks = 0;
+	uint64_t finished_tasks = 0;
+	uint64_t fill_iterations = 0;
+	int sync_requests = 0;
+	std::vector<std::shared_ptr<AudioStream>> streams;
+	std::deque<std::function<void()>> tasks;
+	std::deque<std::function<void()>> urgent_tasks;
+	std::vector<std::string> warnings;
+	bool quit = false;
+
+	// Only used by Fill
+	std::vector<std::shared_ptr<AudioStream>> filled_streams;
+};
+
+#endif
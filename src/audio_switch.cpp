@@ -95,6 +95,8 @@ NxAudio::NxAudio() :
 }
 
 NxAudio::~NxAudio() {
+	Stop();
+
 	// Closing streaming thread
 	termStream = true;
 	threadWaitForExit(&audio_thread);
@@ -20,6 +20,7 @@
 #  pragma warning(disable: 4003)
 #endif
 
+#include <cassert>
 #include <map>
 #include <tuple>
 
@@ -170,6 +171,24 @@ namespace {
 		{ "Frame", true, 320, 320, 240, 240, frame_dummy_func, true },
 	};
 
+	/** Flags used when loading images of a material */
+	uint32_t GetFlags(int material) {
+		return Bitmap::Flag_ReadOnly | (
+			material == Material::Chipset? Bitmap::Flag_Chipset:
+			material == Material::System? Bitmap::Flag_System:
+			0);
+	}
+
+	int FindMaterial(const std::string& folder_name) {
+		for (int i = 0; i < Material::END; ++i) {
+			if (folder_name == spec[i].directory) {
+				return i;
+			}
+		}
+		assert(false && "Invalid folder");
+		return Material::REND;
+	}
+
 	template<Material::Type T>
 	BitmapRef DrawCheckerboard() {
 		static_assert(Material::REND < T && T < Material::END, "Invalid material.");
@@ -223,10 +242,7 @@ namespace {
 			return BitmapRef();
 		}
 
-		BitmapRef ret = LoadBitmap(s.directory, f, transparent, Bitmap::Flag_ReadOnly | (
-										 T == Material::Chipset? Bitmap::Flag_Chipset:
-										 T == Material::System? Bitmap::Flag_System:
-										 0));
+		BitmapRef ret = LoadBitmap(s.directory, f, transparent, GetFlags(T));
 
 		if (!ret) {
 			Output::Warning("Image not found: %s/%s", s.directory, f.c_str());
@@ -342,6 +358,19 @@ BitmapRef Cache::Tile(const std::string& filename, int tile_id) {
 	} else { return it->second.lock(); }
 }
 
+BitmapRef Cache::Decode(const std::string& folder_name, const std::string& path) {
+	int material = FindMaterial(folder_name);
+
+	return Bitmap::Create(path, spec[material].transparent, GetFlags(material));
+}
+
+void Cache::Store(const std::string& folder_name, const std::string& filename, BitmapRef bitmap) {
+	int material = FindMaterial(folder_name);
+
+	KeyType const key(folder_name, filename, spec[material].transparent);
+	cache[key] = {bitmap, DisplayUi->GetTicks()};
+}
+
 void Cache::Clear() {
 	cache.clear();
 
@@ -52,6 +52,25 @@ namespace Cache {
 
 	void Clear();
 
+	/**
+	 * Decodes an image without adding it to the cache. Unlike the other
+	 * functions this can run on a worker thread.
+	 *
+	 * @param folder_name folder of the image, e.g. "System".
+	 * @param path path of the image found by FileFinder::FindImage.
+	 * @return the image, null when it is invalid.
+	 */
+	BitmapRef Decode(const std::string& folder_name, const std::string& path);
+
+	/**
+	 * Adds an image returned by Decode to the cache.
+	 *
+	 * @param folder_name folder of the image.
+	 * @param filename name of the image without extension.
+	 * @param bitmap the image.
+	 */
+	void Store(const std::string& folder_name, const std::string& filename, BitmapRef bitmap);
+
 	BitmapRef System();
 	void SetSystemName(std::string const& filename);
 }
@@ -20,24 +20,31 @@
 #ifdef WANT_FMMIDI
 
 // Headers
+#include <algorithm>
 #include <cstdio>
 #include <cassert>
+#include <cstring>
 #include "audio_decoder.h"
 #include "output.h"
+#include "player.h"
 #include "decoder_fmmidi.h"
 
 FmMidiDecoder::FmMidiDecoder() {
 	note_factory.reset(new midisynth::fm_note_factory());
 	synth.reset(new midisynth::synthesizer(note_factory.get()));
+	synth->set_max_polyphony(FMMIDI_MAX_POLYPHONY);
 	seq.reset(new midisequencer::sequencer());
 	
 	music_type = "midi";
+	cache_key.pitch = 100;
 	
 	load_programs();
 }
 
 FmMidiDecoder::~FmMidiDecoder() {
-	fclose(file);
+	if (file) {
+		fclose(file);
+	}
 }
 
 int read_func(void* instance) {
@@ -60,10 +67,41 @@ bool FmMidiDecoder::Open(FILE* file) {
 	fseek(file, old_pos, SEEK_SET);
 	size_t bytes_read = fread(file_buffer.data(), 1, file_buffer.size(), file);
 
-	if ((bytes_read != file_buffer.size()) || (!seq->load(this, read_func))) {
+	if (bytes_read != file_buffer.size() || !Load()) {
+		error_message = "FM Midi: Error reading file";
+		return false;
+	}
+
+#ifdef EMSCRIPTEN
+	// Rendering needs a thread, the flag is ignored
+	prerender = false;
+#else
+	prerender = Player::midi_prerender_flag;
+#endif
+	if (prerender) {
+		cache_key.hash = AudioMidiCache::Hash(file_buffer);
+	}
+
+	return true;
+}
+
+bool FmMidiDecoder::OpenMemory(std::vector<uint8_t> data) {
+	seq->clear();
+	file_buffer = std::move(data);
+	file_buffer_pos = 0;
+
+	if (!Load()) {
 		error_message = "FM Midi: Error reading file";
 		return false;
 	}
+
+	return true;
+}
+
+bool FmMidiDecoder::Load() {
+	if (!seq->load(this, read_func)) {
+		return false;
+	}
 	seq->rewind();
 
 	return true;
@@ -74,6 +112,8 @@ bool FmMidiDecoder::Seek(size_t offset, Origin origin) {
 		mtime = 0.0f;
 		seq->rewind();
 		begin = true;
+		track_pos = 0;
+		resync = false;
 
 		return true;
 	}
@@ -81,7 +121,39 @@ bool FmMidiDecoder::Seek(size_t offset, Origin origin) {
 	return false;
 }
 
+bool FmMidiDecoder::SeekTime(int ms) {
+	if (ms <= 0) {
+		return Seek(0, Origin::Begin);
+	}
+
+	float time = ms / 1000.0f;
+	if (time >= seq->get_total_time()) {
+		return false;
+	}
+
+	// Replays the controller and program changes up to the position
+	synth->all_sound_off_immediately();
+	seq->set_time(time, this);
+	mtime = time;
+	begin = false;
+	resync = false;
+
+	if (track) {
+		SyncTrackPosition();
+	}
+
+	return true;
+}
+
+int FmMidiDecoder::TellTime() const {
+	return (int)(mtime * 1000.0f);
+}
+
 bool FmMidiDecoder::IsFinished() const {
+	if (track) {
+		return track_pos >= track->frames;
+	}
+
 	return mtime >= seq->get_total_time();
 }
 
@@ -92,6 +164,10 @@ void FmMidiDecoder::GetFormat(int& freq, AudioDecoder::Format& format, int& chan
 }
 
 bool FmMidiDecoder::SetFormat(int freq, AudioDecoder::Format format, int channels) {
+	if (freq != frequency) {
+		// A rendering for the new frequency is needed
+		DropTrack();
+	}
 	frequency = freq;
 
 	if (channels != 2 || format != Format::S16) {
@@ -103,6 +179,10 @@ bool FmMidiDecoder::SetFormat(int freq, AudioDecoder::Format format, int channel
 
 bool FmMidiDecoder::SetPitch(int pitch) {
 	this->pitch = 100.0f / pitch;
+	if (pitch != cache_key.pitch) {
+		DropTrack();
+	}
+	cache_key.pitch = pitch;
 
 	return true;
 }
@@ -112,6 +192,27 @@ int FmMidiDecoder::GetTicks() const {
 }
 
 int FmMidiDecoder::FillBuffer(uint8_t* buffer, int length) {
+	if (prerender && !track) {
+		cache_key.frequency = frequency;
+		track = AudioMidiCache::Get(cache_key, file_buffer);
+		if (track) {
+			// Continue at the position the synthesizer reached
+			SyncTrackPosition();
+		}
+	}
+
+	if (track) {
+		return FillBufferFromTrack(buffer, length);
+	}
+
+	if (resync) {
+		// Otherwise all notes since the position where the track started
+		// would be played at once
+		synth->all_sound_off_immediately();
+		seq->set_time(mtime, this);
+		resync = false;
+	}
+
 	size_t samples = (size_t)length / sizeof(int_least16_t) / 2;
 
 	float delta = (float)samples / (frequency * pitch);
@@ -123,6 +224,9 @@ int FmMidiDecoder::FillBuffer(uint8_t* buffer, int length) {
 		seq->play(mtime, this);
 		notes = synthesize(reinterpret_cast<int_least16_t*>(buffer), samples, frequency);
 		mtime += delta;
+		if (begin && notes == 0) {
+			begin_time = mtime;
+		}
 	} while (begin && notes == 0 && !IsFinished());
 
 	begin = false;
@@ -130,6 +234,45 @@ int FmMidiDecoder::FillBuffer(uint8_t* buffer, int length) {
 	return length;
 }
 
+void FmMidiDecoder::SyncTrackPosition() {
+	float pos = std::max(mtime - begin_time, 0.0f) * frequency * pitch;
+	track_pos = std::min((int)pos, track->frames);
+	track_block = -1;
+}
+
+void FmMidiDecoder::DropTrack() {
+	if (track) {
+		track.reset();
+		resync = true;
+	}
+}
+
+int FmMidiDecoder::FillBufferFromTrack(uint8_t* buffer, int length) {
+	int16_t* output = reinterpret_cast<int16_t*>(buffer);
+	int frames = std::min(length / (int)sizeof(int16_t) / 2, track->frames - track_pos);
+
+	block_buffer.resize(AudioMidiCache::block_frames * 2);
+	for (int i = 0; i < frames; ) {
+		int block = track_pos / AudioMidiCache::block_frames;
+		if (block != track_block) {
+			track->DecodeBlock(block, block_buffer.data());
+			track_block = block;
+		}
+
+		int offset = track_pos % AudioMidiCache::block_frames;
+		int count = std::min(frames - i, AudioMidiCache::block_frames - offset);
+		memcpy(&output[i * 2], &block_buffer[offset * 2], count * 2 * sizeof(int16_t));
+		i += count;
+		track_pos += count;
+	}
+
+	// Position of the sequencer, it continues here when the track is dropped
+	mtime = begin_time + (float)track_pos / (frequency * pitch);
+	begin = false;
+
+	return frames * 2 * sizeof(int16_t);
+}
+
 int FmMidiDecoder::synthesize(int_least16_t * output, std::size_t samples, float rate) {
 	return synth->synthesize(output, samples, rate);
 }
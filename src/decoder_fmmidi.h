@@ -22,6 +22,7 @@
 #include <string>
 #include <memory>
 #include "audio_decoder.h"
+#include "audio_midicache.h"
 #include "midisequencer.h"
 #include "midisynth.h"
 
@@ -37,8 +38,21 @@ public:
 	// Audio Decoder interface
 	bool Open(FILE* file) override;
 
+	/**
+	 * Opens MIDI data from memory. Used for rendering tracks, the decoder
+	 * never streams from the AudioMidiCache.
+	 *
+	 * @param data MIDI file data
+	 * @return true on success
+	 */
+	bool OpenMemory(std::vector<uint8_t> data);
+
 	bool Seek(size_t offset, Origin origin) override;
 
+	bool SeekTime(int ms) override;
+
+	int TellTime() const override;
+
 	bool IsFinished() const override;
 
 	void GetFormat(int& frequency, AudioDecoder::Format& format, int& channels) const override;
@@ -53,12 +67,30 @@ public:
 	size_t file_buffer_pos = 0;
 private:
 	int FillBuffer(uint8_t* buffer, int length) override;
-
-	FILE* file;
+	bool Load();
+	int FillBufferFromTrack(uint8_t* buffer, int length);
+	/** Moves the track position to mtime */
+	void SyncTrackPosition();
+	/** Stops streaming from the track, the synthesizer continues at mtime */
+	void DropTrack();
+
+	FILE* file = nullptr;
 	float mtime = 0.0f;
 	float pitch = 1.0f;
 	int frequency = 44100;
 	bool begin = true;
+	/** mtime when the first notes were synthesized */
+	float begin_time = 0.0f;
+
+	// Pre-rendered track, replaces the synthesizer once available
+	bool prerender = false;
+	AudioMidiCache::Key cache_key = {};
+	std::shared_ptr<const AudioMidiCache::Track> track;
+	int track_pos = 0;
+	int track_block = -1;
+	std::vector<int16_t> block_buffer;
+	/** The sequencer is behind mtime because the track was played */
+	bool resync = false;
 
 	// midisequencer::output interface
 	int synthesize(int_least16_t* output, std::size_t samples, float rate);
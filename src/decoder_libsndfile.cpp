@@ -91,6 +91,19 @@ bool LibsndfileDecoder::Seek(size_t offset, Origin /* origin */) {
 	return sf_seek(soundfile,offset,SEEK_SET)!=-1;
 }
 
+bool LibsndfileDecoder::SeekTime(int ms) {
+	finished = false;
+	if(soundfile == 0)
+		return false;
+	return sf_seek(soundfile, (sf_count_t)ms * soundinfo.samplerate / 1000, SEEK_SET) != -1;
+}
+
+int LibsndfileDecoder::TellTime() const {
+	if(soundfile == 0)
+		return -1;
+	return (int)(sf_seek(soundfile, 0, SEEK_CUR) * 1000 / soundinfo.samplerate);
+}
+
 bool LibsndfileDecoder::IsFinished() const {
 	return finished;
 }
@@ -39,6 +39,10 @@ public:
 
 	bool Seek(size_t offset, Origin origin) override;
 
+	bool SeekTime(int ms) override;
+
+	int TellTime() const override;
+
 	bool IsFinished() const override;
 
 	void GetFormat(int& frequency, AudioDecoder::Format& format, int& channels) const override;
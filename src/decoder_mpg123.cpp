@@ -21,6 +21,9 @@
 
 // Headers
 #include <cassert>
+#include <map>
+#include <mutex>
+#include <vector>
 #include "decoder_mpg123.h"
 #include "output.h"
 
@@ -47,6 +50,47 @@ static void custom_close(void* io) {
 
 static void noop_close(void*) {}
 
+namespace {
+	/** Frame offsets collected by mpg123 while decoding and seeking */
+	struct FrameIndex {
+		off_t step = 0;
+		std::vector<off_t> offsets;
+		unsigned last_use = 0;
+	};
+
+	// Indexes of recently played files, restored when a file is opened
+	// again so seeking does not need to parse the frames in between.
+	const size_t index_cache_size = 32;
+	std::mutex index_mutex;
+	std::map<uint64_t, FrameIndex> index_cache;
+	unsigned index_uses = 0;
+
+	// Identifies a file by its size and the beginning of the data
+	uint64_t GetIndexKey(FILE* file) {
+		uint64_t hash = 14695981039346656037ULL;
+		auto add = [&hash](uint8_t byte) {
+			hash = (hash ^ byte) * 1099511628211ULL;
+		};
+
+		long pos = ftell(file);
+		fseek(file, 0, SEEK_END);
+		long size = ftell(file) - pos;
+		fseek(file, pos, SEEK_SET);
+		for (int i = 0; i < 8; ++i) {
+			add((uint8_t)(size >> (i * 8)));
+		}
+
+		uint8_t buffer[4096];
+		size_t read = fread(buffer, 1, sizeof(buffer), file);
+		fseek(file, pos, SEEK_SET);
+		for (size_t i = 0; i < read; ++i) {
+			add(buffer[i]);
+		}
+
+		return hash;
+	}
+}
+
 Mpg123Decoder::Mpg123Decoder() :
 	handle(nullptr, mpg123_delete)
 {
@@ -75,6 +119,34 @@ Mpg123Decoder::Mpg123Decoder() :
 }
 
 Mpg123Decoder::~Mpg123Decoder() {
+	if (!handle || index_key == 0) {
+		return;
+	}
+
+	off_t* offsets;
+	off_t step;
+	size_t fill;
+	if (mpg123_index(handle.get(), &offsets, &step, &fill) != MPG123_OK || fill == 0) {
+		return;
+	}
+
+	std::lock_guard<std::mutex> lock(index_mutex);
+	FrameIndex& index = index_cache[index_key];
+	if (fill > index.offsets.size()) {
+		index.step = step;
+		index.offsets.assign(offsets, offsets + fill);
+	}
+	index.last_use = ++index_uses;
+
+	if (index_cache.size() > index_cache_size) {
+		auto oldest = index_cache.begin();
+		for (auto it = index_cache.begin(); it != index_cache.end(); ++it) {
+			if (it->second.last_use < oldest->second.last_use) {
+				oldest = it;
+			}
+		}
+		index_cache.erase(oldest);
+	}
 }
 
 bool Mpg123Decoder::WasInited() const {
@@ -88,12 +160,24 @@ bool Mpg123Decoder::Open(FILE* file) {
 
 	finished = false;
 
+	index_key = GetIndexKey(file);
+
 	err = mpg123_open_handle(handle.get(), file);
 	if (err != MPG123_OK) {
 		error_message = "mpg123: " + std::string(mpg123_plain_strerror(err));
 		return false;
 	}
 
+	{
+		std::lock_guard<std::mutex> lock(index_mutex);
+		auto it = index_cache.find(index_key);
+		if (it != index_cache.end()) {
+			FrameIndex& index = it->second;
+			mpg123_set_index(handle.get(), index.offsets.data(), index.step, index.offsets.size());
+			index.last_use = ++index_uses;
+		}
+	}
+
 	// Samplerate cached, regularly needed for Ticks function
 	int ch;
 	int fmt;
@@ -109,6 +193,37 @@ bool Mpg123Decoder::Seek(size_t offset, Origin origin) {
 	return true;
 }
 
+bool Mpg123Decoder::SeekTime(int ms) {
+	long rate;
+	int ch;
+	int fmt;
+	if (mpg123_getformat(handle.get(), &rate, &ch, &fmt) != MPG123_OK) {
+		return false;
+	}
+
+	// Jumps to the nearest indexed frame, the index grows when seeking further
+	if (mpg123_seek(handle.get(), (off_t)((int64_t)ms * rate / 1000), SEEK_SET) < 0) {
+		return false;
+	}
+	finished = false;
+	return true;
+}
+
+int Mpg123Decoder::TellTime() const {
+	long rate;
+	int ch;
+	int fmt;
+	if (mpg123_getformat(handle.get(), &rate, &ch, &fmt) != MPG123_OK || rate == 0) {
+		return -1;
+	}
+
+	off_t pos = mpg123_tell(handle.get());
+	if (pos < 0) {
+		return -1;
+	}
+	return (int)((int64_t)pos * 1000 / rate);
+}
+
 bool Mpg123Decoder::IsFinished() const {
 	return finished;
 }
@@ -208,6 +323,8 @@ bool Mpg123Decoder::IsMp3(FILE* stream) {
 	if (!decoder.Open(stream)) {
 		return false;
 	}
+	// Detection only decodes a few frames, keep them out of the index cache
+	decoder.index_key = 0;
 
 	unsigned char buffer[1024];
 	int err = 0;
@@ -41,6 +41,10 @@ public:
 
 	bool Seek(size_t offset, Origin origin) override;
 
+	bool SeekTime(int ms) override;
+
+	int TellTime() const override;
+
 	bool IsFinished() const override;
 
 	void GetFormat(int& frequency, AudioDecoder::Format& format, int& channels) const override;
@@ -60,6 +64,8 @@ private:
 	bool finished = false;
 
 	long samplerate = 0;
+	/** Identifies the file in the frame index cache */
+	uint64_t index_key = 0;
 };
 
 #endif
@@ -86,6 +86,27 @@ bool OggVorbisDecoder::Seek(size_t offset, Origin origin) {
 	return false;
 }
 
+bool OggVorbisDecoder::SeekTime(int ms) {
+	if (!ovf) {
+		return false;
+	}
+
+	// Bisects over the granule positions of the pages, no decoding needed
+	if (ov_pcm_seek(ovf, (ogg_int64_t)ms * frequency / 1000) != 0) {
+		return false;
+	}
+	finished = false;
+	return true;
+}
+
+int OggVorbisDecoder::TellTime() const {
+	if (!ovf) {
+		return -1;
+	}
+
+	return (int)(ov_pcm_tell(ovf) * 1000 / frequency);
+}
+
 bool OggVorbisDecoder::IsFinished() const {
 	if (!ovf)
 		return false;
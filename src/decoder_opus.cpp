@@ -83,6 +83,28 @@ bool OpusDecoder::Seek(size_t offset, Origin origin) {
 	return false;
 }
 
+bool OpusDecoder::SeekTime(int ms) {
+	if (!oof) {
+		return false;
+	}
+
+	// Bisects over the granule positions of the pages, the position is
+	// always in samples at 48 kHz
+	if (op_pcm_seek(oof, (ogg_int64_t)ms * 48) != 0) {
+		return false;
+	}
+	finished = false;
+	return true;
+}
+
+int OpusDecoder::TellTime() const {
+	if (!oof) {
+		return -1;
+	}
+
+	return (int)(op_pcm_tell(oof) / 48);
+}
+
 bool OpusDecoder::IsFinished() const {
 	if (!oof)
 		return false;
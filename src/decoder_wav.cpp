@@ -111,6 +111,25 @@ bool WavDecoder::Seek(size_t offset, Origin origin) {
 	return success;
 }
 
+bool WavDecoder::SeekTime(int ms) {
+	size_t frame_size = GetSamplesizeForFormat(output_format) * nchannels;
+	size_t offset = (size_t)((int64_t)ms * samplerate / 1000) * frame_size;
+	if (offset > chunk_size) {
+		return false;
+	}
+
+	return Seek(offset, Origin::Begin);
+}
+
+int WavDecoder::TellTime() const {
+	if (file_ == NULL) {
+		return -1;
+	}
+
+	size_t frame_size = GetSamplesizeForFormat(output_format) * nchannels;
+	return (int)((int64_t)(cur_pos - audiobuf_offset) / frame_size * 1000 / samplerate);
+}
+
 bool WavDecoder::IsFinished() const {
 	return finished;
 }
@@ -309,6 +309,24 @@ bool WildMidiDecoder::Seek(size_t offset, Origin origin) {
 	return false;
 }
 
+bool WildMidiDecoder::SeekTime(int ms) {
+	if (!handle)
+		return false;
+
+	// Only processes the events up to the position, nothing is rendered
+	unsigned long int pos = (unsigned long int)((int64_t)ms * WILDMIDI_FREQ / 1000);
+	return WildMidi_FastSeek(handle, &pos) == 0;
+}
+
+int WildMidiDecoder::TellTime() const {
+	if (!handle)
+		return -1;
+
+	struct _WM_Info* midi_info = WildMidi_GetInfo(handle);
+
+	return (int)((int64_t)midi_info->current_sample * 1000 / WILDMIDI_FREQ);
+}
+
 bool WildMidiDecoder::IsFinished() const {
 	if (!handle)
 		return false;
@@ -80,10 +80,30 @@ bool XMPDecoder::Seek(size_t offset, Origin origin) {
 		return true;
 	}
 
-	// TODO: maybe use xmp_set_position(ctx, int pos) or xmp_seek_time(ctx, int time)
 	return false;
 }
 
+bool XMPDecoder::SeekTime(int ms) {
+	if (!ctx)
+		return false;
+
+	// Jumps to the pattern containing the position using the order list
+	if (xmp_seek_time(ctx, ms) < 0) {
+		return false;
+	}
+	finished = false;
+	return true;
+}
+
+int XMPDecoder::TellTime() const {
+	if (!ctx)
+		return -1;
+
+	xmp_frame_info info;
+	xmp_get_frame_info(ctx, &info);
+	return info.time;
+}
+
 bool XMPDecoder::IsFinished() const {
 	if (!ctx)
 		return false;
@@ -23,7 +23,10 @@
 #include <cstring>
 #include <algorithm>
 #include <fstream>
+#include <map>
+#include <mutex>
 #include <string>
+#include <unordered_set>
 #include <vector>
 #include <sstream>
 
@@ -42,6 +45,7 @@
 #else
 #  ifdef PSP2
 #    include <psp2/io/dirent.h>
+#    include <psp2/io/fcntl.h>
 #    include <psp2/io/stat.h>
 #    define S_ISDIR SCE_S_ISDIR
 #    define opendir sceIoDopen
@@ -97,6 +101,16 @@ namespace {
 	search_path_list search_paths;
 	std::string fonts_path;
 
+	/**
+	 * Searches that found nothing in the game and the RTP, cleared when the
+	 * directory trees change. { directory, name and extensions }
+	 */
+	std::unordered_set<std::string> missing_files;
+
+	/** Listings of RTP directories made before the engine was known */
+	std::map<std::string, std::shared_ptr<FileFinder::DirectoryTree> > rtp_prefetched;
+	std::mutex rtp_prefetched_mutex;
+
 	std::string FindFile(FileFinder::DirectoryTree const& tree,
 										  const std::string& dir,
 										  const std::string& name,
@@ -152,11 +166,12 @@ namespace {
 		string_map::const_iterator dir_it = tree.directories.find(corrected_dir);
 		if(dir_it == tree.directories.end()) { return ""; }
 
-		string_map const& dir_map = tree.sub_members.find(corrected_dir)->second;
+		string_map const* dir_map = GetSubMembers(tree, corrected_dir);
+		if (!dir_map) { return ""; }
 
 		for(char const** c = exts; *c != NULL; ++c) {
-			string_map::const_iterator const name_it = dir_map.find(corrected_name + *c);
-			if(name_it != dir_map.end()) {
+			string_map::const_iterator const name_it = dir_map->find(corrected_name + *c);
+			if(name_it != dir_map->end()) {
 				return MakePath
 					(std::string(tree.directory_path).append("/")
 					 .append(dir_it->second), name_it->second);
@@ -173,30 +188,30 @@ namespace {
 	}
 
 	const std::string translate_rtp(const std::string& dir, const std::string& name) {
-		RTP::rtp_table_type const& table =
-			Player::IsRPG2k() ? RTP::RTP_TABLE_2000 : RTP::RTP_TABLE_2003;
-
-		RTP::rtp_table_type::const_iterator dir_it = table.find(ReaderUtil::Normalize(dir).c_str());
+		std::string corrected_dir = ReaderUtil::Normalize(dir);
 		std::string corrected_name = ReaderUtil::Normalize(name);
 
-		if (dir_it == table.end()) { return name; }
-
-		std::map<const char*, const char*>::const_iterator file_it = dir_it->second.find(corrected_name.c_str());
-		if (file_it == dir_it->second.end()) {
-			if (is_not_ascii_filename(corrected_name)) {
-				// Linear Search: Japanese file name to English file name
-				for (const auto& entry : dir_it->second) {
-					if (!strcmp(entry.second, corrected_name.c_str())) {
-						return entry.first;
-					}
-				}
-			}
-			return name;
+		const char* translated = RTP::FindJapaneseName(Player::IsRPG2k(), corrected_dir, corrected_name);
+		if (!translated && is_not_ascii_filename(corrected_name)) {
+			// Japanese file name to English file name
+			translated = RTP::FindEnglishName(Player::IsRPG2k(), corrected_dir, corrected_name);
 		}
-		return file_it->second;
+
+		return translated ? translated : name;
 	}
 
 	std::string FindFile(const std::string &dir, const std::string& name, const char* exts[]) {
+#ifndef EMSCRIPTEN
+		// Not on emscripten, files appear when they were downloaded
+		std::string missing_key = dir + '\n' + name;
+		for (char const** c = exts; *c != NULL; ++c) {
+			missing_key.append("\n").append(*c);
+		}
+		if (missing_files.find(missing_key) != missing_files.end()) {
+			return std::string();
+		}
+#endif
+
 		const std::shared_ptr<FileFinder::DirectoryTree> tree = FileFinder::GetDirectoryTree();
 		std::string const ret = FindFile(*tree, dir, name, exts);
 		if (!ret.empty()) { return ret; }
@@ -216,6 +231,10 @@ namespace {
 		Output::Debug("Cannot find: %s/%s (%s)", dir.c_str(), name.c_str(),
 						name == rtp_name ? "!" : rtp_name.c_str());
 
+#ifndef EMSCRIPTEN
+		missing_files.insert(missing_key);
+#endif
+
 		return std::string();
 	}
 } // anonymous namespace
@@ -246,6 +265,7 @@ const std::shared_ptr<FileFinder::DirectoryTree> FileFinder::CreateSaveDirectory
 
 void FileFinder::SetDirectoryTree(std::shared_ptr<DirectoryTree> directory_tree) {
 	game_directory_tree = directory_tree;
+	missing_files.clear();
 }
 
 std::shared_ptr<FileFinder::DirectoryTree> FileFinder::CreateDirectoryTree(const std::string& p, bool recursive) {
@@ -261,14 +281,28 @@ std::shared_ptr<FileFinder::DirectoryTree> FileFinder::CreateDirectoryTree(const
 		tree->directories[i.first] = i.second;
 	}
 
-	if (recursive) {
-		for (auto& i : mem.directories) {
-			GetDirectoryMembers(MakePath(tree->directory_path, i.second), RECURSIVE).files.swap(tree->sub_members[i.first]);
-		}
-	}
+	// Most games only use a few RTP folders, they are listed on first use
+	tree->lazy = recursive;
+
 	return tree;
 }
 
+const FileFinder::string_map* FileFinder::GetSubMembers(const DirectoryTree& tree, const std::string& dir) {
+	sub_members_type::const_iterator it = tree.sub_members.find(dir);
+	if (it != tree.sub_members.end()) {
+		return &it->second;
+	}
+
+	string_map::const_iterator dir_it = tree.directories.find(dir);
+	if (!tree.lazy || dir_it == tree.directories.end()) {
+		return nullptr;
+	}
+
+	string_map& files = tree.sub_members[dir];
+	GetDirectoryMembers(MakePath(tree.directory_path, dir_it->second), RECURSIVE).files.swap(files);
+	return &files;
+}
+
 std::string FileFinder::MakePath(const std::string& dir, const std::string& name) {
 	std::string str = dir.empty()? name : dir + "/" + name;
 #ifdef _WIN32
@@ -420,57 +454,75 @@ std::string FileFinder::FindFont(const std::string& name) {
 
 static void add_rtp_path(const std::string& p) {
 	using namespace FileFinder;
-	std::shared_ptr<DirectoryTree> tree(CreateDirectoryTree(p));
+	std::shared_ptr<DirectoryTree> tree;
+	bool prefetched = false;
+
+	{
+		std::lock_guard<std::mutex> lock(rtp_prefetched_mutex);
+		auto it = rtp_prefetched.find(p);
+		if (it != rtp_prefetched.end()) {
+			tree = it->second;
+			prefetched = true;
+		}
+	}
+
+	if (!prefetched) {
+		tree = CreateDirectoryTree(p);
+	}
+
 	if(tree) {
 		Output::Debug("Adding %s to RTP path", p.c_str());
 		search_paths.push_back(tree);
 	}
 }
 
-static void read_rtp_registry(const std::string& company, const std::string& product, const std::string& key) {
+static void read_rtp_registry(std::vector<std::string>& paths, const std::string& company, const std::string& product, const std::string& key) {
 #if !(defined(GEKKO) || defined(__SWITCH__) || defined(__ANDROID__) || defined(EMSCRIPTEN) || defined(_3DS)) && !(defined(_WIN32) && defined(_ARM_))
 	std::string rtp_path = Registry::ReadStrValue(HKEY_CURRENT_USER, "Software\\" + company + "\\" + product, key, KEY32);
 	if (!rtp_path.empty()) {
-		add_rtp_path(rtp_path);
+		paths.push_back(rtp_path);
 	}
 
 	rtp_path = Registry::ReadStrValue(HKEY_LOCAL_MACHINE, "Software\\" + company + "\\" + product, key, KEY32);
 	if (!rtp_path.empty()) {
-		add_rtp_path(rtp_path);
+		paths.push_back(rtp_path);
 	}
 #else
-	(void)company; (void)product; (void)key;
+	(void)paths; (void)company; (void)product; (void)key;
 #endif
 }
 
-void FileFinder::InitRtpPaths(bool warn_no_rtp_found) {
-#ifdef EMSCRIPTEN
-	// No RTP support for emscripten at the moment.
-	return;
-#endif
-
-	RTP::Init();
+/**
+ * Gets the RTP directories of an engine in search order.
+ *
+ * @param engine engine flags, see Player::EngineType.
+ * @return paths of the directories, they do not need to exist.
+ */
+static std::vector<std::string> get_rtp_paths(int engine) {
+	std::vector<std::string> paths;
 
-	search_paths.clear();
+	bool is_2k = (engine & Player::EngineRpg2k) == Player::EngineRpg2k;
+	bool is_2k3 = (engine & Player::EngineRpg2k3) == Player::EngineRpg2k3;
+	bool is_english = (engine & Player::EngineEnglish) == Player::EngineEnglish;
 
 	std::string const version_str =
-		Player::IsRPG2k() ? "2000" :
-		Player::IsRPG2k3() ? "2003" :
+		is_2k ? "2000" :
+		is_2k3 ? "2003" :
 		"";
 
 	assert(!version_str.empty());
 
 #ifdef GEKKO
-	add_rtp_path("sd:/data/rtp/" + version_str + "/");
-	add_rtp_path("usb:/data/rtp/" + version_str + "/");
+	paths.push_back("sd:/data/rtp/" + version_str + "/");
+	paths.push_back("usb:/data/rtp/" + version_str + "/");
 #elif defined(__SWITCH__)
-	add_rtp_path("./rtp/" + version_str + "/");
-	add_rtp_path("/switch/easyrpg-player/rtp/" + version_str + "/");
+	paths.push_back("./rtp/" + version_str + "/");
+	paths.push_back("/switch/easyrpg-player/rtp/" + version_str + "/");
 #elif defined(_3DS)
-	add_rtp_path("romfs:/data/rtp/" + version_str + "/");
-	add_rtp_path("sdmc:/data/rtp/" + version_str + "/");
+	paths.push_back("romfs:/data/rtp/" + version_str + "/");
+	paths.push_back("sdmc:/data/rtp/" + version_str + "/");
 #elif defined(PSP2)
-	add_rtp_path("ux0:/data/easyrpg-player/rtp/" + version_str + "/");
+	paths.push_back("ux0:/data/easyrpg-player/rtp/" + version_str + "/");
 #elif defined(__ANDROID__)
 	// Invoke "String getRtpPath()" in EasyRPG Activity via JNI
 	JNIEnv* env = (JNIEnv*)SDL_AndroidGetJNIEnv();
@@ -486,34 +538,34 @@ void FileFinder::InitRtpPaths(bool warn_no_rtp_found) {
 	env->DeleteLocalRef(sdl_activity);
 	env->DeleteLocalRef(cls);
 
-	add_rtp_path(cs + "/" + version_str + "/");
+	paths.push_back(cs + "/" + version_str + "/");
 #else
 	// Windows/Wine
 	std::string const product = "RPG" + version_str;
-	if (Player::IsRPG2k()) {
+	if (is_2k) {
 		// Prefer original 2000 RTP over Kadokawa, because there is no
 		// reliable way to detect this engine and much more 2k games
 		// use the non-English version
-		read_rtp_registry("ASCII", product, "RuntimePackagePath");
-		read_rtp_registry("KADOKAWA", product, "RuntimePackagePath");
+		read_rtp_registry(paths, "ASCII", product, "RuntimePackagePath");
+		read_rtp_registry(paths, "KADOKAWA", product, "RuntimePackagePath");
 	}
-	else if (Player::IsRPG2k3Legacy()) {
+	else if (!is_english) {
 		// Original 2003 RTP installer registry key is upper case
 		// and Wine registry is case insensitive but new 2k3v1.10 installer is not
 		// Prefer Enterbrain RTP over Kadokawa for old RPG2k3 (search order)
-		read_rtp_registry("Enterbrain", product, "RUNTIMEPACKAGEPATH");
-		read_rtp_registry("KADOKAWA", product, "RuntimePackagePath");
+		read_rtp_registry(paths, "Enterbrain", product, "RUNTIMEPACKAGEPATH");
+		read_rtp_registry(paths, "KADOKAWA", product, "RuntimePackagePath");
 	}
-	else if (Player::IsRPG2k3E()) {
+	else {
 		// Prefer Kadokawa RTP over Enterbrain for new RPG2k3
-		read_rtp_registry("KADOKAWA", product, "RuntimePackagePath");
-		read_rtp_registry("Enterbrain", product, "RUNTIMEPACKAGEPATH");
+		read_rtp_registry(paths, "KADOKAWA", product, "RuntimePackagePath");
+		read_rtp_registry(paths, "Enterbrain", product, "RUNTIMEPACKAGEPATH");
 	}
 
 	// Our RTP is for all engines
-	read_rtp_registry("EasyRPG", "RTP", "path");
+	read_rtp_registry(paths, "EasyRPG", "RTP", "path");
 
-	add_rtp_path("/data/rtp/" + version_str + "/");
+	paths.push_back("/data/rtp/" + version_str + "/");
 #endif
 	std::vector<std::string> env_paths;
 
@@ -526,9 +578,9 @@ void FileFinder::InitRtpPaths(bool warn_no_rtp_found) {
 #endif
 	};
 
-	if (Player::IsRPG2k() && getenv("RPG2K_RTP_PATH"))
+	if (is_2k && getenv("RPG2K_RTP_PATH"))
 		env_paths = Utils::Tokenize(getenv("RPG2K_RTP_PATH"), f);
-	else if (Player::IsRPG2k3() && getenv("RPG2K3_RTP_PATH"))
+	else if (is_2k3 && getenv("RPG2K3_RTP_PATH"))
 		env_paths = Utils::Tokenize(getenv("RPG2K3_RTP_PATH"), f);
 
 	if (getenv("RPG_RTP_PATH")) {
@@ -536,10 +588,62 @@ void FileFinder::InitRtpPaths(bool warn_no_rtp_found) {
 		env_paths.insert(env_paths.end(), tmp.begin(), tmp.end());
 	}
 
-	for (const std::string p : env_paths) {
+	paths.insert(paths.end(), env_paths.begin(), env_paths.end());
+
+	return paths;
+}
+
+std::vector<std::string> FileFinder::GetRtpPathCandidates() {
+	std::vector<std::string> paths;
+
+#ifndef EMSCRIPTEN
+	// The registry order of 2k3 only depends on the English flag,
+	// the directories are the same
+	for (int engine : { Player::EngineRpg2k, Player::EngineRpg2k3 }) {
+		for (const std::string& p : get_rtp_paths(engine)) {
+			if (std::find(paths.begin(), paths.end(), p) == paths.end()) {
+				paths.push_back(p);
+			}
+		}
+	}
+#endif
+
+	return paths;
+}
+
+void FileFinder::PrefetchRtpPath(const std::string& path) {
+	std::shared_ptr<DirectoryTree> tree = CreateDirectoryTree(path);
+	if (tree) {
+		// Not on the main thread, listing all folders now is cheaper than
+		// listing them on first use
+		for (auto& dir : tree->directories) {
+			GetSubMembers(*tree, dir.first);
+		}
+	}
+
+	std::lock_guard<std::mutex> lock(rtp_prefetched_mutex);
+	rtp_prefetched[path] = tree;
+}
+
+void FileFinder::InitRtpPaths(bool warn_no_rtp_found) {
+#ifdef EMSCRIPTEN
+	// No RTP support for emscripten at the moment.
+	return;
+#endif
+
+	search_paths.clear();
+	missing_files.clear();
+
+	for (const std::string& p : get_rtp_paths(Player::engine)) {
 		add_rtp_path(p);
 	}
 
+	// Listings of the other engine are not needed anymore
+	{
+		std::lock_guard<std::mutex> lock(rtp_prefetched_mutex);
+		rtp_prefetched.clear();
+	}
+
 	if (warn_no_rtp_found && search_paths.empty()) {
 		Output::Warning("RTP not found. This may create missing file errors. "
 			"Install RTP files or check they are installed fine. "
@@ -551,6 +655,7 @@ void FileFinder::InitRtpPaths(bool warn_no_rtp_found) {
 void FileFinder::Quit() {
 	search_paths.clear();
 	game_directory_tree.reset();
+	missing_files.clear();
 }
 
 FILE* FileFinder::fopenUTF8(const std::string& name_utf8, char const* mode) {
@@ -691,6 +796,19 @@ bool FileFinder::Exists(const std::string& filename) {
 #endif
 }
 
+bool FileFinder::Rename(const std::string& from, const std::string& to) {
+#ifdef _WIN32
+	return ::MoveFileExW(Utils::ToWideString(from).c_str(), Utils::ToWideString(to).c_str(),
+		MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH) != 0;
+#elif defined(PSP2)
+	// Fails when the target exists
+	sceIoRemove(to.c_str());
+	return sceIoRename(from.c_str(), to.c_str()) >= 0;
+#else
+	return std::rename(from.c_str(), to.c_str()) == 0;
+#endif
+}
+
 bool FileFinder::IsDirectory(const std::string& dir) {
 #if (defined(GEKKO) || defined(_3DS) || defined(__SWITCH__))
 	struct stat sb;
@@ -832,6 +950,21 @@ Offset FileFinder::GetFileSize(const std::string& file) {
 	return (result == 0) ? sb.st_size : -1;
 }
 
+int64_t FileFinder::GetFileModifiedTime(const std::string& file) {
+	StatBuf sb;
+	int result = GetStat(file.c_str(), &sb);
+	if (result != 0) {
+		return -1;
+	}
+
+#ifdef PSP2
+	const SceDateTime& t = sb.st_mtime;
+	return ((((((int64_t)t.year * 12 + t.month) * 31 + t.day) * 24 + t.hour) * 60 + t.minute) * 60 + t.second) * 1000000 + t.microsecond;
+#else
+	return (int64_t)sb.st_mtime;
+#endif
+}
+
 bool FileFinder::IsMajorUpdatedTree() {
 	Offset size;
 
@@ -852,12 +985,14 @@ bool FileFinder::IsMajorUpdatedTree() {
 		const std::shared_ptr<DirectoryTree> tree = GetDirectoryTree();
 		string_map::const_iterator const music_it = tree->directories.find("music");
 		if (music_it != tree->directories.end()) {
-			string_map mem = tree->sub_members["music"];
-			for (auto& i : mem) {
-				std::string file = mem[i.first];
-				if (Utils::EndsWith(Utils::LowerCase(file), ".mp3")) {
-					Output::Debug("MP3 file (%s) found", file.c_str());
-					return true;
+			const string_map* mem = GetSubMembers(*tree, "music");
+			if (mem) {
+				for (auto& i : *mem) {
+					const std::string& file = i.second;
+					if (Utils::EndsWith(Utils::LowerCase(file), ".mp3")) {
+						Output::Debug("MP3 file (%s) found", file.c_str());
+						return true;
+					}
 				}
 			}
 		}
@@ -22,6 +22,7 @@
 #include "system.h"
 
 #include <string>
+#include <cstdint>
 #include <cstdio>
 #include <ios>
 #include <unordered_map>
@@ -46,6 +47,22 @@ namespace FileFinder {
 	 */
 	void InitRtpPaths(bool warn_no_rtp_found = true);
 
+	/**
+	 * Gets the RTP directories of all engines. Used to list the RTP while
+	 * the database is read, before the engine is known.
+	 *
+	 * @return paths of the directories, they do not need to exist.
+	 */
+	std::vector<std::string> GetRtpPathCandidates();
+
+	/**
+	 * Lists an RTP directory and its subdirectories for the next
+	 * InitRtpPaths call. Can be called from worker threads.
+	 *
+	 * @param path directory returned by GetRtpPathCandidates.
+	 */
+	void PrefetchRtpPath(const std::string& path);
+
 	/**
 	 * Quits FileFinder.
 	 */
@@ -64,9 +81,24 @@ namespace FileFinder {
 	struct DirectoryTree {
 		std::string directory_path;
 		string_map files, directories;
-		sub_members_type sub_members;
+		/**
+		 * Files of the subdirectories, use GetSubMembers to access them.
+		 * Subdirectories of a lazy tree are listed on first use.
+		 */
+		mutable sub_members_type sub_members;
+		bool lazy = false;
 	}; // struct DirectoryTree
 
+	/**
+	 * Gets the files of a subdirectory of a tree. A subdirectory of a lazy
+	 * tree is listed when it is accessed the first time.
+	 *
+	 * @param tree tree containing the subdirectory.
+	 * @param dir case lowered name of the subdirectory.
+	 * @return files of the subdirectory, null when it does not exist.
+	 */
+	const string_map* GetSubMembers(const DirectoryTree& tree, const std::string& dir);
+
 	/**
 	 * Finds an image file.
 	 * Searches through the current RPG Maker game and the RTP directories.
@@ -186,6 +218,15 @@ namespace FileFinder {
 	 */
 	bool Exists(const std::string& file);
 
+	/**
+	 * Renames a file, an existing file with the new name is replaced.
+	 *
+	 * @param from file to rename.
+	 * @param to new name of the file.
+	 * @return true on success, otherwise false.
+	 */
+	bool Rename(const std::string& from, const std::string& to);
+
 	/**
 	 * Appends name to directory.
 	 *
@@ -268,6 +309,15 @@ namespace FileFinder {
 	 */
 	const std::shared_ptr<DirectoryTree> GetDirectoryTree();
 	const std::shared_ptr<DirectoryTree> CreateSaveDirectoryTree();
+
+	/**
+	 * Lists a directory.
+	 *
+	 * @param p path of the directory.
+	 * @param recursive whether the files of the subdirectories are needed,
+	 *                  they are listed on first use (lazy tree).
+	 * @return directory tree, null when the directory does not exist.
+	 */
 	std::shared_ptr<DirectoryTree> CreateDirectoryTree(std::string const& p, bool recursive = true);
 
 	bool IsValidProject(DirectoryTree const& dir);
@@ -289,6 +339,14 @@ namespace FileFinder {
 	 */
 	Offset GetFileSize(const std::string& file);
 
+	/** Get the last modification time of a file
+	 *
+	 * @param file the path to a file
+	 * @return the modification time (only comparable to other results of
+	 *         this function), or -1 on error
+	 */
+	int64_t GetFileModifiedTime(const std::string& file);
+
 	/**
 	 * Known file sizes
 	 */
@@ -361,6 +361,7 @@ bool Game_Battle::UpdateEvents() {
 	for (const auto& page : troop->pages) {
 		if (page_can_run[page.ID - 1]) {
 			interpreter->Setup(page.event_commands, 0);
+			interpreter->SetProfileSource(InterpreterProfiler::Source_BattleEvent, troop->ID);
 			page_can_run[page.ID - 1] = false;
 			return false;
 		}
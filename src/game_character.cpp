@@ -19,6 +19,7 @@
 #include "audio.h"
 #include "game_character.h"
 #include "game_map.h"
+#include "game_pathing.h"
 #include "game_player.h"
 #include "game_switches.h"
 #include "game_system.h"
@@ -492,6 +493,15 @@ void Game_Character::MoveTowardsPlayer() {
 	int sx = DistanceXfromPlayer();
 	int sy = DistanceYfromPlayer();
 
+	if (Player::chase_pathfinding_flag) {
+		int dirs[4];
+		int count = Game_Pathing::GetDirectionsTowardsPlayer(GetX(), GetY(), dirs);
+		if (count >= 0) {
+			MoveAlongPath(dirs, count);
+			return;
+		}
+	}
+
 	// Try in the same direction of the last failed move
 	if (last_move_failed) {
 		MoveForward();
@@ -517,6 +527,15 @@ void Game_Character::MoveAwayFromPlayer() {
 	int sx = DistanceXfromPlayer();
 	int sy = DistanceYfromPlayer();
 
+	if (Player::chase_pathfinding_flag) {
+		int dirs[4];
+		int count = Game_Pathing::GetDirectionsAwayFromPlayer(GetX(), GetY(), dirs);
+		if (count >= 0) {
+			MoveAlongPath(dirs, count);
+			return;
+		}
+	}
+
 	if (sx != 0 || sy != 0) {
 		if ( std::abs(sx) > std::abs(sy) ) {
 			Move((sx > 0) ? Right : Left);
@@ -530,6 +549,20 @@ void Game_Character::MoveAwayFromPlayer() {
 	}
 }
 
+void Game_Character::MoveAlongPath(const int (&dirs)[4], int count) {
+	if (count == 0) {
+		// No path, the RPG_RT movement would only bump into walls
+		move_failed = true;
+		return;
+	}
+
+	// Face the preferred step even when an event blocks it
+	Move(dirs[0]);
+	for (int i = 1; i < count && move_failed && !IsJumping(); ++i) {
+		Move(dirs[i], MoveOption::IgnoreIfCantMove);
+	}
+}
+
 void Game_Character::Turn(int dir) {
 	SetDirection(dir);
 	SetSpriteDirection(dir);
@@ -829,6 +829,14 @@ protected:
 
 protected:
 	bool MakeWayDiagonal(int x, int y, int d) const;
+
+	/**
+	 * Tries the steps of Game_Pathing in order until one succeeds.
+	 *
+	 * @param dirs directions, the preferred one first
+	 * @param count number of directions, 0 fails the move
+	 */
+	void MoveAlongPath(const int (&dirs)[4], int count);
 	virtual void UpdateSelfMovement();
 	void UpdateJump();
 
@@ -28,9 +28,13 @@ Game_CommonEvent::Game_CommonEvent(int common_event_id) :
 }
 
 void Game_CommonEvent::SetSaveData(const RPG::SaveEventData& data) {
+	Game_Map::GetInterpreterScheduler().Wake(*this);
+
 	if (!data.commands.empty()) {
 		interpreter.reset(new Game_Interpreter_Map());
 		interpreter->SetupFromSave(data.commands);
+		// The savegame only knows map events
+		interpreter->SetProfileSource(InterpreterProfiler::Source_CommonEvent, common_event_id);
 	}
 
 	Refresh();
@@ -44,6 +48,8 @@ void Game_CommonEvent::Refresh() {
 			}
 			parallel_running = true;
 		} else {
+			// The remaining wait is kept while suspended
+			Game_Map::GetInterpreterScheduler().Wake(*this);
 			parallel_running = false;
 		}
 	}
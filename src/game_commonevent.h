@@ -104,6 +104,8 @@ public:
 	RPG::SaveEventData GetSaveData();
 
 private:
+	friend class Game_InterpreterScheduler;
+
 	int common_event_id;
 	/**
 	 * If parallel interpreter is running (true) or suspended (false).
@@ -113,6 +115,9 @@ private:
 
 	/** Interpreter for parallel common events. */
 	std::unique_ptr<Game_Interpreter_Map> interpreter;
+
+	/** Scheduler tick at which a sleeping interpreter wakes up, -1 when awake */
+	int sleep_until = -1;
 };
 
 #endif
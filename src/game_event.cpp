@@ -97,6 +97,13 @@ void Game_Event::ClearStarting() {
 	started_by_decision_key = false;
 }
 
+void Game_Event::SetTrigger(int new_trigger) {
+	if (trigger != new_trigger) {
+		Game_Map::UpdateEventTrigger(this, trigger, new_trigger);
+		trigger = new_trigger;
+	}
+}
+
 void Game_Event::Setup(const RPG::EventPage* new_page) {
 	bool from_null = page == nullptr;
 
@@ -118,7 +125,7 @@ void Game_Event::Setup(const RPG::EventPage* new_page) {
 		SetSpriteIndex(0);
 		SetDirection(RPG::EventPage::Direction_down);
 		//move_type = 0;
-		trigger = -1;
+		SetTrigger(-1);
 		list.clear();
 		return;
 	}
@@ -153,7 +160,7 @@ void Game_Event::Setup(const RPG::EventPage* new_page) {
 	SetTransparency(page->translucent ? 3 : 0);
 	SetLayer(page->layer);
 	data()->overlap_forbidden = page->overlap_forbidden;
-	trigger = page->trigger;
+	SetTrigger(page->trigger);
 	list = page->event_commands;
 
 	if (trigger == RPG::EventPage::Trigger_parallel) {
@@ -165,7 +172,7 @@ void Game_Event::SetupFromSave(const RPG::EventPage* new_page) {
 	page = new_page;
 
 	if (page == nullptr) {
-		trigger = -1;
+		SetTrigger(-1);
 		list.clear();
 		interpreter.reset();
 		return;
@@ -173,7 +180,7 @@ void Game_Event::SetupFromSave(const RPG::EventPage* new_page) {
 
 	move_type = page->move_type;
 	original_move_route = page->move_route;
-	trigger = page->trigger;
+	SetTrigger(page->trigger);
 	list = page->event_commands;
 
 	// Trigger parallel events when the interpreter wasn't already running
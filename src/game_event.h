@@ -165,6 +165,13 @@ protected:
 private:
 	void UpdateSelfMovement() override;
 
+	/**
+	 * Changes the trigger and updates the trigger index of the map.
+	 *
+	 * @param new_trigger trigger of the new page, -1 if none
+	 */
+	void SetTrigger(int new_trigger);
+
 	/**
 	 * Moves on a random route.
 	 */
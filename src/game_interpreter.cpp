@@ -74,6 +74,9 @@ Game_Interpreter::Game_Interpreter(int _depth, bool _main_flag) {
 }
 
 Game_Interpreter::~Game_Interpreter() {
+	if (transition_owner == this) {
+		transition_owner = nullptr;
+	}
 }
 
 // Clear.
@@ -117,6 +120,8 @@ void Game_Interpreter::Setup(
 
 	triggered_by_decision_key = started_by_decision_key;
 
+	SetProfileSource(event_id > 0 ? InterpreterProfiler::Source_MapEvent : InterpreterProfiler::Source_Unknown, event_id);
+
 	index = 0;
 
 	CancelMenuCall();
@@ -138,12 +143,19 @@ void Game_Interpreter::SetupWait(int duration) {
 	}
 }
 
+void Game_Interpreter::SetProfileSource(InterpreterProfiler::SourceType type, int id) {
+	profile_type = type;
+	profile_id = id;
+}
+
 void Game_Interpreter::SetContinuation(Game_Interpreter::ContinuationFunction func) {
 	continuation = func;
 }
 
 // Update
 void Game_Interpreter::Update() {
+	InterpreterProfiler::UpdateScope profile_scope(profile_type, profile_id, depth);
+
 	updating = true;
 	// 10000 based on: https://gist.github.com/4406621
 	for (loop_count = 0; loop_count < 10000; ++loop_count) {
@@ -232,7 +244,16 @@ void Game_Interpreter::Update() {
 			break;
 		}
 
-		if (!ExecuteCommand()) {
+		bool result;
+		if (InterpreterProfiler::IsEnabled()) {
+			InterpreterProfiler::BeginCommand(index < list.size() ? list[index].code : static_cast<int>(Cmd::END));
+			result = ExecuteCommand();
+			InterpreterProfiler::EndCommand();
+		} else {
+			result = ExecuteCommand();
+		}
+
+		if (!result) {
 			break;
 		}
 
@@ -252,11 +273,40 @@ void Game_Interpreter::Update() {
 	if (loop_count > 9999) {
 		// Executed Events Count exceeded (10000)
 		Output::Debug("Event %d exceeded execution limit", event_id);
+		profile_scope.SetLimitHit();
 	}
 
 	updating = false;
 }
 
+bool Game_Interpreter::IsWaitingForTime() const {
+	if (!IsRunning()) {
+		return false;
+	}
+
+	if (child_interpreter) {
+		return child_interpreter->IsWaitingForTime();
+	}
+
+	if (main_flag) {
+		if (Game_Message::message_waiting) {
+			return false;
+		}
+	} else if ((Game_Message::visible || Game_Message::message_waiting) && wait_messages) {
+		return false;
+	}
+
+	if (Game_Temp::transition_processing || (transition_owner && transition_owner != this)) {
+		return false;
+	}
+
+	return wait_count > 0;
+}
+
+bool Game_Interpreter::HasTransitionOwner() {
+	return transition_owner != nullptr;
+}
+
 // Setup Starting Event
 void Game_Interpreter::Setup(Game_Event* ev) {
 	Setup(ev->GetList(), ev->GetId(), ev->WasStartedByDecisionKey());
@@ -269,6 +319,7 @@ void Game_Interpreter::Setup(Game_Event* ev) {
 void Game_Interpreter::Setup(Game_CommonEvent* ev, int caller_id) {
 	Setup(ev->GetList(), caller_id, false);
 	event_info.x = ev->GetIndex();
+	SetProfileSource(InterpreterProfiler::Source_CommonEvent, ev->GetIndex());
 }
 
 void Game_Interpreter::CheckGameOver() {
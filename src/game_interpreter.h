@@ -27,9 +27,11 @@
 #include "rpg_eventcommand.h"
 #include "system.h"
 #include "command_codes.h"
+#include "interpreter_profiler.h"
 
 class Game_Event;
 class Game_CommonEvent;
+class Game_InterpreterScheduler;
 
 namespace RPG {
 	class EventPage;
@@ -62,11 +64,35 @@ public:
 	void Setup(Game_Event* ev);
 	void Setup(Game_CommonEvent* ev, int caller_id);
 
+	/**
+	 * Sets the origin of the running commands reported to the profiler.
+	 * Setup assigns this automatically for map and common events.
+	 *
+	 * @param type source type
+	 * @param id source id
+	 */
+	void SetProfileSource(InterpreterProfiler::SourceType type, int id);
+
 	void InputButton();
 	void SetupChoices(const std::vector<std::string>& choices);
 
 	virtual bool ExecuteCommand();
 
+	/**
+	 * Determines whether the interpreter (or its innermost called event)
+	 * is only blocked by a timed Wait. Uses the same precedence as Update,
+	 * so messages and transitions take priority over the wait.
+	 *
+	 * @return true when only the wait_count blocks further commands
+	 */
+	bool IsWaitingForTime() const;
+
+	/**
+	 * @return true when an Erase/Show Screen transition blocks all
+	 * interpreters except the one which started it
+	 */
+	static bool HasTransitionOwner();
+
 	/**
 	 * @return true if an immediate call is requested
 	 */
@@ -104,6 +130,7 @@ public:
 
 protected:
 	friend class Game_Interpreter_Map;
+	friend class Game_InterpreterScheduler;
 
 	int depth;
 	bool main_flag;
@@ -129,6 +156,10 @@ protected:
 
 	bool triggered_by_decision_key = false;
 
+	/** Origin of the running commands, used by the profiler */
+	InterpreterProfiler::SourceType profile_type = InterpreterProfiler::Source_Unknown;
+	int profile_id = 0;
+
 	/**
 	 * Gets strings for choice selection.
 	 * This is just a helper (private) method
@@ -59,6 +59,7 @@ bool Game_Interpreter_Map::SetupFromSave(const std::vector<RPG::SaveEventCommand
 			// When 0 the event is from a different map
 			map_id = Game_Map::GetMapId();
 		}
+		SetProfileSource(event_id > 0 ? InterpreterProfiler::Source_MapEvent : InterpreterProfiler::Source_Unknown, event_id);
 		list = save[_index].commands;
 		index = save[_index].current_command;
 		triggered_by_decision_key = save[_index].actioned;
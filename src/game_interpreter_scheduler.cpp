@@ -0,0 +1,122 @@
+/*
+ * This file is part of EasyRPG Player.
+ *
+ * EasyRPG Player is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * EasyRPG Player is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with EasyRPG Player. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Headers
+#include <algorithm>
+#include "game_interpreter_scheduler.h"
+#include "game_commonevent.h"
+#include "game_interpreter_map.h"
+#include "game_message.h"
+#include "game_temp.h"
+
+void Game_InterpreterScheduler::Reset() {
+	tick = 0;
+	sleeping_count = 0;
+	current = nullptr;
+	quiet = false;
+}
+
+bool Game_InterpreterScheduler::IsQuiet() {
+	return !Game_Temp::transition_processing &&
+		!Game_Interpreter::HasTransitionOwner() &&
+		!Game_Message::visible &&
+		!Game_Message::message_waiting;
+}
+
+void Game_InterpreterScheduler::Update(std::vector<Game_CommonEvent>& common_events) {
+	quiet = IsQuiet();
+
+	if (quiet) {
+		++tick;
+	} else if (sleeping_count > 0) {
+		WakeAll(common_events);
+	}
+
+	for (Game_CommonEvent& ev : common_events) {
+		current = &ev;
+
+		if (ev.sleep_until >= 0) {
+			if (ev.sleep_until > tick) {
+				// Still sleeping, the wait advanced by one
+				continue;
+			}
+
+			// Wait is over, run the command after it
+			ev.sleep_until = -1;
+			--sleeping_count;
+			ev.interpreter->wait_count = 0;
+		}
+
+		ev.UpdateParallel();
+
+		if (!quiet) {
+			continue;
+		}
+
+		if (!IsQuiet()) {
+			// A message or transition started: Interpreters after this one
+			// don't advance their wait anymore in this update.
+			quiet = false;
+			WakeAll(common_events);
+			continue;
+		}
+
+		TrySleep(ev);
+	}
+
+	current = nullptr;
+}
+
+void Game_InterpreterScheduler::Wake(Game_CommonEvent& ev) {
+	if (ev.sleep_until < 0) {
+		return;
+	}
+
+	// Number of ticks in which the wait of the interpreter advanced.
+	// Events after the one being updated did not advance in this tick yet.
+	int advanced = tick;
+	if (current && &ev > current) {
+		--advanced;
+	}
+
+	ev.interpreter->wait_count = std::max(ev.sleep_until - 1 - advanced, 0);
+	ev.sleep_until = -1;
+	--sleeping_count;
+}
+
+void Game_InterpreterScheduler::WakeAll(std::vector<Game_CommonEvent>& common_events) {
+	for (Game_CommonEvent& ev : common_events) {
+		Wake(ev);
+	}
+}
+
+void Game_InterpreterScheduler::TrySleep(Game_CommonEvent& ev) {
+	if (!ev.parallel_running || !ev.interpreter) {
+		return;
+	}
+
+	const Game_Interpreter& interpreter = *ev.interpreter;
+
+	if (interpreter.child_interpreter || !interpreter.IsWaitingForTime()) {
+		return;
+	}
+
+	// The wait advances in the next wait_count updates, the update after
+	// them executes the next command.
+	ev.sleep_until = tick + interpreter.wait_count + 1;
+	++sleeping_count;
+}
@@ -0,0 +1,79 @@
+/*
+ * This file is part of EasyRPG Player.
+ *
+ * EasyRPG Player is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * EasyRPG Player is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with EasyRPG Player. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef EP_GAME_INTERPRETER_SCHEDULER_H
+#define EP_GAME_INTERPRETER_SCHEDULER_H
+
+// Headers
+#include <vector>
+
+class Game_CommonEvent;
+
+/**
+ * Updates the parallel common events and puts interpreters which are only
+ * counting down a timed Wait to sleep until the wait is over.
+ *
+ * A sleeping interpreter is skipped completely. This is only done in
+ * "quiet" updates (no message and no screen transition) because in these
+ * the wait of every interpreter is guaranteed to advance by exactly one
+ * per update. When an update stops being quiet all sleeping interpreters
+ * get their remaining wait restored and run through the normal
+ * Game_Interpreter::Update path again, so the behaviour is identical to
+ * updating them every frame.
+ */
+class Game_InterpreterScheduler {
+public:
+	/**
+	 * Wakes all interpreters and forgets the sleep state.
+	 * Must be called when the common events are recreated.
+	 */
+	void Reset();
+
+	/**
+	 * Runs UpdateParallel of all common events, skipping sleeping ones.
+	 *
+	 * @param common_events common events of the map
+	 */
+	void Update(std::vector<Game_CommonEvent>& common_events);
+
+	/**
+	 * Wakes a sleeping common event and restores the remaining wait of
+	 * its interpreter. Does nothing when the event is not sleeping.
+	 *
+	 * @param ev common event
+	 */
+	void Wake(Game_CommonEvent& ev);
+
+private:
+	/**
+	 * @return whether the wait of every interpreter advances in this update
+	 */
+	static bool IsQuiet();
+
+	void WakeAll(std::vector<Game_CommonEvent>& common_events);
+	void TrySleep(Game_CommonEvent& ev);
+
+	/** Number of quiet updates */
+	int tick = 0;
+	/** Whether the running update is quiet */
+	bool quiet = false;
+	/** Event being updated, nullptr outside of Update */
+	const Game_CommonEvent* current = nullptr;
+	int sleeping_count = 0;
+};
+
+#endif
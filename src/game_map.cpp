@@ -21,19 +21,24 @@
 #include <sstream>
 #include <algorithm>
 #include <climits>
+#include <functional>
 
 #include "async_handler.h"
 #include "system.h"
 #include "battle_animation.h"
+#include "command_codes.h"
 #include "game_battle.h"
 #include "game_battler.h"
 #include "game_map.h"
 #include "game_interpreter_map.h"
+#include "game_interpreter_scheduler.h"
+#include "game_pathing.h"
 #include "game_switches.h"
 #include "game_temp.h"
 #include "game_player.h"
 #include "lmu_reader.h"
 #include "reader_lcf.h"
+#include "map_cache.h"
 #include "map_data.h"
 #include "main_data.h"
 #include "output.h"
@@ -62,10 +67,51 @@ namespace {
 
 	std::vector<unsigned char> passages_down;
 	std::vector<unsigned char> passages_up;
+
+	/**
+	 * Attributes of a tile cached in the collision grid.
+	 * Bits 0-3 of the flags are the Passable direction bits of IsPassableTile.
+	 */
+	enum CollisionFlag {
+		Collision_Landable = 0x10,
+		Collision_UpperAbove = 0x20,
+		Collision_Counter = 0x40,
+		Collision_ValidTerrain = 0x80,
+		Collision_BoatPass = 0x100,
+		Collision_ShipPass = 0x200,
+		Collision_AirshipPass = 0x400
+	};
+
+	struct CollisionTile {
+		uint16_t flags;
+		int16_t terrain_id;
+		int16_t bush_depth;
+	};
+
+	/** Decoded tile attributes of the map, rebuilt lazily when dirty */
+	std::vector<CollisionTile> collision;
+	bool collision_dirty = true;
+
 	std::vector<Game_Event> events;
 	std::vector<Game_CommonEvent> common_events;
 
-	std::unique_ptr<RPG::Map> map;
+	/**
+	 * Events by the trigger of their page, sorted by address which is the
+	 * order of the events vector.
+	 */
+	constexpr int trigger_count = RPG::EventPage::Trigger_parallel + 1;
+	std::vector<Game_Event*> trigger_events[trigger_count];
+	Game_InterpreterScheduler interpreter_scheduler;
+
+	std::shared_ptr<const RPG::Map> map;
+
+	// Number of maps behind the closest transfers parsed in advance
+	constexpr size_t preload_transfer_count = 2;
+
+	/** Event index and destination of the Teleport commands of the map */
+	std::vector<std::pair<int, int>> transfers;
+	/** Maps preloaded since entering the map */
+	std::vector<int> preloaded_maps;
 
 	std::unique_ptr<Game_Interpreter_Map> interpreter;
 	std::vector<std::shared_ptr<Game_Interpreter> > free_interpreters;
@@ -91,6 +137,22 @@ namespace {
 
 static Game_Map::Parallax::Params GetParallaxParams();
 
+static std::string FindMapFile(int map_id, std::string& name) {
+	// Try loading EasyRPG map files first, then fallback to normal RPG Maker
+	std::stringstream ss;
+	ss << "Map" << std::setfill('0') << std::setw(4) << map_id << ".emu";
+
+	std::string map_file = FileFinder::FindDefault(ss.str());
+	if (map_file.empty()) {
+		ss.str("");
+		ss << "Map" << std::setfill('0') << std::setw(4) << map_id << ".lmu";
+		map_file = FileFinder::FindDefault(ss.str());
+	}
+
+	name = ss.str();
+	return map_file;
+}
+
 void Game_Map::Init() {
 	Dispose();
 
@@ -103,6 +165,7 @@ void Game_Map::Init() {
 	map_info.encounter_rate = 0;
 
 	common_events.clear();
+	interpreter_scheduler.Reset();
 	common_events.reserve(Data::commonevents.size());
 	for (const RPG::CommonEvent& ev : Data::commonevents) {
 		common_events.emplace_back(ev.ID);
@@ -125,6 +188,9 @@ void Game_Map::Init() {
 }
 
 void Game_Map::Dispose() {
+	for (auto& list : trigger_events) {
+		list.clear();
+	}
 	events.clear();
 	pending.clear();
 
@@ -134,12 +200,16 @@ void Game_Map::Dispose() {
 
 	map.reset();
 	animation.reset();
+
+	collision_dirty = true;
+	Game_Pathing::Invalidate();
 }
 
 void Game_Map::Quit() {
 	Dispose();
 
 	common_events.clear();
+	interpreter_scheduler.Reset();
 	interpreter.reset();
 }
 
@@ -268,32 +338,34 @@ void Game_Map::SetupCommon(int _id, bool is_load_savegame) {
 
 	location.map_id = _id;
 
-	// Try loading EasyRPG map files first, then fallback to normal RPG Maker
-	std::stringstream ss;
-	ss << "Map" << std::setfill('0') << std::setw(4) << location.map_id << ".emu";
-
-	std::string map_file = FileFinder::FindDefault(ss.str());
-	if (map_file.empty()) {
-		ss.str("");
-		ss << "Map" << std::setfill('0') << std::setw(4) << location.map_id << ".lmu";
-		map_file = FileFinder::FindDefault(ss.str());
-
-		map = LMU_Reader::Load(map_file, Player::encoding);
-	} else {
-		map = LMU_Reader::LoadXml(map_file);
-	}
+	std::string map_name;
+	std::string map_file = FindMapFile(location.map_id, map_name);
+	map = MapCache::Get(map_file);
 
-	Output::Debug("Loading Map %s", ss.str().c_str());
+	Output::Debug("Loading Map %s", map_name.c_str());
 
 	if (map.get() == NULL) {
 		Output::ErrorStr(LcfReader::GetError());
 	}
 
+	// Destinations of the transfers for preloading
+	transfers.clear();
+	preloaded_maps.clear();
+	for (size_t i = 0; i < map->events.size(); ++i) {
+		for (const RPG::EventPage& page : map->events[i].pages) {
+			for (const RPG::EventCommand& com : page.event_commands) {
+				if (com.code == Cmd::Teleport && !com.parameters.empty() && com.parameters[0] != location.map_id) {
+					transfers.emplace_back(i, com.parameters[0]);
+				}
+			}
+		}
+	}
+
 	refresh_type = Refresh_All;
 
 	int current_index = GetMapIndex(location.map_id);
 
-	ss.str("");
+	std::stringstream ss;
 	for (int cur = current_index;
 		GetMapIndex(Data::treemap.maps[cur].parent_map) != cur;
 		cur = GetMapIndex(Data::treemap.maps[cur].parent_map)) {
@@ -357,6 +429,14 @@ void Game_Map::PrepareSave() {
 	}
 }
 
+static int GetMusicMapIndex(int current_index) {
+	// Inherited music is taken from the parent map
+	while (Data::treemap.maps[current_index].music_type == 0 && Game_Map::GetMapIndex(Data::treemap.maps[current_index].parent_map) != current_index) {
+		current_index = Game_Map::GetMapIndex(Data::treemap.maps[current_index].parent_map);
+	}
+	return current_index;
+}
+
 void Game_Map::PlayBgm() {
 	if (last_map_id == location.map_id) {
 		// Don't change BGM when the map stayed the same
@@ -367,9 +447,7 @@ void Game_Map::PlayBgm() {
 	int current_index = GetMapIndex(location.map_id);
 	last_map_id = current_index;
 
-	while (Data::treemap.maps[current_index].music_type == 0 && GetMapIndex(Data::treemap.maps[current_index].parent_map) != current_index) {
-		current_index = GetMapIndex(Data::treemap.maps[current_index].parent_map);
-	}
+	current_index = GetMusicMapIndex(current_index);
 
 	if ((current_index > 0) && !Data::treemap.maps[current_index].music.name.empty()) {
 		if (Data::treemap.maps[current_index].music_type == 1) {
@@ -384,6 +462,72 @@ void Game_Map::PlayBgm() {
 	}
 }
 
+void Game_Map::PrefetchBgm(int map_id) {
+	if (map_id == location.map_id) {
+		return;
+	}
+
+	int current_index = GetMapIndex(map_id);
+	if (current_index < 0) {
+		return;
+	}
+
+	current_index = GetMusicMapIndex(current_index);
+	auto& map_info = Data::treemap.maps[current_index];
+	if (current_index > 0 && !map_info.music.name.empty() && map_info.music_type != 1) {
+		Game_System::BgmPrefetch(map_info.music);
+	}
+}
+
+void Game_Map::PreloadMap(int map_id) {
+	if (map_id == location.map_id ||
+		std::find(preloaded_maps.begin(), preloaded_maps.end(), map_id) != preloaded_maps.end()) {
+		return;
+	}
+	preloaded_maps.push_back(map_id);
+
+	std::string map_name;
+	std::string map_file = FindMapFile(map_id, map_name);
+	if (!map_file.empty()) {
+		MapCache::Preload(map_file);
+	}
+}
+
+void Game_Map::PreloadNearbyMaps() {
+	if (transfers.empty()) {
+		return;
+	}
+
+	// Distance of the transfer events to the player
+	int x = Main_Data::game_player->GetX();
+	int y = Main_Data::game_player->GetY();
+	std::vector<std::pair<int, int>> closest;
+	for (const auto& transfer : transfers) {
+		if (transfer.first >= (int)events.size()) {
+			continue;
+		}
+		const Game_Event& ev = events[transfer.first];
+		closest.emplace_back(std::abs(ev.GetX() - x) + std::abs(ev.GetY() - y), transfer.second);
+	}
+
+	std::sort(closest.begin(), closest.end());
+
+	std::vector<int> targets;
+	for (const auto& transfer : closest) {
+		if (std::find(targets.begin(), targets.end(), transfer.second) != targets.end()) {
+			continue;
+		}
+		targets.push_back(transfer.second);
+		if (targets.size() == preload_transfer_count) {
+			break;
+		}
+	}
+
+	for (int map_id : targets) {
+		PreloadMap(map_id);
+	}
+}
+
 void Game_Map::Refresh() {
 	if (location.map_id > 0) {
 		for (Game_Event& ev : events) {
@@ -675,20 +819,139 @@ bool Game_Map::IsPassable(int x, int y, int d, const Game_Character* self_event)
 	return IsPassableTile(bit, x + y * GetWidth());
 }
 
+static bool ComputePassableTile(int bit, int tile_index) {
+	int tile_id = map->upper_layer[tile_index] - BLOCK_F;
+	tile_id = map_info.upper_tiles[tile_id];
+
+	if ((passages_up[tile_id] & bit) == 0)
+		return false;
+
+	if ((passages_up[tile_id] & Passable::Above) == 0)
+		return true;
+
+	int tile_raw_id = map->lower_layer[tile_index];
+
+	if (tile_raw_id >= BLOCK_E) {
+		tile_id = tile_raw_id - BLOCK_E;
+		tile_id = map_info.lower_tiles[tile_id] + 18;
+
+	} else if (tile_raw_id >= BLOCK_D) {
+		tile_id = (tile_raw_id - BLOCK_D) / 50 + 6;
+		int autotile_id = (tile_raw_id - BLOCK_D) % 50;
+
+		if (((passages_down[tile_id] & Passable::Wall) != 0) && (
+				(autotile_id >= 20 && autotile_id <= 23) ||
+				(autotile_id >= 33 && autotile_id <= 37) ||
+				autotile_id == 42 || autotile_id == 43 ||
+				autotile_id == 45 || autotile_id == 46))
+			return true;
+
+	} else if (tile_raw_id >= BLOCK_C) {
+		tile_id = (tile_raw_id - BLOCK_C) / 50 + 3;
+
+	} else if (map->lower_layer[tile_index] < BLOCK_C) {
+		tile_id = tile_raw_id / 1000;
+	}
+
+	return (passages_down[tile_id] & bit) != 0;
+}
+
+static int ComputeTerrainTag(int tile_index) {
+	if (!chipset) return 9;
+
+	unsigned const chipID = map->lower_layer[tile_index];
+	unsigned chip_index =
+		(chipID <  3050)?  0 + chipID/1000 :
+		(chipID <  4000)?  4 + (chipID-3050)/50 :
+		(chipID <  5000)?  6 + (chipID-4000)/50 :
+		(chipID <  5144)? 18 + (chipID-5000) :
+		0;
+
+	// Apply tile substitution
+	if (chip_index >= 18 && chip_index <= 144)
+		chip_index = map_info.lower_tiles[chip_index - 18] + 18;
+
+	auto& terrain_data = chipset->terrain_data;
+
+	if (terrain_data.empty()) {
+		// RPG_RT optimisation: When the terrain is all 1, no terrain data is stored
+		return 1;
+	}
+
+	assert(chip_index < terrain_data.size());
+
+	return terrain_data[chip_index];
+}
+
+static void BuildCollisionTile(int tile_index) {
+	CollisionTile& tile = collision[tile_index];
+	tile.flags = 0;
+
+	for (int bit : { Passable::Down, Passable::Left, Passable::Right, Passable::Up }) {
+		if (ComputePassableTile(bit, tile_index)) {
+			tile.flags |= bit;
+		}
+	}
+	if (ComputePassableTile(Passable::Down | Passable::Left | Passable::Right | Passable::Up, tile_index)) {
+		tile.flags |= Collision_Landable;
+	}
+
+	int const upper_id = map->upper_layer[tile_index];
+	if (upper_id >= BLOCK_F) {
+		int const index = map_info.upper_tiles[upper_id - BLOCK_F];
+		if ((passages_up[index] & Passable::Above) != 0) {
+			tile.flags |= Collision_UpperAbove;
+		}
+		if ((passages_up[index] & Passable::Counter) != 0) {
+			tile.flags |= Collision_Counter;
+		}
+	}
+
+	tile.terrain_id = ComputeTerrainTag(tile_index);
+	tile.bush_depth = 0;
+
+	const RPG::Terrain* terrain = ReaderUtil::GetElement(Data::terrains, tile.terrain_id);
+	if (terrain) {
+		tile.flags |= Collision_ValidTerrain;
+		if (terrain->boat_pass)
+			tile.flags |= Collision_BoatPass;
+		if (terrain->ship_pass)
+			tile.flags |= Collision_ShipPass;
+		if (terrain->airship_pass)
+			tile.flags |= Collision_AirshipPass;
+		tile.bush_depth = terrain->bush_depth;
+	}
+}
+
+static const CollisionTile& GetCollisionTile(int tile_index) {
+	if (collision_dirty) {
+		int const size = Game_Map::GetWidth() * Game_Map::GetHeight();
+		collision.resize(size);
+		for (int i = 0; i < size; ++i) {
+			BuildCollisionTile(i);
+		}
+		collision_dirty = false;
+	}
+
+	return collision[tile_index];
+}
+
 bool Game_Map::IsPassableVehicle(int x, int y, Game_Vehicle::Type vehicle_type) {
 	if (!Game_Map::IsValid(x, y)) return false;
 
-	const RPG::Terrain* terrain = ReaderUtil::GetElement(Data::terrains, GetTerrainTag(x, y));
-	if (!terrain) {
+	int const tile_index = x + y * GetWidth();
+	const CollisionTile& tile = GetCollisionTile(tile_index);
+
+	if ((tile.flags & Collision_ValidTerrain) == 0) {
 		Output::Warning("IsPassableVehicle: Invalid terrain at (%d, %d)", x, y);
 	} else if (vehicle_type == Game_Vehicle::Boat) {
-		if (!terrain->boat_pass)
+		if ((tile.flags & Collision_BoatPass) == 0)
 			return false;
 	} else if (vehicle_type == Game_Vehicle::Ship) {
-		if (!terrain->ship_pass)
+		if ((tile.flags & Collision_ShipPass) == 0)
 			return false;
 	} else if (vehicle_type == Game_Vehicle::Airship) {
-		return terrain->airship_pass;
+		return (tile.flags & Collision_AirshipPass) != 0;
 	}
 
 	int tile_id;
@@ -709,12 +972,7 @@ bool Game_Map::IsPassableVehicle(int x, int y, Game_Vehicle::Type vehicle_type)
 		}
 	}
 
-	int const tile_index = x + y * GetWidth();
-
-	tile_id = map->upper_layer[tile_index] - BLOCK_F;
-	tile_id = map_info.upper_tiles[tile_id];
-
-	if ((passages_up[tile_id] & Passable::Above) == 0)
+	if ((tile.flags & Collision_UpperAbove) == 0)
 		return false;
 
 	for (int i = 0; i < 3; i++) {
@@ -754,60 +1012,36 @@ bool Game_Map::IsLandable(int x, int y, const Game_Character *self_event) {
 }
 
 bool Game_Map::IsPassableTile(int bit, int tile_index) {
-	int tile_id = map->upper_layer[tile_index] - BLOCK_F;
-	tile_id = map_info.upper_tiles[tile_id];
-
-	if ((passages_up[tile_id] & bit) == 0)
-		return false;
-
-	if ((passages_up[tile_id] & Passable::Above) == 0)
-		return true;
-
-	int tile_raw_id = map->lower_layer[tile_index];
-
-	if (tile_raw_id >= BLOCK_E) {
-		tile_id = tile_raw_id - BLOCK_E;
-		tile_id = map_info.lower_tiles[tile_id] + 18;
-
-	} else if (tile_raw_id >= BLOCK_D) {
-		tile_id = (tile_raw_id - BLOCK_D) / 50 + 6;
-		int autotile_id = (tile_raw_id - BLOCK_D) % 50;
-
-		if (((passages_down[tile_id] & Passable::Wall) != 0) && (
-				(autotile_id >= 20 && autotile_id <= 23) ||
-				(autotile_id >= 33 && autotile_id <= 37) ||
-				autotile_id == 42 || autotile_id == 43 ||
-				autotile_id == 45 || autotile_id == 46))
-			return true;
-
-	} else if (tile_raw_id >= BLOCK_C) {
-		tile_id = (tile_raw_id - BLOCK_C) / 50 + 3;
-
-	} else if (map->lower_layer[tile_index] < BLOCK_C) {
-		tile_id = tile_raw_id / 1000;
+	const CollisionTile& tile = GetCollisionTile(tile_index);
+
+	switch (bit) {
+		case Passable::Down:
+		case Passable::Left:
+		case Passable::Right:
+		case Passable::Up:
+			return (tile.flags & bit) != 0;
+		case Passable::Down | Passable::Left | Passable::Right | Passable::Up:
+			return (tile.flags & Collision_Landable) != 0;
+		default:
+			return ComputePassableTile(bit, tile_index);
 	}
-
-	return (passages_down[tile_id] & bit) != 0;
 }
 
 int Game_Map::GetBushDepth(int x, int y) {
 	if (!Game_Map::IsValid(x, y)) return 0;
 
-	const RPG::Terrain* terrain = ReaderUtil::GetElement(Data::terrains, GetTerrainTag(x,y));
-	if (!terrain) {
+	const CollisionTile& tile = GetCollisionTile(x + y * GetWidth());
+	if ((tile.flags & Collision_ValidTerrain) == 0) {
 		Output::Warning("GetBushDepth: Invalid terrain at (%d, %d)", x, y);
 		return 0;
 	}
-	return terrain->bush_depth;
+	return tile.bush_depth;
 }
 
 bool Game_Map::IsCounter(int x, int y) {
 	if (!Game_Map::IsValid(x, y)) return false;
 
-	int const tile_id = map->upper_layer[x + y * GetWidth()];
-	if (tile_id < BLOCK_F) return false;
-	int const index = map_info.upper_tiles[tile_id - BLOCK_F];
-	return !!(passages_up[index] & Passable::Counter);
+	return (GetCollisionTile(x + y * GetWidth()).flags & Collision_Counter) != 0;
 }
 
 int Game_Map::GetTerrainTag(int x, int y) {
@@ -815,30 +1049,9 @@ int Game_Map::GetTerrainTag(int x, int y) {
 	x = RoundX(x);
 	y = RoundY(y);
 
-	if (!Game_Map::IsValid(x, y) || !chipset) return 9;
-
-	unsigned const chipID = map->lower_layer[x + y * GetWidth()];
-	unsigned chip_index =
-		(chipID <  3050)?  0 + chipID/1000 :
-		(chipID <  4000)?  4 + (chipID-3050)/50 :
-		(chipID <  5000)?  6 + (chipID-4000)/50 :
-		(chipID <  5144)? 18 + (chipID-5000) :
-		0;
-
-	// Apply tile substitution
-	if (chip_index >= 18 && chip_index <= 144)
-		chip_index = map_info.lower_tiles[chip_index - 18] + 18;
-
-	auto& terrain_data = chipset->terrain_data;
-
-	if (terrain_data.empty()) {
-		// RPG_RT optimisation: When the terrain is all 1, no terrain data is stored
-		return 1;
-	}
+	if (!Game_Map::IsValid(x, y)) return 9;
 
-	assert(chip_index < terrain_data.size());
-
-	return terrain_data[chip_index];
+	return GetCollisionTile(x + y * GetWidth()).terrain_id;
 }
 
 bool Game_Map::AirshipLandOk(int const x, int const y) {
@@ -859,6 +1072,52 @@ void Game_Map::GetEventsXY(std::vector<Game_Event*>& events, int x, int y) {
 	}
 }
 
+void Game_Map::GetEventsXY(std::vector<Game_Event*>& events, int x, int y, const std::vector<int>& triggers) {
+	size_t first = events.size();
+
+	for (int trigger : triggers) {
+		for (Game_Event* ev : GetEventsByTrigger(trigger)) {
+			if (ev->IsInPosition(x, y) && ev->GetActive()) {
+				events.push_back(ev);
+			}
+		}
+	}
+
+	if (triggers.size() > 1) {
+		std::sort(events.begin() + first, events.end(), std::less<Game_Event*>());
+	}
+}
+
+const std::vector<Game_Event*>& Game_Map::GetEventsByTrigger(int trigger) {
+	static const std::vector<Game_Event*> empty;
+
+	if (trigger < 0 || trigger >= trigger_count) {
+		return empty;
+	}
+
+	return trigger_events[trigger];
+}
+
+void Game_Map::UpdateEventTrigger(Game_Event* ev, int old_trigger, int new_trigger) {
+	std::less<Game_Event*> order;
+
+	if (old_trigger >= 0 && old_trigger < trigger_count) {
+		auto& list = trigger_events[old_trigger];
+		auto it = std::lower_bound(list.begin(), list.end(), ev, order);
+		if (it != list.end() && *it == ev) {
+			list.erase(it);
+		}
+	}
+
+	if (new_trigger >= 0 && new_trigger < trigger_count) {
+		auto& list = trigger_events[new_trigger];
+		auto it = std::lower_bound(list.begin(), list.end(), ev, order);
+		if (it == list.end() || *it != ev) {
+			list.insert(it, ev);
+		}
+	}
+}
+
 bool Game_Map::LoopHorizontal() {
 	return map->scroll_type == RPG::Map::ScrollType_horizontal || map->scroll_type == RPG::Map::ScrollType_both;
 }
@@ -911,9 +1170,7 @@ void Game_Map::Update(bool only_parallel) {
 		}
 	}
 
-	for (Game_CommonEvent& ev : common_events) {
-		ev.UpdateParallel();
-	}
+	interpreter_scheduler.Update(common_events);
 
 	for (Game_Event& ev : events) {
 		ev.UpdateParallel();
@@ -922,8 +1179,12 @@ void Game_Map::Update(bool only_parallel) {
 	if (only_parallel)
 		return;
 
-	for (Game_Event& ev : events) {
-		ev.CheckEventTriggers();
+	// Only auto-start and collision pages react to these checks
+	for (Game_Event* ev : trigger_events[RPG::EventPage::Trigger_auto_start]) {
+		ev->CheckEventTriggers();
+	}
+	for (Game_Event* ev : trigger_events[RPG::EventPage::Trigger_collision]) {
+		ev->CheckEventTriggers();
 	}
 
 	Main_Data::game_player->Update();
@@ -1180,11 +1441,11 @@ bool Game_Map::IsBattleAnimationWaiting() {
 	return (bool)animation;
 }
 
-std::vector<short>& Game_Map::GetMapDataDown() {
+const std::vector<short>& Game_Map::GetMapDataDown() {
 	return map->lower_layer;
 }
 
-std::vector<short>& Game_Map::GetMapDataUp() {
+const std::vector<short>& Game_Map::GetMapDataUp() {
 	return map->upper_layer;
 }
 
@@ -1282,6 +1543,10 @@ std::vector<Game_CommonEvent>& Game_Map::GetCommonEvents() {
 	return common_events;
 }
 
+Game_InterpreterScheduler& Game_Map::GetInterpreterScheduler() {
+	return interpreter_scheduler;
+}
+
 int Game_Map::GetMapIndex(int id) {
 	for (unsigned int i = 0; i < Data::treemap.maps.size(); ++i) {
 		if (Data::treemap.maps[i].ID == id) {
@@ -1338,6 +1603,9 @@ void Game_Map::SetChipset(int id) {
 		passages_down.resize(162, (unsigned char) 0x0F);
 	if (passages_up.size() < 144)
 		passages_up.resize(144, (unsigned char) 0x0F);
+
+	collision_dirty = true;
+	Game_Pathing::Invalidate();
 }
 
 Game_Vehicle* Game_Map::GetVehicle(Game_Vehicle::Type which) {
@@ -1394,23 +1662,57 @@ void Game_Map::RemoveAllPendingMoves() {
 	pending.clear();
 }
 
-static int DoSubstitute(std::vector<uint8_t>& tiles, int old_id, int new_id) {
+static int DoSubstitute(std::vector<uint8_t>& tiles, int old_id, int new_id, std::vector<bool>& changed) {
 	int num_subst = 0;
+	changed.assign(tiles.size(), false);
 	for (size_t i = 0; i < tiles.size(); ++i) {
 		if (tiles[i] == old_id) {
 			tiles[i] = (uint8_t) new_id;
+			changed[i] = true;
 			++num_subst;
 		}
 	}
 	return num_subst;
 }
 
+/**
+ * Rebuilds the collision grid entries of all tiles using a substituted id.
+ *
+ * @param layer lower or upper layer of the map
+ * @param first first raw tile id affected by the substitution table
+ * @param changed substituted entries of the table
+ */
+static void RefreshCollisionTiles(const std::vector<int16_t>& layer, int first, const std::vector<bool>& changed) {
+	if (collision_dirty) {
+		return;
+	}
+
+	for (size_t i = 0; i < layer.size() && i < collision.size(); ++i) {
+		int const index = layer[i] - first;
+		if (index >= 0 && index < static_cast<int>(changed.size()) && changed[index]) {
+			BuildCollisionTile(i);
+		}
+	}
+}
+
 int Game_Map::SubstituteDown(int old_id, int new_id) {
-	return DoSubstitute(map_info.lower_tiles, old_id, new_id);
+	std::vector<bool> changed;
+	int num_subst = DoSubstitute(map_info.lower_tiles, old_id, new_id, changed);
+	if (num_subst > 0) {
+		RefreshCollisionTiles(map->lower_layer, BLOCK_E, changed);
+		Game_Pathing::Invalidate();
+	}
+	return num_subst;
 }
 
 int Game_Map::SubstituteUp(int old_id, int new_id) {
-	return DoSubstitute(map_info.upper_tiles, old_id, new_id);
+	std::vector<bool> changed;
+	int num_subst = DoSubstitute(map_info.upper_tiles, old_id, new_id, changed);
+	if (num_subst > 0) {
+		RefreshCollisionTiles(map->upper_layer, BLOCK_F, changed);
+		Game_Pathing::Invalidate();
+	}
+	return num_subst;
 }
 
 void Game_Map::LockPan() {
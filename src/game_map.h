@@ -30,6 +30,7 @@
 #include "rpg_mapinfo.h"
 
 class FileRequestAsync;
+class Game_InterpreterScheduler;
 
 // These are in sixteenths of a pixel.
 constexpr int SCREEN_TILE_SIZE = 256;
@@ -97,6 +98,27 @@ namespace Game_Map {
 	 */
 	void PlayBgm();
 
+	/**
+	 * Opens the BGM PlayBgm would play for a map in advance.
+	 *
+	 * @param map_id map ID
+	 */
+	void PrefetchBgm(int map_id);
+
+	/**
+	 * Parses a map in the background, so the transfer to it does not need
+	 * to wait for the map file.
+	 *
+	 * @param map_id map ID
+	 */
+	void PreloadMap(int map_id);
+
+	/**
+	 * Preloads the destination maps of the transfer events closest to the
+	 * player. Called after every step of the player.
+	 */
+	void PreloadNearbyMaps();
+
 	/**
 	 * Refreshes the map.
 	 */
@@ -353,14 +375,14 @@ namespace Game_Map {
 	 *
 	 * @return lower layer map data.
 	 */
-	std::vector<short>& GetMapDataDown();
+	const std::vector<short>& GetMapDataDown();
 
 	/**
 	 * Gets upper layer map data.
 	 *
 	 * @return upper layer map data.
 	 */
-	std::vector<short>& GetMapDataUp();
+	const std::vector<short>& GetMapDataUp();
 
 	/**
 	 * Gets chipset Id.
@@ -511,8 +533,43 @@ namespace Game_Map {
 	 */
 	std::vector<Game_CommonEvent>& GetCommonEvents();
 
+	/**
+	 * Gets the scheduler of the parallel common events.
+	 *
+	 * @return interpreter scheduler
+	 */
+	Game_InterpreterScheduler& GetInterpreterScheduler();
+
 	void GetEventsXY(std::vector<Game_Event*>& events, int x, int y);
 
+	/**
+	 * Appends the active events at a position which use one of the
+	 * triggers, in the order of the map events.
+	 *
+	 * @param events list the events are appended to
+	 * @param x tile x
+	 * @param y tile y
+	 * @param triggers accepted triggers (RPG::EventPage::Trigger)
+	 */
+	void GetEventsXY(std::vector<Game_Event*>& events, int x, int y, const std::vector<int>& triggers);
+
+	/**
+	 * Gets the events whose current page uses a trigger.
+	 *
+	 * @param trigger trigger (RPG::EventPage::Trigger)
+	 * @return events in the order of the map events
+	 */
+	const std::vector<Game_Event*>& GetEventsByTrigger(int trigger);
+
+	/**
+	 * Updates the trigger index when the page of an event changes.
+	 *
+	 * @param ev event
+	 * @param old_trigger trigger of the old page, -1 if none
+	 * @param new_trigger trigger of the new page, -1 if none
+	 */
+	void UpdateEventTrigger(Game_Event* ev, int old_trigger, int new_trigger);
+
 	bool LoopHorizontal();
 	bool LoopVertical();
 
@@ -0,0 +1,251 @@
+/*
+ * This file is part of EasyRPG Player.
+ *
+ * EasyRPG Player is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * EasyRPG Player is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with EasyRPG Player. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Headers
+#include <algorithm>
+#include <cstdlib>
+#include <vector>
+#include "game_pathing.h"
+#include "game_character.h"
+#include "game_map.h"
+#include "game_player.h"
+#include "main_data.h"
+#include "map_data.h"
+
+namespace {
+	bool valid = false;
+	// False when the search stopped at max_distance before visiting every
+	// connected tile
+	bool complete = false;
+	int field_map_id = 0;
+	int field_x = -1;
+	int field_y = -1;
+
+	// A distance is only valid when the stamp of the tile matches the
+	// current stamp. Avoids clearing the whole field on every rebuild.
+	unsigned int stamp = 0;
+	std::vector<unsigned int> tile_stamps;
+	std::vector<int> distances;
+	std::vector<int> queue;
+
+	// Indexed by Game_Character::Direction
+	const int dir_dx[] = { 0, 1, 0, -1 };
+	const int dir_dy[] = { -1, 0, 1, 0 };
+
+	int DirToMask(int d) {
+		switch (d) {
+			case Game_Character::Up:
+				return Passable::Up;
+			case Game_Character::Right:
+				return Passable::Right;
+			case Game_Character::Down:
+				return Passable::Down;
+			case Game_Character::Left:
+				return Passable::Left;
+			default:
+				return 0;
+		}
+	}
+
+	bool Step(int x, int y, int d, int& new_x, int& new_y) {
+		new_x = Game_Map::RoundX(x + dir_dx[d]);
+		new_y = Game_Map::RoundY(y + dir_dy[d]);
+		return Game_Map::IsValid(new_x, new_y);
+	}
+
+	// Same tile rules as Game_Map::MakeWay, without events and vehicles
+	bool CanWalk(int x, int y, int d, int new_x, int new_y) {
+		int width = Game_Map::GetWidth();
+		return Game_Map::IsPassableTile(DirToMask(d), x + y * width) &&
+			Game_Map::IsPassableTile(DirToMask(Game_Character::ReverseDir(d)), new_x + new_y * width);
+	}
+
+	int Delta(int from, int to, int size, bool loop) {
+		int delta = from - to;
+		if (loop && std::abs(delta) > size / 2) {
+			delta += (delta > 0) ? -size : size;
+		}
+		return delta;
+	}
+
+	void Build() {
+		int width = Game_Map::GetWidth();
+		int height = Game_Map::GetHeight();
+		size_t size = static_cast<size_t>(width * height);
+
+		if (tile_stamps.size() != size) {
+			tile_stamps.assign(size, 0);
+			distances.resize(size);
+		}
+
+		++stamp;
+		if (stamp == 0) {
+			std::fill(tile_stamps.begin(), tile_stamps.end(), 0);
+			stamp = 1;
+		}
+
+		field_map_id = Game_Map::GetMapId();
+		field_x = Main_Data::game_player->GetX();
+		field_y = Main_Data::game_player->GetY();
+		valid = true;
+
+		if (!Game_Map::IsValid(field_x, field_y)) {
+			return;
+		}
+
+		int start = field_x + field_y * width;
+		tile_stamps[start] = stamp;
+		distances[start] = 0;
+		queue.clear();
+		queue.push_back(start);
+
+		for (size_t head = 0; head < queue.size(); ++head) {
+			int index = queue[head];
+			int x = index % width;
+			int y = index / width;
+			int distance = distances[index];
+
+			if (distance >= Game_Pathing::max_distance) {
+				complete = false;
+				continue;
+			}
+
+			for (int d = Game_Character::Up; d <= Game_Character::Left; ++d) {
+				int new_x, new_y;
+				if (!Step(x, y, d, new_x, new_y)) {
+					continue;
+				}
+
+				int new_index = new_x + new_y * width;
+				if (tile_stamps[new_index] == stamp) {
+					continue;
+				}
+
+				// A chaser on the neighbour tile walks in the reverse direction
+				if (!CanWalk(new_x, new_y, Game_Character::ReverseDir(d), x, y)) {
+					continue;
+				}
+
+				tile_stamps[new_index] = stamp;
+				distances[new_index] = distance + 1;
+				queue.push_back(new_index);
+			}
+		}
+	}
+
+	bool Refresh() {
+		if (Game_Map::GetMapId() <= 0 || !Main_Data::game_player) {
+			return false;
+		}
+
+		if (!valid ||
+			field_map_id != Game_Map::GetMapId() ||
+			field_x != Main_Data::game_player->GetX() ||
+			field_y != Main_Data::game_player->GetY()) {
+			Build();
+		}
+
+		return true;
+	}
+
+	int GetFieldDistance(int x, int y) {
+		int index = x + y * Game_Map::GetWidth();
+		return tile_stamps[index] == stamp ? distances[index] : -1;
+	}
+
+	/**
+	 * Orders the directions like the greedy RPG_RT movement would try them,
+	 * so the shortest path looks natural when several are equally short.
+	 */
+	void GetPreferredDirections(int x, int y, bool towards, int (&dirs)[4]) {
+		int sx = Delta(x, field_x, Game_Map::GetWidth(), Game_Map::LoopHorizontal());
+		int sy = Delta(y, field_y, Game_Map::GetHeight(), Game_Map::LoopVertical());
+
+		int horizontal = (sx > 0) == towards ? Game_Character::Left : Game_Character::Right;
+		int vertical = (sy > 0) == towards ? Game_Character::Up : Game_Character::Down;
+
+		if (std::abs(sx) > std::abs(sy)) {
+			dirs[0] = horizontal;
+			dirs[1] = vertical;
+		} else {
+			dirs[0] = vertical;
+			dirs[1] = horizontal;
+		}
+		dirs[2] = Game_Character::ReverseDir(dirs[1]);
+		dirs[3] = Game_Character::ReverseDir(dirs[0]);
+	}
+}
+
+void Game_Pathing::Invalidate() {
+	valid = false;
+}
+
+int Game_Pathing::GetDistance(int x, int y) {
+	if (!Refresh() || !Game_Map::IsValid(x, y)) {
+		return -1;
+	}
+
+	return GetFieldDistance(x, y);
+}
+
+int Game_Pathing::GetDirectionsTowardsPlayer(int x, int y, int (&dirs)[4]) {
+	if (!Refresh() || !Game_Map::IsValid(x, y)) {
+		return -1;
+	}
+
+	int distance = GetFieldDistance(x, y);
+	if (distance < 0) {
+		return complete ? 0 : -1;
+	}
+
+	int preferred[4];
+	GetPreferredDirections(x, y, true, preferred);
+
+	int count = 0;
+	for (int d : preferred) {
+		int new_x, new_y;
+		if (Step(x, y, d, new_x, new_y) &&
+			GetFieldDistance(new_x, new_y) == distance - 1 &&
+			CanWalk(x, y, d, new_x, new_y)) {
+			dirs[count++] = d;
+		}
+	}
+
+	return count;
+}
+
+int Game_Pathing::GetDirectionsAwayFromPlayer(int x, int y, int (&dirs)[4]) {
+	int distance = GetDistance(x, y);
+	if (distance < 0 || distance >= max_distance) {
+		return -1;
+	}
+
+	int preferred[4];
+	GetPreferredDirections(x, y, false, preferred);
+
+	int count = 0;
+	for (int d : preferred) {
+		int new_x, new_y;
+		if (Step(x, y, d, new_x, new_y) &&
+			GetFieldDistance(new_x, new_y) > distance &&
+			CanWalk(x, y, d, new_x, new_y)) {
+			dirs[count++] = d;
+		}
+	}
+
+	return count;
+}
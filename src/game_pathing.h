@@ -0,0 +1,78 @@
+/*
+ * This file is part of EasyRPG Player.
+ *
+ * EasyRPG Player is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * EasyRPG Player is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with EasyRPG Player. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef EP_GAME_PATHING_H
+#define EP_GAME_PATHING_H
+
+/**
+ * Shared pathing for events chasing or fleeing the player.
+ *
+ * Keeps a breadth-first distance field from the player over the tile
+ * passability of the map. It is rebuilt lazily the first time it is queried
+ * after the player moved or the passability changed, so all chasers share
+ * one search per player step. Events are not part of the field because they
+ * move every frame: the caller tries the suggested steps in order and waits
+ * when all of them are blocked. The RPG_RT movement is only used when the
+ * character is outside of the searched area.
+ *
+ * Only used when enabled with --chase-pathfinding.
+ */
+namespace Game_Pathing {
+	/** Path length after which the search stops */
+	constexpr int max_distance = 64;
+
+	/**
+	 * Marks the distance field as outdated.
+	 * Must be called when the map or its passability changes.
+	 */
+	void Invalidate();
+
+	/**
+	 * Gets the walking distance from a tile to the player.
+	 *
+	 * @param x tile x
+	 * @param y tile y
+	 * @return distance in steps or -1 when unreachable or too far
+	 */
+	int GetDistance(int x, int y);
+
+	/**
+	 * Gets the first steps of all shortest paths to the player, the
+	 * preferred one first.
+	 *
+	 * @param x tile x
+	 * @param y tile y
+	 * @param dirs receives the directions (Game_Character::Direction)
+	 * @return number of directions, 0 when there is no path or -1 when the
+	 *         tile is too far away to know
+	 */
+	int GetDirectionsTowardsPlayer(int x, int y, int (&dirs)[4]);
+
+	/**
+	 * Gets all steps which increase the walking distance to the player, the
+	 * preferred one first.
+	 *
+	 * @param x tile x
+	 * @param y tile y
+	 * @param dirs receives the directions (Game_Character::Direction)
+	 * @return number of directions, 0 when the character is cornered or -1
+	 *         when the tile is not connected to the player or too far away
+	 */
+	int GetDirectionsAwayFromPlayer(int x, int y, int (&dirs)[4]);
+}
+
+#endif
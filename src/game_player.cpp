@@ -71,6 +71,9 @@ void Game_Player::ReserveTeleport(int map_id, int x, int y, int direction) {
 	FileRequestAsync* request = Game_Map::RequestMap(new_map_id);
 	request->SetImportantFile(true);
 	request->Start();
+
+	Game_Map::PrefetchBgm(new_map_id);
+	Game_Map::PreloadMap(new_map_id);
 }
 
 void Game_Player::ReserveTeleport(const RPG::SaveTarget& target) {
@@ -266,6 +269,11 @@ void Game_Player::Update() {
 
 	if (IsMoving() || was_blocked) return;
 
+	if (last_moving) {
+		// A step finished, the next transfer is likely close by
+		Game_Map::PreloadNearbyMaps();
+	}
+
 	if (last_moving && data()->boarding) {
 		// Boarding completed
 		data()->aboard = true;
@@ -326,12 +334,11 @@ bool Game_Player::CheckEventTriggerHere(const std::vector<int>& triggers, bool t
 	bool result = false;
 
 	std::vector<Game_Event*> events;
-	Game_Map::GetEventsXY(events, GetX(), GetY());
+	Game_Map::GetEventsXY(events, GetX(), GetY(), triggers);
 
 	std::vector<Game_Event*>::iterator i;
 	for (i = events.begin(); i != events.end(); ++i) {
-		if (((*i)->GetLayer() != RPG::EventPage::Layers_same)
-			&& std::find(triggers.begin(), triggers.end(), (*i)->GetTrigger() ) != triggers.end() ) {
+		if ((*i)->GetLayer() != RPG::EventPage::Layers_same) {
 			(*i)->Start(triggered_by_decision_key);
 			result = (*i)->GetStarting();
 		}
@@ -348,13 +355,10 @@ bool Game_Player::CheckEventTriggerThere(const std::vector<int>& triggers, bool
 	int front_y = Game_Map::YwithDirection(GetY(), GetDirection());
 
 	std::vector<Game_Event*> events;
-	Game_Map::GetEventsXY(events, front_x, front_y);
+	Game_Map::GetEventsXY(events, front_x, front_y, triggers);
 
 	for (const auto& ev : events) {
-		if ( ev->GetLayer() == RPG::EventPage::Layers_same &&
-			std::find(triggers.begin(), triggers.end(), ev->GetTrigger() ) != triggers.end()
-		)
-		{
+		if (ev->GetLayer() == RPG::EventPage::Layers_same) {
 			if (!ev->GetList().empty()) {
 				ev->StartTalkToHero();
 			}
@@ -367,13 +371,10 @@ bool Game_Player::CheckEventTriggerThere(const std::vector<int>& triggers, bool
 		front_x = Game_Map::XwithDirection(front_x, GetDirection());
 		front_y = Game_Map::YwithDirection(front_y, GetDirection());
 
-		Game_Map::GetEventsXY(events, front_x, front_y);
+		Game_Map::GetEventsXY(events, front_x, front_y, triggers);
 
 		for (const auto& ev : events) {
-			if ( ev->GetLayer() == 1 &&
-				std::find(triggers.begin(), triggers.end(), ev->GetTrigger() ) != triggers.end()
-			)
-			{
+			if (ev->GetLayer() == RPG::EventPage::Layers_same) {
 				if (!ev->GetList().empty()) {
 					ev->StartTalkToHero();
 				}
@@ -391,12 +392,10 @@ bool Game_Player::CheckEventTriggerTouch(int x, int y) {
 	bool result = false;
 
 	std::vector<Game_Event*> events;
-	Game_Map::GetEventsXY(events, x, y);
+	Game_Map::GetEventsXY(events, x, y, {RPG::EventPage::Trigger_touched, RPG::EventPage::Trigger_collision});
 
 	for (const auto& ev : events) {
-		if (ev->GetLayer() == RPG::EventPage::Layers_same &&
-			(ev->GetTrigger() == RPG::EventPage::Trigger_touched ||
-			ev->GetTrigger() == RPG::EventPage::Trigger_collision) ) {
+		if (ev->GetLayer() == RPG::EventPage::Layers_same) {
 			if (!ev->GetList().empty()) {
 				ev->StartTalkToHero();
 			}
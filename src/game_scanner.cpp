@@ -0,0 +1,155 @@
+/*
+ * This file is part of EasyRPG Player.
+ *
+ * EasyRPG Player is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * EasyRPG Player is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with EasyRPG Player. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Headers
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+#include "game_scanner.h"
+#include "output.h"
+
+namespace {
+	const char index_name[] = "GameIndex.easyrpg";
+	const char index_header[] = "EasyRPG game index 1";
+
+	// Workers listing the uncached directories
+	const unsigned max_workers = 4;
+}
+
+GameScanner::GameScanner(const std::string& path) :
+	path(path),
+	index_file(FileFinder::MakePath(path, index_name)) {
+
+	std::shared_ptr<FileFinder::DirectoryTree> tree = FileFinder::CreateDirectoryTree(path, false);
+	if (tree) {
+		for (auto& dir : tree->directories) {
+			entries.emplace_back();
+			entries.back().name = dir.second;
+		}
+	}
+
+	LoadIndex();
+
+	// Added or removed directories change the index as well
+	bool changed = cached.size() != entries.size();
+	workers.Start(entries.size(), max_workers, changed,
+		[this](int i) { return Scan(i); }, [this]() { WriteIndex(); });
+}
+
+GameScanner::~GameScanner() {
+	workers.Stop();
+}
+
+bool GameScanner::Poll(std::vector<std::string>& found) {
+	std::vector<int> done;
+	bool finished = workers.Poll(done);
+
+	found.clear();
+	for (int i : done) {
+		if (entries[i].is_game) {
+			found.push_back(entries[i].name);
+		}
+	}
+	return finished;
+}
+
+std::shared_ptr<FileFinder::DirectoryTree> GameScanner::GetGameTree(const std::string& name) {
+	auto it = std::find_if(entries.begin(), entries.end(), [&name](const Entry& entry) {
+		return entry.name == name;
+	});
+
+	std::shared_ptr<FileFinder::DirectoryTree> tree;
+	if (it != entries.end() && it->tree) {
+		tree = it->tree;
+		it->tree.reset();
+	} else {
+		// Result came from the index
+		tree = FileFinder::CreateDirectoryTree(FileFinder::MakePath(path, name), false);
+		if (!tree) {
+			return tree;
+		}
+	}
+
+	// Subdirectories are listed on first use, like CreateDirectoryTree does
+	tree->lazy = true;
+	return tree;
+}
+
+bool GameScanner::Scan(int i) {
+	Entry& entry = entries[i];
+	std::string dir = FileFinder::MakePath(path, entry.name);
+	entry.mtime = FileFinder::GetFileModifiedTime(dir);
+
+	auto it = cached.find(entry.name);
+	if (it != cached.end() && entry.mtime >= 0 && it->second.first == entry.mtime) {
+		entry.is_game = it->second.second;
+		return false;
+	}
+
+	entry.tree = FileFinder::CreateDirectoryTree(dir, false);
+	entry.is_game = entry.tree && FileFinder::IsValidProject(*entry.tree);
+	if (!entry.is_game) {
+		entry.tree.reset();
+	}
+	return true;
+}
+
+void GameScanner::LoadIndex() {
+	std::shared_ptr<std::fstream> stream = FileFinder::openUTF8(index_file, std::ios_base::in | std::ios_base::binary);
+	if (!stream) {
+		return;
+	}
+
+	std::string line;
+	if (!std::getline(*stream, line) || line != index_header) {
+		return;
+	}
+
+	// <mtime> <is_game> <name>
+	while (std::getline(*stream, line)) {
+		std::istringstream entry(line);
+		int64_t mtime;
+		int is_game;
+		std::string name;
+		if (!(entry >> mtime >> is_game) || entry.get() != ' ' || !std::getline(entry, name) || name.empty()) {
+			Output::Debug("Ignoring broken game index %s", index_file.c_str());
+			cached.clear();
+			return;
+		}
+		cached[name] = std::make_pair(mtime, is_game != 0);
+	}
+}
+
+void GameScanner::WriteIndex() const {
+	// The game directory of the web player only contains the downloaded
+	// files, an index written there is gone on the next visit
+#ifndef EMSCRIPTEN
+	std::shared_ptr<std::fstream> stream = FileFinder::openUTF8(index_file,
+		std::ios_base::out | std::ios_base::binary | std::ios_base::trunc);
+	if (!stream) {
+		// Read-only directory, the games are detected again next time
+		return;
+	}
+
+	*stream << index_header << '\n';
+	for (const Entry& entry : entries) {
+		if (entry.mtime >= 0 && entry.name.find('\n') == std::string::npos) {
+			*stream << entry.mtime << ' ' << (entry.is_game ? 1 : 0) << ' ' << entry.name << '\n';
+		}
+	}
+#endif
+}
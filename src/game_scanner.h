@@ -0,0 +1,93 @@
+/*
+ * This file is part of EasyRPG Player.
+ *
+ * EasyRPG Player is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * EasyRPG Player is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with EasyRPG Player. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef EP_GAME_SCANNER_H
+#define EP_GAME_SCANNER_H
+
+// Headers
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "filefinder.h"
+#include "index_workers.h"
+
+/**
+ * Finds the games in the subdirectories of the game browser directory.
+ *
+ * The subdirectories are checked on worker threads. The results are cached
+ * in an index file in the directory, a subdirectory is only listed again
+ * when its modification time changed. The listing of a game directory is
+ * kept, booting the game only has to scan its subdirectories.
+ */
+class GameScanner {
+public:
+	/**
+	 * Starts the scan.
+	 *
+	 * @param path directory containing the games.
+	 */
+	GameScanner(const std::string& path);
+
+	/**
+	 * Stops the workers, directories not checked yet are skipped.
+	 */
+	~GameScanner();
+
+	/**
+	 * Gets the games that were found since the last call.
+	 *
+	 * @param found receives the names of the game directories.
+	 * @return whether all directories were checked.
+	 */
+	bool Poll(std::vector<std::string>& found);
+
+	/**
+	 * Gets the directory tree of a game returned by Poll.
+	 *
+	 * @param name name of the game directory.
+	 * @return the directory tree, null when the directory vanished.
+	 */
+	std::shared_ptr<FileFinder::DirectoryTree> GetGameTree(const std::string& name);
+
+private:
+	struct Entry {
+		std::string name;
+		int64_t mtime = -1;
+		bool is_game = false;
+		/** Listing of the directory, only when it was listed */
+		std::shared_ptr<FileFinder::DirectoryTree> tree;
+	};
+
+	bool Scan(int i);
+	void LoadIndex();
+	void WriteIndex() const;
+
+	std::string path;
+	std::string index_file;
+
+	/** Content of the index file: name -> (mtime, is_game) */
+	std::unordered_map<std::string, std::pair<int64_t, bool> > cached;
+	/** Written by the workers */
+	std::vector<Entry> entries;
+
+	/** Last member: Destroyed first, the workers use the other members */
+	IndexWorkers workers;
+};
+
+#endif
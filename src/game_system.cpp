@@ -36,6 +36,9 @@ namespace {
 	std::map<std::string, FileRequestBinding> se_request_ids;
 	/** When true (BgmFade called) always forces a BGM_Play even when the same music is used */
 	bool force_bgm_play = false;
+	/** Position in ms the BGM bgm_resume_name continues at, -1 for the beginning */
+	int bgm_resume_position = -1;
+	std::string bgm_resume_name;
 
 	/**
 	 * Determines if the requested file is supposed to Stop BGM/SE play.
@@ -63,6 +66,62 @@ namespace {
 
 		return found_name.empty() && (Utils::StartsWith(name, "(") && Utils::EndsWith(name, ")"));
 	}
+
+	/**
+	 * Gets the file and tempo passed to SE_Prefetch.
+	 *
+	 * @return false when the sound can't be prefetched
+	 */
+	bool GetPrefetchSe(const RPG::Sound& se, std::string& path, int& tempo) {
+		tempo = se.tempo;
+		if (tempo < 50 || tempo > 200) {
+			tempo = 100;
+		}
+
+		// Not supported for files which are not downloaded yet
+		return !isStopFilename(se.name, FileFinder::FindSound, path) && !path.empty();
+	}
+
+	// Animation sounds pinned by SePrefetch until ReleaseAnimationSe
+	std::vector<std::pair<std::string, int>> prefetched_animation_se;
+
+	// System sounds pinned by PinSystemSe, indexed by the SFX type.
+	// An empty name means nothing is pinned.
+	std::vector<std::pair<std::string, int>> prefetched_system_se(Game_System::SFX_Count);
+
+	/**
+	 * Pins the sound of a system SFX type and unpins the sound pinned for
+	 * it before.
+	 */
+	void PinSystemSe(int which, const RPG::Sound& se) {
+		std::pair<std::string, int>& pinned = prefetched_system_se[which];
+
+		std::string path;
+		int tempo;
+		bool prefetch = GetPrefetchSe(se, path, tempo);
+		if (prefetch && pinned.first == path && pinned.second == tempo) {
+			return;
+		}
+
+		if (!pinned.first.empty()) {
+			Audio().SE_Unpin(pinned.first, pinned.second);
+			pinned = {};
+		}
+
+		if (prefetch) {
+			Audio().SE_Prefetch(path, tempo);
+			pinned = { path, tempo };
+		}
+	}
+
+	void UnpinSystemSe() {
+		for (std::pair<std::string, int>& pinned : prefetched_system_se) {
+			if (!pinned.first.empty()) {
+				Audio().SE_Unpin(pinned.first, pinned.second);
+				pinned = {};
+			}
+		}
+	}
 }
 
 static RPG::SaveSystem& data = Main_Data::game_data.system;
@@ -71,6 +130,15 @@ bool bgm_pending = false;
 
 void Game_System::Init() {
 	data.Setup();
+
+	music_request_id = FileRequestBinding();
+	se_request_ids.clear();
+	force_bgm_play = false;
+	bgm_pending = false;
+	bgm_resume_position = -1;
+	bgm_resume_name.clear();
+	ReleaseAnimationSe();
+	UnpinSystemSe();
 }
 
 int Game_System::GetSaveCount() {
@@ -100,10 +168,16 @@ void Game_System::BgmPlay(RPG::Music const& bgm) {
 		Output::Debug("BGM %s has invalid tempo %d", bgm.name.c_str(), bgm.tempo);
 	}
 
+	// The resume position only belongs to the music it was set for
+	if (bgm.name != bgm_resume_name) {
+		bgm_resume_position = -1;
+	}
+
 	// (OFF) means play nothing
 	if (!bgm.name.empty() && bgm.name != "(OFF)") {
 		// Same music: Only adjust volume and speed
 		if (!force_bgm_play && previous_music.name == bgm.name) {
+			bgm_resume_position = -1;
 			if (previous_music.volume != data.current_music.volume) {
 				if (!bgm_pending) { // Delay if not ready
 					Audio().BGM_Volume(data.current_music.volume);
@@ -128,12 +202,32 @@ void Game_System::BgmPlay(RPG::Music const& bgm) {
 	force_bgm_play = false;
 }
 
+void Game_System::BgmPrefetch(RPG::Music const& bgm) {
+	if (bgm.name == data.current_music.name) {
+		return;
+	}
+
+	// Not supported for Ineluki links and files which are not downloaded yet
+	std::string path;
+	if (isStopFilename(bgm.name, FileFinder::FindMusic, path) || path.empty() ||
+		Utils::EndsWith(bgm.name, ".link")) {
+		return;
+	}
+
+	Audio().BGM_Prefetch(path);
+}
+
 void Game_System::BgmStop() {
 	music_request_id = FileRequestBinding();
 	data.current_music.name = "(OFF)";
 	Audio().BGM_Stop();
 }
 
+void Game_System::BgmResumeAt(const std::string& name, int ms) {
+	bgm_resume_name = name;
+	bgm_resume_position = ms;
+}
+
 void Game_System::BgmFade(int duration) {
 	Audio().BGM_Fade(duration);
 	force_bgm_play = true;
@@ -197,6 +291,30 @@ void Game_System::SePlay(const RPG::Animation &animation) {
 	}
 }
 
+void Game_System::SePrefetch(const RPG::Animation& animation) {
+	for (const auto& anim : animation.timings) {
+		std::string path;
+		int tempo;
+		if (GetPrefetchSe(anim.se, path, tempo)) {
+			Audio().SE_Prefetch(path, tempo);
+			prefetched_animation_se.emplace_back(path, tempo);
+		}
+	}
+}
+
+void Game_System::ReleaseAnimationSe() {
+	for (const auto& se : prefetched_animation_se) {
+		Audio().SE_Unpin(se.first, se.second);
+	}
+	prefetched_animation_se.clear();
+}
+
+void Game_System::PrefetchSystemSe() {
+	for (int i = 0; i < SFX_Count; ++i) {
+		PinSystemSe(i, GetSystemSE(i));
+	}
+}
+
 std::string Game_System::GetSystemName() {
 	return data.graphics_name;
 }
@@ -257,6 +375,7 @@ RPG::Sound& Game_System::GetSystemSE(int which) {
 
 void Game_System::SetSystemSE(int which, const RPG::Sound& sfx) {
 	GetSystemSE(which) = sfx;
+	PinSystemSe(which, sfx);
 }
 
 void Game_System::SetAllowTeleport(bool allow) {
@@ -400,6 +519,9 @@ void Game_System::OnBgmReady(FileRequestResult* result) {
 	// Take from current_music, params could have changed over time
 	bgm_pending = false;
 
+	int resume_position = result->file == bgm_resume_name ? bgm_resume_position : -1;
+	bgm_resume_position = -1;
+
 	std::string path;
 	if (isStopFilename(result->file, FileFinder::FindMusic, path)) {
 		Audio().BGM_Stop();
@@ -436,12 +558,18 @@ void Game_System::OnBgmReady(FileRequestResult* result) {
 		}
 
 		Audio().BGM_Play(ineluki_path, data.current_music.volume, data.current_music.tempo, data.current_music.fadein);
+		if (resume_position >= 0) {
+			Audio().BGM_Seek(resume_position);
+		}
 
 		return;
 		#endif
 	}
 
 	Audio().BGM_Play(path, data.current_music.volume, data.current_music.tempo, data.current_music.fadein);
+	if (resume_position >= 0) {
+		Audio().BGM_Seek(resume_position);
+	}
 }
 
 void Game_System::OnSeReady(FileRequestResult* result, int volume, int tempo, bool stop_sounds) {
@@ -92,6 +92,8 @@ namespace Game_System {
 
 	/**
 	 * Initializes Game System.
+	 * Also forgets pending music and sound requests and releases the
+	 * prefetched animation and system sounds of the previous game.
 	 */
 	void Init();
 
@@ -102,11 +104,29 @@ namespace Game_System {
 	 */
 	void BgmPlay(RPG::Music const& bgm);
 
+	/**
+	 * Opens a Music in advance, so a later BgmPlay starts it faster.
+	 * Does nothing when the music is already playing.
+	 *
+	 * @param bgm music data.
+	 */
+	void BgmPrefetch(RPG::Music const& bgm);
+
 	/**
 	 * Stops playing music.
 	 */
 	void BgmStop();
 
+	/**
+	 * Continues the music started by the next BgmPlay at a position instead
+	 * of the beginning, e.g. when a rewind snapshot is restored.
+	 * Discarded when BgmPlay is called with another music first.
+	 *
+	 * @param name name of the music.
+	 * @param ms position returned by BGM_GetPosition.
+	 */
+	void BgmResumeAt(const std::string& name, int ms);
+
 	/**
 	 * Fades out the current BGM
 	 *
@@ -129,6 +149,27 @@ namespace Game_System {
 	 */
 	void SePlay(const RPG::Animation& animation);
 
+	/**
+	 * Decodes all sounds of an animation in advance. They stay in memory
+	 * until ReleaseAnimationSe is called.
+	 *
+	 * @param animation animation data.
+	 */
+	void SePrefetch(const RPG::Animation& animation);
+
+	/**
+	 * Allows removing the sounds of all animations passed to SePrefetch
+	 * from memory again.
+	 */
+	void ReleaseAnimationSe();
+
+	/**
+	 * Decodes all system sounds (cursor, decision, battle...) in advance.
+	 * They stay in memory until they are replaced by SetSystemSE or
+	 * another call of this function.
+	 */
+	void PrefetchSystemSe();
+
 	/**
 	 * Gets system graphic name.
 	 *
@@ -0,0 +1,82 @@
+/*
+ * This file is part of EasyRPG Player.
+ *
+ * EasyRPG Player is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * EasyRPG Player is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with EasyRPG Player. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Headers
+#include <algorithm>
+#include "index_workers.h"
+
+IndexWorkers::~IndexWorkers() {
+	Stop();
+}
+
+void IndexWorkers::Start(int count, unsigned max_workers, bool changed, Job job, std::function<void()> write_index) {
+	this->count = count;
+	this->changed = changed;
+	this->job = std::move(job);
+	this->write_index = std::move(write_index);
+	remaining = count;
+
+#ifdef EMSCRIPTEN
+	// No threads
+	(void)max_workers;
+	Run();
+#else
+	unsigned threads = std::max(1u, std::min(max_workers, std::thread::hardware_concurrency()));
+	threads = std::min<unsigned>(threads, count);
+	for (unsigned i = 0; i < threads; ++i) {
+		workers.emplace_back(&IndexWorkers::Run, this);
+	}
+#endif
+}
+
+void IndexWorkers::Stop() {
+	quit = true;
+	for (auto& worker : workers) {
+		worker.join();
+	}
+	workers.clear();
+}
+
+bool IndexWorkers::Poll(std::vector<int>& done) {
+	std::lock_guard<std::mutex> lock(mutex);
+	done.swap(done_items);
+	done_items.clear();
+	return remaining == 0;
+}
+
+void IndexWorkers::Run() {
+	for (;;) {
+		int i = next_item++;
+		if (quit || i >= count) {
+			return;
+		}
+
+		bool updated = job(i);
+
+		bool write;
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			done_items.push_back(i);
+			changed = changed || updated;
+			write = --remaining == 0 && changed;
+		}
+
+		if (write) {
+			write_index();
+		}
+	}
+}
@@ -0,0 +1,89 @@
+/*
+ * This file is part of EasyRPG Player.
+ *
+ * EasyRPG Player is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * EasyRPG Player is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with EasyRPG Player. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef EP_INDEX_WORKERS_H
+#define EP_INDEX_WORKERS_H
+
+// Headers
+#include <atomic>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * Worker threads of the scanners that cache their results in an index file
+ * (GameScanner, SaveIndex).
+ *
+ * Every item is processed once by one of the workers. The worker finishing
+ * the last item writes the index when any result differs from it. On
+ * Emscripten the items are processed inline by Start.
+ */
+class IndexWorkers {
+public:
+	/** Processes an item, returns whether the result differs from the index */
+	typedef std::function<bool(int)> Job;
+
+	/**
+	 * Stops the workers.
+	 */
+	~IndexWorkers();
+
+	/**
+	 * Starts processing the items.
+	 *
+	 * @param count number of items.
+	 * @param max_workers maximum number of threads.
+	 * @param changed whether the index must be written even when no result
+	 *                differs, e.g. because items were added or removed.
+	 * @param job processes an item.
+	 * @param write_index writes the index, called on a worker.
+	 */
+	void Start(int count, unsigned max_workers, bool changed, Job job, std::function<void()> write_index);
+
+	/**
+	 * Stops the workers, items not processed yet are skipped.
+	 * Must be called before the data used by the job is destroyed.
+	 */
+	void Stop();
+
+	/**
+	 * Gets the items that were processed since the last call.
+	 *
+	 * @param done receives the numbers of the items.
+	 * @return whether all items were processed.
+	 */
+	bool Poll(std::vector<int>& done);
+
+private:
+	void Run();
+
+	Job job;
+	std::function<void()> write_index;
+	int count = 0;
+
+	std::vector<std::thread> workers;
+	std::atomic<int> next_item{0};
+	std::atomic<bool> quit{false};
+
+	std::mutex mutex;
+	std::vector<int> done_items;
+	int remaining = 0;
+	bool changed = false;
+};
+
+#endif
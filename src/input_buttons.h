@@ -52,6 +52,7 @@ namespace Input {
 		DEBUG_MENU,
 		DEBUG_THROUGH,
 		DEBUG_SAVE,
+		DEBUG_REWIND,
 		TOGGLE_FPS,
 		TAKE_SCREENSHOT,
 		SHOW_LOG,
@@ -74,6 +74,7 @@ void Input::InitButtons() {
 	buttons[DEBUG_THROUGH].push_back(Keys::LCTRL);
 	buttons[DEBUG_THROUGH].push_back(Keys::RCTRL);
 	buttons[DEBUG_SAVE].push_back(Keys::F11);
+	buttons[DEBUG_REWIND].push_back(Keys::R);
 	buttons[TAKE_SCREENSHOT].push_back(Keys::F10);
 	buttons[TOGGLE_FPS].push_back(Keys::F2);
 	buttons[SHOW_LOG].push_back(Keys::F3);
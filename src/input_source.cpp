@@ -41,6 +41,6 @@ void Input::LogSource::Update() {
 	log_file >> pressed_buttons;
 
 	if (!log_file) {
-		Player::exit_flag = true;
+		Player::replay_finished = true;
 	}
 }
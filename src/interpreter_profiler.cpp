@@ -0,0 +1,337 @@
+/*
+ * This file is part of EasyRPG Player.
+ *
+ * EasyRPG Player is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * EasyRPG Player is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with EasyRPG Player. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Headers
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <map>
+#include <sstream>
+#include <tuple>
+#include "interpreter_profiler.h"
+#include "data.h"
+#include "filefinder.h"
+#include "game_map.h"
+#include "output.h"
+#include "picojson.h"
+#include "player.h"
+#include "reader_util.h"
+#include "utils.h"
+
+namespace {
+	typedef std::chrono::steady_clock profiler_clock;
+	typedef std::tuple<int, int, int> SourceKey;
+
+	struct UpdateFrame {
+		InterpreterProfiler::SourceStats* stats;
+		profiler_clock::time_point start;
+		double child_ms;
+	};
+
+	struct CommandFrame {
+		int code;
+		profiler_clock::time_point start;
+	};
+
+	bool enabled = false;
+	std::string report_path;
+	int max_depth = 0;
+
+	std::map<SourceKey, InterpreterProfiler::SourceStats> sources;
+	std::map<int, InterpreterProfiler::CommandStats> commands;
+
+	std::vector<UpdateFrame> update_stack;
+	std::vector<CommandFrame> command_stack;
+
+	double ElapsedMs(profiler_clock::time_point start) {
+		return std::chrono::duration<double, std::milli>(profiler_clock::now() - start).count();
+	}
+
+	std::string GetSourceName(const InterpreterProfiler::SourceStats& stats) {
+		switch (stats.type) {
+			case InterpreterProfiler::Source_MapEvent:
+				if (stats.map_id == Game_Map::GetMapId()) {
+					Game_Event* ev = Game_Map::GetEvent(stats.id);
+					if (ev) {
+						return ev->GetName();
+					}
+				}
+				break;
+			case InterpreterProfiler::Source_CommonEvent: {
+				const RPG::CommonEvent* ce = ReaderUtil::GetElement(Data::commonevents, stats.id);
+				if (ce) {
+					return ce->name;
+				}
+				break;
+			}
+			case InterpreterProfiler::Source_BattleEvent: {
+				const RPG::Troop* troop = ReaderUtil::GetElement(Data::troops, stats.id);
+				if (troop) {
+					return troop->name;
+				}
+				break;
+			}
+			default:
+				break;
+		}
+		return "";
+	}
+
+	const char* GetTypeName(InterpreterProfiler::SourceType type) {
+		switch (type) {
+			case InterpreterProfiler::Source_MapEvent:
+				return "map_event";
+			case InterpreterProfiler::Source_CommonEvent:
+				return "common_event";
+			case InterpreterProfiler::Source_BattleEvent:
+				return "battle_event";
+			default:
+				return "unknown";
+		}
+	}
+
+	std::string CsvEscape(const std::string& s) {
+		std::string res = "\"";
+		for (char c : s) {
+			if (c == '"') {
+				res += '"';
+			}
+			res += c;
+		}
+		res += '"';
+		return res;
+	}
+}
+
+void InterpreterProfiler::SetEnabled(bool new_enabled) {
+	if (enabled == new_enabled) {
+		return;
+	}
+
+	enabled = new_enabled;
+	update_stack.clear();
+	command_stack.clear();
+
+	Output::Debug("Interpreter profiler %s", enabled ? "enabled" : "disabled");
+}
+
+bool InterpreterProfiler::IsEnabled() {
+	return enabled;
+}
+
+void InterpreterProfiler::Reset() {
+	sources.clear();
+	commands.clear();
+	update_stack.clear();
+	command_stack.clear();
+	max_depth = 0;
+}
+
+void InterpreterProfiler::SetReportPath(const std::string& path) {
+	report_path = path;
+}
+
+void InterpreterProfiler::Quit() {
+	if (!report_path.empty() && (!sources.empty() || !commands.empty())) {
+		std::shared_ptr<std::fstream> os = FileFinder::openUTF8(report_path,
+			std::ios_base::out | std::ios_base::trunc);
+
+		if (!os) {
+			Output::Warning("Profiler: Could not write report to %s", report_path.c_str());
+		} else {
+			std::string ext = report_path.size() >= 5 ?
+				Utils::LowerCase(report_path.substr(report_path.size() - 5)) : "";
+			if (ext == ".json") {
+				WriteJson(*os);
+			} else {
+				WriteCsv(*os);
+			}
+			Output::Debug("Profiler: Report written to %s", report_path.c_str());
+		}
+	}
+
+	SetEnabled(false);
+	Reset();
+}
+
+void InterpreterProfiler::BeginUpdate(SourceType type, int id, int depth) {
+	int map_id = type == Source_MapEvent ? Game_Map::GetMapId() : 0;
+
+	SourceStats& stats = sources[SourceKey(type, map_id, id)];
+	stats.type = type;
+	stats.id = id;
+	stats.map_id = map_id;
+	++stats.executions;
+	stats.max_depth = std::max(stats.max_depth, depth);
+	max_depth = std::max(max_depth, depth);
+
+	update_stack.push_back({&stats, profiler_clock::now(), 0.0});
+}
+
+void InterpreterProfiler::EndUpdate(bool limit_hit) {
+	if (update_stack.empty()) {
+		// Profiler was reset during the update
+		return;
+	}
+
+	UpdateFrame frame = update_stack.back();
+	update_stack.pop_back();
+
+	double elapsed = ElapsedMs(frame.start);
+	frame.stats->total_ms += elapsed;
+	frame.stats->self_ms += elapsed - frame.child_ms;
+
+	if (limit_hit && frame.stats->last_limit_frame != Player::GetFrames()) {
+		++frame.stats->limit_hits;
+		frame.stats->last_limit_frame = Player::GetFrames();
+	}
+
+	if (!update_stack.empty()) {
+		update_stack.back().child_ms += elapsed;
+	}
+}
+
+void InterpreterProfiler::BeginCommand(int code) {
+	if (!update_stack.empty()) {
+		++update_stack.back().stats->commands;
+	}
+
+	command_stack.push_back({code, profiler_clock::now()});
+}
+
+void InterpreterProfiler::EndCommand() {
+	if (command_stack.empty()) {
+		return;
+	}
+
+	CommandFrame frame = command_stack.back();
+	command_stack.pop_back();
+
+	CommandStats& stats = commands[frame.code];
+	stats.code = frame.code;
+	++stats.count;
+	stats.total_ms += ElapsedMs(frame.start);
+}
+
+std::vector<InterpreterProfiler::SourceStats> InterpreterProfiler::GetSourceStats() {
+	std::vector<SourceStats> result;
+	result.reserve(sources.size());
+	for (const auto& it : sources) {
+		result.push_back(it.second);
+	}
+
+	std::stable_sort(result.begin(), result.end(), [](const SourceStats& a, const SourceStats& b) {
+		return a.self_ms > b.self_ms;
+	});
+
+	return result;
+}
+
+std::vector<InterpreterProfiler::CommandStats> InterpreterProfiler::GetCommandStats() {
+	std::vector<CommandStats> result;
+	result.reserve(commands.size());
+	for (const auto& it : commands) {
+		result.push_back(it.second);
+	}
+
+	std::stable_sort(result.begin(), result.end(), [](const CommandStats& a, const CommandStats& b) {
+		return a.total_ms > b.total_ms;
+	});
+
+	return result;
+}
+
+std::string InterpreterProfiler::GetSourceLabel(const SourceStats& stats) {
+	std::stringstream ss;
+	switch (stats.type) {
+		case Source_MapEvent:
+			ss << "EV";
+			break;
+		case Source_CommonEvent:
+			ss << "CE";
+			break;
+		case Source_BattleEvent:
+			ss << "TP";
+			break;
+		default:
+			ss << "??";
+			break;
+	}
+	ss << std::setfill('0') << std::setw(4) << stats.id;
+	return ss.str();
+}
+
+void InterpreterProfiler::WriteCsv(std::ostream& os) {
+	os << "type,map_id,id,name,executions,commands,total_ms,self_ms,limit_hits,last_limit_frame,max_depth\n";
+	for (const auto& stats : GetSourceStats()) {
+		os << GetTypeName(stats.type) << ","
+			<< stats.map_id << ","
+			<< stats.id << ","
+			<< CsvEscape(GetSourceName(stats)) << ","
+			<< stats.executions << ","
+			<< stats.commands << ","
+			<< stats.total_ms << ","
+			<< stats.self_ms << ","
+			<< stats.limit_hits << ","
+			<< stats.last_limit_frame << ","
+			<< stats.max_depth << "\n";
+	}
+
+	os << "\ncode,count,total_ms\n";
+	for (const auto& stats : GetCommandStats()) {
+		os << stats.code << ","
+			<< stats.count << ","
+			<< stats.total_ms << "\n";
+	}
+}
+
+void InterpreterProfiler::WriteJson(std::ostream& os) {
+	picojson::array source_list;
+	for (const auto& stats : GetSourceStats()) {
+		picojson::object o;
+		o["type"] = picojson::value(GetTypeName(stats.type));
+		o["map_id"] = picojson::value(static_cast<double>(stats.map_id));
+		o["id"] = picojson::value(static_cast<double>(stats.id));
+		o["name"] = picojson::value(GetSourceName(stats));
+		o["executions"] = picojson::value(static_cast<double>(stats.executions));
+		o["commands"] = picojson::value(static_cast<double>(stats.commands));
+		o["total_ms"] = picojson::value(stats.total_ms);
+		o["self_ms"] = picojson::value(stats.self_ms);
+		o["limit_hits"] = picojson::value(static_cast<double>(stats.limit_hits));
+		o["last_limit_frame"] = picojson::value(static_cast<double>(stats.last_limit_frame));
+		o["max_depth"] = picojson::value(static_cast<double>(stats.max_depth));
+		source_list.push_back(picojson::value(o));
+	}
+
+	picojson::array command_list;
+	for (const auto& stats : GetCommandStats()) {
+		picojson::object o;
+		o["code"] = picojson::value(static_cast<double>(stats.code));
+		o["count"] = picojson::value(static_cast<double>(stats.count));
+		o["total_ms"] = picojson::value(stats.total_ms);
+		command_list.push_back(picojson::value(o));
+	}
+
+	picojson::object root;
+	root["frames"] = picojson::value(static_cast<double>(Player::GetFrames()));
+	root["max_depth"] = picojson::value(static_cast<double>(max_depth));
+	root["sources"] = picojson::value(source_list);
+	root["commands"] = picojson::value(command_list);
+
+	os << picojson::value(root).serialize(true);
+}
@@ -0,0 +1,185 @@
+/*
+ * This file is part of EasyRPG Player.
+ *
+ * EasyRPG Player is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * EasyRPG Player is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with EasyRPG Player. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef EP_INTERPRETER_PROFILER_H
+#define EP_INTERPRETER_PROFILER_H
+
+// Headers
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+/**
+ * Opt-in profiler for the event interpreter.
+ * Collects execution statistics per map event, common event and
+ * event command code. When disabled all hooks only test a flag.
+ */
+namespace InterpreterProfiler {
+	/** Origin of the event commands run by an interpreter */
+	enum SourceType {
+		Source_Unknown,
+		Source_MapEvent,
+		Source_CommonEvent,
+		Source_BattleEvent
+	};
+
+	struct SourceStats {
+		SourceType type = Source_Unknown;
+		/** Event, common event or troop ID */
+		int id = 0;
+		/** Map the event belongs to, 0 for common and battle events */
+		int map_id = 0;
+		/** Number of interpreter updates */
+		uint64_t executions = 0;
+		/** Number of executed event commands */
+		uint64_t commands = 0;
+		/** Wall time including called events in ms */
+		double total_ms = 0.0;
+		/** Wall time excluding called events in ms */
+		double self_ms = 0.0;
+		/** Frames in which the 10000 command limit was hit */
+		int limit_hits = 0;
+		/** Last frame the limit was hit, -1 if never */
+		int last_limit_frame = -1;
+		/** Deepest CallEvent nesting this source was executed at */
+		int max_depth = 0;
+	};
+
+	struct CommandStats {
+		int code = 0;
+		uint64_t count = 0;
+		double total_ms = 0.0;
+	};
+
+	/**
+	 * Enables or disables data collection.
+	 *
+	 * @param enabled new state
+	 */
+	void SetEnabled(bool enabled);
+
+	/**
+	 * @return Whether the profiler collects data
+	 */
+	bool IsEnabled();
+
+	/**
+	 * Discards all collected data.
+	 */
+	void Reset();
+
+	/**
+	 * Sets the file the report is written to by Quit.
+	 * The format is JSON when the file ends with ".json", otherwise CSV.
+	 *
+	 * @param path report file, empty to disable
+	 */
+	void SetReportPath(const std::string& path);
+
+	/**
+	 * Writes the report file (when configured) and disables the profiler.
+	 */
+	void Quit();
+
+	/**
+	 * Marks the begin of an interpreter update.
+	 * Must be paired with EndUpdate.
+	 *
+	 * @param type source type
+	 * @param id source id
+	 * @param depth callstack depth of the interpreter
+	 */
+	void BeginUpdate(SourceType type, int id, int depth);
+
+	/**
+	 * Marks the end of the current interpreter update.
+	 *
+	 * @param limit_hit whether the command execution limit was reached
+	 */
+	void EndUpdate(bool limit_hit);
+
+	/**
+	 * Marks the begin of an event command.
+	 * Must be paired with EndCommand.
+	 *
+	 * @param code event command code
+	 */
+	void BeginCommand(int code);
+
+	/**
+	 * Marks the end of the current event command.
+	 */
+	void EndCommand();
+
+	/**
+	 * @return statistics of all sources, sorted by self time (descending)
+	 */
+	std::vector<SourceStats> GetSourceStats();
+
+	/**
+	 * @return statistics of all command codes, sorted by total time (descending)
+	 */
+	std::vector<CommandStats> GetCommandStats();
+
+	/**
+	 * Returns a short human readable name for a source, e.g. "EV0012" or "CE0003".
+	 *
+	 * @param stats source
+	 * @return name
+	 */
+	std::string GetSourceLabel(const SourceStats& stats);
+
+	/**
+	 * Writes the collected data as CSV.
+	 *
+	 * @param os output stream
+	 */
+	void WriteCsv(std::ostream& os);
+
+	/**
+	 * Writes the collected data as JSON.
+	 *
+	 * @param os output stream
+	 */
+	void WriteJson(std::ostream& os);
+
+	/**
+	 * RAII helper around BeginUpdate/EndUpdate.
+	 */
+	class UpdateScope {
+	public:
+		UpdateScope(SourceType type, int id, int depth) : active(IsEnabled()) {
+			if (active) {
+				BeginUpdate(type, id, depth);
+			}
+		}
+		~UpdateScope() {
+			if (active) {
+				EndUpdate(limit_hit);
+			}
+		}
+		void SetLimitHit() {
+			limit_hit = true;
+		}
+	private:
+		bool active;
+		bool limit_hit = false;
+	};
+}
+
+#endif
@@ -0,0 +1,229 @@
+/*
+ * This file is part of EasyRPG Player.
+ *
+ * EasyRPG Player is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * EasyRPG Player is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with EasyRPG Player. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Headers
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <list>
+#include <mutex>
+#include <thread>
+#include "filefinder.h"
+#include "lmu_reader.h"
+#include "map_cache.h"
+#include "player.h"
+#include "utils.h"
+
+namespace {
+	// Number of maps kept in memory
+	const size_t cache_size = 8;
+
+	struct Entry {
+		std::string path;
+		int64_t mtime;
+		Offset size;
+		std::shared_ptr<const RPG::Map> map;
+		/** Queued or parsed by the loader right now */
+		bool pending;
+	};
+
+	struct Job {
+		std::string path;
+		std::string encoding;
+	};
+
+	class Loader {
+	public:
+		~Loader();
+
+		void Run();
+		std::list<Entry>::iterator Find(const std::string& path);
+		void Insert(Entry entry);
+
+		std::mutex mutex;
+		// Signals new jobs to the loader
+		std::condition_variable cv;
+		// Signals finished jobs to Get
+		std::condition_variable cv_done;
+		std::thread thread;
+		std::deque<Job> jobs;
+		bool quit = false;
+
+		// Most recently used map first
+		std::list<Entry> entries;
+	};
+
+	Loader loader;
+
+	std::shared_ptr<const RPG::Map> Parse(const std::string& path, const std::string& encoding) {
+		if (Utils::EndsWith(Utils::LowerCase(path), ".emu")) {
+			return LMU_Reader::LoadXml(path);
+		}
+		return LMU_Reader::Load(path, encoding);
+	}
+}
+
+Loader::~Loader() {
+	if (thread.joinable()) {
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			quit = true;
+		}
+		cv.notify_one();
+		thread.join();
+	}
+}
+
+void Loader::Run() {
+	std::unique_lock<std::mutex> lock(mutex);
+	while (!quit) {
+		if (jobs.empty()) {
+			cv.wait(lock);
+			continue;
+		}
+
+		Job job = std::move(jobs.front());
+		jobs.pop_front();
+		lock.unlock();
+
+		std::shared_ptr<const RPG::Map> map = Parse(job.path, job.encoding);
+
+		lock.lock();
+		auto it = Find(job.path);
+		if (it != entries.end() && it->pending) {
+			if (map) {
+				it->map = std::move(map);
+				it->pending = false;
+			} else {
+				// Get reports the error when the map is needed
+				entries.erase(it);
+			}
+		}
+		cv_done.notify_all();
+	}
+}
+
+std::list<Entry>::iterator Loader::Find(const std::string& path) {
+	return std::find_if(entries.begin(), entries.end(), [&path](const Entry& entry) {
+		return entry.path == path;
+	});
+}
+
+void Loader::Insert(Entry entry) {
+	entries.push_front(std::move(entry));
+
+	// Pending entries are kept, the loader inserts into them
+	auto it = entries.end();
+	while (entries.size() > cache_size && it != std::next(entries.begin())) {
+		--it;
+		if (!it->pending) {
+			it = entries.erase(it);
+		}
+	}
+}
+
+std::shared_ptr<const RPG::Map> MapCache::Get(const std::string& map_file) {
+	int64_t mtime = FileFinder::GetFileModifiedTime(map_file);
+	Offset size = FileFinder::GetFileSize(map_file);
+
+	std::unique_lock<std::mutex> lock(loader.mutex);
+
+	auto it = loader.Find(map_file);
+	if (it != loader.entries.end() && it->pending) {
+		auto job = std::find_if(loader.jobs.begin(), loader.jobs.end(), [&map_file](const Job& job) {
+			return job.path == map_file;
+		});
+		if (job != loader.jobs.end()) {
+			// Not started yet, parsing it here is faster than waiting for the queue
+			loader.jobs.erase(job);
+			loader.entries.erase(it);
+		} else {
+			loader.cv_done.wait(lock, [&map_file]() {
+				auto it = loader.Find(map_file);
+				return it == loader.entries.end() || !it->pending;
+			});
+		}
+		it = loader.Find(map_file);
+	}
+
+	if (it != loader.entries.end()) {
+		if (it->mtime == mtime && it->size == size) {
+			loader.entries.splice(loader.entries.begin(), loader.entries, it);
+			return it->map;
+		}
+		// Changed on disk
+		loader.entries.erase(it);
+	}
+	lock.unlock();
+
+	std::shared_ptr<const RPG::Map> map = Parse(map_file, Player::encoding);
+	if (!map || mtime < 0) {
+		return map;
+	}
+
+	lock.lock();
+	it = loader.Find(map_file);
+	if (it == loader.entries.end()) {
+		loader.Insert({ map_file, mtime, size, map, false });
+	}
+
+	return map;
+}
+
+void MapCache::Preload(const std::string& map_file) {
+#ifdef EMSCRIPTEN
+	// No threads, Get parses the map when it is needed
+	(void)map_file;
+#else
+	int64_t mtime = FileFinder::GetFileModifiedTime(map_file);
+	if (mtime < 0) {
+		return;
+	}
+	Offset size = FileFinder::GetFileSize(map_file);
+
+	std::lock_guard<std::mutex> lock(loader.mutex);
+
+	auto it = loader.Find(map_file);
+	if (it != loader.entries.end()) {
+		if (it->pending || (it->mtime == mtime && it->size == size)) {
+			return;
+		}
+		loader.entries.erase(it);
+	}
+
+	loader.Insert({ map_file, mtime, size, nullptr, true });
+	loader.jobs.push_back({ map_file, Player::encoding });
+
+	if (!loader.thread.joinable()) {
+		loader.thread = std::thread(&Loader::Run, &loader);
+	}
+	loader.cv.notify_one();
+#endif
+}
+
+void MapCache::Clear() {
+	std::lock_guard<std::mutex> lock(loader.mutex);
+
+	// Pending entries are kept, the loader inserts into them
+	for (auto it = loader.entries.begin(); it != loader.entries.end(); ) {
+		if (it->pending) {
+			++it;
+		} else {
+			it = loader.entries.erase(it);
+		}
+	}
+}
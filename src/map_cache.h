@@ -0,0 +1,57 @@
+/*
+ * This file is part of EasyRPG Player.
+ *
+ * EasyRPG Player is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * EasyRPG Player is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with EasyRPG Player. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef EP_MAP_CACHE_H
+#define EP_MAP_CACHE_H
+
+// Headers
+#include <memory>
+#include <string>
+#include "rpg_map.h"
+
+/**
+ * Cache of parsed map files.
+ *
+ * Keeps the most recently used maps, an entry is only used as long as the
+ * modification time and size of the file did not change. Maps the player
+ * is likely to enter next are parsed in the background by Preload.
+ */
+namespace MapCache {
+	/**
+	 * Gets a parsed map. The map is parsed when it is not cached, a running
+	 * Preload of the file is waited for.
+	 *
+	 * @param map_file path of the map file (.lmu or .emu)
+	 * @return the map or null on error (see LcfReader::GetError)
+	 */
+	std::shared_ptr<const RPG::Map> Get(const std::string& map_file);
+
+	/**
+	 * Parses a map in the background unless it is already cached.
+	 * Does nothing on Emscripten (no threads).
+	 *
+	 * @param map_file path of the map file (.lmu or .emu)
+	 */
+	void Preload(const std::string& map_file);
+
+	/**
+	 * Removes all maps from the cache.
+	 */
+	void Clear();
+}
+
+#endif
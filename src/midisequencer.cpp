@@ -195,19 +195,23 @@ namespace midisequencer{
         }
     }
 
+    namespace{
+        bool message_before(const midi_message& m, float time)
+        {
+            return m.time < time;
+        }
+    }
     void sequencer::set_time(float time, output* out)
     {
-        if(position != messages.begin() && (position - 1)->time >= time){
+        // messages are sorted by time, the target is found by bisection
+        std::vector<midi_message>::iterator target = std::lower_bound(messages.begin(), messages.end(), time, message_before);
+        if(target < position || position == messages.begin()){
             position = messages.begin();
-        }
-        if(position == messages.begin() && position != messages.end() && position->time < time){
             out->reset();
         }
 
-        if(position->time > time)
-            position = messages.begin();
-
-        while(position != messages.end() && position->time < time){
+        // Restore the controller state, notes before the target are skipped
+        while(position != target){
             uint_least32_t message = position->message;
             int port = position->port;
             ++position;
@@ -229,10 +233,7 @@ namespace midisequencer{
                 }
                     break;
                 default:
-
-                    if((message & 0xF0) == 0x80 || (message & 0xF0) == 0x90)
-                    {
-                        out->meta_event(META_EVENT_ALL_NOTE_OFF, NULL, 0);
+                    if((message & 0xF0) == 0x80 || (message & 0xF0) == 0x90){
                         break;
                     }
 
@@ -162,6 +162,27 @@ namespace midisynth{
         }
         notes.clear();
     }
+    // Returns whether a note is released or sounded off.
+    bool channel::has_released_note()const
+    {
+        for(std::vector<NOTE>::const_iterator i = notes.begin(); i != notes.end(); ++i){
+            if(i->status != NOTE::NOTEON){
+                return true;
+            }
+        }
+        return false;
+    }
+    // Removes the oldest (released) note immediately.
+    void channel::steal_note(bool released_only)
+    {
+        for(std::vector<NOTE>::iterator i = notes.begin(); i != notes.end(); ++i){
+            if(!released_only || i->status != NOTE::NOTEON){
+                delete i->note;
+                notes.erase(i);
+                return;
+            }
+        }
+    }
     // Note on. Sound output.
     void channel::note_on(int note, int velocity)
     {
@@ -440,7 +461,8 @@ namespace midisynth{
     }
 
     // Synthesizer constructor.
-    synthesizer::synthesizer(note_factory* factory)
+    synthesizer::synthesizer(note_factory* factory):
+        max_polyphony(0)
     {
         for(int i = 0; i < 16; ++i){
             channels[i].reset(new channel(factory, i == 9 ? 0x3C00 : 0x3C80));
@@ -457,11 +479,11 @@ namespace midisynth{
     int synthesizer::synthesize(int_least16_t* output, std::size_t samples, float rate)
     {
         std::size_t n = samples * 2;
-        std::vector<int_least32_t> buf(n);
-        int num_notes = synthesize_mixing(&buf[0], samples, rate);
+        mix_buffer.assign(n, 0);
+        int num_notes = synthesize_mixing(&mix_buffer[0], samples, rate);
         if(num_notes){
             for(std::size_t i = 0; i < n; ++i){
-                int_least32_t x = buf[i];
+                int_least32_t x = mix_buffer[i];
                 if(x < -32767){
                     output[i] = -32767;
                 }else if(x > 32767){
@@ -539,6 +561,42 @@ namespace midisynth{
             channels[i]->all_sound_off_immediately();
         }
     }
+    // Note on. Ends another note first when the polyphony limit is reached.
+    void synthesizer::note_on(int channel, int note, int velocity)
+    {
+        if(velocity && max_polyphony > 0){
+            int num_notes = 0;
+            for(int i = 0; i < NUM_CHANNELS; ++i){
+                num_notes += channels[i]->get_num_notes();
+            }
+            for(; num_notes >= max_polyphony && num_notes > 0; --num_notes){
+                steal_note();
+            }
+        }
+        get_channel(channel)->note_on(note, velocity);
+    }
+    // Voice stealing. Takes the oldest note of the channel with the most notes,
+    // notes in the release phase are taken first.
+    void synthesizer::steal_note()
+    {
+        channel* victim = NULL;
+        bool released = false;
+        for(int i = 0; i < NUM_CHANNELS; ++i){
+            channel* ch = channels[i].get();
+            int num_notes = ch->get_num_notes();
+            if(num_notes == 0){
+                continue;
+            }
+            bool r = ch->has_released_note();
+            if(!victim || (r && !released) || (r == released && num_notes > victim->get_num_notes())){
+                victim = ch;
+                released = r;
+            }
+        }
+        if(victim){
+            victim->steal_note(released);
+        }
+    }
     // Sets and execututes system exclusive messages.
     void synthesizer::sysex_message(const void* pvdata, std::size_t size)
     {
@@ -679,9 +737,9 @@ namespace midisynth{
         }
     }
     // Adds modulation.
-    void sine_wave_generator::add_modulation(int_least32_t x)
+    void sine_wave_generator::add_modulation(int_least32_t x, int times)
     {
-        position += static_cast<int_least32_t>(static_cast<int_least64_t>(step) * x >> 16);
+        position += static_cast<int_least32_t>(static_cast<int_least64_t>(step) * x * times >> 16);
     }
     // Gets the next sample.
     inline int sine_wave_generator::get_next()
@@ -1055,7 +1113,8 @@ namespace midisynth{
            SR * 2 + keyscale_table[KS][key],
            RR * 4 + keyscale_table[KS][key] + 2,
            SL,
-           TL)
+           TL),
+        level(0)
     {
         assert(AR >= 0 && AR <= 31);
         assert(DR >= 0 && DR <= 31);
@@ -1089,20 +1148,26 @@ namespace midisynth{
         freq += DT;
         freq *= ML;
         swg.set_cycle(rate / freq);
-        eg.set_rate(rate);
+        // The envelope advances a control step per call
+        eg.set_rate(rate / CONTROL_PERIOD);
+    }
+    // Advances the envelope by a control step.
+    inline void fm_operator::update_envelope()
+    {
+        level = eg.get_next();
+    }
+    inline void fm_operator::update_envelope(int ams)
+    {
+        level = eg.get_next() * (ams * ams_factor + ams_bias) >> 15;
     }
     // Gets the next sample.
     inline int fm_operator::get_next()
     {
-        return static_cast<int_least32_t>(swg.get_next()) * eg.get_next() >> 15;
+        return static_cast<int_least32_t>(swg.get_next()) * level >> 15;
     }
     inline int fm_operator::get_next(int modulate)
     {
-        return static_cast<int_least32_t>(swg.get_next(modulate)) * eg.get_next() >> 15;
-    }
-    inline int fm_operator::get_next(int ams, int modulate)
-    {
-        return (static_cast<int_least32_t>(swg.get_next(modulate)) * eg.get_next() >> 15) * (ams * ams_factor + ams_bias) >> 15;
+        return static_cast<int_least32_t>(swg.get_next(modulate)) * level >> 15;
     }
 
     // Vibrato table.
@@ -1141,7 +1206,9 @@ namespace midisynth{
         rate(0),
         feedback(0),
         damper(0),
-        sostenute(0)
+        sostenute(0),
+        control_remaining(0),
+        control_tremolo(4096)
     {
         assert(ALG >= 0 && ALG <= 7);
         assert(params.LFO >= 0 && params.LFO <= 7);
@@ -1163,9 +1230,11 @@ namespace midisynth{
     {
         if(this->rate != rate){
             this->rate = rate;
-            ams_lfo.set_cycle(rate / ams_freq);
-            vibrato_lfo.set_cycle(rate / vibrato_freq);
-            tremolo_lfo.set_cycle(rate / tremolo_freq);
+            // The LFOs advance a control step per call
+            float control_rate = rate / CONTROL_PERIOD;
+            ams_lfo.set_cycle(control_rate / ams_freq);
+            vibrato_lfo.set_cycle(control_rate / vibrato_freq);
+            tremolo_lfo.set_cycle(control_rate / tremolo_freq);
             float f = freq * freq_mul;
             op1.set_freq_rate(f, rate);
             op2.set_freq_rate(f, rate);
@@ -1217,14 +1286,14 @@ namespace midisynth{
     {
         tremolo_depth = depth;
         tremolo_freq = frequency;
-        tremolo_lfo.set_cycle(rate / frequency);
+        tremolo_lfo.set_cycle(rate / CONTROL_PERIOD / frequency);
     }
     // Sets vibrato effect.
     void fm_sound_generator::set_vibrato(float depth, float frequency)
     {
         vibrato_depth = static_cast<int>(depth * (vibrato_table::DIVISION / 256.0));
         vibrato_freq = frequency;
-        vibrato_lfo.set_cycle(rate / frequency);
+        vibrato_lfo.set_cycle(rate / CONTROL_PERIOD / frequency);
     }
     // Key-off.
     void fm_sound_generator::key_off()
@@ -1263,88 +1332,118 @@ namespace midisynth{
             return true;
         }
     }
-    // Gets the next sample.
-    int fm_sound_generator::get_next()
+    // Updates envelopes and LFOs for the next control step of CONTROL_PERIOD samples. Returns the tremolo factor.
+    int_least32_t fm_sound_generator::update_control()
     {
         if(vibrato_depth){
             int x = static_cast<int_least32_t>(vibrato_lfo.get_next()) * vibrato_depth >> 15;
             int_least32_t modulation = vibrato_table.get(x);
-            op1.add_modulation(modulation);
-            op2.add_modulation(modulation);
-            op3.add_modulation(modulation);
-            op4.add_modulation(modulation);
+            op1.add_modulation(modulation, CONTROL_PERIOD);
+            op2.add_modulation(modulation, CONTROL_PERIOD);
+            op3.add_modulation(modulation, CONTROL_PERIOD);
+            op4.add_modulation(modulation, CONTROL_PERIOD);
         }
-        int feedback = (this->feedback << 1) >> FB;
-        int ret;
         if(ams_enable){
             int ams = ams_lfo.get_next() >> 7;
-            switch(ALG){
-            case 0:
-                ret = op4(ams, op3(ams, op2(ams, this->feedback = op1(ams, feedback))));
-                break;
-            case 1:
-                ret = op4(ams, op3(ams, op2(ams, 0) + (this->feedback = op1(ams, feedback))));
-                break;
-            case 2:
-                ret = op4(ams, op3(ams, op2(ams, 0)) + (this->feedback = op1(ams, feedback)));
-                break;
-            case 3:
-                ret = op4(ams, op3(ams, 0) + op2(ams, this->feedback = op1(ams, feedback)));
-                break;
-            case 4:
-                ret = op4(ams, op3(ams, 0)) + op2(ams, this->feedback = op1(ams, feedback));
-                break;
-            case 5:
-                this->feedback = feedback = op1(ams, feedback);
-                ret = op4(ams, feedback) + op3(ams, feedback) + op2(ams, feedback);
-                break;
-            case 6:
-                ret = op4(ams, 0) + op3(ams, 0) + op2(ams, this->feedback = op1(ams, feedback));
-                break;
-            case 7:
-                ret = op4(ams, 0) + op3(ams, 0) + op2(ams, 0) + (this->feedback = op1(ams, feedback));
-                break;
-            default:
-                assert(!"fm_sound_generator: invalid algorithm number");
-                return 0;
-            }
+            op1.update_envelope(ams);
+            op2.update_envelope(ams);
+            op3.update_envelope(ams);
+            op4.update_envelope(ams);
         }else{
-            switch(ALG){
-            case 0:
-                ret = op4(op3(op2(this->feedback = op1(feedback))));
-                break;
-            case 1:
-                ret = op4(op3(op2() + (this->feedback = op1(feedback))));
-                break;
-            case 2:
-                ret = op4(op3(op2()) + (this->feedback = op1(feedback)));
-                break;
-            case 3:
-                ret = op4(op3() + op2(this->feedback = op1(feedback)));
-                break;
-            case 4:
-                ret = op4(op3()) + op2(this->feedback = op1(feedback));
-                break;
-            case 5:
-                this->feedback = feedback = op1(feedback);
-                ret = op4(feedback) + op3(feedback) + op2(feedback);
-                break;
-            case 6:
-                ret = op4() + op3() + op2(this->feedback = op1(feedback));
-                break;
-            case 7:
-                ret = op4() + op3() + op2() + (this->feedback = op1(feedback));
-                break;
-            default:
-                assert(!"fm_sound_generator: invalid algorithm number");
-                return 0;
-            }
+            op1.update_envelope();
+            op2.update_envelope();
+            op3.update_envelope();
+            op4.update_envelope();
         }
         if(tremolo_depth){
-            int_least32_t x = 4096 - (((static_cast<int_least32_t>(tremolo_lfo.get_next()) + 32768) * tremolo_depth) >> 11);
-            ret = ret * x >> 12;
+            return 4096 - (((static_cast<int_least32_t>(tremolo_lfo.get_next()) + 32768) * tremolo_depth) >> 11);
+        }
+        return 4096;
+    }
+    // Synthesizes samples with a fixed algorithm and mixes them into buf.
+    template<int ALG> void fm_sound_generator::synthesize_algorithm(int_least32_t* buf, std::size_t samples, int_least32_t left, int_least32_t right)
+    {
+        // A control step which does not fit into this call is continued in the next one,
+        // so the envelopes and LFOs advance independent of the block size.
+        for(std::size_t i = 0; i < samples; ){
+            if(control_remaining == 0){
+                control_tremolo = update_control();
+                control_remaining = CONTROL_PERIOD;
+            }
+            int n = static_cast<int>(std::min<std::size_t>(control_remaining, samples - i));
+            int_least32_t tremolo = control_tremolo;
+            int_least32_t* out = buf + i * 2;
+            for(int j = 0; j < n; ++j){
+                int feedback = (this->feedback << 1) >> FB;
+                int ret;
+                switch(ALG){
+                case 0:
+                    ret = op4(op3(op2(this->feedback = op1(feedback))));
+                    break;
+                case 1:
+                    ret = op4(op3(op2() + (this->feedback = op1(feedback))));
+                    break;
+                case 2:
+                    ret = op4(op3(op2()) + (this->feedback = op1(feedback)));
+                    break;
+                case 3:
+                    ret = op4(op3() + op2(this->feedback = op1(feedback)));
+                    break;
+                case 4:
+                    ret = op4(op3()) + op2(this->feedback = op1(feedback));
+                    break;
+                case 5:
+                    this->feedback = feedback = op1(feedback);
+                    ret = op4(feedback) + op3(feedback) + op2(feedback);
+                    break;
+                case 6:
+                    ret = op4() + op3() + op2(this->feedback = op1(feedback));
+                    break;
+                default:
+                    ret = op4() + op3() + op2() + (this->feedback = op1(feedback));
+                    break;
+                }
+                ret = ret * tremolo >> 12;
+                out[j * 2 + 0] += (ret * left) >> 14;
+                out[j * 2 + 1] += (ret * right) >> 14;
+            }
+            control_remaining -= n;
+            i += n;
+        }
+    }
+    // Synthesizes samples and mixes them into buf.
+    void fm_sound_generator::synthesize(int_least32_t* buf, std::size_t samples, int_least32_t left, int_least32_t right)
+    {
+        // The algorithm is resolved once per call instead of per sample
+        switch(ALG){
+        case 0:
+            synthesize_algorithm<0>(buf, samples, left, right);
+            break;
+        case 1:
+            synthesize_algorithm<1>(buf, samples, left, right);
+            break;
+        case 2:
+            synthesize_algorithm<2>(buf, samples, left, right);
+            break;
+        case 3:
+            synthesize_algorithm<3>(buf, samples, left, right);
+            break;
+        case 4:
+            synthesize_algorithm<4>(buf, samples, left, right);
+            break;
+        case 5:
+            synthesize_algorithm<5>(buf, samples, left, right);
+            break;
+        case 6:
+            synthesize_algorithm<6>(buf, samples, left, right);
+            break;
+        case 7:
+            synthesize_algorithm<7>(buf, samples, left, right);
+            break;
+        default:
+            assert(!"fm_sound_generator: invalid algorithm number");
+            break;
         }
-        return ret;
     }
 
     // FM notes constructor.
@@ -1362,11 +1461,7 @@ namespace midisynth{
         left = (left * velocity) >> 7;
         right = (right * velocity) >> 7;
         fm.set_rate(rate);
-        for(std::size_t i = 0; i < samples; ++i){
-            int_least32_t sample = fm.get_next();
-            buf[i * 2 + 0] += (sample * left) >> 14;
-            buf[i * 2 + 1] += (sample * right) >> 14;
-        }
+        fm.synthesize(buf, samples, left, right);
         return !fm.is_finished();
     }
     // Note off.
@@ -44,6 +44,10 @@ namespace midisynth{
     */
     class channel;
 
+    // Samples per control step. Envelopes and LFOs are only updated once
+    // per step, the operators run at the sample rate.
+    enum{ CONTROL_PERIOD = 16 };
+
     // System mode enumeration type.
     enum system_mode_t{ system_mode_default, system_mode_gm, system_mode_gm2, system_mode_gs, system_mode_xg };
 
@@ -99,6 +103,9 @@ namespace midisynth{
         void all_note_off();
         void all_sound_off();
         void all_sound_off_immediately();
+        int get_num_notes()const{ return static_cast<int>(notes.size()); }
+        bool has_released_note()const;
+        void steal_note(bool released_only);
 
         void note_off(int note, int velocity);
         void note_on(int note, int velocity);
@@ -214,7 +221,7 @@ namespace midisynth{
         void all_sound_off();
         void all_sound_off_immediately();
 
-        void note_on(int channel, int note, int velocity){ get_channel(channel)->note_on(note, velocity); }
+        void note_on(int channel, int note, int velocity);
         void note_off(int channel, int note, int velocity){ get_channel(channel)->note_off(note, velocity); }
         void polyphonic_key_pressure(int channel, int note, int value){ get_channel(channel)->polyphonic_key_pressure(note, value); }
         void control_change(int channel, int control, int value){ get_channel(channel)->control_change(control, value); }
@@ -231,6 +238,7 @@ namespace midisynth{
         void set_master_fine_tuning(int value){ master_fine_tuning = value; update_master_frequency_multiplier(); }
         void set_master_coarse_tuning(int value){ master_coarse_tuning = value; update_master_frequency_multiplier(); }
         void set_system_mode(system_mode_t mode);
+        void set_max_polyphony(int value){ max_polyphony = value; }
 
         int get_main_volume()const{ return main_volume; }
         int get_master_volume()const{ return master_volume; }
@@ -238,9 +246,11 @@ namespace midisynth{
         int get_master_fine_tuning()const{ return master_fine_tuning; }
         int get_master_coarse_tuning()const{ return master_coarse_tuning; }
         system_mode_t get_system_mode()const{ return system_mode; }
+        int get_max_polyphony()const{ return max_polyphony; }
 
     private:
         std::unique_ptr<channel> channels[NUM_CHANNELS];
+        std::vector<int_least32_t> mix_buffer;
         float active_sensing;
         int main_volume;
         int master_volume;
@@ -249,7 +259,9 @@ namespace midisynth{
         int master_coarse_tuning;
         float master_frequency_multiplier;
         system_mode_t system_mode;
+        int max_polyphony;
         void update_master_frequency_multiplier();
+        void steal_note();
     };
 
     // Sine wave generator.
@@ -259,7 +271,7 @@ namespace midisynth{
         sine_wave_generator();
         sine_wave_generator(float cycle);
         void set_cycle(float cycle);
-        void add_modulation(int_least32_t x);
+        void add_modulation(int_least32_t x, int times = 1);
         int get_next();
         int get_next(int_least32_t modulation);
     private:
@@ -297,19 +309,20 @@ namespace midisynth{
         void set_freq_rate(float freq, float rate);
         void set_hold(float value){ eg.set_hold(value); }
         void set_freeze(float value){ eg.set_freeze(value); }
-        void add_modulation(int_least32_t x){ swg.add_modulation(x); }
+        void add_modulation(int_least32_t x, int times){ swg.add_modulation(x, times); }
         void key_off(){ eg.key_off(); }
         void sound_off(){ eg.sound_off(); }
         bool is_finished()const{ return eg.is_finished(); }
+        void update_envelope();
+        void update_envelope(int ams);
         int get_next();
         int get_next(int modulate);
-        int get_next(int lfo, int modulate);
         inline int operator()(){ return get_next(); }
         inline int operator()(int m){ return get_next(m); }
-        inline int operator()(int lfo, int m){ return get_next(lfo, m); }
     private:
         sine_wave_generator swg;
         envelope_generator eg;
+        int_least32_t level;
         float ML;
         float DT;
         int_least32_t ams_factor;
@@ -342,7 +355,7 @@ namespace midisynth{
         void key_off();
         void sound_off();
         bool is_finished()const;
-        int get_next();
+        void synthesize(int_least32_t* buf, std::size_t samples, int_least32_t left, int_least32_t right);
     private:
         fm_operator op1;
         fm_operator op2;
@@ -365,6 +378,10 @@ namespace midisynth{
         int feedback;
         int damper;
         int sostenute;
+        int control_remaining;
+        int_least32_t control_tremolo;
+        int_least32_t update_control();
+        template<int ALG> void synthesize_algorithm(int_least32_t* buf, std::size_t samples, int_least32_t left, int_least32_t right);
     };
 
     // FM sound generator notes.
@@ -71,6 +71,57 @@
 /** Enables or disables font smoothing. */
 #define FONT_SMOOTHING 0
 
+/**
+ * Maximum number of notes played at once by the built-in MIDI synthesizer,
+ * the oldest notes are ended when it is exceeded. 0 disables the limit.
+ */
+#ifndef FMMIDI_MAX_POLYPHONY
+#  if defined(_3DS) || defined(GEKKO) || defined(PSP2)
+#    define FMMIDI_MAX_POLYPHONY 24
+#  else
+#    define FMMIDI_MAX_POLYPHONY 0
+#  endif
+#endif
+
+/**
+ * Maximum number of sound effects played at once by the software mixer.
+ * When it is exceeded the quietest sound effect is replaced.
+ */
+#ifndef AUDIO_SE_MAX_VOICES
+#  if defined(_3DS) || defined(GEKKO) || defined(PSP2)
+#    define AUDIO_SE_MAX_VOICES 16
+#  else
+#    define AUDIO_SE_MAX_VOICES 64
+#  endif
+#endif
+
+/**
+ * Maximum number of instances of the same sound effect played at once by
+ * the software mixer. When it is exceeded the oldest instance restarts.
+ */
+#ifndef AUDIO_SE_MAX_INSTANCES
+#  define AUDIO_SE_MAX_INSTANCES 4
+#endif
+
+/**
+ * Number of frames on the map between two rewind snapshots in test play.
+ */
+#ifndef REWIND_INTERVAL
+#  define REWIND_INTERVAL 30
+#endif
+
+/**
+ * Number of rewind snapshots kept in test play, the oldest one is
+ * replaced when it is exceeded.
+ */
+#ifndef REWIND_SNAPSHOTS
+#  if defined(_3DS) || defined(GEKKO) || defined(PSP2)
+#    define REWIND_SNAPSHOTS 10
+#  else
+#    define REWIND_SNAPSHOTS 60
+#  endif
+#endif
+
 // OUTPUT_TYPE
 //		OUTPUT_NONE - no output
 //		OUTPUT_CONSOLE - print to console
@@ -20,6 +20,7 @@
 #include <algorithm>
 #include <cstring>
 #include <cstdlib>
+#include <deque>
 #include <iostream>
 #include <iomanip>
 #include <fstream>
@@ -42,9 +43,11 @@
 
 #include "async_handler.h"
 #include "audio.h"
+#include "audio_midicache.h"
 #include "cache.h"
 #include "filefinder.h"
 #include "game_actors.h"
+#include "game_interpreter.h"
 #include "game_map.h"
 #include "game_message.h"
 #include "game_enemyparty.h"
@@ -57,6 +60,7 @@
 #include "graphics.h"
 #include "inireader.h"
 #include "input.h"
+#include "interpreter_profiler.h"
 #include "ldb_reader.h"
 #include "lmt_reader.h"
 #include "lsd_reader.h"
@@ -65,14 +69,18 @@
 #include "player.h"
 #include "reader_lcf.h"
 #include "reader_util.h"
+#include "replay.h"
+#include "rewind.h"
 #include "scene_battle.h"
 #include "scene_logo.h"
+#include "startup_graph.h"
 #include "utils.h"
 #include "version.h"
 
 namespace Player {
 	bool exit_flag;
 	bool reset_flag;
+	bool replay_finished;
 	bool debug_flag;
 	bool hide_title_flag;
 	bool window_flag;
@@ -87,6 +95,10 @@ namespace Player {
 	int start_map_id;
 	bool no_rtp_flag;
 	bool no_audio_flag;
+	int audio_buffer_ms = 200;
+	std::string audio_output;
+	bool chase_pathfinding_flag;
+	bool midi_prerender_flag;
 	bool mouse_flag;
 	bool touch_flag;
 	std::string encoding;
@@ -112,6 +124,17 @@ namespace {
 	// Overwritten by --encoding
 	std::string forced_encoding;
 
+	// Further --replay-input logs, replayed after the current one
+	std::deque<std::string> replay_queue;
+	// Set by --seed, every replay starts with it
+	bool seed_flag = false;
+	int32_t seed;
+
+	// Set by --replay-turbo, --replay-mark and --replay-dump
+	int replay_turbo_interval = -1;
+	std::vector<int> replay_marks;
+	std::string replay_dump_path;
+
 	FileRequestBinding system_request_id;
 	FileRequestBinding save_request_id;
 	FileRequestBinding map_request_id;
@@ -154,6 +177,15 @@ void Player::Init(int argc, char *argv[]) {
 
 	ParseCommandLine(argc, argv);
 
+	if (replay_turbo_interval >= 0) {
+		if (replay_input_path.empty()) {
+			Output::Warning("--replay-turbo requires --replay-input");
+		} else {
+			no_audio_flag = true;
+			Replay::Init(replay_turbo_interval, replay_marks, replay_dump_path);
+		}
+	}
+
 #ifdef EMSCRIPTEN
 	Output::IgnorePause(true);
 
@@ -176,6 +208,8 @@ void Player::Init(int argc, char *argv[]) {
 
 	Main_Data::Init();
 
+	StartupGraph::ScopedStep step("Display");
+
 	DisplayUi.reset();
 
 	if(! DisplayUi) {
@@ -236,6 +270,30 @@ void Player::Resume() {
 	FrameReset();
 }
 
+/** Continues with the next --replay-input log */
+static void StartNextReplay() {
+	Player::replay_input_path = replay_queue.front();
+	replay_queue.pop_front();
+
+	Output::Debug("Replaying %s", Player::replay_input_path.c_str());
+
+	if (Replay::IsTurbo()) {
+		Replay::Restart();
+	}
+
+	// Start over like a new process, only the database, the directory
+	// trees and the asset caches are kept
+	Scene::PopUntil(Scene::Null);
+	Scene::Push(std::make_shared<Scene_Logo>(true));
+
+	Player::ResetGameState();
+
+	if (seed_flag) {
+		Utils::SeedRandomNumberGenerator(seed);
+	}
+	Input::Init(Player::replay_input_path, "");
+}
+
 void Player::Update(bool update_scene) {
 	// available ms per frame, game logic expects 60 fps
 	static const double framerate_interval = 1000.0 / Graphics::GetDefaultFps();
@@ -247,13 +305,20 @@ void Player::Update(bool update_scene) {
 	// 1000s of times.
 	Graphics::Draw();
 #else
-	double cur_time = (double)DisplayUi->GetTicks();
-	if (cur_time < next_frame) {
-		Graphics::Draw();
-		cur_time = (double)DisplayUi->GetTicks();
-		// Still time after graphic update? Yield until it's time for next one.
+	if (Replay::IsTurbo()) {
+		// No frame limit, most frames are not drawn
+		if (Replay::IsDrawFrame(frames)) {
+			Graphics::Draw();
+		}
+	} else {
+		double cur_time = (double)DisplayUi->GetTicks();
 		if (cur_time < next_frame) {
-			DisplayUi->Sleep((uint32_t)(next_frame - cur_time));
+			Graphics::Draw();
+			cur_time = (double)DisplayUi->GetTicks();
+			// Still time after graphic update? Yield until it's time for next one.
+			if (cur_time < next_frame) {
+				DisplayUi->Sleep((uint32_t)(next_frame - cur_time));
+			}
 		}
 	}
 #endif
@@ -281,6 +346,16 @@ void Player::Update(bool update_scene) {
 	// Update Logic:
 	DisplayUi->ProcessEvents();
 
+	if (replay_finished) {
+		replay_finished = false;
+		if (replay_queue.empty()) {
+			exit_flag = true;
+		} else {
+			StartNextReplay();
+			update_scene = false;
+		}
+	}
+
 	if (exit_flag) {
 		Scene::PopUntil(Scene::Null);
 	} else if (reset_flag) {
@@ -310,6 +385,10 @@ void Player::Update(bool update_scene) {
 			// RPG_RT compatible frame counter.
 			++Main_Data::game_data.system.frame_count;
 
+			if (Replay::IsTurbo()) {
+				Replay::OnFrame(frames);
+			}
+
 			// Scene changed or webplayer waits for files.
 			// Not save to Update again, setup code must run:
 			if (&*old_instance != &*Scene::instance || AsyncHandler::IsImportantFilePending()) {
@@ -349,6 +428,8 @@ void Player::Exit() {
 	DisplayUi->UpdateDisplay();
 #endif
 
+	InterpreterProfiler::Quit();
+	Replay::Report();
 	Player::ResetGameObjects();
 	Font::Dispose();
 	Graphics::Quit();
@@ -382,6 +463,7 @@ void Player::ParseCommandLine(int argc, char *argv[]) {
 	hide_title_flag = false;
 	exit_flag = false;
 	reset_flag = false;
+	replay_finished = false;
 	battle_test_flag = false;
 	battle_test_troop_id = 0;
 	new_game_flag = false;
@@ -391,6 +473,8 @@ void Player::ParseCommandLine(int argc, char *argv[]) {
 	start_map_id = -1;
 	no_rtp_flag = false;
 	no_audio_flag = false;
+	chase_pathfinding_flag = false;
+	midi_prerender_flag = false;
 	mouse_flag = false;
 	touch_flag = false;
 
@@ -476,6 +560,15 @@ void Player::ParseCommandLine(int argc, char *argv[]) {
 			// case sensitive
 			Main_Data::SetSavePath(argv[it - args.begin() + 1]);
 		}
+		else if (*it == "--profile-events") {
+			++it;
+			if (it == args.end()) {
+				return;
+			}
+			// case sensitive
+			InterpreterProfiler::SetReportPath(argv[it - args.begin() + 1]);
+			InterpreterProfiler::SetEnabled(true);
+		}
 		else if (*it == "--new-game") {
 			new_game_flag = true;
 		}
@@ -503,7 +596,9 @@ void Player::ParseCommandLine(int argc, char *argv[]) {
 			if (it == args.end()) {
 				return;
 			}
-			Utils::SeedRandomNumberGenerator(atoi((*it).c_str()));
+			seed = atoi((*it).c_str());
+			seed_flag = true;
+			Utils::SeedRandomNumberGenerator(seed);
 		}
 		else if (*it == "--start-map-id") {
 			++it;
@@ -563,7 +658,37 @@ void Player::ParseCommandLine(int argc, char *argv[]) {
 			if (it == args.end()) {
 				return;
 			}
-			replay_input_path = *it;
+			if (replay_input_path.empty()) {
+				replay_input_path = *it;
+			} else {
+				replay_queue.push_back(*it);
+			}
+		}
+		else if (*it == "--replay-turbo") {
+			++it;
+			if (it == args.end()) {
+				return;
+			}
+			replay_turbo_interval = std::max(0, atoi((*it).c_str()));
+		}
+		else if (*it == "--replay-mark") {
+			++it;
+			if (it == args.end()) {
+				return;
+			}
+			std::stringstream marks(*it);
+			std::string mark;
+			while (std::getline(marks, mark, ',')) {
+				replay_marks.push_back(atoi(mark.c_str()));
+			}
+		}
+		else if (*it == "--replay-dump") {
+			++it;
+			if (it == args.end()) {
+				return;
+			}
+			// case sensitive
+			replay_dump_path = argv[it - args.begin() + 1];
 		}
 		else if (*it == "--encoding") {
 			++it;
@@ -572,6 +697,41 @@ void Player::ParseCommandLine(int argc, char *argv[]) {
 			}
 			forced_encoding = *it;
 		}
+		else if (*it == "--audio-buffer") {
+			++it;
+			if (it == args.end()) {
+				return;
+			}
+			audio_buffer_ms = std::max(atoi((*it).c_str()), 1);
+		}
+		else if (*it == "--audio-output") {
+			++it;
+			if (it == args.end()) {
+				return;
+			}
+			// case sensitive
+			audio_output = argv[it - args.begin() + 1];
+		}
+		else if (*it == "--midi-prerender") {
+			midi_prerender_flag = true;
+		}
+		else if (*it == "--startup-profile") {
+			StartupGraph::EnableProfile();
+		}
+		else if (*it == "--midi-cache") {
+			++it;
+			if (it == args.end()) {
+				return;
+			}
+			midi_prerender_flag = true;
+#ifdef WANT_FMMIDI
+			// case sensitive
+			AudioMidiCache::SetDirectory(argv[it - args.begin() + 1]);
+#endif
+		}
+		else if (*it == "--chase-pathfinding") {
+			chase_pathfinding_flag = true;
+		}
 		else if (*it == "--disable-audio") {
 			no_audio_flag = true;
 		}
@@ -603,7 +763,10 @@ static void OnSystemFileReady(FileRequestResult* result) {
 }
 
 void Player::CreateGameObjects() {
-	GetEncoding();
+	{
+		StartupGraph::ScopedStep step("Encoding");
+		GetEncoding();
+	}
 	escape_symbol = ReaderUtil::Recode("\\", encoding);
 	if (escape_symbol.empty()) {
 		Output::Error("Invalid encoding: %s.", encoding.c_str());
@@ -618,8 +781,7 @@ void Player::CreateGameObjects() {
 		Output::Debug("Using %s as Save directory", save_path.c_str());
 	}
 
-	LoadDatabase();
-
+	// Read before the database because it decides whether the RTP is used
 	std::string ini_file = FileFinder::FindDefault(INI_NAME);
 
 	INIReader ini(ini_file);
@@ -639,6 +801,87 @@ void Player::CreateGameObjects() {
 	title << GAME_TITLE;
 	DisplayUi->SetTitle(title.str());
 
+	// The RTP directories are listed while the database is parsed,
+	// the RTP of the engine is selected afterwards.
+	// The System and Title graphics are decoded in parallel.
+	StartupGraph startup;
+
+	DatabaseFiles files = FindDatabase();
+	bool database_read = false;
+	StartupGraph::Step database = startup.Add("Database", [&files, &database_read]() {
+		database_read = ReadDatabase(files);
+	});
+
+	StartupGraph::Step engine_detection = startup.Add("Engine detection", [&database_read]() {
+		if (!database_read) {
+			Output::ErrorStr(LcfReader::GetError());
+		}
+		DetectEngine();
+	}, { database }, StartupGraph::Thread::Main);
+
+	std::vector<StartupGraph::Step> rtp_dependencies = { engine_detection };
+	if (!no_rtp_flag) {
+		for (const std::string& path : FileFinder::GetRtpPathCandidates()) {
+			rtp_dependencies.push_back(startup.Add("RTP listing", [path]() {
+				FileFinder::PrefetchRtpPath(path);
+			}));
+		}
+	}
+
+	StartupGraph::Step rtp = startup.Add("RTP", []() {
+		if (!no_rtp_flag) {
+			FileFinder::InitRtpPaths();
+		}
+	}, rtp_dependencies, StartupGraph::Thread::Main);
+
+	// Not on emscripten, the files are downloaded later
+#ifndef EMSCRIPTEN
+	struct Image {
+		const char* folder;
+		std::string name;
+		std::string path;
+		BitmapRef bitmap;
+	};
+	std::vector<Image> images = { { "System" }, { "Title" } };
+
+	StartupGraph::Step find_images = startup.Add("Find images", [&images]() {
+		images[0].name = Data::system.system_name;
+		if (Data::system.show_title && !new_game_flag && !battle_test_flag && !hide_title_flag) {
+			images[1].name = Data::system.title_name;
+		}
+
+		for (Image& image : images) {
+			if (!image.name.empty()) {
+				image.path = FileFinder::FindImage(image.folder, image.name);
+			}
+		}
+	}, { rtp }, StartupGraph::Thread::Main);
+
+	std::vector<StartupGraph::Step> decoded;
+	for (Image& image : images) {
+		decoded.push_back(startup.Add(image.folder, [&image]() {
+			if (!image.path.empty()) {
+				image.bitmap = Cache::Decode(image.folder, image.path);
+			}
+		}, { find_images }));
+	}
+
+	startup.Add("Cache images", [&images]() {
+		for (Image& image : images) {
+			if (image.bitmap) {
+				Cache::Store(image.folder, image.name, image.bitmap);
+			}
+		}
+	}, decoded, StartupGraph::Thread::Main);
+#endif
+
+	startup.Run();
+
+	StartupGraph::ScopedStep step("Game objects");
+	ResetGameObjects();
+}
+
+void Player::DetectEngine() {
 	if (engine == EngineNone) {
 		if (Data::system.ldb_id == 2003) {
 			engine = EngineRpg2k3;
@@ -679,12 +922,6 @@ void Player::CreateGameObjects() {
 		}
 	}
 	Output::Debug("Engine configured as: 2k=%d 2k3=%d 2k3Legacy=%d MajorUpdated=%d Eng=%d", Player::IsRPG2k(), Player::IsRPG2k3(), Player::IsRPG2k3Legacy(), Player::IsMajorUpdatedVersion(), Player::IsEnglish());
-
-	if (!no_rtp_flag) {
-		FileFinder::InitRtpPaths();
-	}
-
-	ResetGameObjects();
 }
 
 void Player::ResetGameObjects() {
@@ -715,13 +952,22 @@ void Player::ResetGameObjects() {
 	Main_Data::game_party.reset(new Game_Party());
 	Main_Data::game_player.reset(new Game_Player());
 
+	Rewind::Clear();
+
 	FrameReset();
 }
 
-void Player::LoadDatabase() {
-	// Load Database
-	Data::Clear();
+void Player::ResetGameState() {
+	Audio().BGM_Stop();
+	Audio().SE_Stop();
+
+	Game_Interpreter::ResetEventCalling();
+	ResetGameObjects();
+
+	frames = 0;
+}
 
+Player::DatabaseFiles Player::FindDatabase() {
 	if (!FileFinder::IsRPG2kProject(*FileFinder::GetDirectoryTree()) &&
 		!FileFinder::IsEasyRpgProject(*FileFinder::GetDirectoryTree())) {
 		// Unlikely to happen because of the game browser only launches valid games
@@ -734,30 +980,41 @@ void Player::LoadDatabase() {
 			"RPG Maker XP, VX, VX Ace and MV are NOT supported.");
 	}
 
+	DatabaseFiles files;
+
 	// Try loading EasyRPG project files first, then fallback to normal RPG Maker
 	std::string edb = FileFinder::FindDefault(DATABASE_NAME_EASYRPG);
 	std::string emt = FileFinder::FindDefault(TREEMAP_NAME_EASYRPG);
 
-	bool easyrpg_project = !edb.empty() && !emt.empty();
+	files.easyrpg_project = !edb.empty() && !emt.empty();
 
-	if (easyrpg_project) {
-		if (!LDB_Reader::LoadXml(edb)) {
-			Output::ErrorStr(LcfReader::GetError());
-		}
-		if (!LMT_Reader::LoadXml(emt)) {
-			Output::ErrorStr(LcfReader::GetError());
-		}
+	if (files.easyrpg_project) {
+		files.database = edb;
+		files.treemap = emt;
+	} else {
+		files.database = FileFinder::FindDefault(DATABASE_NAME);
+		files.treemap = FileFinder::FindDefault(TREEMAP_NAME);
 	}
-	else {
-		std::string ldb = FileFinder::FindDefault(DATABASE_NAME);
-		std::string lmt = FileFinder::FindDefault(TREEMAP_NAME);
 
-		if (!LDB_Reader::Load(ldb, encoding)) {
-			Output::ErrorStr(LcfReader::GetError());
-		}
-		if (!LMT_Reader::Load(lmt, encoding)) {
-			Output::ErrorStr(LcfReader::GetError());
-		}
+	return files;
+}
+
+bool Player::ReadDatabase(const DatabaseFiles& files) {
+	// Load Database
+	Data::Clear();
+
+	if (files.easyrpg_project) {
+		return LDB_Reader::LoadXml(files.database) &&
+			LMT_Reader::LoadXml(files.treemap);
+	}
+
+	return LDB_Reader::Load(files.database, encoding) &&
+		LMT_Reader::Load(files.treemap, encoding);
+}
+
+void Player::LoadDatabase() {
+	if (!ReadDatabase(FindDatabase())) {
+		Output::ErrorStr(LcfReader::GetError());
 	}
 }
 
@@ -779,13 +1036,22 @@ static void OnMapSaveFileReady(FileRequestResult*) {
 	Game_System::BgmPlay(current_music);
 }
 
-void Player::LoadSavegame(const std::string& save_name) {
+bool Player::LoadSavegame(const std::string& save_name) {
 	std::unique_ptr<RPG::Save> save = LSD_Reader::Load(save_name, encoding);
 
 	if (!save.get()) {
-		Output::Error("%s", LcfReader::GetError().c_str());
+		Output::Warning("Savegame %s is corrupted: %s", save_name.c_str(),
+			LcfReader::GetError().c_str());
+		return false;
 	}
 
+	Rewind::Clear();
+	LoadSavegame(std::move(save));
+
+	return true;
+}
+
+void Player::LoadSavegame(std::unique_ptr<RPG::Save> save) {
 	Scene::PopUntil(Scene::Title);
 	Game_Temp::Init();
 	Game_Map::Dispose();
@@ -796,6 +1062,8 @@ void Player::LoadSavegame(const std::string& save_name) {
 	Game_Actors::Fixup();
 	Main_Data::game_party->RemoveInvalidData();
 
+	Game_System::PrefetchSystemSe();
+
 	int map_id = save->party_location.map_id;
 
 	FileRequestAsync* map = Game_Map::RequestMap(map_id);
@@ -931,7 +1199,14 @@ void Player::PrintUsage() {
 	std::cout <<
 R"(EasyRPG Player - An open source interpreter for RPG Maker 2000/2003 games.
 Options:
+      --audio-buffer N     Decode the music N milliseconds ahead of the
+                           playback (default: 200).
+      --audio-output FILE  Mix the audio without a sound device, driven by the
+                           game clock, and write it to the WAV file FILE.
+                           Use "null" to discard the audio.
       --battle-test N      Start a battle test with monster party N.
+      --chase-pathfinding  Events moving towards or away from the hero walk
+                           around walls instead of getting stuck.
       --disable-audio      Disable audio (in case you prefer your own music).
       --disable-rtp        Disable support for the Runtime Package (RTP).
       --encoding N         Instead of auto detecting the encoding or using
@@ -953,12 +1228,34 @@ Options:
                            command menu.
       --load-game-id N     Skip the title scene and load SaveN.lsd
                            (N is padded to two digits).
+      --midi-cache PATH    Store MIDI music rendered by --midi-prerender in
+                           the directory PATH and reuse it on the next start.
+                           Implies --midi-prerender.
+      --midi-prerender     Render MIDI music of the built-in synthesizer in the
+                           background and play the rendered music, which
+                           reduces the CPU load during playback.
       --new-game           Skip the title scene and start a new game directly.
+      --profile-events PATH
+                           Collect execution statistics of all map events,
+                           common events and event commands and write them to
+                           PATH on exit (JSON when PATH ends with .json,
+                           otherwise CSV). The statistics are also shown in
+                           the debug menu.
       --project-path PATH  Instead of using the working directory the game in
                            PATH is used.
       --record-input PATH  Record all button input to a log file at PATH.
+      --replay-dump PATH   Write screenshots of the frames marked by
+                           --replay-mark to the directory PATH.
       --replay-input PATH  Replays button presses from an input log generated by
-                           --record-input.
+                           --record-input. When given multiple times the logs
+                           are replayed one after another without loading the
+                           game again.
+      --replay-mark N,M... Log a checksum of the game state at the frames N,
+                           M... when replaying with --replay-turbo.
+      --replay-turbo N     Replay the input log of --replay-input as fast as
+                           possible without audio and only draw every Nth
+                           frame (0: only marked frames). The speed and the
+                           checksums are logged on exit.
       --save-path PATH     Instead of storing save files in the game directory
                            they are stored in PATH. The directory must exist.
                            When using the game browser all games will share
@@ -973,6 +1270,8 @@ Options:
       --start-party A B... Overwrite the starting party members with the actors
                            with IDs A, B, C...
                            Incompatible with --load-game-id.
+      --startup-profile    Log how long every step of loading the game took
+                           when the title screen appears.
       --test-play          Enable TestPlay mode.
       --window             Start in window mode.
   -v, --version            Display program version and exit.
@@ -20,8 +20,14 @@
 
 // Headers
 #include "baseui.h"
+#include <memory>
+#include <string>
 #include <vector>
 
+namespace RPG {
+	class Save;
+}
+
 /**
  * Player namespace.
  */
@@ -107,17 +113,63 @@ namespace Player {
 	 */
 	void ResetGameObjects();
 
+	/**
+	 * Starts over like a new process: Stops the audio and resets the game
+	 * objects and the state kept by the game classes between games.
+	 * The database, the directory trees and the asset caches are kept.
+	 */
+	void ResetGameState();
+
 	/**
 	 * Loads all databases.
 	 */
 	void LoadDatabase();
 
+	/** Files of the database */
+	struct DatabaseFiles {
+		std::string database;
+		std::string treemap;
+		/** XML files of an EasyRPG project instead of LCF files */
+		bool easyrpg_project = false;
+	};
+
+	/**
+	 * Finds the files of the database.
+	 * Shows an error when the game directory contains no game.
+	 *
+	 * @return the files.
+	 */
+	DatabaseFiles FindDatabase();
+
+	/**
+	 * Parses the database. Does not report errors and can run on a worker
+	 * thread.
+	 *
+	 * @param files files returned by FindDatabase.
+	 * @return whether the database was read, see LcfReader::GetError.
+	 */
+	bool ReadDatabase(const DatabaseFiles& files);
+
+	/**
+	 * Detects the engine from the database unless it was set by --engine.
+	 */
+	void DetectEngine();
+
 	/**
 	 * Loads savegame data.
 	 *
 	 * @param save_file Savegame file to load
+	 * @return whether the savegame was loaded, the game state is unchanged
+	 *         when the savegame is corrupted
+	 */
+	bool LoadSavegame(const std::string& save_file);
+
+	/**
+	 * Loads savegame data that is already in memory.
+	 *
+	 * @param save savegame data to load
 	 */
-	void LoadSavegame(const std::string& save_file);
+	void LoadSavegame(std::unique_ptr<RPG::Save> save);
 
 	/**
 	 * Moves the player to the start map.
@@ -221,6 +273,12 @@ namespace Player {
 	/** Reset flag, if true will restart game on next Player::Update. */
 	extern bool reset_flag;
 
+	/**
+	 * Replay finished flag, set when the --replay-input log ended. The next
+	 * Player::Update starts the next log or exits when there is none.
+	 */
+	extern bool replay_finished;
+
 	/** Debug flag, if true will run game in debug mode. */
 	extern bool debug_flag;
 
@@ -269,6 +327,18 @@ namespace Player {
 	/** Mutes audio playback */
 	extern bool no_audio_flag;
 
+	/** How far ahead of the playback BGM are decoded in milliseconds */
+	extern int audio_buffer_ms;
+
+	/** WAV file or "null" when audio is mixed without a device (OfflineAudio) */
+	extern std::string audio_output;
+
+	/** Events chasing the player walk around obstacles (Game_Pathing) */
+	extern bool chase_pathfinding_flag;
+
+	/** MIDI of the built-in synthesizer is pre-rendered (AudioMidiCache) */
+	extern bool midi_prerender_flag;
+
 	/** Encoding used */
 	extern std::string encoding;
 
@@ -0,0 +1,171 @@
+/*
+ * This file is part of EasyRPG Player.
+ *
+ * EasyRPG Player is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * EasyRPG Player is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with EasyRPG Player. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Headers
+#include <algorithm>
+#include <random>
+#include "baseui.h"
+#include "filefinder.h"
+#include "game_map.h"
+#include "graphics.h"
+#include "main_data.h"
+#include "output.h"
+#include "replay.h"
+#include "utils.h"
+
+namespace {
+	bool turbo = false;
+	int draw_interval;
+	std::vector<int> marks;
+	std::string dump_path;
+
+	uint32_t start_ticks;
+	int start_frame = -1;
+	int last_frame;
+
+	struct Checksum {
+		int frame;
+		uint64_t value;
+	};
+	std::vector<Checksum> checksums;
+
+	/** FNV-1a */
+	class Hash {
+	public:
+		void Add(int64_t value) {
+			for (int i = 0; i < 8; ++i) {
+				hash = (hash ^ (uint8_t)(value >> (i * 8))) * 0x100000001b3ull;
+			}
+		}
+
+		uint64_t hash = 0xcbf29ce484222325ull;
+	};
+
+	bool IsMarked(int frame) {
+		return std::binary_search(marks.begin(), marks.end(), frame);
+	}
+}
+
+void Replay::Init(int draw_interval, std::vector<int> marks, std::string dump_path) {
+	turbo = true;
+	::draw_interval = draw_interval;
+	::marks = std::move(marks);
+	::dump_path = std::move(dump_path);
+	std::sort(::marks.begin(), ::marks.end());
+}
+
+bool Replay::IsTurbo() {
+	return turbo;
+}
+
+bool Replay::IsDrawFrame(int frame) {
+	return (draw_interval > 0 && frame % draw_interval == 0) || IsMarked(frame);
+}
+
+void Replay::OnFrame(int frame) {
+	if (start_frame < 0) {
+		start_frame = frame;
+		start_ticks = DisplayUi->GetTicks();
+	}
+	last_frame = frame;
+
+	if (!IsMarked(frame)) {
+		return;
+	}
+
+	uint64_t checksum = GetGameStateChecksum();
+	checksums.push_back({ frame, checksum });
+	Output::Debug("Replay: Frame %d checksum %016llx", frame, (unsigned long long)checksum);
+
+	if (!dump_path.empty()) {
+		Graphics::Draw();
+		Output::TakeScreenshot(FileFinder::MakePath(dump_path, "frame_" + std::to_string(frame) + ".png"));
+	}
+}
+
+void Replay::Report() {
+	if (!turbo || start_frame < 0) {
+		return;
+	}
+
+	int frames = last_frame - start_frame;
+	double seconds = (DisplayUi->GetTicks() - start_ticks) / 1000.0;
+	Output::Debug("Replay: %d frames in %.2f s (%.1f fps)", frames, seconds,
+		seconds > 0 ? frames / seconds : 0.0);
+
+	for (const Checksum& checksum : checksums) {
+		Output::Debug("Replay: Frame %d checksum %016llx", checksum.frame, (unsigned long long)checksum.value);
+	}
+	for (int frame : marks) {
+		if (frame > last_frame) {
+			Output::Debug("Replay: Frame %d not reached", frame);
+		}
+	}
+}
+
+void Replay::Restart() {
+	Report();
+
+	start_frame = -1;
+	checksums.clear();
+}
+
+uint64_t Replay::GetGameStateChecksum() {
+	// Stores the events and the interpreters in game_data
+	Game_Map::PrepareSave();
+
+	const RPG::Save& save = Main_Data::game_data;
+	Hash hash;
+
+	for (bool sw : save.system.switches) {
+		hash.Add(sw);
+	}
+	for (int32_t var : save.system.variables) {
+		hash.Add(var);
+	}
+
+	hash.Add(save.inventory.gold);
+	for (const RPG::SaveActor& actor : save.actors) {
+		hash.Add(actor.level);
+		hash.Add(actor.exp);
+		hash.Add(actor.current_hp);
+		hash.Add(actor.current_sp);
+	}
+
+	const RPG::SavePartyLocation& location = save.party_location;
+	hash.Add(location.map_id);
+	hash.Add(location.position_x);
+	hash.Add(location.position_y);
+	hash.Add(location.direction);
+
+	for (const RPG::SaveMapEvent& event : save.map_info.events) {
+		hash.Add(event.position_x);
+		hash.Add(event.position_y);
+		hash.Add(event.direction);
+		hash.Add(event.active);
+	}
+
+	for (const RPG::SaveEventCommands& commands : save.events.commands) {
+		hash.Add(commands.current_command);
+	}
+
+	// A copy, the game must draw the same numbers afterwards
+	std::mt19937 rng = Utils::GetRNG();
+	hash.Add(rng());
+
+	return hash.hash;
+}
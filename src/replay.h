@@ -0,0 +1,84 @@
+/*
+ * This file is part of EasyRPG Player.
+ *
+ * EasyRPG Player is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * EasyRPG Player is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with EasyRPG Player. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef EP_REPLAY_H
+#define EP_REPLAY_H
+
+// Headers
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * Turbo mode for replaying input logs (--replay-turbo).
+ *
+ * The game logic runs as fast as possible without audio, the screen is only
+ * drawn every few frames. At marked frames a checksum of the game state is
+ * logged and the screen is optionally dumped. The throughput and the
+ * checksums are reported when the Player exits.
+ */
+namespace Replay {
+	/**
+	 * Enables the turbo mode.
+	 *
+	 * @param draw_interval the screen is drawn every draw_interval frames,
+	 *                      0 draws only marked frames.
+	 * @param marks frames at which a checksum is taken.
+	 * @param dump_path directory for screenshots of the marked frames,
+	 *                  empty disables them.
+	 */
+	void Init(int draw_interval, std::vector<int> marks, std::string dump_path);
+
+	/**
+	 * @return whether the turbo mode is enabled.
+	 */
+	bool IsTurbo();
+
+	/**
+	 * @param frame number of the frame.
+	 * @return whether the frame must be drawn.
+	 */
+	bool IsDrawFrame(int frame);
+
+	/**
+	 * Called after the scene was updated, takes the checksum at marked
+	 * frames.
+	 *
+	 * @param frame number of the frame.
+	 */
+	void OnFrame(int frame);
+
+	/**
+	 * Logs the throughput and the checksums.
+	 */
+	void Report();
+
+	/**
+	 * Reports the current replay and starts counting for the next one.
+	 */
+	void Restart();
+
+	/**
+	 * Calculates a checksum of the game state, e.g. switches, variables,
+	 * the party, the events on the map and the RNG.
+	 *
+	 * @return the checksum.
+	 */
+	uint64_t GetGameStateChecksum();
+}
+
+#endif
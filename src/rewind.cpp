@@ -0,0 +1,137 @@
+/*
+ * This file is part of EasyRPG Player.
+ *
+ * EasyRPG Player is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * EasyRPG Player is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with EasyRPG Player. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Headers
+#include <algorithm>
+#include <memory>
+#include <random>
+#include <vector>
+#include "audio.h"
+#include "game_map.h"
+#include "game_system.h"
+#include "main_data.h"
+#include "options.h"
+#include "output.h"
+#include "player.h"
+#include "rewind.h"
+#include "rpg_save.h"
+#include "utils.h"
+
+namespace {
+	struct Snapshot {
+		/** Savegame data without switches and variables */
+		RPG::Save save;
+		std::shared_ptr<const std::vector<bool> > switches;
+		std::shared_ptr<const std::vector<int32_t> > variables;
+		std::mt19937 rng;
+		/** Position of the BGM in ms, -1 if unknown */
+		int bgm_position = -1;
+	};
+
+	std::vector<Snapshot> snapshots;
+	// Slot of the next snapshot
+	size_t head = 0;
+	size_t count = 0;
+	int frames = 0;
+
+	/** Shares the data of the previous snapshot when it did not change */
+	template <typename T>
+	std::shared_ptr<const T> Share(const T& data, const std::shared_ptr<const T>& previous) {
+		if (previous && *previous == data) {
+			return previous;
+		}
+		return std::make_shared<const T>(data);
+	}
+}
+
+void Rewind::Update() {
+	if (++frames < REWIND_INTERVAL) {
+		return;
+	}
+	frames = 0;
+
+	if (snapshots.empty()) {
+		snapshots.resize(REWIND_SNAPSHOTS);
+	}
+
+	std::shared_ptr<const std::vector<bool> > previous_switches;
+	std::shared_ptr<const std::vector<int32_t> > previous_variables;
+	if (count > 0) {
+		const Snapshot& previous = snapshots[(head + snapshots.size() - 1) % snapshots.size()];
+		previous_switches = previous.switches;
+		previous_variables = previous.variables;
+	}
+
+	Game_Map::PrepareSave();
+
+	RPG::SaveSystem& system = Main_Data::game_data.system;
+	Snapshot& snapshot = snapshots[head];
+	snapshot.switches = Share(system.switches, previous_switches);
+	snapshot.variables = Share(system.variables, previous_variables);
+
+	// Copy everything else, the old snapshot in the slot keeps its memory
+	std::vector<bool> switches;
+	std::vector<int32_t> variables;
+	switches.swap(system.switches);
+	variables.swap(system.variables);
+	snapshot.save = Main_Data::game_data;
+	switches.swap(system.switches);
+	variables.swap(system.variables);
+
+	snapshot.rng = Utils::GetRNG();
+	snapshot.bgm_position = Audio().BGM_GetPosition();
+
+	head = (head + 1) % snapshots.size();
+	count = std::min(count + 1, snapshots.size());
+}
+
+bool Rewind::Restore() {
+	if (count == 0) {
+		return false;
+	}
+
+	head = (head + snapshots.size() - 1) % snapshots.size();
+	--count;
+	frames = 0;
+
+	Snapshot& snapshot = snapshots[head];
+	std::unique_ptr<RPG::Save> save(new RPG::Save(std::move(snapshot.save)));
+	save->system.switches = *snapshot.switches;
+	save->system.variables = *snapshot.variables;
+	snapshot.switches.reset();
+	snapshot.variables.reset();
+
+	Output::Debug("Rewinding to snapshot %d", (int)count + 1);
+
+	// The savegame restarts the BGM, continue where the snapshot was taken.
+	// Set before loading, the BGM can start before LoadSavegame returns.
+	if (snapshot.bgm_position >= 0) {
+		Game_System::BgmResumeAt(save->system.current_music.name, snapshot.bgm_position);
+	}
+
+	Player::LoadSavegame(std::move(save));
+	Utils::GetRNG() = snapshot.rng;
+
+	return true;
+}
+
+void Rewind::Clear() {
+	snapshots.clear();
+	head = 0;
+	count = 0;
+	frames = 0;
+}
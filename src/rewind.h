@@ -0,0 +1,49 @@
+/*
+ * This file is part of EasyRPG Player.
+ *
+ * EasyRPG Player is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * EasyRPG Player is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with EasyRPG Player. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef EP_REWIND_H
+#define EP_REWIND_H
+
+/**
+ * In-memory snapshots of the game state for rewinding in test play.
+ *
+ * Every REWIND_INTERVAL frames on the map the savegame data is copied into
+ * a ring buffer of REWIND_SNAPSHOTS entries. Switches and variables are
+ * shared with the previous snapshot when they did not change.
+ */
+namespace Rewind {
+	/**
+	 * Counts a frame on the map and takes a snapshot when the interval
+	 * elapsed.
+	 */
+	void Update();
+
+	/**
+	 * Loads the newest snapshot like a savegame and removes it from the
+	 * buffer. The caller must push a Scene_Map afterwards.
+	 *
+	 * @return whether a snapshot was available.
+	 */
+	bool Restore();
+
+	/**
+	 * Removes all snapshots, e.g. when another game is started.
+	 */
+	void Clear();
+}
+
+#endif
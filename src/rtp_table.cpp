@@ -15,3609 +15,4722 @@
  * along with EasyRPG Player. If not, see <http://www.gnu.org/licenses/>.
  */
 
-#include "rtp_table.h"
-
-namespace RTP {
-	rtp_table_type RTP_TABLE_2003;
-	rtp_table_type RTP_TABLE_2000;	
-}
-
-void RTP::Init() {
-	static bool rtp_init = false;
-	if (rtp_init) return;	
-	rtp_init = true;
-	
-	RTP_TABLE_2003["backdrop"] = {
-	 // Official English translation names
-	 {"graveyard", "お墓"},
-	 {"temple1", "お寺"},
-	 {"dungeon1", "ダンジョン１"},
-	 {"dungeon2", "ダンジョン２"},
-	 {"dungeon3", "ダンジョン３"},
-	 {"dungeon4", "ダンジョン４"},
-	 {"dungeon5", "ダンジョン５"},
-	 {"dungeon6", "ダンジョン６"},
-	 {"universe", "宇宙"},
-	 {"mountain road", "山道"},
-	 {"rocky road", "岩場"},
-	 {"ruins1", "廃墟"},
-	 {"old town", "旧市街"},
-	 {"forest1", "森１"},
-	 {"forest2", "森２"},
-	 {"bridge", "橋"},
-	 {"swamp", "毒沼"},
-	 {"mansion", "洋館"},
-	 {"sea", "海"},
-	 {"castle", "玉座"},
-	 {"space", "異空間"},
-	 {"beach", "砂浜"},
-	 {"desert", "砂漠"},
-	 {"temple2", "神殿"},
-	 {"sky", "空"},
-	 {"ship", "船上"},
-	 {"grassland", "草原"},
-	 {"wasteland", "荒地"},
-	 {"town", "街中"},
-	 {"road", "路上"},
-	 {"ruins2", "遺跡"},
-	 {"bathhouse", "銭湯"},
-	 {"arena", "闘技場"},
-	 {"snow field", "雪原"},
-
-	 // RPG Advocate English translation names
-	 {"shrine", "お寺"},
-	 {"space", "宇宙"},
-	 {"mountain", "山道"},
-	 {"rockbed", "岩場"},
-	 {"wasteland", "廃墟"},
-	 {"ghost-town", "旧市街"},
-	 {"building", "洋館"},
-	 {"ocean", "海"},
-	 {"strange", "異空間"},
-	 {"ruins1", "神殿"},
-	 {"shipdeck", "船上"},
-	 {"plains", "草原"},
-	 {"barren", "荒地"},
-	 {"bath", "銭湯"},
-	 {"snowfield", "雪原"},
-
-	 // Unknown English translation names used by Spanish games
-	 {"grave", "お墓"},
-	 {"temple", "お寺"},
-	 {"donjohn1", "ダンジョン１"},
-	 {"donjohnq", "ダンジョン２"},
-	 {"donjohnr", "ダンジョン３"},
-	 {"donjohns", "ダンジョン４"},
-	 {"donjohnt", "ダンジョン５"},
-	 {"donjohnu", "ダンジョン６"},
-	 {"mountainpath", "山道"},
-	 {"rocks", "岩場"},
-	 {"oldurban", "旧市街"},
-	 {"forestp", "森１"},
-	 {"forestq", "森２"},
-	 {"poisonswamp", "毒沼"},
-	 {"westernstylebuilding", "洋館"},
-	 {"ballseat", "玉座"},
-	 {"strangespacial", "異空間"},
-	 {"sandybeach", "砂浜"},
-	 {"sanctuary", "神殿"},
-	 {"empty", "空"},
-	 {"onboat", "船上"},
-	 {"grassyplain", "草原"},
-	 {"roughforging", "荒地"},
-	 {"city", "街中"},
-	 {"ruins", "遺跡,"},
-	 {"competitionplace", "闘技場"},
-
-	 // Russian RTP translation by Vlad Kovnerov
-	 {"cave", "ダンジョン１"},
-	 {"lavacave", "ダンジョン２"},
-	 {"icecave", "ダンジョン３"},
-	 {"stalagmites", "ダンジョン４"},
-	 {"labyrinth", "ダンジョン５"},
-	 {"traininghall", "ダンジョン６"},
-	 {"ruins", "廃墟"},
-	 {"city", "旧市街"},
-	 {"insidecastle", "洋館"},
-	 {"spacelight", "異空間"},
-	 {"clouds", "空"},
-	 {"grass", "草原"},
-	 {"cityhouse", "街中"},
-	 {"insidepyramid", "遺跡"},
-	 {"snow", "雪原"},
-
-	 // 2000 RTP names not overwritten by Vlad Kovnerov's installation
-	 {"cave1", "ダンジョン１"},
-	 {"lavacave2", "ダンジョン２"},
-	 {"icecave3", "ダンジョン３"},
-	 {"cave4", "ダンジョン４"},
-	 {"brickcave5", "ダンジョン５"},
-	 {"galaxy", "宇宙"},
-	 {"canyon", "山道"},
-	 {"snowcanyon", "岩場"},
-	 {"wasteruins", "廃墟"},
-	 {"lightspeed", "異空間"},
-	 {"seabeach", "砂浜"},
-	 {"greece", "神殿"},
-
-	 // Korean RTP
-	 {"던젼１", "ダンジョン１"},
-	 {"던젼２", "ダンジョン２"},
-	 {"던젼３", "ダンジョン３"},
-	 {"던젼４", "ダンジョン４"},
-	 {"던젼５", "ダンジョン５"},
-	 {"던젼６", "ダンジョン６"},
-	 {"바닥", "お墓"},
-	 {"우주", "宇宙"},
-	 {"절", "お寺"},
-	 {"산길", "山道"},
-	 {"바위", "岩場"},
-	 {"폐허", "廃墟"},
-	 {"구시가지", "旧市街"},
-	 {"숲１", "森１"},
-	 {"숲２", "森２"},
-	 {"다리", "橋"},
-	 {"독연못", "毒沼"},
-	 {"양관(서양식집)", "洋館"},
-	 {"바다", "海"},
-	 {"옥좌", "玉座"},
-	 {"이공간", "異空間"},
-	 {"사구", "砂浜"},
-	 {"사막", "砂漠"},
-	 {"신전", "神殿"},
-	 {"하늘", "空"},
-	 {"선상", "船上"},
-	 {"초원", "草原"},
-	 {"황야", "荒地"},
-	 {"길가운데", "街中"},
-	 {"도로 위", "路上"},
-	 {"유적", "遺跡"},
-	 {"공중 목욕탕", "銭湯"},
-	 {"투기장", "闘技場"},
-	 {"설원", "雪原"}
-	};
-
-	RTP_TABLE_2003["battle"] = {
-	 // Official English translation names
-	 {"2003 other1", "2003その他1"},
-	 {"2003 other2", "2003その他2"},
-	 {"2003 barrier", "2003バリア"},
-	 {"2003 breath", "2003ブレス"},
-	 {"2003 light pillar", "2003光柱"},
-	 {"2003 cold", "2003冷気"},
-	 {"2003 sword", "2003剣"},
-	 {"2003 absorb", "2003吸収"},
-	 {"2003 recovery", "2003回復"},
-	 {"2003 earth", "2003大地"},
-	 {"2003 bow", "2003弓"},
-	 {"2003 blow", "2003打撃"},
-	 {"2003 axe", "2003斧"},
-	 {"2003 dark", "2003暗黒"},
-	 {"2003 spear", "2003槍"},
-	 {"2003 water", "2003水"},
-	 {"2003 cure", "2003治療"},
-	 {"2003 fire", "2003炎"},
-	 {"2003 explosion", "2003爆発"},
-	 {"2003 claw", "2003爪"},
-	 {"2003 holy", "2003神聖"},
-	 {"2003 revive", "2003蘇生"},
-	 {"2003 thunder", "2003雷"},
-	 {"2003 whip", "2003鞭"},
-	 {"2003 wind", "2003風"},
-	 {"2003 Paralysis", "2003麻痺"},
-	 {"other", "その他"},
-	 {"barrier", "バリア"},
-	 {"breath", "ブレス"},
-	 {"buff", "上昇"},
-	 {"debuff", "下降"},
-	 {"ice", "冷気"},
-	 {"sword1", "剣1"},
-	 {"sword2", "剣2"},
-	 {"bite", "吸収"},
-	 {"recovery", "回復"},
-	 {"earth", "大地"},
-	 {"blow", "打撃"},
-	 {"axe", "斧"},
-	 {"dark", "暗黒"},
-	 {"spear", "槍"},
-	 {"water", "水"},
-	 {"treatment", "治療"},
-	 {"fire1", "炎1"},
-	 {"fire2", "炎2"},
-	 {"explosion", "爆発"},
-	 {"claw", "爪"},
-	 {"arrow", "矢"},
-	 {"holy", "神聖"},
-	 {"ressurection", "蘇生"},
-	 {"thunder", "雷"},
-	 {"whip", "鞭"},
-	 {"wind", "風"},
-	 {"paralysis", "麻痺"},
-
-	 // RPG Advocate English translation names
-	 {"misc1", "2003その他1"},
-	 {"misc2", "2003その他2"},
-	 {"barrier1", "2003バリア"},
-	 {"breath1", "2003ブレス"},
-	 {"lightray", "2003光柱"},
-	 {"ice1", "2003冷気"},
-	 {"sword1", "2003剣"},
-	 {"absorb1", "2003吸収"},
-	 {"healing1", "2003回復"},
-	 {"earth1", "2003大地"},
-	 {"bow1", "2003弓"},
-	 {"strike", "2003打撃"},
-	 {"axe1", "2003斧"},
-	 {"dark1", "2003暗黒"},
-	 {"spear1", "2003槍"},
-	 {"water1", "2003水"},
-	 {"cure1", "2003治療"},
-	 {"fire1", "2003炎"},
-	 {"explode1", "2003爆発"},
-	 {"claw1", "2003爪"},
-	 {"holy1", "2003神聖"},
-	 {"revive1", "2003蘇生"},
-	 {"bolt1", "2003雷"},
-	 {"whip1", "2003鞭"},
-	 {"wind1", "2003風"},
-	 {"paralyze1", "2003麻痺"},
-	 {"misc3", "その他"},
-	 {"barrier2", "バリア"},
-	 {"breath2", "ブレス"},
-	 {"increase", "上昇"},
-	 {"decrease", "下降"},
-	 {"ice2", "冷気"},
-	 {"sword2", "剣1"},
-	 {"sword3", "剣2"},
-	 {"absorb2", "吸収"},
-	 {"healing2", "回復"},
-	 {"earth2", "大地"},
-	 {"attack", "打撃"},
-	 {"axe2", "斧"},
-	 {"dark2", "暗黒"},
-	 {"spear2", "槍"},
-	 {"water2", "水"},
-	 {"cure2", "治療"},
-	 {"fire2", "炎1"},
-	 {"fire3", "炎2"},
-	 {"explode2", "爆発"},
-	 {"claw2", "爪"},
-	 {"bow2", "矢"},
-	 {"holy2", "神聖"},
-	 {"revive2", "蘇生"},
-	 {"bolt2", "雷"},
-	 {"whip2", "鞭"},
-	 {"wind2", "風"},
-	 {"paralyze2", "麻痺"},
-
-	 // Unknown English translation names used by Spanish games
-	 {"2003addition1", "2003その他1"},
-	 {"2003addition2", "2003その他2"},
-	 {"2003barrier", "2003バリア"},
-	 {"2003breath", "2003ブレス"},
-	 {"2003luminouspillar", "2003光柱"},
-	 {"2003coldair", "2003冷気"},
-	 {"2003sword", "2003剣"},
-	 {"2003absorption", "2003吸収"},
-	 {"2003recovery", "2003回復"},
-	 {"2003ground", "2003大地"},
-	 {"2003bow", "2003弓"},
-	 {"2003shock", "2003打撃"},
-	 {"2003ax", "2003斧"},
-	 {"2003dark", "2003暗黒"},
-	 {"2003spear", "2003槍"},
-	 {"2003water", "2003水"},
-	 {"2003remedy", "2003治療"},
-	 {"2003flame", "2003炎"},
-	 {"2003explosive", "2003爆発"},
-	 {"2003nail", "2003爪"},
-	 {"2003holy", "2003神聖"},
-	 {"2003revival", "2003蘇生"},
-	 {"2003thunder", "2003雷"},
-	 {"2003rod", "2003鞭"},
-	 {"2003wind", "2003風"},
-	 {"2003paralysis", "2003麻痺"},
-	 {"addition", "その他"},
-	 {"rise", "上昇"},
-	 {"drop", "下降"},
-	 {"coldair", "冷気"},
-	 {"absorption", "吸収"},
-	 {"ground", "大地"},
-	 {"shock", "打撃"},
-	 {"ax", "斧"},
-	 {"remedy", "治療"},
-	 {"flame1", "炎1"},
-	 {"flame2", "炎2"},
-	 {"explosive", "爆発"},
-	 {"nail", "爪"},
-	 {"bow", "矢"},
-	 {"revivial", "蘇生"},
-	 {"rod", "鞭"},
-
-	 // Russian RTP translation by Vlad Kovnerov
-	 {"2003-other1", "2003その他1"},
-	 {"2003-other2", "2003その他2"},
-	 {"2003-barrier", "2003バリア"},
-	 {"2003-poison", "2003ブレス"},
-	 {"2003-lines", "2003光柱"},
-	 {"2003-cold", "2003冷気"},
-	 {"2003-sword", "2003剣"},
-	 {"2003-absorption", "2003吸収"},
-	 {"2003-sun", "2003回復"},
-	 {"2003-earth", "2003大地"},
-	 {"2003-arrow", "2003弓"},
-	 {"2003-hit", "2003打撃"},
-	 {"2003-axe", "2003斧"},
-	 {"2003-dark", "2003暗黒"},
-	 {"2003-spear", "2003槍"},
-	 {"2003-water", "2003水"},
-	 {"2003-sphere", "2003治療"},
-	 {"2003-fire", "2003炎"},
-	 {"2003-explosion", "2003爆発"},
-	 {"2003-claws", "2003爪"},
-	 {"2003-holy", "2003神聖"},
-	 {"2003-angel", "2003蘇生"},
-	 {"2003-zip", "2003雷"},
-	 {"2003-whip", "2003鞭"},
-	 {"2003-wind", "2003風"},
-	 {"2003-paralysis", "2003麻痺"},
-
-	 // 2000 RTP names not overwritten by Vlad Kovnerov's installation
-	 {"etc", "その他"},
-	 {"poison", "ブレス"},
-	 {"up", "上昇"},
-	 {"down", "下降"},
-	 {"cold", "冷気"},
-	 {"sun", "回復"},
-	 {"hit", "打撃"},
-	 {"sphere", "治療"},
-	 {"fang", "爪"},
-	 {"ray", "蘇生"},
-	 {"zip", "雷"},
-
-	 // Korean RTP
-	 {"검1", "剣1"},
-	 {"화염1", "炎1"},
-	 {"2003기타1", "2003その他1"},
-	 {"2003기타2", "2003その他2"},
-	 {"2003베리어", "2003バリア"},
-	 {"2003브레스", "2003ブレス"},
-	 {"2003주위의 빛", "2003光柱"},
-	 {"2003냉기", "2003冷気"},
-	 {"2003검", "2003剣"},
-	 {"2003흡수", "2003吸収"},
-	 {"2003회복", "2003回復"},
-	 {"2003대지", "2003大地"},
-	 {"2003화살", "2003弓"},
-	 {"2003타격", "2003打撃"},
-	 {"2003도끼", "2003斧"},
-	 {"2003암흑", "2003暗黒"},
-	 {"2003창", "2003槍"},
-	 {"2003물", "2003水"},
-	 {"2003치료", "2003治療"},
-	 {"2003화염", "2003炎"},
-	 {"2003폭발", "2003爆発"},
-	 {"2003손톱", "2003爪"},
-	 {"2003신성", "2003神聖"},
-	 {"2003소생", "2003蘇生"},
-	 {"2003전격", "2003雷"},
-	 {"2003채찍", "2003鞭"},
-	 {"2003바람", "2003風"},
-	 {"2003마비", "2003麻痺"},
-	 {"검2", "剣2"},
-	 {"화염2", "炎2"},
-	 {"브레스", "ブレス"},
-	 {"베리어", "バリア"},
-	 {"상승", "上昇"},
-	 {"하강", "下降"},
-	 {"기타", "その他"},
-	 {"냉기", "冷気"},
-	 {"흡수", "吸収"},
-	 {"회복", "回復"},
-	 {"대지", "大地"},
-	 {"타격", "打撃"},
-	 {"도끼", "斧"},
-	 {"암흑", "暗黒"},
-	 {"창", "槍"},
-	 {"물", "水"},
-	 {"치료", "治療"},
-	 {"폭발", "爆発"},
-	 {"손톱", "爪"},
-	 {"화살", "矢"},
-	 {"신성", "神聖"},
-	 {"소생", "蘇生"},
-	 {"전격", "雷"},
-	 {"채찍", "鞭"},
-	 {"바람", "風"},
-	 {"마비", "麻痺"}
-	};
-
-	RTP_TABLE_2003["battlecharset"] = {
-	 // Official English translation names
-	 {"female elf a", "エルフ女a"},
-	 {"female elf b", "エルフ女b"},
-	 {"male elf a", "エルフ男a"},
-	 {"male elf b", "エルフ男b"},
-	 {"chinese woman a", "中華女a"},
-	 {"chinese woman b", "中華女b"},
-	 {"chinese man a", "中華男a"},
-	 {"chinese man b", "中華男b"},
-	 {"samurai a", "侍a"},
-	 {"samurai b", "侍b"},
-	 {"female monk a", "僧侶女a"},
-	 {"female monk b", "僧侶女b"},
-	 {"male monk a", "僧侶男a"},
-	 {"male monk b", "僧侶男b"},
-	 {"female hero a", "勇者女a"},
-	 {"female hero b", "勇者女b"},
-	 {"male hero a", "勇者男a"},
-	 {"male hero b", "勇者男b"},
-	 {"woman1 a", "女性１a"},
-	 {"woman1 b", "女性１b"},
-	 {"woman2 a", "女性２a"},
-	 {"woman2 b", "女性２b"},
-	 {"woman3 a", "女性３a"},
-	 {"woman3 b", "女性３b"},
-	 {"woman4 a", "女性４a"},
-	 {"woman4 b", "女性４b"},
-	 {"woman5 a", "女性５a"},
-	 {"woman5 b", "女性５b"},
-	 {"female ninja a", "忍者女a"},
-	 {"female ninja b", "忍者女b"},
-	 {"male ninja a", "忍者男a"},
-	 {"male ninja b", "忍者男b"},
-	 {"female warrior a", "戦士女a"},
-	 {"female warrior b", "戦士女b"},
-	 {"male warrior a", "戦士男a"},
-	 {"male warrior b", "戦士男b"},
-	 {"female fighter a", "格闘家女a"},
-	 {"female fighter b", "格闘家女b"},
-	 {"male fighter a", "格闘家男a"},
-	 {"male fighter b", "格闘家男b"},
-	 {"female pirate a", "海賊女a"},
-	 {"female pirate b", "海賊女b"},
-	 {"male pirate a", "海賊男a"},
-	 {"male pirate b", "海賊男b"},
-	 {"man1 a", "男性１a"},
-	 {"man1 b", "男性１b"},
-	 {"man2 a", "男性２a"},
-	 {"man2 b", "男性２b"},
-	 {"man3 a", "男性３a"},
-	 {"man3 b", "男性３b"},
-	 {"man4 a", "男性４a"},
-	 {"man4 b", "男性４b"},
-	 {"man5 a", "男性５a"},
-	 {"man5 b", "男性５b"},
-	 {"female bandit a", "盗賊女a"},
-	 {"female bandit b", "盗賊女b"},
-	 {"male bandit a", "盗賊男a"},
-	 {"male bandit b", "盗賊男b"},
-	 {"armored warror a", "鎧武者a"},
-	 {"armored warror b", "鎧武者b"},
-	 {"female mage a", "魔術師女a"},
-	 {"female mage b", "魔術師女b"},
-	 {"male mage a", "魔術師男a"},
-	 {"male mage b", "魔術師男b"},
-
-	 // RPG Advocate English translation names
-	 {"elf-f-1", "エルフ女a"},
-	 {"elf-f-2", "エルフ女b"},
-	 {"elf-m-1", "エルフ男a"},
-	 {"elf-m-2", "エルフ男b"},
-	 {"chinese-f-1", "中華女a"},
-	 {"chinese-f-2", "中華女b"},
-	 {"chinese-m-1", "中華男a"},
-	 {"chinese-m-2", "中華男b"},
-	 {"samurai1", "侍a"},
-	 {"samurai2", "侍b"},
-	 {"priestess1", "僧侶女a"},
-	 {"priestess2", "僧侶女b"},
-	 {"priest1", "僧侶男a"},
-	 {"priest2", "僧侶男b"},
-	 {"hero-f-1", "勇者女a"},
-	 {"hero-f-2", "勇者女b"},
-	 {"hero-m-1", "勇者男a"},
-	 {"hero-m-2", "勇者男b"},
-	 {"woman1-1", "女性１a"},
-	 {"woman1-2", "女性１b"},
-	 {"woman2-1", "女性２a"},
-	 {"woman2-2", "女性２b"},
-	 {"woman3-1", "女性３a"},
-	 {"woman3-2", "女性３b"},
-	 {"woman4-1", "女性４a"},
-	 {"woman4-2", "女性４b"},
-	 {"woman5-1", "女性５a"},
-	 {"woman5-2", "女性５b"},
-	 {"ninja-f-1", "忍者女a"},
-	 {"ninja-f-2", "忍者女b"},
-	 {"ninja-m-1", "忍者男a"},
-	 {"ninja-m-2", "忍者男b"},
-	 {"soldier-f-1", "戦士女a"},
-	 {"soldier-f-2", "戦士女b"},
-	 {"soldier-m-1", "戦士男a"},
-	 {"solider-m-2", "戦士男b"},
-	 {"monk-f-1", "格闘家女a"},
-	 {"monk-f-2", "格闘家女b"},
-	 {"monk-m-1", "格闘家男a"},
-	 {"monk-m-2", "格闘家男b"},
-	 {"pirate-f-1", "海賊女a"},
-	 {"pirate-f-2", "海賊女b"},
-	 {"pirate-m-1", "海賊男a"},
-	 {"pirate-m-2", "海賊男b"},
-	 {"man1-1", "男性１a"},
-	 {"man1-2", "男性１b"},
-	 {"man2-1", "男性２a"},
-	 {"man2-2", "男性２b"},
-	 {"man3-1", "男性３a"},
-	 {"man3-2", "男性３b"},
-	 {"man4-1", "男性４a"},
-	 {"man4-2", "男性４b"},
-	 {"man5-1", "男性５a"},
-	 {"man5-2", "男性５b"},
-	 {"thief-f-1", "盗賊女a"},
-	 {"thief-f-2", "盗賊女b"},
-	 {"thief-m-1", "盗賊男a"},
-	 {"thief-m-2", "盗賊男b"},
-	 {"armor1", "鎧武者a"},
-	 {"armor2", "鎧武者b"},
-	 {"mage-f-1", "魔術師女a"},
-	 {"mage-f-2", "魔術師女b"},
-	 {"mage-m-1", "魔術師男a"},
-	 {"mage-m-2", "魔術師男b"},
-
-	 // Unknown English translation names used by Spanish games
-	 {"elfwomana", "エルフ女a"},
-	 {"elfwomanb", "エルフ女b"},
-	 {"elfmana", "エルフ男a"},
-	 {"elfmanb", "エルフ男b"},
-	 {"chinesewomana", "中華女a"},
-	 {"chinesewomanb", "中華女b"},
-	 {"chinesemana", "中華男a"},
-	 {"chinesemanb", "中華男b"},
-	 {"samuraia", "侍a"},
-	 {"samuraib", "侍b"},
-	 {"monkwomana", "僧侶女a"},
-	 {"monkwomanb", "僧侶女b"},
-	 {"monkmana", "僧侶男a"},
-	 {"monkmanb", "僧侶男b"},
-	 {"herowomana", "勇者女a"},
-	 {"herowomanb", "勇者女b"},
-	 {"heromana", "勇者男a"},
-	 {"heromanb", "勇者男b"},
-	 {"womanépa", "女性１a"},
-	 {"womanépb", "女性１b"},
-	 {"womanéqa", "女性２a"},
-	 {"womanéqb", "女性２b"},
-	 {"womanéra", "女性３a"},
-	 {"womanérb", "女性３b"},
-	 {"womanésa", "女性４a"},
-	 {"womanésb", "女性４b"},
-	 {"womanéta", "女性５a"},
-	 {"womanétb", "女性５b"},
-	 {"ninjawomana", "忍者女a"},
-	 {"ninjawomanb", "忍者女b"},
-	 {"ninjamana", "忍者男a"},
-	 {"ninjamanb", "忍者男b"},
-	 {"soldierwomana", "戦士女a"},
-	 {"soldierwomanb", "戦士女b"},
-	 {"soldiermana", "戦士男a"},
-	 {"soldiermanb", "戦士男b"},
-	 {"grapplehousewomana", "格闘家女a"},
-	 {"grapplehousewomanb", "格闘家女b"},
-	 {"grapplehousemana", "格闘家男a"},
-	 {"grapplehousemanb", "格闘家男b"},
-	 {"piratewomana", "海賊女a"},
-	 {"piratewomanb", "海賊女b"},
-	 {"piratemana", "海賊男a"},
-	 {"pirateb", "海賊男b"},
-	 {"manépa", "男性１a"},
-	 {"manépb", "男性１b"},
-	 {"manéqa", "男性２a"},
-	 {"manéqb", "男性２b"},
-	 {"manéra", "男性３a"},
-	 {"manérb", "男性３b"},
-	 {"manésa", "男性４a"},
-	 {"manésb", "男性４b"},
-	 {"manéta", "男性５a"},
-	 {"manétb", "男性５b"},
-	 {"thiefwomana", "盗賊女a"},
-	 {"thiefwomanb", "盗賊女b"},
-	 {"thiefmana", "盗賊男a"},
-	 {"thiefmanb", "盗賊男b"},
-	 {"armourwarriora", "鎧武者a"},
-	 {"armourwarriorb", "鎧武者b"},
-	 {"magicteacherwomana", "魔術師女a"},
-	 {"magicteacherwomanb", "魔術師女b"},
-	 {"magicteachermana", "魔術師男a"},
-	 {"magicteachermanb", "魔術師男b"},
-
-	 // Russian RTP translation by Vlad Kovnerov
-	 {"tuanaa", "エルフ女a"},
-	 {"tanab", "エルフ女b"},
-	 {"temmada", "エルフ男a"},
-	 {"temmadb", "エルフ男b"},
-	 {"chuzaa", "中華女a"},
-	 {"chuzab", "中華女b"},
-	 {"chinga", "中華男a"},
-	 {"chingb", "中華男b"},
-	 {"garrea", "侍a"},
-	 {"garreb", "侍b"},
-	 {"kloria", "僧侶女a"},
-	 {"klorib", "僧侶女b"},
-	 {"siossa", "僧侶男a"},
-	 {"siossb", "僧侶男b"},
-	 {"noddaa", "勇者女a"},
-	 {"noddab", "勇者女b"},
-	 {"jemmona", "勇者男a"},
-	 {"jemmonb", "勇者男b"},
-	 {"cletoa", "女性１a"},
-	 {"cletob", "女性１b"},
-	 {"cikuaa", "女性２a"},
-	 {"jikuab", "女性２b"},
-	 {"irregiaa", "女性３a"},
-	 {"irregiab", "女性３b"},
-	 {"nysmaa", "女性４a"},
-	 {"nysmab", "女性４b"},
-	 {"beruaa", "女性５a"},
-	 {"beruab", "女性５b"},
-	 {"ginnya", "忍者女a"},
-	 {"ginnyb", "忍者女b"},
-	 {"xeoda", "忍者男a"},
-	 {"xeodb", "忍者男b"},
-	 {"eljeaa", "戦士女a"},
-	 {"eljeab", "戦士女b"},
-	 {"raglea", "戦士男a"},
-	 {"ragleb", "戦士男b"},
-	 {"phesaa", "格闘家女a"},
-	 {"phesab", "格闘家女b"},
-	 {"rasnena", "格闘家男a"},
-	 {"rasnenb", "格闘家男b"},
-	 {"rennaa", "海賊女a"},
-	 {"rennab", "海賊女b"},
-	 {"goxana", "海賊男a"},
-	 {"goxanb", "海賊男b"},
-	 {"jidada", "男性１a"},
-	 {"jidadb", "男性１b"},
-	 {"mjitta", "男性２a"},
-	 {"mjittb", "男性２b"},
-	 {"chuaza", "男性３a"},
-	 {"chuazb", "男性３b"},
-	 {"shella", "男性４a"},
-	 {"shellb", "男性４b"},
-	 {"frossa", "男性５a"},
-	 {"frossb", "男性５b"},
-	 {"otipaa", "盗賊女a"},
-	 {"otipab", "盗賊女b"},
-	 {"unnona", "盗賊男a"},
-	 {"unnonb", "盗賊男b"},
-	 {"joegoa", "鎧武者a"},
-	 {"joegob", "鎧武者b"},
-	 {"ljitia", "魔術師女a"},
-	 {"ljitib", "魔術師女b"},
-	 {"rivraa", "魔術師男a"},
-	 {"rivrab", "魔術師男b"},
-
-	 // Korean RTP
-	 {"사무라이a", "侍a"},
-	 {"엘프女 a", "エルフ女a"},
-	 {"여성１a", "女性１a"},
-	 {"여성５a", "女性５a"},
-	 {"여성４a", "女性４a"},
-	 {"여성２a", "女性２a"},
-	 {"여성３a", "女性３a"},
-	 {"해적女a", "海賊女a"},
-	 {"남성４a", "男性４a"},
-	 {"남성３a", "男性３a"},
-	 {"남성２a", "男性２a"},
-	 {"남성５a", "男性５a"},
-	 {"남성１a", "男性１a"},
-	 {"갑옷무사a", "鎧武者a"},
-	 {"사무라이b", "侍b"},
-	 {"엘프女 b", "エルフ女b"},
-	 {"여성４b", "女性４b"},
-	 {"여성３b", "女性３b"},
-	 {"여성１b", "女性１b"},
-	 {"여성２b", "女性２b"},
-	 {"여성５b", "女性５b"},
-	 {"해적女b", "海賊女b"},
-	 {"남성１b", "男性１b"},
-	 {"남성２b", "男性２b"},
-	 {"남성５b", "男性５b"},
-	 {"남성４b", "男性４b"},
-	 {"남성３b", "男性３b"},
-	 {"갑옷무사b", "鎧武者b"},
-	 {"중화女a", "中華女a"},
-	 {"승려女a", "僧侶女a"},
-	 {"용자女a", "勇者女a"},
-	 {"닌자女a", "忍者女a"},
-	 {"전사女a", "戦士女a"},
-	 {"격투가女a", "格闘家女a"},
-	 {"도적女a", "盗賊女a"},
-	 {"마술사女a", "魔術師女a"},
-	 {"중화女b", "中華女b"},
-	 {"승려女b", "僧侶女b"},
-	 {"용자女b", "勇者女b"},
-	 {"닌자女b", "忍者女b"},
-	 {"전사女b", "戦士女b"},
-	 {"격투가女b", "格闘家女b"},
-	 {"도적女b", "盗賊女b"},
-	 {"마술사女b", "魔術師女b"},
-	 {"중화男a", "中華男a"},
-	 {"승려男a", "僧侶男a"},
-	 {"용자男a", "勇者男a"},
-	 {"닌자男a", "忍者男a"},
-	 {"전사男a", "戦士男a"},
-	 {"격투가男a", "格闘家男a"},
-	 {"해적男a", "海賊男a"},
-	 {"엘프男 a", "エルフ男a"},
-	 {"도적男a", "盗賊男a"},
-	 {"마술사男a", "魔術師男a"},
-	 {"중화男b", "中華男b"},
-	 {"승려男b", "僧侶男b"},
-	 {"용자男b", "勇者男b"},
-	 {"닌자男b", "忍者男b"},
-	 {"전사男b", "戦士男b"},
-	 {"격투가男b", "格闘家男b"},
-	 {"해적男b", "海賊男b"},
-	 {"엘프男 b", "エルフ男b"},
-	 {"도적男b", "盗賊男b"},
-	 {"마술사男b", "魔術師男b"}
-	};
-
-	RTP_TABLE_2003["battleweapon"] = {
-	 // Official English translation names
-	 {"weapon", "武器"},
-
-	 // RPG Advocate English translation name
-	 {"weapons", "武器"},
-
-	 // Russian RTP translation by Vlad Kovnerov
-	 {"standart", "武器"},
-
-	 // Korean RTP
-	 {"무기", "武器"}
-	};
-
-	RTP_TABLE_2003["charset"] = {
-	 // Official English translation names
-	 {"object1", "オブジェクト1"},
-	 {"object2", "オブジェクト2"},
-	 {"monster1", "モンスター1"},
-	 {"monster2", "モンスター2"},
-	 {"people1", "一般1"},
-	 {"people2", "一般2"},
-	 {"people3", "一般3"},
-	 {"people4", "一般4"},
-	 {"people5", "一般5"},
-	 {"actor1", "主人公1"},
-	 {"actor2", "主人公2"},
-	 {"actor3", "主人公3"},
-	 {"actor4", "主人公4"},
-	 {"vehicles", "乗り物"},
-	 {"animal", "動物"},
-
-	 // RPG Advocate English translation names
-	 {"char1", "一般1"},
-	 {"char2", "一般2"},
-	 {"char3", "一般3"},
-	 {"char4", "一般4"},
-	 {"char5", "一般5"},
-	 {"hero1", "主人公1"},
-	 {"hero2", "主人公2"},
-	 {"hero3", "主人公3"},
-	 {"hero4", "主人公4"},
-	 {"vehicle", "乗り物"},
-
-	 // Unknown English translation names used by Spanish games
-	 {"general1", "一般1"},
-	 {"general2", "一般2"},
-	 {"general3", "一般3"},
-	 {"general4", "一般4"},
-	 {"general5", "一般5"},
-	 {"protagonist1", "主人公1"},
-	 {"protagonist2", "主人公2"},
-	 {"protagonist3", "主人公3"},
-	 {"protagonist4", "主人公4"},
-
-	 // Russian RTP translation by Vlad Kovnerov
-	 {"objects1", "オブジェクト1"},
-	 {"objects2", "オブジェクト2"},
-	 {"monsters1", "モンスター1"},
-	 {"monsters2", "モンスター2"},
-	 {"chara1", "主人公1"},
-	 {"chara2", "主人公2"},
-	 {"chara3", "主人公3"},
-	 {"chara4", "主人公4"},
-	 {"animals", "動物"},
-
-	 // 2000 RTP names not overwritten by Vlad Kovnerov's installation
-	 {"people7", "一般2"},
-
-	 // Orphaned Don Miguel's 2000 RTP extras pointing to nearest match
-	 {"chubby1", "一般3"},
-	 {"chubby2", "一般2"},
-	 {"crown1", "主人公4"},
-	 {"crown2", "モンスター2"},
-	 {"crown3", "モンスター1"},
-	 {"crown4", "動物"},
-	 {"crown5", "一般5"},
-	 {"crown6", "モンスター1"},
-	 {"crown7", "動物"},
-	 {"future1", "一般1"},
-	 {"future2", "一般4"},
-	 {"future3", "一般5"},
-	 {"men1", "一般4"},
-	 {"women1", "一般5"},
-
-	 //Korean RTP
-	 {"오브젝트1", "オブジェクト1"},
-	 {"몬스터1", "モンスター1"},
-	 {"일반1", "一般1"},
-	 {"주인공1", "主人公1"},
-	 {"오브젝트2", "オブジェクト2"},
-	 {"몬스터2", "モンスター2"},
-	 {"일반2", "一般2"},
-	 {"주인공2", "主人公2"},
-	 {"일반3", "一般3"},
-	 {"주인공3", "主人公3"},
-	 {"일반4", "一般4"},
-	 {"주인공4", "主人公4"},
-	 {"일반5", "一般5"},
-	 {"탈것", "乗り物"},
-	 {"동물", "動物"}
-	};
-
-	RTP_TABLE_2003["chipset"] = {
-	 // Official English translation names
-	 {"dungeon", "ダンジョン"},
-	 {"interior", "内装"},
-	 {"world", "基本"},
-	 {"exterior", "外観"},
-	 {"ship", "船"},
-
-	 // RPG Advocate English translation names
-	 {"building", "内装"},
-	 {"main", "基本"},
-	 {"town", "外観"},
-
-	 // Unknown English translation names used by Spanish games
-	 {"donjohn", "ダンジョン"},
-	 {"basic", "基本"},
-	 {"appearance", "外観"},
-	 {"boat", "船"},
-
-	 // Russian RTP translation by Vlad Kovnerov
-	 {"internal1", "ダンジョン"},
-	 {"internal2", "内装"},
-	 {"village", "外観"},
-
-	 // 2000 RTP names not overwritten by Vlad Kovnerov's installation
-	 {"inner", "内装"},
-	 {"basis", "基本"},
-	 {"outline", "外観"},
-
-	 // Orphaned Don Miguel's 2000 RTP extras pointing to nearest match
-	 {"chipset1", "ダンジョン"},
-	 {"chipset2", "内装"},
-	 {"chipset3", "船"},
-
-	 // Korean RTP
-	 {"던젼", "ダンジョン"},
-	 {"내부", "内装"},
-	 {"기본", "基本"},
-	 {"외견", "外観"},
-	 {"배", "船"}
-	};
-
-	RTP_TABLE_2003["faceset"] = {
-	 // Official English translation names
-	 {"monster", "モンスター"},
-	 {"people1", "一般1"},
-	 {"people2", "一般2"},
-	 {"actor1", "主人公1"},
-	 {"actor2", "主人公2"},
-
-	 // RPG Advocate English translation names
-	 {"faces1", "一般1"},
-	 {"faces2", "一般2"},
-	 {"hero1", "主人公1"},
-	 {"hero2", "主人公2"},
-
-	 // Unknown English translation names used by Spanish games
-	 {"general1", "一般1"},
-	 {"general2", "一般2"},
-	 {"protagonist1", "主人公1"},
-	 {"protagonist2", "主人公2"},
-
-	 // Russian RTP translation by Vlad Kovnerov
-	 {"monsters", "モンスター"},
-	 {"people", "一般1"},
-	 {"peopleanimal", "一般2"},
-	 {"face1", "主人公1"},
-	 {"face2", "主人公2"},
-
-	 // 2000 RTP names not overwritten by Vlad Kovnerov's installation
-	 {"people1", "一般1"},
-	 {"people2", "一般2"},
-	 {"chara1", "主人公1"},
-	 {"chara2", "主人公2"},
-
-	 // Korean RTP
-	 {"일반1", "一般1"},
-	 {"일반2", "一般2"},
-	 {"주인공1", "主人公1"},
-	 {"주인공2", "主人公2"},
-	 {"몬스터", "モンスター"}
-	};
-
-	RTP_TABLE_2003["gameover"] = {
-	 // Official English translation names
-	 {"game over", "ゲームオーバー"},
+// Generated by resources/rtp_table/gen_rtp_table.py, do not edit.
+// The names are listed in resources/rtp_table/rtp_2000.txt and rtp_2003.txt
 
-	 // RPG Advocate English translation names
-	 {"gameover", "ゲームオーバー"},
-
-	 // Korean RTP
-	 {"게임오버", "ゲームオーバー"}
-	};
-
-	RTP_TABLE_2003["monster"] = {
-	 // Official English translation names
-	 {"ahriman", "アーリマン"},
-	 {"asura", "アスラ"},
-	 {"anaconda", "アナコンダ"},
-	 {"alligator", "アリゲーター"},
-	 {"undead knight", "アンデッドナイト"},
-	 {"ifreet", "イフリート"},
-	 {"imp", "インプ"},
-	 {"vampire", "ヴァンパイア"},
-	 {"ouroboros", "ウロボロス"},
-	 {"elf", "エルフ"},
-	 {"ogre", "オーガ"},
-	 {"orc", "オーク"},
-	 {"odin", "オーディン"},
-	 {"octopus", "オクトパス"},
-	 {"gargoyle", "ガーゴイル"},
-	 {"carbuncle", "カーバンクル"},
-	 {"carmilla", "カーミラ"},
-	 {"kappa", "カッパ"},
-	 {"catoblepas", "カトブレパス"},
-	 {"garuda", "ガルーダ"},
-	 {"chimera", "キメラ"},
-	 {"ghoul", "グール"},
-	 {"kraken", "クラーケン"},
-	 {"crab", "クラブ"},
-	 {"griffon", "グリフォン"},
-	 {"grell", "グレル"},
-	 {"crawler", "クロウラー"},
-	 {"gazer", "ゲイザー"},
-	 {"quetzalcoatl", "ケツアルクアトル"},
-	 {"cait sith", "ケットシー"},
-	 {"cerberus", "ケルベロス"},
-	 {"centaur", "ケンタウロス"},
-	 {"gorgon", "ゴーゴン"},
-	 {"ghost", "ゴースト"},
-	 {"golem", "ゴーレム"},
-	 {"cockatorice", "コカトリス"},
-	 {"goblin", "ゴブリン"},
-	 {"kobold", "コボルト"},
-	 {"cyclops", "サイクロプス"},
-	 {"satan", "サタナエル"},
-	 {"sahagin", "サハギン"},
-	 {"salamander", "サラマンダー"},
-	 {"shark", "シャーク"},
-	 {"giant", "ジャイアント"},
-	 {"jack-o-lantern", "ジャック・オー・ランタン"},
-	 {"shadow", "シャドウ"},
-	 {"sylph", "シルフ"},
-	 {"scylla", "スキュラ"},
-	 {"skeleton", "スケルトン"},
-	 {"scorpion", "スコーピオン"},
-	 {"snake", "スネーク"},
-	 {"spirit", "スピリッツ"},
-	 {"sphinx", "スフィンクス"},
-	 {"spectre", "スペクター"},
-	 {"slime", "スライム"},
-	 {"siren", "セイレーン"},
-	 {"seraphim", "セラフィム"},
-	 {"centipede", "センチピード"},
-	 {"sorcerer", "ソーサラー"},
-	 {"zombie", "ゾンビ"},
-	 {"dark elf", "ダークエルフ"},
-	 {"dark knight", "ダークナイト"},
-	 {"titan", "タイタン"},
-	 {"tarantula", "タランチュラ"},
-	 {"tiamat", "ティアマット"},
-	 {"demon", "デーモン"},
-	 {"toad", "トード"},
-	 {"dragon", "ドラゴン"},
-	 {"dragon knight", "ドラゴンナイト"},
-	 {"treant", "トレント"},
-	 {"troll", "トロール"},
-	 {"necromancer", "ネクロマンサー"},
-	 {"nepenthes", "ネペンテス"},
-	 {"berserker", "バーサーカー"},
-	 {"harpy", "ハーピー"},
-	 {"basilisk", "バジリスク"},
-	 {"bat", "バット"},
-	 {"bahamut", "バハムート"},
-	 {"parasite", "パラサイト"},
-	 {"big foot", "ビッグフット"},
-	 {"hydra", "ヒュドラ"},
-	 {"phoenix", "フェニックス"},
-	 {"fenrir", "フェンリル"},
-	 {"behemoth", "ベヒーモス"},
-	 {"hornet", "ホーネット"},
-	 {"manticore", "マンティコア"},
-	 {"mantis", "マンティス"},
-	 {"mammoth", "マンモス"},
-	 {"mummy", "ミイラ男"},
-	 {"midgardsormr", "ミドガルズオルム"},
-	 {"minotaur", "ミノタウロス"},
-	 {"mimic", "ミミック"},
-	 {"medusa", "メデューサ"},
-	 {"unicorn", "ユニコーン"},
-	 {"lakshmi", "ラクシュミ"},
-	 {"lamia", "ラミア"},
-	 {"leviathan", "リヴァイアサン"},
-	 {"lizard", "リザード"},
-	 {"lizardman", "リザードマン"},
-	 {"lich", "リッチ"},
-	 {"lilith", "リリス"},
-	 {"wraith", "レイス"},
-	 {"remora", "レモラ"},
-	 {"werewolf", "ワーウルフ"},
-	 {"worm", "ワーム"},
-	 {"wight", "ワイト"},
-	 {"wyvern", "ワイバーン"},
-	 {"kyuubi", "九尾の狐"},
-	 {"suzaku", "朱雀"},
-	 {"genbu", "玄武"},
-	 {"byakko", "白虎"},
-	 {"horse", "馬"},
-	 {"oni", "鬼"},
-	 {"kirin", "麒麟"},
-	 {"ryuu", "龍"},
-
-	 // RPG Advocate English translation names
-	 {"ariman", "アーリマン"},
-	 {"u-knight", "アンデッドナイト"},
-	 {"efreet", "イフリート"},
-	 {"oroboros", "ウロボロス"},
-	 {"cojurer", "カーミラ"},
-	 {"cancer", "クラブ"},
-	 {"deathgaze", "ゲイザー"},
-	 {"quezal", "ケツアルクアトル"},
-	 {"caitsith", "ケットシー"},
-	 {"cockatrice", "コカトリス"},
-	 {"jack", "ジャック・オー・ランタン"},
-	 {"specter", "スペクター"},
-	 {"seraph", "セラフィム"},
-	 {"darkelf", "ダークエルフ"},
-	 {"darkknight", "ダークナイト"},
-	 {"spider", "タランチュラ"},
-	 {"dragonknight", "ドラゴンナイト"},
-	 {"nepenthe", "ネペンテス"},
-	 {"bigfoot", "ビッグフット"},
-	 {"midgard-serp", "ミドガルズオルム"},
-	 {"rakashimi", "ラクシュミ"},
-	 {"lillith", "リリス"},
-	 {"ninetail", "九尾の狐"},
-	 {"redsparrow", "朱雀"},
-	 {"blackturtle", "玄武"},
-	 {"whitetiger", "白虎"},
-	 {"nightmare", "馬"},
-	 {"ki-rin", "麒麟"},
-	 {"bluedragon", "龍"},
-
-	 // Unknown English translation names used by Spanish games
-	 {"multiarmdemon", "アスラ"},
-	 {"pimpskeleton", "アンデッドナイト"},
-	 {"ifrit", "イフリート"},
-	 {"littledemon", "インプ"},
-	 {"dragon", "ウロボロス"},
-	 {"auger", "オーガ"},
-	 {"ork", "オーク"},
-	 {"carbunkle", "カーバンクル"},
-	 {"carmira", "カーミラ"},
-	 {"raincoat", "カッパ"},
-	 {"demonhorsething", "カトブレパス"},
-	 {"seamonster", "クラーケン"},
-	 {"griffin", "グリフォン"},
-	 {"jellyfish", "グレル"},
-	 {"crowera", "クロウラー"},
-	 {"eyestalk", "ゲイザー"},
-	 {"birdsnake", "ケツアルクアトル"},
-	 {"ketsea", "ケットシー"},
-	 {"cerebus", "ケルベロス"},
-	 {"bull", "ゴーゴン"},
-	 {"imp", "ゴブリン"},
-	 {"giant", "サイクロプス"},
-	 {"darkangel", "サタナエル"},
-	 {"merman", "サハギン"},
-	 {"giant-2", "ジャイアント"},
-	 {"jackolantern", "ジャック・オー・ランタン"},
-	 {"fairy", "シルフ"},
-	 {"gorgon", "スキュラ"},
-	 {"lostsoul", "スペクター"},
-	 {"merangel", "セイレーン"},
-	 {"angel", "セラフィム"},
-	 {"catterpillar", "センチピード"},
-	 {"wizard", "ソーサラー"},
-	 {"daemon", "デーモン"},
-	 {"frog", "トード"},
-	 {"dragon-2", "ドラゴン"},
-	 {"tree", "トレント"},
-	 {"killerplant", "ネペンテス"},
-	 {"barbarian", "バーサーカー"},
-	 {"earwig", "バジリスク"},
-	 {"lizarddemon", "バハムート"},
-	 {"yeti", "ビッグフット"},
-	 {"wolf", "フェンリル"},
-	 {"bea", "ホーネット"},
-	 {"monster", "マンティコア"},
-	 {"preyingmantis", "マンティス"},
-	 {"monster-2", "ミドガルズオルム"},
-	 {"mystic", "ラクシュミ"},
-	 {"gorgon-2", "ラミア"},
-	 {"spectre", "レイス"},
-	 {"flyingfish", "レモラ"},
-	 {"yto", "ワイト"},
-	 {"yburning", "ワイバーン"},
-	 {"foxofninetails", "九尾の狐"},
-	 {"monster-3", "玄武"},
-	 {"ogre", "鬼"},
-	 {"giraffe", "麒麟"},
-
-	 // Russian RTP translation by Vlad Kovnerov
-	 {"maliciousflower", "アーリマン"},
-	 {"weaponmaster", "アスラ"},
-	 {"snake", "アナコンダ"},
-	 {"crocodile", "アリゲーター"},
-	 {"deadpirate", "アンデッドナイト"},
-	 {"efrit", "イフリート"},
-	 {"features", "インプ"},
-	 {"levitan", "ウロボロス"},
-	 {"archer", "エルフ"},
-	 {"primitiveman", "オーガ"},
-	 {"pigsoldier", "オーク"},
-	 {"dangeroussoldier", "オーディン"},
-	 {"rubyfox", "カーバンクル"},
-	 {"murdererwoman", "カーミラ"},
-	 {"morloc", "カッパ"},
-	 {"curvebull", "カトブレパス"},
-	 {"flyingwarrior", "ガルーダ"},
-	 {"zombie", "グール"},
-	 {"seabowl", "クラーケン"},
-	 {"griphon", "グリフォン"},
-	 {"robot", "グレル"},
-	 {"worm", "クロウラー"},
-	 {"eye", "ゲイザー"},
-	 {"flyingworm", "ケツアルクアトル"},
-	 {"eremite", "ケットシー"},
-	 {"infernalbull", "ゴーゴン"},
-	 {"witchphantom", "ゴースト"},
-	 {"rooster", "コカトリス"},
-	 {"littledemon", "ゴブリン"},
-	 {"wolf", "コボルト"},
-	 {"triton", "サハギン"},
-	 {"burninglizard", "サラマンダー"},
-	 {"cannibal", "ジャイアント"},
-	 {"pumpkin", "ジャック・オー・ランタン"},
-	 {"lostshadow", "シャドウ"},
-	 {"medusa", "スキュラ"},
-	 {"cancer", "スコーピオン"},
-	 {"dangeroussnake", "スネーク"},
-	 {"laughingspirit", "スピリッツ"},
-	 {"sphynx", "スフィンクス"},
-	 {"magicskull", "スペクター"},
-	 {"flyingmermaid", "セイレーン"},
-	 {"sephiroth", "セラフィム"},
-	 {"multileg", "センチピード"},
-	 {"magician", "ソーサラー"},
-	 {"poisonzombie", "ゾンビ"},
-	 {"fencer", "ダークエルフ"},
-	 {"knight", "ダークナイト"},
-	 {"many-domeddragon", "ティアマット"},
-	 {"horngoat", "デーモン"},
-	 {"bluedragon", "ドラゴン"},
-	 {"dragonwarrior", "ドラゴンナイト"},
-	 {"dendrid", "トレント"},
-	 {"orc", "トロール"},
-	 {"necromant", "ネクロマンサー"},
-	 {"multirootflower", "ネペンテス"},
-	 {"horned", "バジリスク"},
-	 {"dragon", "バハムート"},
-	 {"all-knowing", "パラサイト"},
-	 {"many-domeduglycreature", "ヒュドラ"},
-	 {"realwolf", "フェンリル"},
-	 {"infernaldog", "ベヒーモス"},
-	 {"bee", "ホーネット"},
-	 {"crossedbeast", "マンティコア"},
-	 {"insect", "マンティス"},
-	 {"mamont", "マンモス"},
-	 {"creepingcreature", "ミドガルズオルム"},
-	 {"ogrechest", "ミミック"},
-	 {"hypermedusa", "メデューサ"},
-	 {"prophet", "ラクシュミ"},
-	 {"mermaid", "ラミア"},
-	 {"levitanwithahorn", "リヴァイアサン"},
-	 {"monitorlizard", "リザード"},
-	 {"lizardsoldier", "リザードマン"},
-	 {"powerfulnecromant", "リッチ"},
-	 {"multihandswarrior", "リリス"},
-	 {"phantom", "レイス"},
-	 {"sharpfish", "レモラ"},
-	 {"werwolf", "ワーウルフ"},
-	 {"toothworm", "ワーム"},
-	 {"seizedsoldier", "ワイト"},
-	 {"browndragon", "ワイバーン"},
-	 {"magicfox", "九尾の狐"},
-	 {"vainbird", "朱雀"},
-	 {"turtlesnake", "玄武"},
-	 {"polartiger", "白虎"},
-	 {"darkhorse", "馬"},
-	 {"fairytalehorse", "麒麟"},
-	 {"longdragon", "龍"},
-
-	 // 2000 RTP names not overwritten by Vlad Kovnerov's installation
-	 {"hog", "オーク"},
-	 {"darkrider", "トルーパー"},
-	 {"aquamen", "マーマン"},
-	 {"hellhound", "ケルベロス"},
-	 {"wolfman", "コボルト"},
-	 {"flyingdemon", "デーモン"},
-	 {"greendragon1", "ドラゴン"},
-	 {"oak", "トレント"},
-	 {"lizardmen", "リザードマン"},
-	 {"darkspirit", "リッチ"},
-	 {"greendragon2", "龍"},
-
-	 // Orphaned 2000 names pointing to nearest match
-	 {"boy1", "インプ"},
-	 {"girl2", "シルフ"},
-	 {"boy3", "ソーサラー"},
-	 {"girl4", "エルフ"},
-	 {"man5", "ダークエルフ"},
-	 {"girl6", "カーミラ"},
-	 {"oldman7", "アンデッドナイト"},
-	 {"granny", "ラクシュミ"},
-	 {"warrior", "ワイト"},
-	 {"redscorpion", "スコーピオン"},
-	 {"princess", "ラクシュミ"},
-	 {"ninja", "シャドウ"},
-	 {"fish", "レモラ"},
-	 {"hero1", "ダークエルフ"},
-	 {"hero2", "カーミラ"},
-	 {"samurai", "オーディン"},
-	 {"death", "レイス"},
-	 {"gnome", "オーガ"},
-	 {"king", "タイタン"},
-	 {"thief", "ケットシー"},
-	 {"firescull", "スピリッツ"},
-	 {"cloakdemon", "ネクロマンサー"},
-	 {"witch1", "ソーサラー"},
-	 {"witch2", "カーミラ"},
-
-	 // Korean RTP
-	 {"잭-오-랜턴", "ジャック・オー・ランタン"},
-	 {"웜", "ワーム"},
-	 {"데어 매트", "ティアマット"},
-	 {"다크 엘프", "ダークエルフ"},
-	 {"다크 나이트", "ダークナイト"},
-	 {"실프", "シルフ"},
-	 {"배트", "バット"},
-	 {"크랩", "クラブ"},
-	 {"엘프", "エルフ"},
-	 {"구렐", "グレル"},
-	 {"토드", "トード"},
-	 {"구울", "グール"},
-	 {"오거", "オーガ"},
-	 {"리치", "リッチ"},
-	 {"임프", "インプ"},
-	 {"좀비", "ゾンビ"},
-	 {"오크", "オーク"},
-	 {"데몬", "デーモン"},
-	 {"샤크", "シャーク"},
-	 {"미믹", "ミミック"},
-	 {"골렘", "ゴーレム"},
-	 {"트롤", "トロール"},
-	 {"하피", "ハーピー"},
-	 {"고곤", "ゴーゴン"},
-	 {"펜릴", "フェンリル"},
-	 {"오딘", "オーディン"},
-	 {"호넷", "ホーネット"},
-	 {"빅풋", "ビッグフット"},
-	 {"드래곤 나이트", "ドラゴンナイト"},
-	 {"언데드 나이트", "アンデッドナイト"},
-	 {"와이트", "ワイト"},
-	 {"라미아", "ラミア"},
-	 {"리리스", "リリス"},
-	 {"카트바", "カッパ"},
-	 {"레이스", "レイス"},
-	 {"아수라", "アスラ"},
-	 {"키메라", "キメラ"},
-	 {"레모라", "レモラ"},
-	 {"고블린", "ゴブリン"},
-	 {"맘모스", "マンモス"},
-	 {"드래곤", "ドラゴン"},
-	 {"사하킨", "サハギン"},
-	 {"타이탄", "タイタン"},
-	 {"카미라", "カーミラ"},
-	 {"스쿨라", "スキュラ"},
-	 {"코볼트", "コボルト"},
-	 {"슬라임", "スライム"},
-	 {"고스트", "ゴースト"},
-	 {"리자드", "リザード"},
-	 {"게이져", "ゲイザー"},
-	 {"히드라", "ヒュドラ"},
-	 {"가루다", "ガルーダ"},
-	 {"셰도우", "シャドウ"},
-	 {"트렌트", "トレント"},
-	 {"세이렌", "セイレーン"},
-	 {"캐트시", "ケットシー"},
-	 {"세라핌", "セラフィム"},
-	 {"가고일", "ガーゴイル"},
-	 {"그리폰", "グリフォン"},
-	 {"와이번", "ワイバーン"},
-	 {"스펙터", "スペクター"},
-	 {"크라켄", "クラーケン"},
-	 {"스켈톤", "スケルトン"},
-	 {"워울프", "ワーウルフ"},
-	 {"메두사", "メデューサ"},
-	 {"아리맨", "アーリマン"},
-	 {"소서러", "ソーサラー"},
-	 {"유니콘", "ユニコーン"},
-	 {"만티스", "マンティス"},
-	 {"피닉스", "フェニックス"},
-	 {"카방클", "カーバンクル"},
-	 {"버저커", "バーサーカー"},
-	 {"미드갈즈 오르무", "ミドガルズオルム"},
-	 {"스테이크", "スネーク"},
-	 {"아나콘다", "アナコンダ"},
-	 {"쿠로우라", "クロウラー"},
-	 {"사타나엘", "サタナエル"},
-	 {"이프리트", "イフリート"},
-	 {"라쿠슈미", "ラクシュミ"},
-	 {"네벤테스", "ネペンテス"},
-	 {"배히모스", "ベヒーモス"},
-	 {"바하무트", "バハムート"},
-	 {"옥토퍼스", "オクトパス"},
-	 {"켈베로스", "ケルベロス"},
-	 {"스피릿츠", "スピリッツ"},
-	 {"스핑크스", "スフィンクス"},
-	 {"타란튤라", "タランチュラ"},
-	 {"사라멘더", "サラマンダー"},
-	 {"스콜피온", "スコーピオン"},
-	 {"센티피드", "センチピード"},
-	 {"뱀파이어", "ヴァンパイア"},
-	 {"리자드맨", "リザードマン"},
-	 {"자이언트", "ジャイアント"},
-	 {"만티코어", "マンティコア"},
-	 {"우로보로스", "ウロボロス"},
-	 {"페러사이트", "パラサイト"},
-	 {"바실리크스", "バジリスク"},
-	 {"코카트리스", "コカトリス"},
-	 {"켄타우르스", "ケンタウロス"},
-	 {"엘리게이터", "アリゲーター"},
-	 {"사이클롭스", "サイクロプス"},
-	 {"네크로맨서", "ネクロマンサー"},
-	 {"리바이어던", "リヴァイアサン"},
-	 {"케이시아르크 아토르", "ケツアルクアトル"},
-	 {"카토부레바트", "カトブレパス"},
-	 {"미노타우르스", "ミノタウロス"},
-	 {"구미호", "九尾の狐"},
-	 {"주작", "朱雀"},
-	 {"현무", "玄武"},
-	 {"백호", "白虎"},
-	 {"말", "馬"},
-	 {"기린", "麒麟"},
-	 {"용", "龍"},
-	 {"청룡", "龍"},
-	 {"미이라 男", "ミイラ男"},
-	 {"도깨비(鬼)", "鬼"}
-	};
-
-	RTP_TABLE_2003["music"] = {
-	 // Official English translation names
-	 {"2003healing spring", "2003いやしの泉"},
-	 {"2003casino indulgence", "2003カジノ三昧"},
-	 {"2003colosseum", "2003コロシアム"},
-	 {"2003cyber city", "2003サイバーシティ"},
-	 {"2003snow town", "2003スノータウン"},
-	 {"2003panic", "2003パニック"},
-	 {"2003maximum battle", "2003マキシマム・バトル"},
-	 {"2003dream of striking it rich", "2003一獲千金の夢"},
-	 {"2003adventurers", "2003冒険者たち"},
-	 {"2003hero's return", "2003勇者の凱旋"},
-	 {"2003ancient city", "2003古城"},
-	 {"2003subterranean maze", "2003地下迷宮"},
-	 {"2003dream forest", "2003夢幻の森"},
-	 {"2003dreaminess", "2003夢見心地"},
-	 {"2003free for all", "2003大混戦"},
-	 {"2003wings to the sky", "2003大空への翼"},
-	 {"2003cathedral", "2003大聖堂"},
-	 {"2003fairy forest", "2003妖精の森"},
-	 {"2003lonesome journey", "2003孤独な旅立ち"},
-	 {"2003little army's march", "2003小さな兵隊のマーチ"},
-	 {"2003village in the valley", "2003山あいの村"},
-	 {"2003empire", "2003帝国〜エンパイア"},
-	 {"2003young memories", "2003幼少の記憶"},
-	 {"2003creeping darkness", "2003忍び寄る闇"},
-	 {"2003in the eternal flow of time", "2003悠久の時の流れに"},
-	 {"2003sorrow", "2003悲しみ"},
-	 {"2003beginning of a war", "2003戦いの幕開け"},
-	 {"2003church", "2003教会"},
-	 {"2003sunnyvillage", "2003日だまりの村"},
-	 {"2003darkaltar", "2003暗黒の祭壇"},
-	 {"2003village of savages", "2003未開の集落"},
-	 {"2003far eastern land", "2003極東の地"},
-	 {"2003machine fortress", "2003機械要塞"},
-	 {"2003ice labyrinth", "2003氷のラビリンス"},
-	 {"2003final battleground", "2003決戦の地"},
-	 {"2003deserted mansion", "2003無人の館"},
-	 {"2003palace party", "2003王宮のパーティー"},
-	 {"2003otherworldly corridor", "2003異次元回廊"},
-	 {"2003waltz of blessings", "2003祝福ワルツ"},
-	 {"2003steady breeze", "2003穏やかな風"},
-	 {"2003tension", "2003緊迫"},
-	 {"2003tepeated wars", "2003繰り返される戦い"},
-	 {"2003city bustle", "2003街の賑わい"},
-	 {"2003tavern", "2003街の酒場"},
-	 {"2003deep memory", "2003記憶の彼方に"},
-	 {"2003exploring ruins", "2003遺跡探索"},
-	 {"2003battle with an evil god", "2003邪神との戦い"},
-	 {"2003silence", "2003静寂"},
-	 {"j2003horn", "j2003ホルン"},
-	 {"jitem", "jアイテム"},
-	 {"jjoke 1", "jギャグ1"},
-	 {"jjoke 2", "jギャグ2"},
-	 {"jfanfare 1", "jファンファーレ1"},
-	 {"jfanfare 2", "jファンファーレ2"},
-	 {"jfanfare 3", "jファンファーレ3"},
-	 {"jfanfare 4", "jファンファーレ4"},
-	 {"jfanfare 5", "jファンファーレ5"},
-	 {"jfanfare 6", "jファンファーレ6"},
-	 {"jinn 1", "j宿1"},
-	 {"jinn 2", "j宿2"},
-	 {"jend of battle 1", "j戦闘終了1"},
-	 {"jend of battle 2", "j戦闘終了2"},
-	 {"jend of battle 3", "j戦闘終了3"},
-	 {"jend of battle 4", "j戦闘終了4"},
-	 {"jdoubt", "j疑惑"},
-	 {"jmystery", "j謎"},
-	 {"se2003alarm", "se2003アラーム"},
-	 {"se2003jungle", "se2003ジャングル"},
-	 {"se2003bustle", "se2003雑踏"},
-	 {"se2003wind", "se2003風"},
-	 {"se2003bird", "se2003鳥"},
-	 {"seearthquake", "se地震"},
-	 {"sedownpour", "se大雨"},
-	 {"seclock", "se時計"},
-	 {"sesea", "se海"},
-	 {"serain", "se雨"},
-	 {"ending 1", "エンディング1"},
-	 {"ending 2", "エンディング2"},
-	 {"ending 3", "エンディング3"},
-	 {"opening 1", "オープニング1"},
-	 {"opening 2", "オープニング2"},
-	 {"opening 3", "オープニング3"},
-	 {"game over 1", "ゲームオーバー1"},
-	 {"game over 2", "ゲームオーバー2"},
-	 {"game over 3", "ゲームオーバー3"},
-	 {"ghost town 1", "ゴーストタウン1"},
-	 {"ghost town 2", "ゴーストタウン2"},
-	 {"dungeon 1", "ダンジョン1"},
-	 {"dungeon 2", "ダンジョン2"},
-	 {"dungeon 3", "ダンジョン3"},
-	 {"dungeon 4", "ダンジョン4"},
-	 {"dungeon 5", "ダンジョン5"},
-	 {"in a pinch", "ピンチ"},
-	 {"field 1", "フィールド1"},
-	 {"field 2", "フィールド2"},
-	 {"field 3", "フィールド3"},
-	 {"field 4", "フィールド4"},
-	 {"boss 1", "ボス1"},
-	 {"boss 2", "ボス2"},
-	 {"boss 3", "ボス3"},
-	 {"boss 4", "ボス4"},
-	 {"vehicle 1", "乗り物1"},
-	 {"vehicle 2", "乗り物2"},
-	 {"vehicle 3", "乗り物3"},
-	 {"parting 1", "別れ1"},
-	 {"parting 2", "別れ2"},
-	 {"hero 1", "勇者1"},
-	 {"hero 2", "勇者2"},
-	 {"animal", "動物"},
-	 {"victory", "勝利"},
-	 {"castle 1", "城1"},
-	 {"castle 2", "城2"},
-	 {"castle 3", "城3"},
-	 {"tower 1", "塔1"},
-	 {"tower 2", "塔2"},
-	 {"tower 3", "塔3"},
-	 {"fairy 1", "妖精1"},
-	 {"fairy 2", "妖精2"},
-	 {"repose 1", "安らぎ1"},
-	 {"repose 2", "安らぎ2"},
-	 {"repose 3", "安らぎ3"},
-	 {"shop 1", "店1"},
-	 {"shop 2", "店2"},
-	 {"shop 3", "店3"},
-	 {"wrath", "怒り"},
-	 {"sorrow", "悲しみ"},
-	 {"battle 1", "戦闘1"},
-	 {"battle 2", "戦闘2"},
-	 {"battle 3", "戦闘3"},
-	 {"exploration", "探索"},
-	 {"defeat", "敗北"},
-	 {"church", "教会"},
-	 {"lively market", "明るい市場"},
-	 {"village 1", "村1"},
-	 {"village 2", "村2"},
-	 {"village 3", "村3"},
-	 {"thief", "泥棒"},
-	 {"liveliness", "活気"},
-	 {"town 1", "町1"},
-	 {"town 2", "町2"},
-	 {"town 3", "町3"},
-	 {"mystery 1", "神秘1"},
-	 {"mystery 2", "神秘2"},
-	 {"mystery 3", "神秘3"},
-	 {"secret treasure", "秘宝"},
-	 {"ship 1", "船1"},
-	 {"ship 2", "船2"},
-	 {"ship 3", "船3"},
-	 {"trial", "試練"},
-	 {"black market", "闇市"},
-	 {"demon lord", "魔王"},
-
-	 // RPG Advocate English translation names
-	 {"spring", "2003いやしの泉"},
-	 {"casino", "2003カジノ三昧"},
-	 {"arena", "2003コロシアム"},
-	 {"bustling-city", "2003サイバーシティ"},
-	 {"snowtown", "2003スノータウン"},
-	 {"panic", "2003パニック"},
-	 {"fierce-battle", "2003マキシマム・バトル"},
-	 {"jackpot", "2003一獲千金の夢"},
-	 {"adventure", "2003冒険者たち"},
-	 {"triumph", "2003勇者の凱旋"},
-	 {"ancient-castle", "2003古城"},
-	 {"labyrinth", "2003地下迷宮"},
-	 {"forest", "2003夢幻の森"},
-	 {"moonlight", "2003夢見心地"},
-	 {"armyclash", "2003大混戦"},
-	 {"airborne", "2003大空への翼"},
-	 {"hallowed-halls", "2003大聖堂"},
-	 {"fairies", "2003妖精の森"},
-	 {"lonewolf", "2003孤独な旅立ち"},
-	 {"march", "2003小さな兵隊のマーチ"},
-	 {"mtn-village", "2003山あいの村"},
-	 {"empire", "2003帝国〜エンパイア"},
-	 {"memories", "2003幼少の記憶"},
-	 {"foreboding", "2003忍び寄る闇"},
-	 {"eternal", "2003悠久の時の流れに"},
-	 {"sadness", "2003悲しみ"},
-	 {"intro", "2003戦いの幕開け"},
-	 {"church1", "2003教会"},
-	 {"village4", "2003日だまりの村"},
-	 {"evil-temple", "2003暗黒の祭壇"},
-	 {"strangetown", "2003未開の集落"},
-	 {"far-east", "2003極東の地"},
-	 {"mecha-base", "2003機械要塞"},
-	 {"icecave", "2003氷のラビリンス"},
-	 {"showdown", "2003決戦の地"},
-	 {"haunted", "2003無人の館"},
-	 {"royal-ball", "2003王宮のパーティー"},
-	 {"dimension", "2003異次元回廊"},
-	 {"waltz", "2003祝福ワルツ"},
-	 {"interlude", "2003穏やかな風"},
-	 {"tension", "2003緊迫"},
-	 {"endless-fight", "2003繰り返される戦い"},
-	 {"town-square", "2003街の賑わい"},
-	 {"bar", "2003街の酒場"},
-	 {"memories2", "2003記憶の彼方に"},
-	 {"ruins", "2003遺跡探索"},
-	 {"godslayer", "2003邪神との戦い"},
-	 {"calm", "2003静寂"},
-	 {"horns", "j2003ホルン"},
-	 {"item", "jアイテム"},
-	 {"mischief1", "jギャグ1"},
-	 {"mischief2", "jギャグ2"},
-	 {"fanfare1", "jファンファーレ1"},
-	 {"fanfare2", "jファンファーレ2"},
-	 {"fanfare3", "jファンファーレ3"},
-	 {"fanfare4", "jファンファーレ4"},
-	 {"fanfare5", "jファンファーレ5"},
-	 {"fanfare6", "jファンファーレ6"},
-	 {"inn1", "j宿1"},
-	 {"inn2", "j宿2"},
-	 {"victory1", "j戦闘終了1"},
-	 {"victory2", "j戦闘終了2"},
-	 {"victory3", "j戦闘終了3"},
-	 {"victory4", "j戦闘終了4"},
-	 {"surprise", "j疑惑"},
-	 {"riddle", "j謎"},
-	 {"se-alarm", "se2003アラーム"},
-	 {"se-jungle", "se2003ジャングル"},
-	 {"se-crowd", "se2003雑踏"},
-	 {"se-gale", "se2003風"},
-	 {"se-bird", "se2003鳥"},
-	 {"se-quake", "se地震"},
-	 {"se-torrent", "se大雨"},
-	 {"se-clock", "se時計"},
-	 {"se-ocean", "se海"},
-	 {"se-rain", "se雨"},
-	 {"ending1", "エンディング1"},
-	 {"ending2", "エンディング2"},
-	 {"ending3", "エンディング3"},
-	 {"opening1", "オープニング1"},
-	 {"opening2", "オープニング2"},
-	 {"opening3", "オープニング3"},
-	 {"gameover1", "ゲームオーバー1"},
-	 {"gameover2", "ゲームオーバー2"},
-	 {"gameover3", "ゲームオーバー3"},
-	 {"ghost-town1", "ゴーストタウン1"},
-	 {"ghost-town2", "ゴーストタウン2"},
-	 {"dungeon1", "ダンジョン1"},
-	 {"dungeon2", "ダンジョン2"},
-	 {"dungeon3", "ダンジョン3"},
-	 {"dungeon4", "ダンジョン4"},
-	 {"dungeon5", "ダンジョン5"},
-	 {"tightspot", "ピンチ"},
-	 {"field1", "フィールド1"},
-	 {"field2", "フィールド2"},
-	 {"field3", "フィールド3"},
-	 {"field4", "フィールド4"},
-	 {"boss1", "ボス1"},
-	 {"boss2", "ボス2"},
-	 {"boss3", "ボス3"},
-	 {"boss4", "ボス4"},
-	 {"vehicle1", "乗り物1"},
-	 {"vehicle2", "乗り物2"},
-	 {"vehicle3", "乗り物3"},
-	 {"parting1", "別れ1"},
-	 {"parting2", "別れ2"},
-	 {"hero1", "勇者1"},
-	 {"hero2", "勇者2"},
-	 {"success", "勝利"},
-	 {"castle1", "城1"},
-	 {"castle2", "城2"},
-	 {"castle3", "城3"},
-	 {"tower1", "塔1"},
-	 {"tower2", "塔2"},
-	 {"tower3", "塔3"},
-	 {"fairy1", "妖精1"},
-	 {"fairy2", "妖精2"},
-	 {"solace1", "安らぎ1"},
-	 {"solace2", "安らぎ2"},
-	 {"solace3", "安らぎ3"},
-	 {"shop1", "店1"},
-	 {"shop2", "店2"},
-	 {"shop3", "店3"},
-	 {"malice", "怒り"},
-	 {"sad", "悲しみ"},
-	 {"battle1", "戦闘1"},
-	 {"battle2", "戦闘2"},
-	 {"battle3", "戦闘3"},
-	 {"explore", "探索"},
-	 {"church2", "教会"},
-	 {"bazaar", "明るい市場"},
-	 {"village1", "村1"},
-	 {"village2", "村2"},
-	 {"village3", "村3"},
-	 {"strength", "活気"},
-	 {"town1", "町1"},
-	 {"town2", "町2"},
-	 {"town3", "町3"},
-	 {"mystery1", "神秘1"},
-	 {"mystery2", "神秘2"},
-	 {"mystery3", "神秘3"},
-	 {"treasure", "秘宝"},
-	 {"boat1", "船1"},
-	 {"boat2", "船2"},
-	 {"boat3", "船3"},
-	 {"ordeal", "試練"},
-	 {"eviltown", "闇市"},
-	 {"demonic", "魔王"},
-
-	 // Unknown English translation names used by Spanish games
-	 {"2003spring", "2003いやしの泉"},
-	 {"2003casino", "2003カジノ三昧"},
-	 {"2003colloseum", "2003コロシアム"},
-	 {"2003rhinobarcity", "2003サイバーシティ"},
-	 {"2003snowtown", "2003スノータウン"},
-	 {"2003maximumsbattle", "2003マキシマム・バトル"},
-	 {"2003dream-catchlotsofmoney", "2003一獲千金の夢"},
-	 {"2003venturepeople", "2003冒険者たち"},
-	 {"2003triumphalreturn", "2003勇者の凱旋"},
-	 {"2003oldcastle", "2003古城"},
-	 {"2003undergroundlabyrinth", "2003地下迷宮"},
-	 {"2003forestoffantasy", "2003夢幻の森"},
-	 {"2003mooniness", "2003夢見心地"},
-	 {"2003largeconfoundcombat", "2003大混戦"},
-	 {"2003wingtoskies", "2003大空への翼"},
-	 {"2003largesaintlyhall", "2003大聖堂"},
-	 {"2003fairyforest", "2003妖精の森"},
-	 {"2003lonelyjourney", "2003孤独な旅立ち"},
-	 {"2003marchofsmallsoldiers", "2003小さな兵隊のマーチ"},
-	 {"2003villageofravines", "2003山あいの村"},
-	 {"2003enpire", "2003帝国〜エンパイア"},
-	 {"2003memoryofinfancy", "2003幼少の記憶"},
-	 {"2003approachingdarkness", "2003忍び寄る闇"},
-	 {"2003theeternalflow", "2003悠久の時の流れに"},
-	 {"2003sorrow", "2003悲しみ"},
-	 {"2003fightopening", "2003戦いの幕開け"},
-	 {"2003church", "2003教会"},
-	 {"2003villageball", "2003日だまりの村"},
-	 {"2003altarofdarkness", "2003暗黒の祭壇"},
-	 {"2003unexploredvillage", "2003未開の集落"},
-	 {"2003fareasternarea", "2003極東の地"},
-	 {"2003machinefortress", "2003機械要塞"},
-	 {"2003icelabyrinth", "2003氷のラビリンス"},
-	 {"2003areaofdecisivebattles", "2003決戦の地"},
-	 {"2003unmannedmansion", "2003無人の館"},
-	 {"2003courtparty", "2003王宮のパーティー"},
-	 {"2003strangedimensionalcorridor", "2003異次元回廊"},
-	 {"2003blessingwaltz", "2003祝福ワルツ"},
-	 {"2003calmwind", "2003穏やかな風"},
-	 {"2003tension", "2003緊迫"},
-	 {"2003thefightwhichisrepeated", "2003繰り返される戦い"},
-	 {"2003towncrowd", "2003街の賑わい"},
-	 {"2003townbar", "2003街の酒場"},
-	 {"2003onthefarsideofmemories", "2003記憶の彼方に"},
-	 {"2003ruinssearch", "2003遺跡探索"},
-	 {"2003wickedgodfight", "2003邪神との戦い"},
-	 {"2003calmness", "2003静寂"},
-	 {"jitem", "jアイテム"},
-	 {"jgag1", "jギャグ1"},
-	 {"jgag2", "jギャグ2"},
-	 {"jfanfare1", "jファンファーレ1"},
-	 {"jfanfare2", "jファンファーレ2"},
-	 {"jfanfare3", "jファンファーレ3"},
-	 {"jfanfare4", "jファンファーレ4"},
-	 {"jfanfare5", "jファンファーレ5"},
-	 {"jfanfare6", "jファンファーレ6"},
-	 {"jinn1", "j宿1"},
-	 {"jinn2", "j宿2"},
-	 {"jaggressiveend1", "j戦闘終了1"},
-	 {"jaggressiveend2", "j戦闘終了2"},
-	 {"jaggressiveend3", "j戦闘終了3"},
-	 {"jaggressiveend4", "j戦闘終了4"},
-	 {"jdoubt", "j疑惑"},
-	 {"jpuzzle", "j謎"},
-	 {"se2003alarm", "se2003アラーム"},
-	 {"se2003jungle", "se2003ジャングル"},
-	 {"se2003bustle", "se2003雑踏"},
-	 {"se2003wind", "se2003風"},
-	 {"se2003bird", "se2003鳥"},
-	 {"seearthquake", "se地震"},
-	 {"seheavyrain", "se大雨"},
-	 {"seclock", "se時計"},
-	 {"sesea", "se海"},
-	 {"serainy", "se雨"},
-
-	 // Russian RTP translation by Vlad Kovnerov
-	 {"2003happiness", "2003いやしの泉"},
-	 {"2003research", "2003カジノ三昧"},
-	 {"2003piracy", "2003コロシアム"},
-	 {"2003joyfulnews", "2003サイバーシティ"},
-	 {"2003lullaby", "2003スノータウン"},
-	 {"2003warning", "2003パニック"},
-	 {"2003pursuit", "2003マキシマム・バトル"},
-	 {"2003silentpleasure", "2003一獲千金の夢"},
-	 {"2003farewell", "2003冒険者たち"},
-	 {"2003bigpalace", "2003勇者の凱旋"},
-	 {"2003glory", "2003古城"},
-	 {"2003fast", "2003地下迷宮"},
-	 {"2003worldsound", "2003夢幻の森"},
-	 {"2003serenity", "2003夢見心地"},
-	 {"2003gangster", "2003大混戦"},
-	 {"2003fanfares", "2003大空への翼"},
-	 {"2003grief", "2003大聖堂"},
-	 {"2003workingmusic", "2003妖精の森"},
-	 {"2003memoirs", "2003孤独な旅立ち"},
-	 {"2003parade", "2003小さな兵隊のマーチ"},
-	 {"2003eaststyle", "2003山あいの村"},
-	 {"2003andagainpleasure", "2003帝国〜エンパイア"},
-	 {"2003fairytale", "2003幼少の記憶"},
-	 {"2003threat", "2003忍び寄る闇"},
-	 {"2003calm", "2003悠久の時の流れに"},
-	 {"2003calm2", "2003悲しみ"},
-	 {"2003dangerousfog", "2003戦いの幕開け"},
-	 {"2003church", "2003教会"},
-	 {"2003farmer", "2003日だまりの村"},
-	 {"2003globalfrustration", "2003暗黒の祭壇"},
-	 {"2003witchsong", "2003未開の集落"},
-	 {"2003flight", "2003極東の地"},
-	 {"2003sadend", "2003機械要塞"},
-	 {"2003drops", "2003氷のラビリンス"},
-	 {"2003battlefield", "2003決戦の地"},
-	 {"2003silentcrying", "2003無人の館"},
-	 {"2003dance", "2003王宮のパーティー"},
-	 {"2003fastbattle", "2003異次元回廊"},
-	 {"2003waltz", "2003祝福ワルツ"},
-	 {"2003summer", "2003穏やかな風"},
-	 {"2003terribledream", "2003緊迫"},
-	 {"2003fastbattle2", "2003繰り返される戦い"},
-	 {"2003pleasure", "2003街の賑わい"},
-	 {"2003travel", "2003街の酒場"},
-	 {"2003morning", "2003記憶の彼方に"},
-	 {"2003infiniteidea", "2003遺跡探索"},
-	 {"2003chaos", "2003邪神との戦い"},
-	 {"2003underwater", "2003静寂"},
-	 {"2003win", "j2003ホルン"},
-	 {"se2003ding", "se2003アラーム"},
-	 {"se2003people", "se2003雑踏"},
-	 {"se2003winter", "se2003風"},
-	 {"se2003birds", "se2003鳥"},
-	 {"serain2", "se大雨"},
-	 {"serain", "se雨"},
-
-	 // 2000 RTP names not overwritten by Vlad Kovnerov's installation
-	 {"gag1", "jギャグ1"},
-	 {"gag2", "jギャグ2"},
-	 {"battleend1", "j戦闘終了1"},
-	 {"battleend2", "j戦闘終了2"},
-	 {"battleend3", "j戦闘終了3"},
-	 {"battleend4", "j戦闘終了4"},
-	 {"doubt", "j疑惑"},
-	 {"gosttown1", "ゴーストタウン1"},
-	 {"gosttown2", "ゴーストタウン2"},
-	 {"crisis", "ピンチ"},
-	 {"ride1", "乗り物1"},
-	 {"ride2", "乗り物2"},
-	 {"ride3", "乗り物3"},
-	 {"farewell1", "別れ1"},
-	 {"farewell2", "別れ2"},
-	 {"get", "勝利"},
-	 {"peace1", "安らぎ1"},
-	 {"peace2", "安らぎ2"},
-	 {"peace3", "安らぎ3"},
-	 {"anger", "怒り"},
-	 {"search", "探索"},
-	 {"lose", "敗北"},
-	 {"church", "教会"},
-	 {"fiesta", "明るい市場"},
-	 {"energy", "活気"},
-	 {"ship1", "船1"},
-	 {"ship2", "船2"},
-	 {"ship3", "船3"},
-	 {"dark", "闇市"},
-	 {"devil", "魔王"},
-
-	 // Korean RTP
-	 {"고스트 타운1", "ゴーストタウン1"},
-	 {"게임오버1", "ゲームオーバー1"},
-	 {"지하감옥1", "ダンジョン1"},
-	 {"오프닝1", "オープニング1"},
-	 {"필드1", "フィールド1"},
-	 {"보스1", "ボス1"},
-	 {"끝1", "エンディング1"},
-	 {"차량1", "乗り物1"},
-	 {"이별1", "別れ1"},
-	 {"용사1", "勇者1"},
-	 {"성1", "城1"},
-	 {"탑1", "塔1"},
-	 {"요정1", "妖精1"},
-	 {"편안해짐1", "安らぎ1"},
-	 {"점1", "店1"},
-	 {"전투1", "戦闘1"},
-	 {"촌1", "村1"},
-	 {"밭두둑1", "町1"},
-	 {"신비1", "神秘1"},
-	 {"배1", "船1"},
-	 {"2003패닉", "2003パニック"},
-	 {"2003스노우 타운", "2003スノータウン"},
-	 {"2003사이버 시티", "2003サイバーシティ"},
-	 {"2003맥시멈·전투", "2003マキシマム・バトル"},
-	 {"2003콜로세움", "2003コロシアム"},
-	 {"2003일획천금의 꿈", "2003一獲千金の夢"},
-	 {"2003카지노", "2003カジノ三昧"},
-	 {"2003여행자 서고", "2003冒険者たち"},
-	 {"2003용사의 개선", "2003勇者の凱旋"},
-	 {"2003고성", "2003古城"},
-	 {"2003지하미궁", "2003地下迷宮"},
-	 {"2003몽환의 숲", "2003夢幻の森"},
-	 {"2003꿈을 꾸는 기분", "2003夢見心地"},
-	 {"2003대혼전", "2003大混戦"},
-	 {"2003대공의 날개", "2003大空への翼"},
-	 {"2003대성당", "2003大聖堂"},
-	 {"2003요정의 숲", "2003妖精の森"},
-	 {"2003고독한 여행", "2003孤独な旅立ち"},
-	 {"2003작은 군대의 행진곡", "2003小さな兵隊のマーチ"},
-	 {"2003산골짜기 마을", "2003山あいの村"},
-	 {"2003제국", "2003帝国～エンパイア"},
-	 {"2003유소의 기억", "2003幼少の記憶"},
-	 {"2003살며시 다가옴", "2003忍び寄る闇"},
-	 {"2003유구의 흐름", "2003悠久の時の流れに"},
-	 {"2003슬퍼하고", "2003悲しみ"},
-	 {"2003싸움의 개막", "2003戦いの幕開け"},
-	 {"2003교회", "2003教会"},
-	 {"2003양지의 마을", "2003日だまりの村"},
-	 {"2003암흑의 제단", "2003暗黒の祭壇"},
-	 {"2003미개한 취락", "2003未開の集落"},
-	 {"2003극동의 땅", "2003極東の地"},
-	 {"2003기계 요새", "2003機械要塞"},
-	 {"2003얼음의 래비런스", "2003氷のラビリンス"},
-	 {"2003결전의 땅", "2003決戦の地"},
-	 {"2003회복의 샘", "2003いやしの泉"},
-	 {"2003무인 저택", "2003無人の館"},
-	 {"2003왕궁의 파티", "2003王宮のパーティー"},
-	 {"2003차원의 길", "2003異次元回廊"},
-	 {"2003축복 왈츠", "2003祝福ワルツ"},
-	 {"2003온화한 바람", "2003穏やかな風"},
-	 {"2003긴박", "2003緊迫"},
-	 {"2003반복된 싸움", "2003繰り返される戦い"},
-	 {"2003거리의 북적임", "2003街の賑わい"},
-	 {"2003거리의 술집", "2003街の酒場"},
-	 {"2003기억의 저쪽에", "2003記憶の彼方に"},
-	 {"2003유적 탐색", "2003遺跡探索"},
-	 {"2003사신과의 싸움", "2003邪神との戦い"},
-	 {"2003정적", "2003静寂"},
-	 {"고스트 타운2", "ゴーストタウン2"},
-	 {"게임오버2", "ゲームオーバー2"},
-	 {"지하감옥2", "ダンジョン2"},
-	 {"오프닝2", "オープニング2"},
-	 {"필드2", "フィールド2"},
-	 {"보스2", "ボス2"},
-	 {"끝2", "エンディング2"},
-	 {"차량2", "乗り物2"},
-	 {"이별2", "別れ2"},
-	 {"용사2", "勇者2"},
-	 {"성2", "城2"},
-	 {"탑2", "塔2"},
-	 {"요정2", "妖精2"},
-	 {"편안해짐2", "安らぎ2"},
-	 {"점2", "店2"},
-	 {"전투2", "戦闘2"},
-	 {"촌2", "村2"},
-	 {"밭두둑2", "町2"},
-	 {"신비2", "神秘2"},
-	 {"배2", "船2"},
-	 {"게임오버3", "ゲームオーバー3"},
-	 {"지하감옥3", "ダンジョン3"},
-	 {"오프닝3", "オープニング3"},
-	 {"필드3", "フィールド3"},
-	 {"보스3", "ボス3"},
-	 {"끝3", "エンディング3"},
-	 {"차량3", "乗り物3"},
-	 {"성3", "城3"},
-	 {"탑3", "塔3"},
-	 {"편안해짐3", "安らぎ3"},
-	 {"점3", "店3"},
-	 {"전투3", "戦闘3"},
-	 {"촌3", "村3"},
-	 {"밭두둑3", "町3"},
-	 {"신비3", "神秘3"},
-	 {"배3", "船3"},
-	 {"지하감옥4", "ダンジョン4"},
-	 {"필드4", "フィールド4"},
-	 {"보스4", "ボス4"},
-	 {"지하감옥5", "ダンジョン5"},
-	 {"J팡파르1", "Jファンファーレ1"},
-	 {"J개그1", "Jギャグ1"},
-	 {"J숙소1", "J宿1"},
-	 {"J전투종료1", "J戦闘終了1"},
-	 {"J2003호른", "J2003ホルン"},
-	 {"J팡파르2", "Jファンファーレ2"},
-	 {"J개그2", "Jギャグ2"},
-	 {"J숙소2", "J宿2"},
-	 {"J전투종료2", "J戦闘終了2"},
-	 {"J팡파르3", "Jファンファーレ3"},
-	 {"J전투종료3", "J戦闘終了3"},
-	 {"J팡파르4", "Jファンファーレ4"},
-	 {"J전투종료4", "J戦闘終了4"},
-	 {"J팡파르5", "Jファンファーレ5"},
-	 {"J팡파르6", "Jファンファーレ6"},
-	 {"J아이템", "Jアイテム"},
-	 {"J의혹", "J疑惑"},
-	 {"J수수께기", "J謎"},
-	 {"핀치", "ピンチ"},
-	 {"동물", "動物"},
-	 {"승리", "勝利"},
-	 {"화내다", "怒り"},
-	 {"슬퍼하다", "悲しみ"},
-	 {"탐색", "探索"},
-	 {"패배", "敗北"},
-	 {"교회", "教会"},
-	 {"밝은 시장", "明るい市場"},
-	 {"도둑", "泥棒"},
-	 {"활기", "活気"},
-	 {"바보", "秘宝"},
-	 {"시련", "試練"},
-	 {"암시장", "闇市"},
-	 {"마왕", "魔王"},
-	 {"SE2003알람", "SE2003アラーム"},
-	 {"SE2003정글", "SE2003ジャングル"},
-	 {"SE2003혼잡", "SE2003雑踏"},
-	 {"SE2003바람", "SE2003風"},
-	 {"SE2003새", "SE2003鳥"},
-	 {"SE지진", "SE地震"},
-	 {"SE호우", "SE大雨"},
-	 {"SE시계", "SE時計"},
-	 {"SE바다", "SE海"},
-	 {"SE비", "SE雨"}
-	};
-
-	RTP_TABLE_2003["panorama"] = {
-	 // Official English translation names
-	 {"sunset1", "夕焼け1"},
-	 {"sunset2", "夕焼け2"},
-	 {"dawn1", "夜明け1"},
-	 {"dawn2", "夜明け2"},
-	 {"night sky1", "夜空1"},
-	 {"night sky2", "夜空2"},
-	 {"cosmos1", "宇宙"},
-	 {"planet1", "惑星1"},
-	 {"planet2", "惑星2"},
-	 {"planet3", "惑星3"},
-	 {"dimension rift", "異空間"},
-	 {"sky1", "空1"},
-	 {"sky2", "空2"},
-
-	 // RPG Advocate English translation names
-	 {"dusk1", "夕焼け1"},
-	 {"dusk2", "夕焼け2"},
-	 {"night1", "夜空1"},
-	 {"night2", "夜空2"},
-	 {"space", "宇宙"},
-	 {"strange", "異空間"},
-
-	 // Unknown English translation names used by Spanish games
-	 {"eveningglow1", "夕焼け1"},
-	 {"eveningglow2", "夕焼け2"},
-	 {"nightempty1", "夜空1"},
-	 {"nightempty2", "夜空2"},
-	 {"planetary1", "惑星1"},
-	 {"planetary2", "惑星2"},
-	 {"planetary3", "惑星3"},
-	 {"strangespacial", "異空間"},
-	 {"empty1", "空1"},
-	 {"empty2", "空2"},
-
-	 // Russian RTP translation by Vlad Kovnerov
-	 {"dawn1", "夕焼け1"},
-	 {"dawn2", "夕焼け2"},
-	 {"evening1", "夜明け1"},
-	 {"evening2", "夜明け2"},
-	 {"galaxy", "宇宙"},
-	 {"weird", "異空間"},
-	 {"morning1", "空1"},
-	 {"morning2", "空2"},
-
-	 // Korean RTP
-	 {"석양1", "夕焼け1"},
-	 {"새벽1", "夜明け1"},
-	 {"밤하늘1", "夜空1"},
-	 {"혹성1", "惑星1"},
-	 {"하늘1", "空1"},
-	 {"석양2", "夕焼け2"},
-	 {"새벽2", "夜明け2"},
-	 {"밤하늘2", "夜空2"},
-	 {"혹성2", "惑星2"},
-	 {"하늘2", "空2"},
-	 {"혹성3", "惑星3"},
-	 {"우주", "宇宙"},
-	 {"이공간", "異空間"}
-	};
-
-	RTP_TABLE_2003["sound"] = {
-	 // Official English translation names
-	 {"item1", "アイテム1"},
-	 {"item2", "アイテム2"},
-	 {"chime1", "あたり1"},
-	 {"chime2", "あたり2"},
-	 {"buff", "アップ"},
-	 {"dog", "イヌ"},
-	 {"cow", "ウシ"},
-	 {"horse", "ウマ"},
-	 {"roar", "おたけび"},
-	 {"cursor1", "カーソル1"},
-	 {"cursor2", "カーソル2"},
-	 {"glassshatter", "ガシャン"},
-	 {"cancel1", "キャンセル1"},
-	 {"cancel2", "キャンセル2"},
-	 {"paralyze1", "しびれ1"},
-	 {"paralyze2", "しびれ2"},
-	 {"paralyze3", "しびれ3"},
-	 {"jump1", "ジャンプ1"},
-	 {"jump2", "ジャンプ2"},
-	 {"shot1", "ショット1"},
-	 {"shot2", "ショット2"},
-	 {"shot3", "ショット3"},
-	 {"switch1", "スイッチ1"},
-	 {"switch2", "スイッチ2"},
-	 {"debuff", "ダウン"},
-	 {"damage1", "ダメージ1"},
-	 {"damage2", "ダメージ2"},
-	 {"teleport1", "テレポート1"},
-	 {"teleport2", "テレポート2"},
-	 {"tiger", "トラ"},
-	 {"glare", "にらみ"},
-	 {"chicken", "にわとり"},
-	 {"cat", "ネコ"},
-	 {"knock", "ノック"},
-	 {"buzzer1", "はずれ1"},
-	 {"buzzer2", "はずれ2"},
-	 {"barrier", "バリア"},
-	 {"sheep", "ひつじ"},
-	 {"buzzer3", "ブザー1"},
-	 {"buzzer4", "ブザー2"},
-	 {"flash1", "フラッシュ1"},
-	 {"flash2", "フラッシュ2"},
-	 {"flash3", "フラッシュ3"},
-	 {"breath", "ブレス"},
-	 {"monster1", "モンスター1"},
-	 {"monster2", "モンスター2"},
-	 {"lion", "ライオン"},
-	 {"ice1", "冷気1"},
-	 {"ice2", "冷気2"},
-	 {"ice3", "冷気3"},
-	 {"ice4", "冷気4"},
-	 {"ice5", "冷気5"},
-	 {"ice6", "冷気6"},
-	 {"ice7", "冷気7"},
-	 {"ice8", "冷気8"},
-	 {"ice9", "冷気9"},
-	 {"ice10", "冷気10"},
-	 {"ice11", "冷気11"},
-	 {"sword1", "剣1"},
-	 {"sword2", "剣2"},
-	 {"sword3", "剣3"},
-	 {"absorb1", "吸収1"},
-	 {"absorb2", "吸収2"},
-	 {"bite", "噛む"},
-	 {"recovery1", "回復1"},
-	 {"recovery2", "回復2"},
-	 {"recovery3", "回復3"},
-	 {"recovery4", "回復4"},
-	 {"recovery5", "回復5"},
-	 {"recovery6", "回復6"},
-	 {"recovery7", "回復7"},
-	 {"recovery8", "回復8"},
-	 {"evade1", "回避1"},
-	 {"evade2", "回避2"},
-	 {"earthquake1", "地震1"},
-	 {"earthquake2", "地震2"},
-	 {"barrier1", "壁1"},
-	 {"barrier2", "壁2"},
-	 {"earth1", "大地1"},
-	 {"earth2", "大地2"},
-	 {"earth3", "大地3"},
-	 {"earth4", "大地4"},
-	 {"earth5", "大地5"},
-	 {"earth6", "大地6"},
-	 {"earth7", "大地7"},
-	 {"earth8", "大地8"},
-	 {"earth9", "大地9"},
-	 {"earth10", "大地10"},
-	 {"ensnare", "巻き付き"},
-	 {"bow1", "弓1"},
-	 {"bow2", "弓2"},
-	 {"combat1", "戦闘1"},
-	 {"combat2", "戦闘2"},
-	 {"blow1", "打撃1"},
-	 {"blow2", "打撃2"},
-	 {"blow3", "打撃3"},
-	 {"blow4", "打撃4"},
-	 {"blow5", "打撃5"},
-	 {"blow6", "打撃6"},
-	 {"blow7", "打撃7"},
-	 {"attack1", "攻撃1"},
-	 {"attack2", "攻撃2"},
-	 {"slash1", "斬る1"},
-	 {"slash10", "斬る10"},
-	 {"slash11", "斬る11"},
-	 {"slash2", "斬る2"},
-	 {"slash3", "斬る3"},
-	 {"slash4", "斬る4"},
-	 {"slash5", "斬る5"},
-	 {"slash6", "斬る6"},
-	 {"slash7", "斬る7"},
-	 {"slash8", "斬る8"},
-	 {"slash9", "斬る9"},
-	 {"clock", "時計"},
-	 {"blind", "暗闇"},
-	 {"darkness1", "暗黒1"},
-	 {"darkness2", "暗黒2"},
-	 {"darkness3", "暗黒3"},
-	 {"darkness4", "暗黒4"},
-	 {"darkness5", "暗黒5"},
-	 {"darkness6", "暗黒6"},
-	 {"song", "歌"},
-	 {"poison", "毒"},
-	 {"water1", "水1"},
-	 {"water2", "水2"},
-	 {"water3", "水3"},
-	 {"water4", "水4"},
-	 {"water5", "水5"},
-	 {"water6", "水6"},
-	 {"decision1", "決定1"},
-	 {"decision2", "決定2"},
-	 {"silence", "沈黙"},
-	 {"sea1", "海1"},
-	 {"sea2", "海2"},
-	 {"collapse1", "消滅1"},
-	 {"collapse2", "消滅2"},
-	 {"confusion", "混乱"},
-	 {"fire1", "炎1"},
-	 {"fire2", "炎2"},
-	 {"fire3", "炎3"},
-	 {"fire4", "炎4"},
-	 {"fire5", "炎5"},
-	 {"fire6", "炎6"},
-	 {"fire7", "炎7"},
-	 {"fire8", "炎8"},
-	 {"explosion1", "爆発1"},
-	 {"explosion2", "爆発2"},
-	 {"explosion3", "爆発3"},
-	 {"explosion4", "爆発4"},
-	 {"explosion5", "爆発5"},
-	 {"explosion6", "爆発6"},
-	 {"explosion7", "爆発7"},
-	 {"sleep", "睡眠"},
-	 {"sandstorm", "砂けむり"},
-	 {"holy1", "神聖1"},
-	 {"holy2", "神聖2"},
-	 {"holy3", "神聖3"},
-	 {"holy4", "神聖4"},
-	 {"holy5", "神聖5"},
-	 {"holy6", "神聖6"},
-	 {"holy7", "神聖7"},
-	 {"holy8", "神聖8"},
-	 {"holy9", "神聖9"},
-	 {"move", "移動"},
-	 {"pollen", "花粉"},
-	 {"fall1", "落ちる1"},
-	 {"fall2", "落ちる2"},
-	 {"raise1", "蘇生1"},
-	 {"raise2", "蘇生2"},
-	 {"raise3", "蘇生3"},
-	 {"escape", "逃走"},
-	 {"key", "鍵"},
-	 {"bell", "鐘"},
-	 {"close1", "閉める1"},
-	 {"close2", "閉める2"},
-	 {"open1", "開ける1"},
-	 {"open2", "開ける2"},
-	 {"rain1", "雨1"},
-	 {"rain2", "雨2"},
-	 {"thunder1", "雷1"},
-	 {"thunder2", "雷2"},
-	 {"thunder3", "雷3"},
-	 {"thunder4", "雷4"},
-	 {"thunder5", "雷5"},
-	 {"thunder6", "雷6"},
-	 {"thunder7", "雷7"},
-	 {"thunder8", "雷8"},
-	 {"thunder9", "雷9"},
-	 {"thunder10", "雷10"},
-	 {"fog1", "霧1"},
-	 {"fog2", "霧2"},
-	 {"wave1", "音波1"},
-	 {"wave2", "音波2"},
-	 {"wind1", "風1"},
-	 {"wind2", "風2"},
-	 {"wind3", "風3"},
-	 {"wind4", "風4"},
-	 {"wind5", "風5"},
-	 {"wind6", "風6"},
-	 {"wind7", "風7"},
-	 {"wind8", "風8"},
-	 {"wind9", "風9"},
-	 {"wind10", "風10"},
-	 {"wind11", "風11"},
-	 {"magic1", "魔法1"},
-	 {"magic2", "魔法2"},
-
-	 // RPG Advocate English translation names
-	 {"jingle1", "あたり1"},
-	 {"jingle2", "あたり2"},
-	 {"increase", "アップ"},
-	 {"shatter", "ガシャン"},
-	 {"decrease", "ダウン"},
-	 {"gaze", "にらみ"},
-	 {"cat", "ネコ"},
-	 {"failure1", "はずれ1"},
-	 {"failure2", "はずれ2"},
-	 {"buzzer1", "ブザー1"},
-	 {"buzzer2", "ブザー2"},
-	 {"ice01", "冷気1"},
-	 {"ice04", "冷気2"},
-	 {"ice05", "冷気3"},
-	 {"ice06", "冷気4"},
-	 {"ice07", "冷気5"},
-	 {"ice08", "冷気6"},
-	 {"ice09", "冷気7"},
-	 {"ice10", "冷気8"},
-	 {"ice11", "冷気9"},
-	 {"ice02", "冷気10"},
-	 {"ice03", "冷気11"},
-	 {"bloodsuck", "噛む"},
-	 {"heal1", "回復1"},
-	 {"heal2", "回復2"},
-	 {"heal3", "回復3"},
-	 {"heal4", "回復4"},
-	 {"heal5", "回復5"},
-	 {"heal6", "回復6"},
-	 {"heal7", "回復7"},
-	 {"heal8", "回復8"},
-	 {"quake1", "地震1"},
-	 {"quake2", "地震2"},
-	 {"bump1", "壁1"},
-	 {"bump2", "壁2"},
-	 {"earth01", "大地1"},
-	 {"earth02", "大地2"},
-	 {"earth03", "大地3"},
-	 {"earth04", "大地4"},
-	 {"earth05", "大地5"},
-	 {"earth06", "大地6"},
-	 {"earth07", "大地7"},
-	 {"earth08", "大地8"},
-	 {"earth09", "大地9"},
-	 {"battle1", "戦闘1"},
-	 {"battle2", "戦闘2"},
-	 {"punch1", "打撃1"},
-	 {"punch2", "打撃2"},
-	 {"punch3", "打撃3"},
-	 {"punch4", "打撃4"},
-	 {"punch5", "打撃5"},
-	 {"punch6", "打撃6"},
-	 {"punch7", "打撃7"},
-	 {"strike01", "斬る1"},
-	 {"strike10", "斬る10"},
-	 {"strike11", "斬る11"},
-	 {"strike02", "斬る2"},
-	 {"strike03", "斬る3"},
-	 {"strike04", "斬る4"},
-	 {"strike05", "斬る5"},
-	 {"strike06", "斬る6"},
-	 {"strike07", "斬る7"},
-	 {"strike08", "斬る8"},
-	 {"strike09", "斬る9"},
-	 {"night", "暗闇"},
-	 {"dark1", "暗黒1"},
-	 {"dark2", "暗黒2"},
-	 {"dark3", "暗黒3"},
-	 {"dark4", "暗黒4"},
-	 {"dark5", "暗黒5"},
-	 {"dark6", "暗黒6"},
-	 {"choice1", "決定1"},
-	 {"choice2", "決定2"},
-	 {"vanish1", "消滅1"},
-	 {"vanish2", "消滅2"},
-	 {"confuse", "混乱"},
-	 {"explode1", "爆発1"},
-	 {"explode2", "爆発2"},
-	 {"explode3", "爆発3"},
-	 {"explode4", "爆発4"},
-	 {"explode5", "爆発5"},
-	 {"explode6", "爆発6"},
-	 {"explode7", "爆発7"},
-	 {"footstep", "移動"},
-	 {"revive1", "蘇生1"},
-	 {"revive2", "蘇生2"},
-	 {"revive3", "蘇生3"},
-	 {"flee", "逃走"},
-	 {"gong", "鐘"},
-	 {"bolt01", "雷1"},
-	 {"bolt02", "雷2"},
-	 {"bolt03", "雷3"},
-	 {"bolt04", "雷4"},
-	 {"bolt05", "雷5"},
-	 {"bolt06", "雷6"},
-	 {"bolt07", "雷7"},
-	 {"bolt08", "雷8"},
-	 {"bolt09", "雷9"},
-	 {"bolt10", "雷10"},
-	 {"wind01", "風1"},
-	 {"wind02", "風2"},
-	 {"wind03", "風3"},
-	 {"wind04", "風4"},
-	 {"wind05", "風5"},
-	 {"wind06", "風6"},
-	 {"wind07", "風7"},
-	 {"wind08", "風8"},
-	 {"wind09", "風9"},
-
-	 // Unknown English translation names used by Spanish games
-	 {"around1", "あたり1"},
-	 {"around2", "あたり2"},
-	 {"upgrade", "アップ"},
-	 {"glass", "ガシャン"},
-	 {"laser1", "ショット1"},
-	 {"laser2", "ショット2"},
-	 {"laser3", "ショット3"},
-	 {"downgrade", "ダウン"},
-	 {"damege1", "ダメージ1"},
-	 {"damege2", "ダメージ2"},
-	 {"glare", "にらみ"},
-	 {"end1", "はずれ1"},
-	 {"end2", "はずれ2"},
-	 {"flashlight1", "フラッシュ1"},
-	 {"flashlight2", "フラッシュ2"},
-	 {"flashlight3", "フラッシュ3"},
-	 {"ice1", "冷気1"},
-	 {"ice2", "冷気2"},
-	 {"ice3", "冷気3"},
-	 {"ice4", "冷気4"},
-	 {"ice5", "冷気5"},
-	 {"ice6", "冷気6"},
-	 {"ice7", "冷気7"},
-	 {"ice8", "冷気8"},
-	 {"ice9", "冷気9"},
-	 {"ice10", "冷気10"},
-	 {"ice11", "冷気11"},
-	 {"absorption1", "吸収1"},
-	 {"absorption2", "吸収2"},
-	 {"bite", "噛む"},
-	 {"recovery1", "回復1"},
-	 {"recovery2", "回復2"},
-	 {"recovery3", "回復3"},
-	 {"recovery4", "回復4"},
-	 {"recovery5", "回復5"},
-	 {"recovery6", "回復6"},
-	 {"recovery7", "回復7"},
-	 {"recovery8", "回復8"},
-	 {"evasion1", "回避1"},
-	 {"evasion2", "回避2"},
-	 {"earthquake1", "地震1"},
-	 {"earthquake2", "地震2"},
-	 {"wall1", "壁1"},
-	 {"wall2", "壁2"},
-	 {"earth1", "大地1"},
-	 {"earth2", "大地2"},
-	 {"earth3", "大地3"},
-	 {"earth4", "大地4"},
-	 {"earth5", "大地5"},
-	 {"earth6", "大地6"},
-	 {"earth7", "大地7"},
-	 {"earth8", "大地8"},
-	 {"earth9", "大地9"},
-	 {"vortex", "巻き付き"},
-	 {"blow1", "打撃1"},
-	 {"blow2", "打撃2"},
-	 {"blow3", "打撃3"},
-	 {"blow4", "打撃4"},
-	 {"blow5", "打撃5"},
-	 {"blow6", "打撃6"},
-	 {"blow7", "打撃7"},
-	 {"cut1", "斬る1"},
-	 {"cut10", "斬る10"},
-	 {"cut11", "斬る11"},
-	 {"cut2", "斬る2"},
-	 {"cut3", "斬る3"},
-	 {"cut4", "斬る4"},
-	 {"cut5", "斬る5"},
-	 {"cut6", "斬る6"},
-	 {"cut7", "斬る7"},
-	 {"cut8", "斬る8"},
-	 {"cut9", "斬る9"},
-	 {"darkness", "暗闇"},
-	 {"darkness1", "暗黒1"},
-	 {"darkness2", "暗黒2"},
-	 {"darkness3", "暗黒3"},
-	 {"darkness4", "暗黒4"},
-	 {"darkness5", "暗黒5"},
-	 {"darkness6", "暗黒6"},
-	 {"decision1", "決定1"},
-	 {"decision2", "決定2"},
-	 {"disappearance1", "消滅1"},
-	 {"disappearance2", "消滅2"},
-	 {"caos", "混乱"},
-	 {"flame1", "炎1"},
-	 {"flame2", "炎2"},
-	 {"flame3", "炎3"},
-	 {"flame4", "炎4"},
-	 {"flame5", "炎5"},
-	 {"flame6", "炎6"},
-	 {"flame7", "炎7"},
-	 {"flame8", "炎8"},
-	 {"explosion1", "爆発1"},
-	 {"explosion2", "爆発2"},
-	 {"explosion3", "爆発3"},
-	 {"explosion4", "爆発4"},
-	 {"explosion5", "爆発5"},
-	 {"explosion6", "爆発6"},
-	 {"explosion7", "爆発7"},
-	 {"sandmind", "砂けむり"},
-	 {"run", "移動"},
-	 {"revival1", "蘇生1"},
-	 {"revival2", "蘇生2"},
-	 {"revival3", "蘇生3"},
-	 {"escape", "逃走"},
-	 {"bell", "鐘"},
-	 {"thunder1", "雷1"},
-	 {"thunder2", "雷2"},
-	 {"thunder3", "雷3"},
-	 {"thunder4", "雷4"},
-	 {"thunder5", "雷5"},
-	 {"thunder6", "雷6"},
-	 {"thunder7", "雷7"},
-	 {"thunder8", "雷8"},
-	 {"thunder9", "雷9"},
-	 {"thunder10", "雷10"},
-	 {"sound wave1", "音波1"},
-	 {"sound wave2", "音波2"},
-	 {"wind1", "風1"},
-	 {"wind2", "風2"},
-	 {"wind3", "風3"},
-	 {"wind4", "風4"},
-	 {"wind5", "風5"},
-	 {"wind6", "風6"},
-	 {"wind7", "風7"},
-	 {"wind8", "風8"},
-	 {"wind9", "風9"},
-
-	 // 2000 RTP names not overwritten by Vlad Kovnerov's installation
-	 {"success1", "あたり1"},
-	 {"success2", "あたり2"},
-	 {"up", "アップ"},
-	 {"glass", "ガシャン"},
-	 {"cansel1", "キャンセル1"},
-	 {"cansel2", "キャンセル2"},
-	 {"numbness1", "しびれ1"},
-	 {"numbness2", "しびれ2"},
-	 {"numbness3", "しびれ3"},
-	 {"down", "ダウン"},
-	 {"power", "にらみ"},
-	 {"breast", "ブレス"},
-	 {"cold1", "冷気1"},
-	 {"cold2", "冷気2"},
-	 {"cold3", "冷気3"},
-	 {"cold4", "冷気4"},
-	 {"cold5", "冷気5"},
-	 {"cold6", "冷気6"},
-	 {"cold7", "冷気7"},
-	 {"cold8", "冷気8"},
-	 {"cold9", "冷気9"},
-	 {"cold10", "冷気10"},
-	 {"cold11", "冷気11"},
-	 {"refer book", "巻き付き"},
-	 {"fight1", "戦闘1"},
-	 {"fight2", "戦闘2"},
-	 {"kill1", "斬る1"},
-	 {"kill2", "斬る2"},
-	 {"kill3", "斬る3"},
-	 {"kill4", "斬る4"},
-	 {"kill5", "斬る5"},
-	 {"kill6", "暗黒6"},
-	 {"kill7", "斬る7"},
-	 {"kill8", "斬る8"},
-	 {"kill9", "斬る9"},
-	 {"kill10", "斬る10"},
-	 {"kill11", "斬る11"},
-	 {"annihilation1", "消滅1"},
-	 {"annihilation2", "消滅2"},
-	 {"chaos", "混乱"},
-	 {"sand storm", "砂けむり"},
-	 {"movement", "移動"},
-	 {"rebirth1", "蘇生1"},
-	 {"rebirth2", "蘇生2"},
-	 {"rebirth3", "蘇生3"},
-	 {"sonic1", "音波1"},
-	 {"sonic2", "音波2"},
+// Headers
+#include <cstdint>
+#include "rtp_table.h"
 
-	 // Korean RTP
-	 {"냉기10", "冷気10"},
-	 {"대지10", "大地10"},
-	 {"벤다10", "斬る10"},
-	 {"전격10", "雷10"},
-	 {"바람10", "風10"},
-	 {"냉기11", "冷気11"},
-	 {"벤다11", "斬る11"},
-	 {"바람11", "風11"},
-	 {"텔레포트1", "テレポート1"},
-	 {"즈음하고1", "あたり1"},
-	 {"잘라내기1", "はずれ1"},
-	 {"플래시1", "フラッシュ1"},
-	 {"몬스터1", "モンスター1"},
-	 {"데미지1", "ダメージ1"},
-	 {"스위치1", "スイッチ1"},
-	 {"아이템1", "アイテム1"},
-	 {"취소1", "キャンセル1"},
-	 {"커서1", "カーソル1"},
-	 {"점프1", "ジャンプ1"},
-	 {"쇼트1", "ショット1"},
-	 {"버저1", "ブザー1"},
-	 {"마비1", "しびれ1"},
-	 {"냉기1", "冷気1"},
-	 {"검1", "剣1"},
-	 {"흡수1", "吸収1"},
-	 {"회복1", "回復1"},
-	 {"회피1", "回避1"},
-	 {"지진1", "地震1"},
-	 {"벽1", "壁1"},
-	 {"대지1", "大地1"},
-	 {"활1", "弓1"},
-	 {"전투1", "戦闘1"},
-	 {"타격1", "打撃1"},
-	 {"공격1", "攻撃1"},
-	 {"벤다1", "斬る1"},
-	 {"암흑1", "暗黒1"},
-	 {"물1", "水1"},
-	 {"결정1", "決定1"},
-	 {"바다1", "海1"},
-	 {"소멸1", "消滅1"},
-	 {"화염1", "炎1"},
-	 {"폭발1", "爆発1"},
-	 {"신성1", "神聖1"},
-	 {"떨어진다1", "落ちる1"},
-	 {"소생1", "蘇生1"},
-	 {"닫는다1", "閉める1"},
-	 {"열다1", "開ける1"},
-	 {"비1", "雨1"},
-	 {"전격1", "雷1"},
-	 {"안개1", "霧1"},
-	 {"음파1", "音波1"},
-	 {"바람1", "風1"},
-	 {"마법1", "魔法1"},
-	 {"텔레포트2", "テレポート2"},
-	 {"잘라내기2", "はずれ2"},
-	 {"즈음하고2", "あたり2"},
-	 {"플래시2", "フラッシュ2"},
-	 {"몬스터2", "モンスター2"},
-	 {"데미지2", "ダメージ2"},
-	 {"아이템2", "アイテム2"},
-	 {"스위치2", "スイッチ2"},
-	 {"취소2", "キャンセル2"},
-	 {"쇼트2", "ショット2"},
-	 {"점프2", "ジャンプ2"},
-	 {"커서2", "カーソル2"},
-	 {"마비2", "しびれ2"},
-	 {"버저2", "ブザー2"},
-	 {"냉기2", "冷気2"},
-	 {"검2", "剣2"},
-	 {"흡수2", "吸収2"},
-	 {"회복2", "回復2"},
-	 {"회피2", "回避2"},
-	 {"지진2", "地震2"},
-	 {"벽2", "壁2"},
-	 {"대지2", "大地2"},
-	 {"활2", "弓2"},
-	 {"전투2", "戦闘2"},
-	 {"타격2", "打撃2"},
-	 {"공격2", "攻撃2"},
-	 {"벤다2", "斬る2"},
-	 {"암흑2", "暗黒2"},
-	 {"물2", "水2"},
-	 {"결정2", "決定2"},
-	 {"바다2", "海2"},
-	 {"소멸2", "消滅2"},
-	 {"화염2", "炎2"},
-	 {"폭발2", "爆発2"},
-	 {"신성2", "神聖2"},
-	 {"떨어진다2", "落ちる2"},
-	 {"소생2", "蘇生2"},
-	 {"닫는다2", "閉める2"},
-	 {"열다2", "開ける2"},
-	 {"비2", "雨2"},
-	 {"전격2", "雷2"},
-	 {"안개2", "霧2"},
-	 {"음파2", "音波2"},
-	 {"바람2", "風2"},
-	 {"마법2", "魔法2"},
-	 {"플래시3", "フラッシュ3"},
-	 {"쇼트3", "ショット3"},
-	 {"마비3", "しびれ3"},
-	 {"냉기3", "冷気3"},
-	 {"검3", "剣3"},
-	 {"회복3", "回復3"},
-	 {"대지3", "大地3"},
-	 {"타격3", "打撃3"},
-	 {"벤다3", "斬る3"},
-	 {"암흑3", "暗黒3"},
-	 {"물3", "水3"},
-	 {"화염3", "炎3"},
-	 {"폭발3", "爆発3"},
-	 {"신성3", "神聖3"},
-	 {"소생3", "蘇生3"},
-	 {"전격3", "雷3"},
-	 {"바람3", "風3"},
-	 {"냉기4", "冷気4"},
-	 {"회복4", "回復4"},
-	 {"대지4", "大地4"},
-	 {"타격4", "打撃4"},
-	 {"벤다4", "斬る4"},
-	 {"암흑4", "暗黒4"},
-	 {"물4", "水4"},
-	 {"화염4", "炎4"},
-	 {"폭발4", "爆発4"},
-	 {"신성4", "神聖4"},
-	 {"전격4", "雷4"},
-	 {"바람4", "風4"},
-	 {"냉기5", "冷気5"},
-	 {"회복5", "回復5"},
-	 {"대지5", "大地5"},
-	 {"타격5", "打撃5"},
-	 {"벤다5", "斬る5"},
-	 {"암흑5", "暗黒5"},
-	 {"물5", "水5"},
-	 {"화염5", "炎5"},
-	 {"폭발5", "爆発5"},
-	 {"신성5", "神聖5"},
-	 {"전격5", "雷5"},
-	 {"바람5", "風5"},
-	 {"냉기6", "冷気6"},
-	 {"회복6", "回復6"},
-	 {"대지6", "大地6"},
-	 {"타격6", "打撃6"},
-	 {"벤다6", "斬る6"},
-	 {"암흑6", "暗黒6"},
-	 {"물6", "水6"},
-	 {"화염6", "炎6"},
-	 {"폭발6", "爆発6"},
-	 {"신성6", "神聖6"},
-	 {"전격6", "雷6"},
-	 {"바람6", "風6"},
-	 {"냉기7", "冷気7"},
-	 {"회복7", "回復7"},
-	 {"대지7", "大地7"},
-	 {"타격7", "打撃7"},
-	 {"벤다7", "斬る7"},
-	 {"화염7", "炎7"},
-	 {"폭발7", "爆発7"},
-	 {"신성7", "神聖7"},
-	 {"전격7", "雷7"},
-	 {"바람7", "風7"},
-	 {"냉기8", "冷気8"},
-	 {"회복8", "回復8"},
-	 {"대지8", "大地8"},
-	 {"벤다8", "斬る8"},
-	 {"화염8", "炎8"},
-	 {"신성8", "神聖8"},
-	 {"전격8", "雷8"},
-	 {"바람8", "風8"},
-	 {"냉기9", "冷気9"},
-	 {"대지9", "大地9"},
-	 {"벤다9", "斬る9"},
-	 {"신성9", "神聖9"},
-	 {"전격9", "雷9"},
-	 {"바람9", "風9"},
-	 {"소", "ウシ"},
-	 {"양", "ひつじ"},
-	 {"업", "アップ"},
-	 {"닭", "にわとり"},
-	 {"발판", "ウマ"},
-	 {"트럭", "トラ"},
-	 {"노크", "ノック"},
-	 {"다운", "ダウン"},
-	 {"호흡", "ブレス"},
-	 {"사자", "ライオン"},
-	 {"가샨", "ガシャン"},
-	 {"우렁찬 외침", "おたけび"},
-	 {"고양이", "ネコ"},
-	 {"강아지", "イヌ"},
-	 {"배리어", "バリア"},
-	 {"노려봄", "にらみ"},
-	 {"물다", "噛む"},
-	 {"달라붙기", "巻き付き"},
-	 {"시계", "時計"},
-	 {"안보임", "暗闇"},
-	 {"노래", "歌"},
-	 {"독", "毒"},
-	 {"침묵", "沈黙"},
-	 {"혼란", "混乱"},
-	 {"수면", "睡眠"},
-	 {"모래 연기", "砂けむり"},
-	 {"이동", "移動"},
-	 {"꽃가루", "花粉"},
-	 {"도주", "逃走"},
-	 {"자물쇠", "鍵"},
-	 {"종", "鐘"}
+namespace {
+	struct Entry {
+		const char* folder;
+		const char* name;
+		const char* translation;
 	};
 
-	RTP_TABLE_2003["system"] = {
-	 // Official English translation names
-	 {"system", "システム"},
-	 {"systema", "システムa"},
-	 {"systemb", "システムb"},
-	 {"systemc", "システムc"},
-
-	 // RPG Advocate English translation names
-	 {"system1", "システム"},
-	 {"system2", "システムa"},
-	 {"system3", "システムb"},
-	 {"system4", "システムc"},
-
-	 // Orphaned Don Miguel's 2000 RTP extras pointing to nearest match
-	 {"royal", "システム"},
-
-	 // Korean RTP
-	 {"시스템", "システム"},
-	 {"시스템a", "システムa"},
-	 {"시스템b", "システムb"},
-	 {"시스템c", "システムc"}
+	struct Table {
+		const Entry* entries;
+		const int32_t* seeds;
+		uint32_t size;
 	};
 
-	RTP_TABLE_2003["system2"] = {
-	 // Official English translation names
-	 {"system2a", "システム２a"},
-	 {"system2b", "システム２b"},
-	 {"system2c", "システム２c"},
+	/** FNV-1a of "folder/name", must match gen_rtp_table.py */
+	uint32_t Hash(uint32_t seed, const std::string& folder, const std::string& name) {
+		uint32_t hash = 2166136261u ^ seed;
+		auto add = [&hash](unsigned char c) {
+			if (c >= 'A' && c <= 'Z') {
+				c += 'a' - 'A';
+			}
+			hash = (hash ^ c) * 16777619u;
+		};
 
-	 // Unknown English translation names used by Spanish games
-	 {"systeméqa", "システム２a"},
-	 {"systeméqb", "システム２b"},
-	 {"systeméqc", "システム２c"},
+		for (unsigned char c : folder) {
+			add(c);
+		}
+		add('/');
+		for (unsigned char c : name) {
+			add(c);
+		}
+		return hash;
+	}
 
-	 // Korean RTP
-	 {"시스템２a", "システム２a"},
-	 {"시스템２b", "システム２b"},
-	 {"시스템２c", "システム２c"}
-	};
+	bool EqualsIgnoreCase(const char* a, const std::string& b) {
+		auto lower = [](unsigned char c) {
+			return (c >= 'A' && c <= 'Z') ? c + 'a' - 'A' : c;
+		};
 
-	RTP_TABLE_2003["title"] = {
-	 // Official English translation names
-	 {"title1", "タイトル1"},
-	 {"title2", "タイトル2"},
-	 {"title3", "タイトル3"},
-	 {"title4", "タイトル4"},
+		size_t i = 0;
+		for (; a[i] != '\0'; ++i) {
+			if (i == b.size() || lower(a[i]) != lower(b[i])) {
+				return false;
+			}
+		}
+		return i == b.size();
+	}
 
-	 // Korean RTP
-	 {"타이틀1", "タイトル1"},
-	 {"타이틀2", "タイトル2"},
-	 {"타이틀3", "タイトル3"},
-	 {"타이틀4", "タイトル4"}
-	};
+	const char* Lookup(const Table& table, const std::string& folder, const std::string& name) {
+		int32_t seed = table.seeds[Hash(0, folder, name) % table.size];
+		uint32_t slot = seed < 0 ? -(seed + 1) : Hash(seed, folder, name) % table.size;
 
-	RTP_TABLE_2000["backdrop"] = {
-	 // Official English translation names
-	 {"dungeon1", "ダンジョン1"},
-	 {"dungeon2", "ダンジョン2"},
-	 {"dungeon3", "ダンジョン3"},
-	 {"dungeon4", "ダンジョン4"},
-	 {"dungeon5", "ダンジョン5"},
-	 {"space", "宇宙"},
-	 {"mountainpath", "山道"},
-	 {"rockyarea", "岩場"},
-	 {"ruins", "廃墟"},
-	 {"forest1", "森1"},
-	 {"forest2", "森2"},
-	 {"bridge", "橋"},
-	 {"poisonswamp", "毒沼"},
-	 {"sea", "海"},
-	 {"throne", "玉座"},
-	 {"strangespace", "異空間"},
-	 {"sandybeach", "砂浜"},
-	 {"desert", "砂漠"},
-	 {"shrine", "神殿"},
-	 {"sky", "空"},
-	 {"shipdeck", "船上"},
-	 {"grassland", "草原"},
-	 {"wasteland", "荒地"},
-	 {"downtown", "街中"},
-	 {"snowfield", "雪原"},
+		const Entry& entry = table.entries[slot];
+		if (EqualsIgnoreCase(entry.folder, folder) && EqualsIgnoreCase(entry.name, name)) {
+			return entry.translation;
+		}
+		return nullptr;
+	}
 
-	 // Don Miguel's English translation names
-	 {"cave1", "ダンジョン1"},
-	 {"lavacave2", "ダンジョン2"},
-	 {"icecave3", "ダンジョン3"},
-	 {"cave4", "ダンジョン4"},
-	 {"brickcave5", "ダンジョン5"},
-	 {"galaxy", "宇宙"},
-	 {"canyon", "山道"},
-	 {"snowcanyon", "岩場"},
-	 {"wasteruins", "廃墟"},
-	 {"swamp", "毒沼"},
-	 {"castle", "玉座"},
-	 {"lightspeed", "異空間"},
-	 {"seabeach", "砂浜"},
-	 {"greece", "神殿"},
-	 {"ship", "船上"},
-	 {"grass", "草原"},
-	 {"town", "街中"},
-	 {"snow", "雪原"}
+	const Entry entries_2000_japanese[669] = {
+		{ "backdrop", "sandybeach", "砂浜" },
+		{ "title", "title1", "タイトル1" },
+		{ "monster", "bee", "ホーネット" },
+		{ "battle", "axe", "斧" },
+		{ "sound", "flame5", "炎5" },
+		{ "battle", "ressurection", "蘇生" },
+		{ "chipset", "dungeon", "ダンジョン" },
+		{ "monster", "witch2", "魔術師2" },
+		{ "monster", "magician1", "魔術師1" },
+		{ "music", "sad", "悲しみ" },
+		{ "monster", "dragonknight", "ドラゴンナイト" },
+		{ "panorama", "night sky1", "夜空1" },
+		{ "music", "dungeon2", "ダンジョン2" },
+		{ "sound", "chime2", "あたり2" },
+		{ "music", "hero2", "勇者2" },
+		{ "music", "tower2", "塔2" },
+		{ "sound", "blow1", "打撃1" },
+		{ "sound", "debuff", "ダウン" },
+		{ "battle", "breath", "ブレス" },
+		{ "monster", "soldier", "兵士" },
+		{ "sound", "success2", "あたり2" },
+		{ "monster", "goblin", "ゴブリン" },
+		{ "sound", "annihilation2", "消滅2" },
+		{ "backdrop", "dungeon5", "ダンジョン5" },
+		{ "sound", "thunder8", "雷8" },
+		{ "backdrop", "downtown", "街中" },
+		{ "panorama", "sky2", "空2" },
+		{ "sound", "collapse1", "消滅1" },
+		{ "chipset", "chipset1", "ダンジョン" },
+		{ "charset", "future3", "一般5" },
+		{ "music", "suspicion", "j疑惑" },
+		{ "music", "fanfare3", "jファンファーレ3" },
+		{ "sound", "blow2", "打撃2" },
+		{ "sound", "decision2", "決定2" },
+		{ "monster", "angel", "天使" },
+		{ "music", "gag2", "jギャグ2" },
+		{ "music", "items", "jアイテム" },
+		{ "panorama", "cosmos1", "宇宙" },
+		{ "charset", "actor1", "主人公1" },
+		{ "music", "ending2", "エンディング2" },
+		{ "backdrop", "sea", "海" },
+		{ "monster", "familiar", "使い魔" },
+		{ "chipset", "ship", "船" },
+		{ "music", "peace3", "安らぎ3" },
+		{ "music", "inn1", "j宿1" },
+		{ "battle", "arrow", "矢" },
+		{ "monster", "magician2", "魔術師2" },
+		{ "chipset", "interior", "内装" },
+		{ "sound", "fall2", "落ちる2" },
+		{ "music", "riddle", "j謎" },
+		{ "music", "battleend1", "j戦闘終了1" },
+		{ "sound", "earth3", "大地3" },
+		{ "charset", "people7", "一般2" },
+		{ "monster", "black knight", "ブラックナイト" },
+		{ "music", "trial", "試練" },
+		{ "battle", "water", "水" },
+		{ "monster", "demon lord", "魔王" },
+		{ "sound", "cold6", "冷気6" },
+		{ "music", "defeat", "敗北" },
+		{ "sound", "ice5", "冷気5" },
+		{ "music", "sea", "se海" },
+		{ "music", "fairy2", "妖精2" },
+		{ "sound", "wind1", "風1" },
+		{ "charset", "actor2", "主人公2" },
+		{ "backdrop", "snow", "雪原" },
+		{ "music", "ending1", "エンディング1" },
+		{ "monster", "orc", "オーク" },
+		{ "backdrop", "ship", "船上" },
+		{ "music", "battleend4", "j戦闘終了4" },
+		{ "sound", "kill3", "斬る3" },
+		{ "music", "mystery", "j謎" },
+		{ "sound", "explosion3", "爆発3" },
+		{ "monster", "wyvern", "ワイバーン" },
+		{ "sound", "shot3", "ショット3" },
+		{ "sound", "slash9", "斬る9" },
+		{ "charset", "people1", "一般1" },
+		{ "sound", "cold4", "冷気4" },
+		{ "music", "battleend2", "j戦闘終了2" },
+		{ "music", "fanfare5", "jファンファーレ5" },
+		{ "monster", "troll", "ゴブリン" },
+		{ "sound", "lion", "ライオン" },
+		{ "backdrop", "cave4", "ダンジョン4" },
+		{ "sound", "sea2", "海2" },
+		{ "panorama", "dimension rift", "異空間" },
+		{ "sound", "ice6", "冷気6" },
+		{ "sound", "thunder7", "雷7" },
+		{ "backdrop", "forest1", "森1" },
+		{ "monster", "redscorpion", "大サソリ" },
+		{ "sound", "holy3", "神聖3" },
+		{ "sound", "cansel2", "キャンセル2" },
+		{ "chipset", "world", "基本" },
+		{ "sound", "dark1", "暗黒1" },
+		{ "sound", "pollen", "花粉" },
+		{ "backdrop", "mountainpath", "山道" },
+		{ "sound", "poison", "毒" },
+		{ "sound", "up", "アップ" },
+		{ "panorama", "dawn1", "夜明け1" },
+		{ "panorama", "evening1", "夜明け1" },
+		{ "battle", "up", "上昇" },
+		{ "sound", "cold1", "冷気1" },
+		{ "music", "gosttown1", "ゴーストタウン1" },
+		{ "sound", "cold8", "冷気8" },
+		{ "chipset", "basis", "基本" },
+		{ "sound", "blow4", "打撃4" },
+		{ "sound", "earth6", "大地6" },
+		{ "faceset", "chara2", "主人公2" },
+		{ "backdrop", "bridge", "橋" },
+		{ "music", "village2", "村2" },
+		{ "charset", "vehicles", "乗り物" },
+		{ "battle", "whip", "鞭" },
+		{ "sound", "cursor2", "カーソル2" },
+		{ "sound", "earth4", "大地4" },
+		{ "backdrop", "snowfield", "雪原" },
+		{ "sound", "attack2", "攻撃2" },
+		{ "sound", "fall1", "落ちる1" },
+		{ "panorama", "dawn2", "夜明け2" },
+		{ "sound", "escape", "逃走" },
+		{ "charset", "chara1", "主人公1" },
+		{ "monster", "ninja", "忍者" },
+		{ "sound", "move", "移動" },
+		{ "music", "fanfare1", "jファンファーレ1" },
+		{ "music", "town3", "町3" },
+		{ "music", "devil", "魔王" },
+		{ "sound", "evade2", "回避2" },
+		{ "sound", "jump1", "ジャンプ1" },
+		{ "panorama", "night1", "夜空1" },
+		{ "backdrop", "sky", "空" },
+		{ "sound", "fog2", "霧2" },
+		{ "sound", "teleport1", "テレポート1" },
+		{ "sound", "flame3", "炎3" },
+		{ "sound", "shot1", "ショット1" },
+		{ "sound", "fire2", "炎2" },
+		{ "music", "church", "教会" },
+		{ "sound", "holy1", "神聖1" },
+		{ "monster", "dark elf", "ダークエルフ" },
+		{ "backdrop", "strangespace", "異空間" },
+		{ "sound", "slash2", "斬る2" },
+		{ "sound", "sandstorm", "砂けむり" },
+		{ "monster", "harpy", "ハーピー" },
+		{ "sound", "down", "ダウン" },
+		{ "sound", "paralyze2", "しびれ2" },
+		{ "sound", "fire4", "炎4" },
+		{ "sound", "item1", "アイテム1" },
+		{ "sound", "failure1", "はずれ1" },
+		{ "sound", "recovery1", "回復1" },
+		{ "sound", "ensnare", "巻き付き" },
+		{ "music", "boss1", "ボス1" },
+		{ "sound", "bell", "鐘" },
+		{ "sound", "wind4", "風4" },
+		{ "battle", "fire2", "炎2" },
+		{ "sound", "evade1", "回避1" },
+		{ "music", "opening1", "オープニング1" },
+		{ "battle", "sword1", "剣1" },
+		{ "sound", "cold7", "冷気7" },
+		{ "panorama", "evening2", "夜明け2" },
+		{ "charset", "crown7", "動物" },
+		{ "battle", "hit", "打撃" },
+		{ "sound", "earthquake2", "地震2" },
+		{ "monster", "gargoyle", "ガーゴイル" },
+		{ "battle", "wind", "風" },
+		{ "sound", "holy2", "神聖2" },
+		{ "sound", "buzzer3", "ブザー1" },
+		{ "sound", "close2", "閉める2" },
+		{ "backdrop", "dungeon2", "ダンジョン2" },
+		{ "sound", "cancel2", "キャンセル2" },
+		{ "monster", "queen", "女王" },
+		{ "monster", "chimera", "キマイラ" },
+		{ "monster", "dragonb", "龍" },
+		{ "sound", "fire1", "炎1" },
+		{ "music", "shop1", "店1" },
+		{ "sound", "failure2", "はずれ2" },
+		{ "sound", "flame6", "炎6" },
+		{ "monster", "reaper", "死神" },
+		{ "faceset", "monsters", "モンスター" },
+		{ "monster", "lizardman", "リザードマン" },
+		{ "monster", "spider", "大グモ" },
+		{ "monster", "warrior", "武者" },
+		{ "monster", "monster fish", "怪魚" },
+		{ "sound", "cursor1", "カーソル1" },
+		{ "monster", "minotaur", "ミノタウロス" },
+		{ "music", "victory", "勝利" },
+		{ "battle", "other", "その他" },
+		{ "sound", "kill8", "斬る8" },
+		{ "sound", "numbness1", "しびれ1" },
+		{ "sound", "earthquake1", "地震1" },
+		{ "monster", "darkspirit", "リッチ" },
+		{ "sound", "slash7", "斬る7" },
+		{ "music", "dungeon5", "ダンジョン5" },
+		{ "sound", "blind", "暗闇" },
+		{ "sound", "magic2", "魔法2" },
+		{ "music", "village3", "村3" },
+		{ "monster", "people5", "一般人5" },
+		{ "sound", "clock", "時計" },
+		{ "charset", "crown4", "動物" },
+		{ "monster", "boy1", "一般人1" },
+		{ "music", "seearthquake", "se地震" },
+		{ "music", "energy", "活気" },
+		{ "sound", "flame2", "炎2" },
+		{ "music", "marketplace", "明るい市場" },
+		{ "battle", "cold", "冷気" },
+		{ "sound", "wave2", "音波2" },
+		{ "charset", "object2", "オブジェクト2" },
+		{ "monster", "griffon", "グリフォン" },
+		{ "sound", "sword2", "剣2" },
+		{ "charset", "animal", "動物" },
+		{ "battle", "buff", "上昇" },
+		{ "backdrop", "dungeon1", "ダンジョン1" },
+		{ "sound", "tiger", "トラ" },
+		{ "sound", "refer book", "巻き付き" },
+		{ "music", "gameover3", "ゲームオーバー3" },
+		{ "monster", "death", "死神" },
+		{ "monster", "treant", "トレント" },
+		{ "sound", "wall1", "魔法1" },
+		{ "sound", "fire7", "炎7" },
+		{ "monster", "giant scorpion", "大サソリ" },
+		{ "sound", "explosion1", "爆発1" },
+		{ "backdrop", "lightspeed", "異空間" },
+		{ "sound", "horse", "ウマ" },
+		{ "sound", "teleport2", "テレポート2" },
+		{ "sound", "silence", "沈黙" },
+		{ "backdrop", "castle", "玉座" },
+		{ "charset", "crown1", "主人公4" },
+		{ "sound", "knock", "ノック" },
+		{ "panorama", "sunset1", "夕焼け1" },
+		{ "monster", "king", "王" },
+		{ "music", "battle2", "戦闘2" },
+		{ "sound", "absorption1", "吸収1" },
+		{ "music", "tower3", "塔3" },
+		{ "backdrop", "dungeon3", "ダンジョン3" },
+		{ "monster", "wolf", "ワーウルフ" },
+		{ "sound", "sword1", "剣1" },
+		{ "music", "fiesta", "明るい市場" },
+		{ "music", "vehicle3", "乗り物3" },
+		{ "sound", "barrier", "バリア" },
+		{ "charset", "future1", "一般1" },
+		{ "monster", "hornet", "ホーネット" },
+		{ "sound", "wind9", "風9" },
+		{ "monster", "griphon", "グリフォン" },
+		{ "sound", "recovery7", "回復7" },
+		{ "sound", "slash1", "斬る1" },
+		{ "backdrop", "brickcave5", "ダンジョン5" },
+		{ "panorama", "sunset2", "夕焼け2" },
+		{ "music", "battleend3", "j戦闘終了3" },
+		{ "panorama", "night sky2", "夜空2" },
+		{ "chipset", "chipset2", "内装" },
+		{ "sound", "cold3", "冷気3" },
+		{ "music", "hero1", "勇者1" },
+		{ "sound", "kill6", "暗黒6" },
+		{ "sound", "attack1", "攻撃1" },
+		{ "panorama", "weird", "異空間" },
+		{ "sound", "earth8", "大地8" },
+		{ "monster", "skeleton", "スケルトン" },
+		{ "sound", "slash8", "斬る8" },
+		{ "monster", "people4", "一般人4" },
+		{ "sound", "annihilation1", "消滅1" },
+		{ "music", "mystery2", "神秘2" },
+		{ "sound", "wind8", "風8" },
+		{ "sound", "ice11", "冷気11" },
+		{ "sound", "slash10", "斬る10" },
+		{ "sound", "flame1", "炎1" },
+		{ "sound", "absorption2", "吸収2" },
+		{ "music", "blackmarket", "闇市" },
+		{ "battle", "paralysis", "麻痺" },
+		{ "backdrop", "town", "街中" },
+		{ "sound", "raise3", "蘇生3" },
+		{ "sound", "ice9", "冷気9" },
+		{ "sound", "buzzer1", "はずれ1" },
+		{ "music", "earthquake", "se地震" },
+		{ "sound", "flame8", "炎8" },
+		{ "sound", "dark4", "暗黒4" },
+		{ "sound", "combat2", "戦闘2" },
+		{ "sound", "flame7", "炎7" },
+		{ "music", "sesea", "se海" },
+		{ "battle", "absorption", "吸収" },
+		{ "music", "castle3", "城3" },
+		{ "sound", "water1", "水1" },
+		{ "sound", "decision1", "決定1" },
+		{ "music", "boss3", "ボス3" },
+		{ "music", "doubt", "j疑惑" },
+		{ "monster", "darkelf", "ダークエルフ" },
+		{ "monster", "giant spider", "大グモ" },
+		{ "monster", "firescull", "鬼火" },
+		{ "music", "mystery1", "神秘1" },
+		{ "sound", "wind3", "風3" },
+		{ "sound", "recovery5", "回復5" },
+		{ "backdrop", "canyon", "山道" },
+		{ "sound", "kill11", "斬る11" },
+		{ "charset", "vehicle", "乗り物" },
+		{ "sound", "holy9", "神聖9" },
+		{ "music", "ending3", "エンディング3" },
+		{ "charset", "monster2", "モンスター2" },
+		{ "battle", "sphere", "治療" },
+		{ "charset", "people3", "一般3" },
+		{ "sound", "earth10", "大地10" },
+		{ "sound", "cold11", "冷気11" },
+		{ "sound", "kill1", "斬る1" },
+		{ "sound", "wind10", "風10" },
+		{ "backdrop", "space", "宇宙" },
+		{ "faceset", "monster", "モンスター" },
+		{ "sound", "ice4", "冷気4" },
+		{ "music", "field1", "フィールド1" },
+		{ "music", "field2", "フィールド2" },
+		{ "sound", "water2", "水2" },
+		{ "sound", "darkness", "暗闇" },
+		{ "sound", "earth2", "大地2" },
+		{ "monster", "dragon knight", "ドラゴンナイト" },
+		{ "sound", "glassshatter", "ガシャン" },
+		{ "sound", "recovery8", "回復8" },
+		{ "sound", "blow6", "打撃6" },
+		{ "sound", "key", "鍵" },
+		{ "sound", "flash2", "フラッシュ2" },
+		{ "monster", "knight", "トルーパー" },
+		{ "sound", "thunder5", "雷5" },
+		{ "battle", "spear", "槍" },
+		{ "sound", "darkness4", "暗黒4" },
+		{ "monster", "witch1", "魔術師1" },
+		{ "music", "town1", "町1" },
+		{ "sound", "cold5", "冷気5" },
+		{ "backdrop", "greece", "神殿" },
+		{ "music", "crisis", "ピンチ" },
+		{ "monster", "cerberus", "ケルベロス" },
+		{ "charset", "monster1", "モンスター1" },
+		{ "sound", "recovery4", "回復4" },
+		{ "sound", "dark2", "暗黒2" },
+		{ "music", "sorrow", "悲しみ" },
+		{ "monster", "warrior2", "戦士2" },
+		{ "sound", "water6", "水6" },
+		{ "backdrop", "shrine", "神殿" },
+		{ "monster", "hero1", "戦士1" },
+		{ "sound", "open2", "開ける2" },
+		{ "sound", "damage1", "ダメージ1" },
+		{ "sound", "earth7", "大地7" },
+		{ "sound", "cansel1", "キャンセル1" },
+		{ "sound", "wind5", "風5" },
+		{ "sound", "power", "にらみ" },
+		{ "sound", "explosion5", "爆発5" },
+		{ "battle", "thunder", "雷" },
+		{ "sound", "ice2", "冷気2" },
+		{ "sound", "holy7", "神聖7" },
+		{ "sound", "thunder6", "雷6" },
+		{ "music", "opening3", "オープニング3" },
+		{ "monster", "boy3", "一般人3" },
+		{ "sound", "numbness3", "しびれ3" },
+		{ "title", "title4", "タイトル4" },
+		{ "sound", "kill7", "斬る7" },
+		{ "faceset", "actor2", "主人公2" },
+		{ "sound", "fire6", "炎6" },
+		{ "sound", "dark5", "暗黒5" },
+		{ "sound", "jump2", "ジャンプ2" },
+		{ "sound", "thunder3", "雷3" },
+		{ "sound", "water5", "水5" },
+		{ "music", "ride2", "乗り物2" },
+		{ "monster", "golem", "ゴーレム" },
+		{ "music", "ghosttown1", "ゴーストタウン1" },
+		{ "sound", "cancel1", "キャンセル1" },
+		{ "music", "search", "探索" },
+		{ "sound", "fight1", "戦闘1" },
+		{ "sound", "kill9", "斬る6" },
+		{ "music", "farewell1", "別れ1" },
+		{ "sound", "fog1", "霧1" },
+		{ "sound", "slash4", "斬る4" },
+		{ "monster", "slime", "スライム" },
+		{ "faceset", "people1", "一般1" },
+		{ "sound", "fire3", "炎3" },
+		{ "music", "shop3", "店3" },
+		{ "sound", "bite", "噛む" },
+		{ "monster", "satan", "魔神" },
+		{ "music", "rain2", "se大雨" },
+		{ "sound", "darkness2", "暗黒2" },
+		{ "monster", "people2", "一般人2" },
+		{ "backdrop", "shipdeck", "船上" },
+		{ "monster", "mimic", "ミミック" },
+		{ "faceset", "actor1", "主人公1" },
+		{ "music", "store3", "店3" },
+		{ "music", "boss2", "ボス2" },
+		{ "monster", "princess", "女王" },
+		{ "sound", "recovery2", "回復2" },
+		{ "music", "animal", "動物" },
+		{ "battle", "earth", "大地" },
+		{ "monster", "medusa", "メデューサ" },
+		{ "monster", "lich", "リッチ" },
+		{ "monster", "hog", "オーク" },
+		{ "monster", "wolfman", "コボルト" },
+		{ "charset", "women1", "一般5" },
+		{ "sound", "explosion4", "爆発4" },
+		{ "sound", "fight2", "戦闘2" },
+		{ "music", "get", "勝利" },
+		{ "sound", "close1", "閉める1" },
+		{ "sound", "chaos", "混乱" },
+		{ "battle", "poison", "ブレス" },
+		{ "monster", "hero2", "戦士2" },
+		{ "monster", "rooster", "コカトリス" },
+		{ "monster", "imp", "使い魔" },
+		{ "title", "title2", "タイトル2" },
+		{ "sound", "sonic2", "音波2" },
+		{ "music", "item", "jアイテム" },
+		{ "monster", "people7", "一般人7" },
+		{ "monster", "warrior1", "戦士1" },
+		{ "sound", "cold10", "冷気10" },
+		{ "monster", "dragona", "ドラゴン" },
+		{ "sound", "numbness2", "しびれ2" },
+		{ "backdrop", "wasteland", "荒地" },
+		{ "monster", "ogrechest", "ミミック" },
+		{ "monster", "octopus", "クラーケン" },
+		{ "charset", "actor4", "主人公4" },
+		{ "sound", "blow5", "打撃5" },
+		{ "backdrop", "forest2", "森2" },
+		{ "sound", "evasion2", "回避2" },
+		{ "system", "system", "システム" },
+		{ "monster", "greendragon1", "ドラゴン" },
+		{ "sound", "cat", "ネコ" },
+		{ "music", "treasure", "秘宝" },
+		{ "music", "ship3", "船3" },
+		{ "sound", "flash3", "フラッシュ3" },
+		{ "sound", "chime1", "あたり1" },
+		{ "music", "town2", "町2" },
+		{ "charset", "chubby2", "一般2" },
+		{ "monster", "girl2", "一般人2" },
+		{ "music", "boss4", "ボス4" },
+		{ "monster", "lizardmen", "リザードマン" },
+		{ "music", "vehicle2", "乗り物2" },
+		{ "music", "gameover1", "ゲームオーバー1" },
+		{ "music", "rain1", "se雨" },
+		{ "monster", "thief", "盗賊" },
+		{ "charset", "crown6", "モンスター1" },
+		{ "sound", "chicken", "にわとり" },
+		{ "music", "seclock", "se時計" },
+		{ "music", "anger", "怒り" },
+		{ "monster", "hellhound", "ケルベロス" },
+		{ "sound", "wall2", "魔法2" },
+		{ "battle", "explosion", "爆発" },
+		{ "sound", "flame4", "炎4" },
+		{ "monster", "people8", "一般人8" },
+		{ "sound", "bow2", "弓2" },
+		{ "panorama", "planet2", "惑星2" },
+		{ "music", "gag1", "jギャグ1" },
+		{ "battle", "debuff", "下降" },
+		{ "charset", "actor3", "主人公3" },
+		{ "music", "inn2", "j宿2" },
+		{ "monster", "wisp", "鬼火" },
+		{ "sound", "confusion", "混乱" },
+		{ "backdrop", "dungeon4", "ダンジョン4" },
+		{ "sound", "slash3", "斬る3" },
+		{ "chipset", "exterior", "外観" },
+		{ "monster", "ghost", "ゴースト" },
+		{ "music", "dungeon3", "ダンジョン3" },
+		{ "battle", "fang", "爪" },
+		{ "sound", "raise1", "蘇生1" },
+		{ "music", "serain", "se雨" },
+		{ "battle", "ray", "蘇生" },
+		{ "sound", "shot2", "ショット2" },
+		{ "monster", "demon", "デーモン" },
+		{ "sound", "kill4", "斬る4" },
+		{ "music", "dungeon4", "ダンジョン4" },
+		{ "monster", "snake", "大蛇" },
+		{ "sound", "blow3", "打撃3" },
+		{ "sound", "wind2", "風2" },
+		{ "sound", "sea1", "海1" },
+		{ "music", "fanfare6", "jファンファーレ6" },
+		{ "music", "gosttown2", "ゴーストタウン2" },
+		{ "music", "castle1", "城1" },
+		{ "gameover", "game over", "ゲームオーバー" },
+		{ "music", "thief", "泥棒" },
+		{ "panorama", "galaxy", "宇宙" },
+		{ "sound", "rain2", "雨2" },
+		{ "sound", "monster1", "モンスター1" },
+		{ "sound", "barrier2", "壁2" },
+		{ "backdrop", "icecave3", "ダンジョン3" },
+		{ "monster", "samurai", "武者" },
+		{ "panorama", "planet3", "惑星3" },
+		{ "sound", "buff", "アップ" },
+		{ "monster", "girl4", "一般人4" },
+		{ "charset", "people5", "一般5" },
+		{ "monster", "greendragon2", "龍" },
+		{ "sound", "song", "歌" },
+		{ "monster", "kraken", "クラーケン" },
+		{ "music", "castle2", "城2" },
+		{ "battle", "claw", "爪" },
+		{ "system", "royal", "システム" },
+		{ "backdrop", "snowcanyon", "岩場" },
+		{ "monster", "oak", "トレント" },
+		{ "backdrop", "wasteruins", "廃墟" },
+		{ "sound", "cold2", "冷気2" },
+		{ "sound", "sand storm", "砂けむり" },
+		{ "music", "fanfare2", "jファンファーレ2" },
+		{ "sound", "movement", "移動" },
+		{ "music", "lose", "敗北" },
+		{ "sound", "kill10", "斬る10" },
+		{ "monster", "vampire", "ヴァンパイア" },
+		{ "sound", "sheep", "ひつじ" },
+		{ "sound", "evasion1", "回避1" },
+		{ "sound", "cow", "ウシ" },
+		{ "sound", "monster2", "モンスター2" },
+		{ "charset", "people2", "一般2" },
+		{ "sound", "wind11", "風11" },
+		{ "sound", "water4", "水4" },
+		{ "sound", "raise2", "蘇生2" },
+		{ "sound", "earth9", "大地9" },
+		{ "monster", "cockatorice", "コカトリス" },
+		{ "monster", "werewolf", "ワーウルフ" },
+		{ "charset", "crown2", "モンスター2" },
+		{ "monster", "aquamen", "マーマン" },
+		{ "sound", "thunder4", "雷4" },
+		{ "battle", "sun", "回復" },
+		{ "battle", "ice", "冷気" },
+		{ "sound", "blow7", "打撃7" },
+		{ "sound", "kill2", "斬る2" },
+		{ "charset", "people4", "一般4" },
+		{ "sound", "earth1", "大地1" },
+		{ "battle", "bite", "吸収" },
+		{ "chipset", "inner", "内装" },
+		{ "backdrop", "rockyarea", "岩場" },
+		{ "monster", "darkknight", "ブラックナイト" },
+		{ "sound", "damage2", "ダメージ2" },
+		{ "backdrop", "grassland", "草原" },
+		{ "monster", "fish", "怪魚" },
+		{ "sound", "holy8", "神聖8" },
+		{ "music", "fanfare4", "jファンファーレ4" },
+		{ "sound", "paralyze1", "しびれ1" },
+		{ "music", "ship1", "船1" },
+		{ "charset", "crown3", "モンスター1" },
+		{ "music", "serain2", "se大雨" },
+		{ "music", "opening2", "オープニング2" },
+		{ "battle", "zip", "雷" },
+		{ "sound", "wind7", "風7" },
+		{ "sound", "ice1", "冷気1" },
+		{ "sound", "switch1", "スイッチ1" },
+		{ "monster", "people1", "一般人1" },
+		{ "sound", "breath", "ブレス" },
+		{ "sound", "absorb1", "吸収1" },
+		{ "monster", "granny", "一般人8" },
+		{ "monster", "merman", "マーマン" },
+		{ "monster", "darkrider", "トルーパー" },
+		{ "music", "village1", "村1" },
+		{ "sound", "thunder9", "雷9" },
+		{ "sound", "combat1", "戦闘1" },
+		{ "monster", "pirate", "海賊" },
+		{ "battle", "recovery", "回復" },
+		{ "sound", "darkness6", "暗黒6" },
+		{ "charset", "future2", "一般4" },
+		{ "monster", "people3", "一般人3" },
+		{ "sound", "rebirth2", "蘇生2" },
+		{ "faceset", "chara1", "主人公1" },
+		{ "sound", "holy5", "神聖5" },
+		{ "monster", "bluedragon", "ワイバーン" },
+		{ "sound", "ice7", "冷気7" },
+		{ "sound", "roar", "おたけび" },
+		{ "sound", "bow1", "弓1" },
+		{ "sound", "earth5", "大地5" },
+		{ "music", "gameover2", "ゲームオーバー2" },
+		{ "monster", "man5", "一般人5" },
+		{ "sound", "fire8", "炎8" },
+		{ "sound", "sleep", "睡眠" },
+		{ "sound", "thunder1", "雷1" },
+		{ "sound", "kill5", "斬る5" },
+		{ "battle", "blow", "打撃" },
+		{ "sound", "absorb2", "吸収2" },
+		{ "sound", "glass", "ガシャン" },
+		{ "sound", "glare", "にらみ" },
+		{ "monster", "hydra", "ヒュドラ" },
+		{ "monster", "bat", "こうもり" },
+		{ "sound", "open1", "開ける1" },
+		{ "backdrop", "grass", "草原" },
+		{ "music", "peace1", "安らぎ1" },
+		{ "panorama", "sky1", "空1" },
+		{ "sound", "slash6", "斬る6" },
+		{ "music", "clock", "se時計" },
+		{ "sound", "dark3", "暗黒3" },
+		{ "monster", "kobold", "コボルト" },
+		{ "sound", "ice8", "冷気8" },
+		{ "sound", "holy6", "神聖6" },
+		{ "backdrop", "desert", "砂漠" },
+		{ "sound", "success1", "あたり1" },
+		{ "sound", "explosion6", "爆発6" },
+		{ "music", "peace2", "安らぎ2" },
+		{ "backdrop", "lavacave2", "ダンジョン2" },
+		{ "monster", "mummy", "マミー" },
+		{ "monster", "zombie", "ゾンビ" },
+		{ "sound", "fire5", "炎5" },
+		{ "backdrop", "cave1", "ダンジョン1" },
+		{ "sound", "cold9", "冷気9" },
+		{ "music", "ship2", "船2" },
+		{ "sound", "slash11", "斬る11" },
+		{ "sound", "recovery6", "回復6" },
+		{ "sound", "breast", "ブレス" },
+		{ "music", "ghosttown2", "ゴーストタウン2" },
+		{ "battle", "fire1", "炎1" },
+		{ "music", "store2", "店2" },
+		{ "music", "field4", "フィールド4" },
+		{ "battle", "sword2", "剣2" },
+		{ "charset", "chara2", "主人公2" },
+		{ "sound", "water3", "水3" },
+		{ "sound", "slash5", "斬る5" },
+		{ "sound", "buzzer2", "はずれ2" },
+		{ "faceset", "people2", "一般2" },
+		{ "sound", "darkness5", "暗黒5" },
+		{ "chipset", "chipset3", "船" },
+		{ "music", "battle3", "戦闘3" },
+		{ "battle", "down", "下降" },
+		{ "sound", "paralyze3", "しびれ3" },
+		{ "sound", "darkness3", "暗黒3" },
+		{ "monster", "gnome", "海賊" },
+		{ "music", "ride1", "乗り物1" },
+		{ "panorama", "planet1", "惑星1" },
+		{ "music", "field3", "フィールド3" },
+		{ "monster", "cloakdemon", "魔王" },
+		{ "battle", "dark", "暗黒" },
+		{ "gameover", "gameover", "ゲームオーバー" },
+		{ "sound", "recovery3", "回復3" },
+		{ "battle", "etc", "その他" },
+		{ "sound", "explosion7", "爆発7" },
+		{ "sound", "thunder2", "雷2" },
+		{ "sound", "wind6", "風6" },
+		{ "sound", "ice10", "冷気10" },
+		{ "music", "store1", "店1" },
+		{ "sound", "rebirth1", "蘇生1" },
+		{ "sound", "rain1", "雨1" },
+		{ "charset", "chara3", "主人公3" },
+		{ "panorama", "morning2", "空2" },
+		{ "monster", "demon god", "魔神" },
+		{ "backdrop", "ruins", "廃墟" },
+		{ "music", "ride3", "乗り物3" },
+		{ "sound", "item2", "アイテム2" },
+		{ "panorama", "night2", "夜空2" },
+		{ "sound", "buzzer4", "ブザー2" },
+		{ "charset", "object1", "オブジェクト1" },
+		{ "sound", "magic1", "魔法1" },
+		{ "music", "battle1", "戦闘1" },
+		{ "monster", "people6", "一般人6" },
+		{ "sound", "ice3", "冷気3" },
+		{ "sound", "switch2", "スイッチ2" },
+		{ "backdrop", "swamp", "毒沼" },
+		{ "monster", "oldman7", "一般人7" },
+		{ "battle", "holy", "神聖" },
+		{ "music", "shop2", "店2" },
+		{ "chipset", "outline", "外観" },
+		{ "monster", "flyingdemon", "デーモン" },
+		{ "music", "mystery3", "神秘3" },
+		{ "charset", "crown5", "一般5" },
+		{ "backdrop", "throne", "玉座" },
+		{ "charset", "men1", "一般4" },
+		{ "sound", "thunder10", "雷10" },
+		{ "monster", "girl6", "一般人6" },
+		{ "sound", "barrier1", "壁1" },
+		{ "music", "farewell2", "別れ2" },
+		{ "sound", "holy4", "神聖4" },
+		{ "backdrop", "seabeach", "砂浜" },
+		{ "sound", "wave1", "音波1" },
+		{ "charset", "chubby1", "一般3" },
+		{ "panorama", "morning1", "空1" },
+		{ "sound", "sword3", "剣3" },
+		{ "sound", "flash1", "フラッシュ1" },
+		{ "sound", "rebirth3", "蘇生3" },
+		{ "sound", "darkness1", "暗黒1" },
+		{ "backdrop", "poisonswamp", "毒沼" },
+		{ "music", "dark", "闇市" },
+		{ "charset", "chara4", "主人公4" },
+		{ "sound", "dog", "イヌ" },
+		{ "title", "title3", "タイトル3" },
+		{ "sound", "sonic1", "音波1" },
+		{ "sound", "collapse2", "消滅2" },
+		{ "sound", "explosion2", "爆発2" },
+		{ "music", "fairy1", "妖精1" },
+		{ "battle", "treatment", "治療" },
+		{ "music", "dungeon1", "ダンジョン1" },
+		{ "music", "tower1", "塔1" },
+		{ "music", "vehicle1", "乗り物1" },
+		{ "battle", "barrier", "バリア" },
+		{ "backdrop", "galaxy", "宇宙" },
 	};
 
-	RTP_TABLE_2000["battle"] = {
-	 // Official English translation names
-	 {"other", "その他"},
-	 {"barrier", "バリア"},
-	 {"breath", "ブレス"},
-	 {"buff", "上昇"},
-	 {"debuff", "下降"},
-	 {"ice", "冷気"},
-	 {"sword1", "剣1"},
-	 {"sword2", "剣2"},
-	 {"bite", "吸収"},
-	 {"recovery", "回復"},
-	 {"earth", "大地"},
-	 {"blow", "打撃"},
-	 {"axe", "斧"},
-	 {"dark", "暗黒"},
-	 {"spear", "槍"},
-	 {"water", "水"},
-	 {"treatment", "治療"},
-	 {"fire1", "炎1"},
-	 {"fire2", "炎2"},
-	 {"explosion", "爆発"},
-	 {"claw", "爪"},
-	 {"arrow", "矢"},
-	 {"holy", "神聖"},
-	 {"ressurection", "蘇生"},
-	 {"thunder", "雷"},
-	 {"whip", "鞭"},
-	 {"wind", "風"},
-	 {"paralysis", "麻痺"},
-
-	 // Don Miguel's English translation names
-	 {"etc", "その他"},
-	 {"poison", "ブレス"},
-	 {"up", "上昇"},
-	 {"down", "下降"},
-	 {"cold", "冷気"},
-	 {"absorption", "吸収"},
-	 {"sun", "回復"},
-	 {"hit", "打撃"},
-	 {"sphere", "治療"},
-	 {"fang", "爪"},
-	 {"ray", "蘇生"},
-	 {"zip", "雷"}
+	const int32_t seeds_2000_japanese[669] = {
+		0, -667, -666, 1, 1, 0, -661, 1, 0, 1, 0, 0, 0, 0, 1, 1,
+		2, 1, 1, 1, 0, 1, -660, 0, 0, 2, -659, 1, -657, 2, 1, 0,
+		-653, 0, -652, 2, 1, -648, 3, -646, 0, -645, -639, -638, 1, 0, 0, 3,
+		1, 0, 0, -637, 1, 1, 0, 0, 0, -634, 0, -632, 0, 1, 2, 0,
+		1, 2, 1, -626, 1, 1, 0, -625, 0, 0, -623, 1, -621, -614, -612, -607,
+		0, 3, 0, -600, 2, 0, -596, 7, 0, -591, 0, -585, -584, 1, 1, 0,
+		-582, 0, -581, -572, 0, 2, 3, 0, -556, -554, -548, 0, 0, 0, 0, 0,
+		-545, -539, -536, 3, 1, -532, 0, 1, -528, -525, -514, 0, -513, 2, 0, 0,
+		2, -509, 0, 0, -503, 0, -502, 0, 2, 0, -496, 0, 0, 1, -495, 4,
+		-494, 0, 0, 1, 5, -493, 0, 2, 1, -492, -491, 1, -487, -486, 0, 2,
+		2, 0, 0, -484, -477, -475, 0, 0, -474, 0, 3, -473, 0, 0, -468, 0,
+		-466, 0, 0, 6, 4, 3, -465, 0, 0, -462, 0, 1, 0, 0, 5, -461,
+		-456, -454, 2, 0, -452, 5, 0, -451, -449, 0, 2, 0, 0, 0, 0, 0,
+		2, -448, 0, 0, -447, 4, 1, 1, 0, 7, 0, 1, -446, 1, -443, -440,
+		-432, 0, 1, -429, -428, 0, 8, 3, -427, -421, 0, 1, 0, -416, 4, -414,
+		-412, 7, 0, 0, 0, -409, -406, 2, 1, 1, 0, -401, 0, 1, -395, 0,
+		0, 5, -394, 0, 3, -392, 1, -390, 2, 1, 0, -389, 1, 3, -388, 1,
+		2, 0, 8, 1, 2, 0, -386, 0, 10, 0, 0, 0, -385, 0, -383, 0,
+		0, -382, -380, 1, 0, 0, -376, -372, 0, 1, 4, 2, 0, -368, 0, 0,
+		1, -357, -356, 1, 0, 1, -350, -349, -344, -341, 0, 0, 2, 0, 1, -338,
+		-337, 3, 0, -335, 1, 2, -334, -333, 1, 0, 1, 0, 4, 0, -332, 0,
+		-329, 1, 2, -328, 0, 0, 0, -327, 4, -325, 3, 0, 10, 0, -322, 1,
+		-321, 0, 1, 0, -319, -318, -314, -312, 9, 5, 0, 3, 1, 1, 0, 1,
+		-306, 0, 0, 1, 0, -300, -297, 0, -293, -291, -290, -289, -284, 0, 0, 2,
+		-281, -279, 0, 0, 0, 0, 0, 17, 1, 0, -277, 0, -275, -274, 2, 0,
+		-266, 0, -260, 0, 0, 0, 3, 0, 0, -252, -249, -246, -245, -243, 0, 5,
+		0, 0, 8, 0, 0, 0, 0, -242, 0, 8, -241, -240, 0, 1, 0, 7,
+		0, 0, -237, 0, 0, -236, 13, 0, 5, 1, 0, 0, -234, 0, 5, -227,
+		0, 2, -224, 2, -222, 5, 4, 0, 0, 0, 5, 0, -218, 0, -216, -215,
+		0, 1, 1, -214, -213, 8, -210, -209, 6, -207, -201, -199, 4, 0, -195, -194,
+		-191, -187, 0, -184, -183, -179, 0, 0, -176, 3, 1, 0, 0, 0, 0, 0,
+		5, -175, 0, -170, -164, 0, -163, 1, 0, 0, 3, 0, -162, 0, 0, 0,
+		-160, 0, 0, -159, 0, -155, -152, 2, -141, 15, -135, 1, 0, -119, -118, -117,
+		-116, 6, 1, 0, -107, 7, 0, -102, 0, 0, 2, 1, 0, -101, 0, 0,
+		-98, 0, 0, 1, 0, 0, 0, 10, 0, 7, 0, -97, -93, 0, 1, -90,
+		0, 0, 0, 0, 0, 1, 2, 0, -88, -86, 0, 0, 4, -83, 0, 24,
+		0, 0, 2, -81, -79, -76, -67, -66, -64, -63, 0, 8, -59, -58, 0, 1,
+		2, -52, 0, -50, -49, -48, 6, -45, 0, 0, 0, -44, 0, 0, 0, 12,
+		2, 0, -40, -39, -37, 0, -36, 0, 1, 0, 0, 2, 0, 0, 2, 6,
+		0, 0, -34, 0, 0, -33, 0, 0, 4, 0, -32, 7, 0, 0, 5, 3,
+		0, 0, 0, 0, -29, 2, 0, 2, -28, -26, -22, 0, -21, 0, 0, -20,
+		-17, -13, 4, -10, 1, -5, 0, 0, 0, -1, 0, 2, 4,
 	};
 
-	RTP_TABLE_2000["charset"] = {
-	 // Official English translation names
-	 {"object1", "オブジェクト1"},
-	 {"object2", "オブジェクト2"},
-	 {"monster1", "モンスター1"},
-	 {"monster2", "モンスター2"},
-	 {"people1", "一般1"},
-	 {"people2", "一般2"},
-	 {"people3", "一般3"},
-	 {"people4", "一般4"},
-	 {"people5", "一般5"},
-	 {"actor1", "主人公1"},
-	 {"actor2", "主人公2"},
-	 {"actor3", "主人公3"},
-	 {"actor4", "主人公4"},
-	 {"vehicles", "乗り物"},
-	 {"animal", "動物"},
-
-	 // Don Miguel's English translation names
-	 {"people7", "一般2"},
-	 {"chara1", "主人公1"},
-	 {"chara2", "主人公2"},
-	 {"chara3", "主人公3"},
-	 {"chara4", "主人公4"},
-	 {"vehicle", "乗り物"},
+	const Table table_2000_japanese = { entries_2000_japanese, seeds_2000_japanese, 669 };
 
-	 // Orphaned Don Miguel's 2000 RTP extras pointing to nearest match
-	 {"chubby1", "一般3"},
-	 {"chubby2", "一般2"},
-	 {"crown1", "主人公4"},
-	 {"crown2", "モンスター2"},
-	 {"crown3", "モンスター1"},
-	 {"crown4", "動物"},
-	 {"crown5", "一般5"},
-	 {"crown6", "モンスター1"},
-	 {"crown7", "動物"},
-	 {"future1", "一般1"},
-	 {"future2", "一般4"},
-	 {"future3", "一般5"},
-	 {"men1", "一般4"},
-	 {"women1", "一般5"}
+	const Entry entries_2000_english[465] = {
+		{ "sound", "暗闇", "blind" },
+		{ "monster", "盗賊", "thief" },
+		{ "sound", "蘇生3", "raise3" },
+		{ "monster", "ヒュドラ", "hydra" },
+		{ "sound", "風9", "wind9" },
+		{ "backdrop", "橋", "bridge" },
+		{ "panorama", "惑星1", "planet1" },
+		{ "battle", "爪", "claw" },
+		{ "sound", "風7", "wind7" },
+		{ "sound", "大地3", "earth3" },
+		{ "sound", "鐘", "bell" },
+		{ "sound", "神聖7", "holy7" },
+		{ "music", "明るい市場", "fiesta" },
+		{ "sound", "雷8", "thunder8" },
+		{ "sound", "モンスター1", "monster1" },
+		{ "sound", "ジャンプ2", "jump2" },
+		{ "music", "店1", "shop1" },
+		{ "sound", "炎5", "fire5" },
+		{ "sound", "風8", "wind8" },
+		{ "sound", "水5", "water5" },
+		{ "sound", "爆発1", "explosion1" },
+		{ "backdrop", "森2", "forest2" },
+		{ "backdrop", "草原", "grass" },
+		{ "sound", "攻撃2", "attack2" },
+		{ "sound", "大地9", "earth9" },
+		{ "sound", "打撃2", "blow2" },
+		{ "sound", "テレポート2", "teleport2" },
+		{ "sound", "回復6", "recovery6" },
+		{ "battle", "バリア", "barrier" },
+		{ "battle", "上昇", "buff" },
+		{ "sound", "ガシャン", "glass" },
+		{ "music", "塔1", "tower1" },
+		{ "music", "悲しみ", "sad" },
+		{ "music", "乗り物3", "ride3" },
+		{ "sound", "斬る6", "kill9" },
+		{ "monster", "メデューサ", "medusa" },
+		{ "monster", "魔術師2", "magician2" },
+		{ "sound", "打撃4", "blow4" },
+		{ "sound", "閉める1", "close1" },
+		{ "battle", "炎2", "fire2" },
+		{ "title", "タイトル4", "title4" },
+		{ "sound", "冷気9", "cold9" },
+		{ "music", "闇市", "blackmarket" },
+		{ "sound", "フラッシュ2", "flash2" },
+		{ "faceset", "一般2", "people2" },
+		{ "music", "jアイテム", "item" },
+		{ "music", "jファンファーレ1", "fanfare1" },
+		{ "music", "神秘2", "mystery2" },
+		{ "sound", "雷9", "thunder9" },
+		{ "monster", "トレント", "oak" },
+		{ "music", "j戦闘終了3", "battleend3" },
+		{ "music", "戦闘2", "battle2" },
+		{ "music", "ゴーストタウン1", "ghosttown1" },
+		{ "sound", "キャンセル1", "cancel1" },
+		{ "monster", "オーク", "hog" },
+		{ "sound", "海1", "sea1" },
+		{ "battle", "冷気", "cold" },
+		{ "sound", "爆発6", "explosion6" },
+		{ "sound", "蘇生2", "raise2" },
+		{ "sound", "風5", "wind5" },
+		{ "music", "se大雨", "rain2" },
+		{ "sound", "睡眠", "sleep" },
+		{ "sound", "地震2", "earthquake2" },
+		{ "charset", "動物", "animal" },
+		{ "monster", "龍", "dragonb" },
+		{ "sound", "移動", "move" },
+		{ "monster", "ミミック", "mimic" },
+		{ "charset", "一般5", "crown5" },
+		{ "sound", "地震1", "earthquake1" },
+		{ "battle", "暗黒", "dark" },
+		{ "sound", "ブザー2", "buzzer4" },
+		{ "sound", "打撃3", "blow3" },
+		{ "monster", "武者", "samurai" },
+		{ "panorama", "夕焼け2", "sunset2" },
+		{ "sound", "決定2", "decision2" },
+		{ "music", "ダンジョン5", "dungeon5" },
+		{ "monster", "大蛇", "snake" },
+		{ "sound", "にらみ", "glare" },
+		{ "music", "乗り物2", "ride2" },
+		{ "monster", "ホーネット", "bee" },
+		{ "sound", "斬る1", "kill1" },
+		{ "battle", "その他", "etc" },
+		{ "sound", "神聖4", "holy4" },
+		{ "music", "フィールド4", "field4" },
+		{ "music", "船3", "ship3" },
+		{ "monster", "ミノタウロス", "minotaur" },
+		{ "sound", "吸収1", "absorb1" },
+		{ "music", "戦闘3", "battle3" },
+		{ "sound", "にわとり", "chicken" },
+		{ "sound", "風4", "wind4" },
+		{ "monster", "使い魔", "familiar" },
+		{ "charset", "主人公2", "actor2" },
+		{ "sound", "ブレス", "breast" },
+		{ "music", "j宿2", "inn2" },
+		{ "sound", "蘇生1", "raise1" },
+		{ "monster", "一般人5", "man5" },
+		{ "backdrop", "神殿", "greece" },
+		{ "charset", "モンスター1", "crown3" },
+		{ "sound", "噛む", "bite" },
+		{ "backdrop", "砂漠", "desert" },
+		{ "sound", "雷7", "thunder7" },
+		{ "music", "試練", "trial" },
+		{ "backdrop", "宇宙", "galaxy" },
+		{ "sound", "冷気10", "cold10" },
+		{ "monster", "ケルベロス", "cerberus" },
+		{ "charset", "乗り物", "vehicle" },
+		{ "sound", "回復4", "recovery4" },
+		{ "sound", "雷4", "thunder4" },
+		{ "music", "j謎", "mystery" },
+		{ "chipset", "内装", "chipset2" },
+		{ "monster", "一般人1", "boy1" },
+		{ "sound", "冷気11", "cold11" },
+		{ "sound", "神聖6", "holy6" },
+		{ "music", "jファンファーレ6", "fanfare6" },
+		{ "sound", "爆発7", "explosion7" },
+		{ "sound", "冷気3", "cold3" },
+		{ "sound", "雷2", "thunder2" },
+		{ "music", "jファンファーレ5", "fanfare5" },
+		{ "backdrop", "ダンジョン1", "cave1" },
+		{ "battle", "大地", "earth" },
+		{ "charset", "主人公1", "actor1" },
+		{ "music", "ダンジョン4", "dungeon4" },
+		{ "monster", "魔神", "demon god" },
+		{ "sound", "雷10", "thunder10" },
+		{ "battle", "回復", "recovery" },
+		{ "sound", "キャンセル2", "cancel2" },
+		{ "sound", "音波1", "sonic1" },
+		{ "sound", "神聖8", "holy8" },
+		{ "panorama", "夕焼け1", "sunset1" },
+		{ "sound", "ノック", "knock" },
+		{ "sound", "ショット3", "shot3" },
+		{ "sound", "魔法2", "magic2" },
+		{ "battle", "打撃", "blow" },
+		{ "music", "怒り", "anger" },
+		{ "music", "勝利", "get" },
+		{ "music", "魔王", "devil" },
+		{ "sound", "大地1", "earth1" },
+		{ "monster", "ダークエルフ", "dark elf" },
+		{ "music", "妖精1", "fairy1" },
+		{ "monster", "兵士", "soldier" },
+		{ "charset", "主人公3", "actor3" },
+		{ "sound", "アイテム1", "item1" },
+		{ "sound", "壁1", "barrier1" },
+		{ "music", "町1", "town1" },
+		{ "monster", "こうもり", "bat" },
+		{ "charset", "一般2", "chubby2" },
+		{ "sound", "回避1", "evade1" },
+		{ "music", "エンディング1", "ending1" },
+		{ "music", "乗り物1", "ride1" },
+		{ "music", "船1", "ship1" },
+		{ "music", "jギャグ1", "gag1" },
+		{ "sound", "冷気1", "cold1" },
+		{ "sound", "雷5", "thunder5" },
+		{ "sound", "決定1", "decision1" },
+		{ "music", "ボス2", "boss2" },
+		{ "chipset", "ダンジョン", "chipset1" },
+		{ "sound", "神聖3", "holy3" },
+		{ "music", "勇者2", "hero2" },
+		{ "music", "ボス4", "boss4" },
+		{ "sound", "神聖9", "holy9" },
+		{ "backdrop", "毒沼", "poisonswamp" },
+		{ "monster", "一般人8", "granny" },
+		{ "sound", "ショット2", "shot2" },
+		{ "backdrop", "ダンジョン5", "brickcave5" },
+		{ "monster", "大サソリ", "giant scorpion" },
+		{ "sound", "回復3", "recovery3" },
+		{ "backdrop", "砂浜", "sandybeach" },
+		{ "sound", "爆発4", "explosion4" },
+		{ "sound", "大地2", "earth2" },
+		{ "sound", "壁2", "barrier2" },
+		{ "backdrop", "空", "sky" },
+		{ "sound", "ライオン", "lion" },
+		{ "music", "村2", "village2" },
+		{ "music", "神秘1", "mystery1" },
+		{ "music", "妖精2", "fairy2" },
+		{ "monster", "ハーピー", "harpy" },
+		{ "sound", "炎7", "fire7" },
+		{ "sound", "斬る9", "slash9" },
+		{ "music", "se地震", "earthquake" },
+		{ "sound", "斬る10", "kill10" },
+		{ "music", "塔2", "tower2" },
+		{ "sound", "爆発3", "explosion3" },
+		{ "sound", "はずれ2", "buzzer2" },
+		{ "panorama", "惑星2", "planet2" },
+		{ "panorama", "夜空1", "night sky1" },
+		{ "battle", "鞭", "whip" },
+		{ "title", "タイトル1", "title1" },
+		{ "battle", "剣2", "sword2" },
+		{ "faceset", "主人公2", "actor2" },
+		{ "monster", "ガーゴイル", "gargoyle" },
+		{ "music", "フィールド1", "field1" },
+		{ "sound", "暗黒3", "dark3" },
+		{ "sound", "水2", "water2" },
+		{ "sound", "逃走", "escape" },
+		{ "sound", "消滅2", "annihilation2" },
+		{ "sound", "霧1", "fog1" },
+		{ "music", "jギャグ2", "gag2" },
+		{ "sound", "神聖1", "holy1" },
+		{ "music", "jファンファーレ4", "fanfare4" },
+		{ "music", "ボス3", "boss3" },
+		{ "sound", "斬る3", "kill3" },
+		{ "sound", "落ちる2", "fall2" },
+		{ "monster", "マミー", "mummy" },
+		{ "sound", "暗黒5", "dark5" },
+		{ "monster", "クラーケン", "kraken" },
+		{ "monster", "トルーパー", "darkrider" },
+		{ "monster", "グリフォン", "griffon" },
+		{ "monster", "王", "king" },
+		{ "music", "オープニング3", "opening3" },
+		{ "sound", "爆発5", "explosion5" },
+		{ "monster", "ヴァンパイア", "vampire" },
+		{ "sound", "回復2", "recovery2" },
+		{ "sound", "炎3", "fire3" },
+		{ "music", "船2", "ship2" },
+		{ "sound", "ダウン", "debuff" },
+		{ "panorama", "夜空2", "night sky2" },
+		{ "monster", "一般人2", "girl2" },
+		{ "sound", "フラッシュ3", "flash3" },
+		{ "music", "秘宝", "treasure" },
+		{ "battle", "風", "wind" },
+		{ "backdrop", "異空間", "lightspeed" },
+		{ "sound", "ショット1", "shot1" },
+		{ "sound", "炎4", "fire4" },
+		{ "backdrop", "海", "sea" },
+		{ "sound", "モンスター2", "monster2" },
+		{ "backdrop", "ダンジョン4", "cave4" },
+		{ "sound", "消滅1", "annihilation1" },
+		{ "monster", "ドラゴンナイト", "dragon knight" },
+		{ "sound", "はずれ1", "buzzer1" },
+		{ "music", "城1", "castle1" },
+		{ "music", "ゲームオーバー3", "gameover3" },
+		{ "sound", "開ける1", "open1" },
+		{ "monster", "ドラゴン", "dragona" },
+		{ "panorama", "空2", "morning2" },
+		{ "monster", "一般人3", "boy3" },
+		{ "charset", "オブジェクト2", "object2" },
+		{ "music", "j疑惑", "doubt" },
+		{ "sound", "斬る2", "kill2" },
+		{ "sound", "カーソル2", "cursor2" },
+		{ "monster", "魔王", "cloakdemon" },
+		{ "music", "塔3", "tower3" },
+		{ "battle", "斧", "axe" },
+		{ "monster", "コボルト", "kobold" },
+		{ "music", "勇者1", "hero1" },
+		{ "monster", "コカトリス", "cockatorice" },
+		{ "monster", "戦士2", "hero2" },
+		{ "sound", "水1", "water1" },
+		{ "gameover", "ゲームオーバー", "game over" },
+		{ "panorama", "夜明け1", "dawn1" },
+		{ "panorama", "宇宙", "cosmos1" },
+		{ "monster", "怪魚", "fish" },
+		{ "sound", "バリア", "barrier" },
+		{ "sound", "神聖2", "holy2" },
+		{ "backdrop", "玉座", "castle" },
+		{ "sound", "雷1", "thunder1" },
+		{ "monster", "ブラックナイト", "black knight" },
+		{ "charset", "一般1", "future1" },
+		{ "sound", "回復1", "recovery1" },
+		{ "sound", "スイッチ2", "switch2" },
+		{ "music", "ダンジョン1", "dungeon1" },
+		{ "sound", "打撃5", "blow5" },
+		{ "music", "ボス1", "boss1" },
+		{ "music", "別れ2", "farewell2" },
+		{ "monster", "鬼火", "firescull" },
+		{ "sound", "暗黒6", "darkness6" },
+		{ "sound", "水3", "water3" },
+		{ "music", "j戦闘終了2", "battleend2" },
+		{ "sound", "弓1", "bow1" },
+		{ "sound", "暗黒2", "dark2" },
+		{ "monster", "スケルトン", "skeleton" },
+		{ "music", "安らぎ3", "peace3" },
+		{ "monster", "ゴーレム", "golem" },
+		{ "monster", "キマイラ", "chimera" },
+		{ "monster", "天使", "angel" },
+		{ "sound", "毒", "poison" },
+		{ "monster", "大グモ", "giant spider" },
+		{ "sound", "冷気6", "cold6" },
+		{ "sound", "しびれ2", "numbness2" },
+		{ "monster", "海賊", "gnome" },
+		{ "faceset", "モンスター", "monster" },
+		{ "backdrop", "荒地", "wasteland" },
+		{ "sound", "風3", "wind3" },
+		{ "charset", "一般3", "chubby1" },
+		{ "sound", "暗黒1", "dark1" },
+		{ "monster", "ゴブリン", "goblin" },
+		{ "battle", "槍", "spear" },
+		{ "battle", "蘇生", "ray" },
+		{ "sound", "風11", "wind11" },
+		{ "music", "戦闘1", "battle1" },
+		{ "battle", "水", "water" },
+		{ "chipset", "基本", "basis" },
+		{ "music", "j戦闘終了1", "battleend1" },
+		{ "music", "動物", "animal" },
+		{ "sound", "斬る4", "kill4" },
+		{ "battle", "下降", "debuff" },
+		{ "sound", "ネコ", "cat" },
+		{ "music", "se海", "sea" },
+		{ "sound", "戦闘1", "combat1" },
+		{ "sound", "神聖5", "holy5" },
+		{ "battle", "麻痺", "paralysis" },
+		{ "music", "se雨", "rain1" },
+		{ "sound", "鍵", "key" },
+		{ "system", "システム", "royal" },
+		{ "music", "安らぎ2", "peace2" },
+		{ "battle", "雷", "thunder" },
+		{ "sound", "霧2", "fog2" },
+		{ "sound", "打撃6", "blow6" },
+		{ "sound", "斬る5", "kill5" },
+		{ "music", "フィールド2", "field2" },
+		{ "sound", "雷3", "thunder3" },
+		{ "monster", "デーモン", "demon" },
+		{ "battle", "神聖", "holy" },
+		{ "sound", "トラ", "tiger" },
+		{ "charset", "オブジェクト1", "object1" },
+		{ "sound", "吸収2", "absorb2" },
+		{ "sound", "ジャンプ1", "jump1" },
+		{ "sound", "あたり1", "chime1" },
+		{ "sound", "炎6", "fire6" },
+		{ "sound", "爆発2", "explosion2" },
+		{ "panorama", "夜明け2", "dawn2" },
+		{ "sound", "大地10", "earth10" },
+		{ "sound", "大地4", "earth4" },
+		{ "music", "ゲームオーバー1", "gameover1" },
+		{ "sound", "音波2", "sonic2" },
+		{ "title", "タイトル2", "title2" },
+		{ "sound", "戦闘2", "combat2" },
+		{ "music", "城3", "castle3" },
+		{ "music", "フィールド3", "field3" },
+		{ "sound", "しびれ3", "numbness3" },
+		{ "backdrop", "街中", "downtown" },
+		{ "sound", "剣1", "sword1" },
+		{ "sound", "混乱", "chaos" },
+		{ "charset", "モンスター2", "crown2" },
+		{ "sound", "風10", "wind10" },
+		{ "backdrop", "ダンジョン2", "dungeon2" },
+		{ "sound", "剣3", "sword3" },
+		{ "music", "オープニング2", "opening2" },
+		{ "sound", "炎8", "fire8" },
+		{ "monster", "一般人6", "girl6" },
+		{ "monster", "忍者", "ninja" },
+		{ "panorama", "異空間", "dimension rift" },
+		{ "sound", "雨1", "rain1" },
+		{ "sound", "炎2", "fire2" },
+		{ "sound", "雨2", "rain2" },
+		{ "sound", "雷6", "thunder6" },
+		{ "sound", "フラッシュ1", "flash1" },
+		{ "faceset", "一般1", "people1" },
+		{ "sound", "ひつじ", "sheep" },
+		{ "backdrop", "森1", "forest1" },
+		{ "sound", "ウシ", "cow" },
+		{ "battle", "矢", "arrow" },
+		{ "music", "ゲームオーバー2", "gameover2" },
+		{ "sound", "打撃7", "blow7" },
+		{ "sound", "ウマ", "horse" },
+		{ "faceset", "主人公1", "actor1" },
+		{ "sound", "冷気4", "cold4" },
+		{ "music", "店2", "shop2" },
+		{ "sound", "斬る7", "kill7" },
+		{ "monster", "ゴースト", "ghost" },
+		{ "sound", "水6", "water6" },
+		{ "music", "jファンファーレ2", "fanfare2" },
+		{ "sound", "ブザー1", "buzzer3" },
+		{ "monster", "戦士1", "hero1" },
+		{ "sound", "カーソル1", "cursor1" },
+		{ "backdrop", "山道", "canyon" },
+		{ "backdrop", "船上", "ship" },
+		{ "sound", "砂けむり", "sand storm" },
+		{ "music", "教会", "church" },
+		{ "music", "別れ1", "farewell1" },
+		{ "sound", "大地5", "earth5" },
+		{ "sound", "風1", "wind1" },
+		{ "sound", "回避2", "evade2" },
+		{ "music", "j戦闘終了4", "battleend4" },
+		{ "sound", "弓2", "bow2" },
+		{ "backdrop", "岩場", "rockyarea" },
+		{ "sound", "アップ", "buff" },
+		{ "music", "エンディング2", "ending2" },
+		{ "sound", "あたり2", "chime2" },
+		{ "sound", "剣2", "sword2" },
+		{ "music", "ゴーストタウン2", "ghosttown2" },
+		{ "monster", "マーマン", "aquamen" },
+		{ "sound", "水4", "water4" },
+		{ "music", "城2", "castle2" },
+		{ "battle", "剣1", "sword1" },
+		{ "monster", "一般人7", "oldman7" },
+		{ "battle", "治療", "sphere" },
+		{ "sound", "アイテム2", "item2" },
+		{ "sound", "スイッチ1", "switch1" },
+		{ "sound", "炎1", "fire1" },
+		{ "music", "店3", "shop3" },
+		{ "monster", "ゾンビ", "zombie" },
+		{ "sound", "海2", "sea2" },
+		{ "backdrop", "ダンジョン3", "dungeon3" },
+		{ "monster", "女王", "princess" },
+		{ "sound", "冷気5", "cold5" },
+		{ "sound", "沈黙", "silence" },
+		{ "sound", "冷気7", "cold7" },
+		{ "music", "ダンジョン2", "dungeon2" },
+		{ "music", "泥棒", "thief" },
+		{ "battle", "爆発", "explosion" },
+		{ "sound", "回復8", "recovery8" },
+		{ "music", "se時計", "clock" },
+		{ "chipset", "外観", "exterior" },
+		{ "music", "jファンファーレ3", "fanfare3" },
+		{ "music", "町3", "town3" },
+		{ "monster", "スライム", "slime" },
+		{ "sound", "ダメージ1", "damage1" },
+		{ "sound", "花粉", "pollen" },
+		{ "music", "敗北", "defeat" },
+		{ "sound", "風6", "wind6" },
+		{ "music", "町2", "town2" },
+		{ "monster", "リザードマン", "lizardman" },
+		{ "backdrop", "廃墟", "ruins" },
+		{ "sound", "開ける2", "open2" },
+		{ "monster", "死神", "death" },
+		{ "sound", "しびれ1", "numbness1" },
+		{ "sound", "斬る8", "kill8" },
+		{ "monster", "魔術師1", "magician1" },
+		{ "sound", "風2", "wind2" },
+		{ "sound", "回復7", "recovery7" },
+		{ "charset", "一般4", "future2" },
+		{ "music", "安らぎ1", "peace1" },
+		{ "music", "ピンチ", "crisis" },
+		{ "monster", "一般人4", "girl4" },
+		{ "charset", "主人公4", "actor4" },
+		{ "sound", "打撃1", "blow1" },
+		{ "sound", "巻き付き", "ensnare" },
+		{ "music", "ダンジョン3", "dungeon3" },
+		{ "sound", "回復5", "recovery5" },
+		{ "music", "j宿1", "inn1" },
+		{ "sound", "攻撃1", "attack1" },
+		{ "panorama", "惑星3", "planet3" },
+		{ "sound", "大地8", "earth8" },
+		{ "sound", "テレポート1", "teleport1" },
+		{ "sound", "魔法1", "magic1" },
+		{ "monster", "ワーウルフ", "werewolf" },
+		{ "sound", "落ちる1", "fall1" },
+		{ "sound", "暗黒4", "dark4" },
+		{ "sound", "大地6", "earth6" },
+		{ "music", "村1", "village1" },
+		{ "music", "探索", "search" },
+		{ "sound", "時計", "clock" },
+		{ "music", "エンディング3", "ending3" },
+		{ "sound", "斬る11", "kill11" },
+		{ "battle", "ブレス", "breath" },
+		{ "sound", "ダメージ2", "damage2" },
+		{ "music", "神秘3", "mystery3" },
+		{ "monster", "ワイバーン", "bluedragon" },
+		{ "music", "村3", "village3" },
+		{ "chipset", "船", "chipset3" },
+		{ "music", "活気", "energy" },
+		{ "battle", "炎1", "fire1" },
+		{ "sound", "閉める2", "close2" },
+		{ "backdrop", "雪原", "snow" },
+		{ "sound", "冷気8", "cold8" },
+		{ "title", "タイトル3", "title3" },
+		{ "sound", "おたけび", "roar" },
+		{ "music", "オープニング1", "opening1" },
+		{ "sound", "大地7", "earth7" },
+		{ "monster", "リッチ", "darkspirit" },
+		{ "sound", "イヌ", "dog" },
+		{ "battle", "吸収", "absorption" },
+		{ "sound", "歌", "song" },
+		{ "sound", "冷気2", "cold2" },
+		{ "panorama", "空1", "morning1" },
 	};
 
-	RTP_TABLE_2000["chipset"] = {
-	 // Official English translation names
-	 {"dungeon", "ダンジョン"},
-	 {"interior", "内装"},
-	 {"world", "基本"},
-	 {"exterior", "外観"},
-	 {"ship", "船"},
-
-	 // Don Miguel's English translation names
-	 {"inner", "内装"},
-	 {"basis", "基本"},
-	 {"outline", "外観"},
-
-	 // Orphaned Don Miguel's 2000 RTP extras pointing to nearest match
-	 {"chipset1", "ダンジョン"},
-	 {"chipset2", "内装"},
-	 {"chipset3", "船"}
+	const int32_t seeds_2000_english[465] = {
+		3, -465, -464, -463, -461, 1, -456, -455, -453, 0, 2, 0, 0, -451, 0, -444,
+		-443, 0, 0, 0, 0, 0, 1, -442, -439, -438, 1, 1, -435, -433, -429, 0,
+		1, -427, 1, -426, 1, 1, 0, -418, 0, -417, -415, -411, -410, -404, 1, 1,
+		-395, 0, -394, 0, 4, 0, 0, -393, 0, -388, -386, -383, 0, 1, -377, 0,
+		2, -375, 0, -374, 1, 0, -370, 1, 1, -369, -367, 0, 1, 0, 3, 0,
+		1, 0, 1, 0, 0, 0, -364, 1, -363, 1, 1, -361, -358, -357, -356, -354,
+		-347, -346, -342, -340, 0, -335, -328, 0, 0, -327, -326, 4, 0, 0, 0, 2,
+		0, 0, 0, -324, -322, 2, 2, -321, -320, 2, 0, 0, -319, 0, -318, 1,
+		0, -317, -316, 3, 0, -314, 2, 0, -313, -312, -310, 1, 1, 1, 0, 0,
+		3, 0, 0, 0, -309, 0, -306, 0, 0, -305, 0, 0, 0, -304, 0, -303,
+		-302, -292, -291, 1, 5, -290, -287, 4, 1, 0, -286, 0, 2, 1, 0, 1,
+		0, 1, 0, 0, 0, 3, -282, -279, 1, 3, -277, 3, -276, -275, 0, 0,
+		0, -273, 0, 1, 0, 2, 0, 0, 0, -272, 0, -271, -270, -268, 5, -267,
+		0, -266, -264, -263, 0, -257, -252, -251, 0, -250, -248, 1, -244, 0, -240, 0,
+		-239, 1, 0, 0, 3, 0, -238, 1, -235, 2, 6, -233, 0, 0, 0, 0,
+		0, 6, 0, -232, 2, -227, 0, 0, -221, -220, -216, 0, 0, 1, 0, 0,
+		0, 0, 1, 6, 1, 1, 0, 0, -213, 5, 2, -210, 0, 1, -209, -207,
+		0, 1, -206, 0, -201, -200, 2, 6, -199, 0, 0, 0, -197, 3, 0, 0,
+		-196, 0, 3, -195, 0, 0, 0, -190, -185, -181, -179, 1, 0, 4, 0, -172,
+		-170, -169, 4, 0, 0, 0, 2, 1, 3, -168, -167, 5, 1, -165, 0, -163,
+		-160, 0, 0, -159, 8, -157, 0, -153, 2, -152, -151, 0, 0, 0, 0, 4,
+		1, 1, 0, -149, 0, 0, 0, 12, 8, 0, 1, 3, 0, 2, -143, -137,
+		-136, 0, -135, -132, 0, 1, 2, 12, 0, 0, 4, 0, 0, -131, -128, -126,
+		0, -123, 7, 2, -114, -108, 3, -104, -102, 0, 0, 4, -100, -94, 0, -92,
+		0, -79, 0, 0, -75, 11, 0, -74, 0, 0, 0, 0, -71, -68, 3, 3,
+		0, -62, 0, 4, -59, -58, 12, -56, 0, 0, -55, 0, 0, -54, -49, 0,
+		5, 9, -47, 5, 0, 1, 0, -45, -44, -43, -42, -39, 4, 15, 14, -34,
+		-33, 0, 0, -32, 0, 0, 0, 0, 0, -30, 0, 2, 5, -29, -27, 0,
+		-25, 3, 9, -21, 0, -18, 0, 2, 0, -16, -15, 0, -14, -11, 5, -9,
+		0,
 	};
 
-	RTP_TABLE_2000["faceset"] = {
-	 // Official English translation names
-	 {"monster", "モンスター"},
-	 {"people1", "一般1"},
-	 {"people2", "一般2"},
-	 {"actor1", "主人公1"},
-	 {"actor2", "主人公2"},
-
-	 // Don Miguel's English translation names
-	 {"monsters", "モンスター"},
-	 {"chara1", "主人公1"},
-	 {"chara2", "主人公2"}
+	const Table table_2000_english = { entries_2000_english, seeds_2000_english, 465 };
 
-	 // Orphaned Don Miguel's 2000 RTP extras with no match
-	 // face1-4
+	const Entry entries_2003_japanese[2528] = {
+		{ "sound", "thunder6", "雷6" },
+		{ "faceset", "chara1", "主人公1" },
+		{ "sound", "recovery8", "回復8" },
+		{ "monster", "dangeroussnake", "スネーク" },
+		{ "sound", "잘라내기2", "はずれ2" },
+		{ "monster", "robot", "グレル" },
+		{ "battle", "2003wind", "2003風" },
+		{ "battlecharset", "해적女b", "海賊女b" },
+		{ "battlecharset", "elfwomanb", "エルフ女b" },
+		{ "battle", "2003-lines", "2003光柱" },
+		{ "music", "보스3", "ボス3" },
+		{ "battlecharset", "unnonb", "盗賊男b" },
+		{ "music", "dungeon2", "ダンジョン2" },
+		{ "battlecharset", "chinesemanb", "中華男b" },
+		{ "charset", "hero4", "主人公4" },
+		{ "faceset", "일반2", "一般2" },
+		{ "monster", "primitiveman", "オーガ" },
+		{ "sound", "cursor1", "カーソル1" },
+		{ "sound", "revive3", "蘇生3" },
+		{ "monster", "multirootflower", "ネペンテス" },
+		{ "battle", "2003 axe", "2003斧" },
+		{ "monster", "giraffe", "麒麟" },
+		{ "sound", "마비3", "しびれ3" },
+		{ "music", "2003pleasure", "2003街の賑わい" },
+		{ "charset", "동물", "動物" },
+		{ "battlecharset", "womanéta", "女性５a" },
+		{ "battlecharset", "goxanb", "海賊男b" },
+		{ "music", "SE시계", "SE時計" },
+		{ "music", "2003darkaltar", "2003暗黒の祭壇" },
+		{ "sound", "strike03", "斬る3" },
+		{ "music", "fiesta", "明るい市場" },
+		{ "monster", "사하킨", "サハギン" },
+		{ "battlecharset", "rivraa", "魔術師男a" },
+		{ "battlecharset", "womanérb", "女性３b" },
+		{ "sound", "holy5", "神聖5" },
+		{ "music", "2003싸움의 개막", "2003戦いの幕開け" },
+		{ "music", "ruins", "2003遺跡探索" },
+		{ "panorama", "nightempty1", "夜空1" },
+		{ "monster", "웜", "ワーム" },
+		{ "monster", "bea", "ホーネット" },
+		{ "music", "2003battle with an evil god", "2003邪神との戦い" },
+		{ "panorama", "혹성2", "惑星2" },
+		{ "battle", "explosive", "爆発" },
+		{ "sound", "night", "暗闇" },
+		{ "music", "search", "探索" },
+		{ "monster", "잭-오-랜턴", "ジャック・オー・ランタン" },
+		{ "charset", "char1", "一般1" },
+		{ "sound", "escape", "逃走" },
+		{ "sound", "배리어", "バリア" },
+		{ "music", "vehicle 1", "乗り物1" },
+		{ "monster", "우로보로스", "ウロボロス" },
+		{ "battle", "sun", "回復" },
+		{ "sound", "revive1", "蘇生1" },
+		{ "monster", "spirit", "スピリッツ" },
+		{ "monster", "sorcerer", "ソーサラー" },
+		{ "faceset", "actor1", "主人公1" },
+		{ "sound", "회복5", "回復5" },
+		{ "music", "boss2", "ボス2" },
+		{ "music", "jaggressiveend1", "j戦闘終了1" },
+		{ "monster", "kraken", "クラーケン" },
+		{ "backdrop", "competitionplace", "闘技場" },
+		{ "sound", "바람6", "風6" },
+		{ "music", "J2003호른", "J2003ホルン" },
+		{ "sound", "silence", "沈黙" },
+		{ "music", "se2003alarm", "se2003アラーム" },
+		{ "sound", "데미지2", "ダメージ2" },
+		{ "sound", "cut7", "斬る7" },
+		{ "music", "ending 2", "エンディング2" },
+		{ "battlecharset", "eljeab", "戦士女b" },
+		{ "music", "2003witchsong", "2003未開の集落" },
+		{ "battlecharset", "chinese man b", "中華男b" },
+		{ "sound", "strike09", "斬る9" },
+		{ "charset", "monster1", "モンスター1" },
+		{ "music", "fairy 1", "妖精1" },
+		{ "sound", "thunder8", "雷8" },
+		{ "monster", "배히모스", "ベヒーモス" },
+		{ "monster", "사타나엘", "サタナエル" },
+		{ "music", "repose 1", "安らぎ1" },
+		{ "music", "se-crowd", "se2003雑踏" },
+		{ "music", "2003machinefortress", "2003機械要塞" },
+		{ "battlecharset", "nysmab", "女性４b" },
+		{ "monster", "unicorn", "ユニコーン" },
+		{ "monster", "killerplant", "ネペンテス" },
+		{ "music", "2003암흑의 제단", "2003暗黒の祭壇" },
+		{ "monster", "blackturtle", "玄武" },
+		{ "music", "2003fightopening", "2003戦いの幕開け" },
+		{ "monster", "cockatorice", "コカトリス" },
+		{ "battlecharset", "magicteacherwomanb", "魔術師女b" },
+		{ "sound", "slash1", "斬る1" },
+		{ "battle", "blow", "打撃" },
+		{ "charset", "탈것", "乗り物" },
+		{ "music", "2003거리의 북적임", "2003街の賑わい" },
+		{ "battle", "2003-wind", "2003風" },
+		{ "monster", "ariman", "アーリマン" },
+		{ "music", "2003eaststyle", "2003山あいの村" },
+		{ "backdrop", "sky", "空" },
+		{ "sound", "도주", "逃走" },
+		{ "battle", "absorb1", "2003吸収" },
+		{ "battle", "absorb2", "吸収" },
+		{ "music", "evil-temple", "2003暗黒の祭壇" },
+		{ "music", "ship 2", "船2" },
+		{ "music", "tower 3", "塔3" },
+		{ "chipset", "appearance", "外観" },
+		{ "charset", "chara1", "主人公1" },
+		{ "monster", "browndragon", "ワイバーン" },
+		{ "sound", "커서2", "カーソル2" },
+		{ "monster", "ork", "オーク" },
+		{ "sound", "water2", "水2" },
+		{ "battlecharset", "male pirate b", "海賊男b" },
+		{ "monster", "yburning", "ワイバーン" },
+		{ "battlecharset", "monkmana", "僧侶男a" },
+		{ "sound", "바람1", "風1" },
+		{ "monster", "ogre", "オーガ" },
+		{ "backdrop", "spacelight", "異空間" },
+		{ "battle", "debuff", "下降" },
+		{ "faceset", "몬스터", "モンスター" },
+		{ "monster", "midgard-serp", "ミドガルズオルム" },
+		{ "battlecharset", "엘프女 b", "エルフ女b" },
+		{ "music", "2003긴박", "2003緊迫" },
+		{ "sound", "earth01", "大地1" },
+		{ "monster", "witchphantom", "ゴースト" },
+		{ "charset", "object1", "オブジェクト1" },
+		{ "music", "tower2", "塔2" },
+		{ "sound", "bow1", "弓1" },
+		{ "monster", "다크 나이트", "ダークナイト" },
+		{ "music", "village1", "村1" },
+		{ "panorama", "이공간", "異空間" },
+		{ "sound", "데미지1", "ダメージ1" },
+		{ "music", "2003cyber city", "2003サイバーシティ" },
+		{ "monster", "ki-rin", "麒麟" },
+		{ "charset", "주인공2", "主人公2" },
+		{ "battlecharset", "male warrior a", "戦士男a" },
+		{ "monster", "bluedragon", "龍" },
+		{ "music", "shop 3", "店3" },
+		{ "battlecharset", "ninjawomana", "忍者女a" },
+		{ "battle", "coldair", "冷気" },
+		{ "battle", "dark", "暗黒" },
+		{ "sound", "holy2", "神聖2" },
+		{ "backdrop", "던젼１", "ダンジョン１" },
+		{ "battle", "rise", "上昇" },
+		{ "sound", "비2", "雨2" },
+		{ "sound", "punch2", "打撃2" },
+		{ "monster", "oldman7", "アンデッドナイト" },
+		{ "sound", "slash6", "斬る6" },
+		{ "sound", "chime2", "あたり2" },
+		{ "monster", "청룡", "龍" },
+		{ "sound", "slash2", "斬る2" },
+		{ "music", "보스4", "ボス4" },
+		{ "music", "jfanfare 5", "jファンファーレ5" },
+		{ "sound", "화염6", "炎6" },
+		{ "charset", "주인공3", "主人公3" },
+		{ "music", "hallowed-halls", "2003大聖堂" },
+		{ "sound", "냉기9", "冷気9" },
+		{ "monster", "princess", "ラクシュミ" },
+		{ "monster", "만티코어", "マンティコア" },
+		{ "monster", "murdererwoman", "カーミラ" },
+		{ "monster", "미노타우르스", "ミノタウロス" },
+		{ "sound", "wind09", "風9" },
+		{ "monster", "nightmare", "馬" },
+		{ "battle", "바람", "風" },
+		{ "music", "시련", "試練" },
+		{ "battle", "2003대지", "2003大地" },
+		{ "music", "2003요정의 숲", "2003妖精の森" },
+		{ "music", "슬퍼하다", "悲しみ" },
+		{ "sound", "pollen", "花粉" },
+		{ "charset", "chara3", "主人公3" },
+		{ "panorama", "space", "宇宙" },
+		{ "music", "gameover2", "ゲームオーバー2" },
+		{ "battle", "bow1", "2003弓" },
+		{ "monster", "구울", "グール" },
+		{ "music", "2003wingtoskies", "2003大空への翼" },
+		{ "music", "지하감옥2", "ダンジョン2" },
+		{ "battle", "fang", "爪" },
+		{ "monster", "백호", "白虎" },
+		{ "battlecharset", "승려男b", "僧侶男b" },
+		{ "title", "타이틀3", "タイトル3" },
+		{ "monster", "gazer", "ゲイザー" },
+		{ "chipset", "chipset3", "船" },
+		{ "backdrop", "universe", "宇宙" },
+		{ "battlecharset", "female monk b", "僧侶女b" },
+		{ "battle", "2003화살", "2003弓" },
+		{ "sound", "earthquake2", "地震2" },
+		{ "sound", "slash7", "斬る7" },
+		{ "sound", "전격5", "雷5" },
+		{ "monster", "merman", "サハギン" },
+		{ "sound", "바람7", "風7" },
+		{ "music", "2003슬퍼하고", "2003悲しみ" },
+		{ "sound", "신성7", "神聖7" },
+		{ "backdrop", "temple2", "神殿" },
+		{ "battle", "treatment", "治療" },
+		{ "battlecharset", "male hero b", "勇者男b" },
+		{ "music", "J전투종료3", "J戦闘終了3" },
+		{ "sound", "breath", "ブレス" },
+		{ "battlecharset", "용자女b", "勇者女b" },
+		{ "sound", "knock", "ノック" },
+		{ "music", "demonic", "魔王" },
+		{ "backdrop", "독연못", "毒沼" },
+		{ "sound", "magic1", "魔法1" },
+		{ "backdrop", "던젼２", "ダンジョン２" },
+		{ "sound", "raise1", "蘇生1" },
+		{ "panorama", "weird", "異空間" },
+		{ "sound", "bolt06", "雷6" },
+		{ "music", "black market", "闇市" },
+		{ "faceset", "faces2", "一般2" },
+		{ "sound", "버저1", "ブザー1" },
+		{ "music", "밭두둑2", "町2" },
+		{ "music", "2003joyfulnews", "2003サイバーシティ" },
+		{ "music", "탑1", "塔1" },
+		{ "battle", "2003luminouspillar", "2003光柱" },
+		{ "sound", "벤다5", "斬る5" },
+		{ "backdrop", "galaxy", "宇宙" },
+		{ "sound", "holy9", "神聖9" },
+		{ "music", "vehicle 2", "乗り物2" },
+		{ "monster", "dangeroussoldier", "オーディン" },
+		{ "faceset", "faces1", "一般1" },
+		{ "music", "2003유소의 기억", "2003幼少の記憶" },
+		{ "panorama", "하늘2", "空2" },
+		{ "music", "dungeon 5", "ダンジョン5" },
+		{ "battle", "2003마비", "2003麻痺" },
+		{ "panorama", "sky1", "空1" },
+		{ "sound", "end1", "はずれ1" },
+		{ "battle", "2003 spear", "2003槍" },
+		{ "battle", "냉기", "冷気" },
+		{ "backdrop", "wasteland", "荒地" },
+		{ "music", "2003wickedgodfight", "2003邪神との戦い" },
+		{ "battlecharset", "female pirate a", "海賊女a" },
+		{ "music", "opening3", "オープニング3" },
+		{ "sound", "벤다10", "斬る10" },
+		{ "battle", "신성", "神聖" },
+		{ "music", "이별2", "別れ2" },
+		{ "battle", "down", "下降" },
+		{ "music", "2003empire", "2003帝国〜エンパイア" },
+		{ "sound", "신성5", "神聖5" },
+		{ "monster", "yeti", "ビッグフット" },
+		{ "sound", "bolt02", "雷2" },
+		{ "charset", "crown1", "主人公4" },
+		{ "music", "dimension", "2003異次元回廊" },
+		{ "backdrop", "길가운데", "街中" },
+		{ "sound", "bolt10", "雷10" },
+		{ "sound", "타격5", "打撃5" },
+		{ "music", "2003dream of striking it rich", "2003一獲千金の夢" },
+		{ "sound", "바람11", "風11" },
+		{ "backdrop", "bath", "銭湯" },
+		{ "charset", "general2", "一般2" },
+		{ "sound", "flee", "逃走" },
+		{ "battlecharset", "tuanaa", "エルフ女a" },
+		{ "sound", "폭발6", "爆発6" },
+		{ "sound", "소", "ウシ" },
+		{ "battle", "poison", "ブレス" },
+		{ "battle", "axe1", "2003斧" },
+		{ "sound", "fire1", "炎1" },
+		{ "sound", "wall1", "壁1" },
+		{ "battlecharset", "hero-m-1", "勇者男a" },
+		{ "sound", "flash3", "フラッシュ3" },
+		{ "battle", "2003 fire", "2003炎" },
+		{ "sound", "flash2", "フラッシュ2" },
+		{ "backdrop", "desert", "砂漠" },
+		{ "backdrop", "barren", "荒地" },
+		{ "music", "2003산골짜기 마을", "2003山あいの村" },
+		{ "sound", "냉기11", "冷気11" },
+		{ "monster", "multileg", "センチピード" },
+		{ "sound", "회복4", "回復4" },
+		{ "music", "se-torrent", "se大雨" },
+		{ "charset", "animal", "動物" },
+		{ "sound", "암흑3", "暗黒3" },
+		{ "music", "2003lonelyjourney", "2003孤独な旅立ち" },
+		{ "music", "2003underwater", "2003静寂" },
+		{ "battle", "claw2", "爪" },
+		{ "panorama", "석양1", "夕焼け1" },
+		{ "sound", "신성2", "神聖2" },
+		{ "battlecharset", "armourwarriora", "鎧武者a" },
+		{ "monster", "u-knight", "アンデッドナイト" },
+		{ "music", "battleend2", "j戦闘終了2" },
+		{ "music", "fanfare5", "jファンファーレ5" },
+		{ "battlecharset", "goxana", "海賊男a" },
+		{ "battlecharset", "phesab", "格闘家女b" },
+		{ "sound", "barrier", "バリア" },
+		{ "charset", "people1", "一般1" },
+		{ "music", "field 1", "フィールド1" },
+		{ "battle", "대지", "大地" },
+		{ "battlecharset", "여성４b", "女性４b" },
+		{ "backdrop", "초원", "草原" },
+		{ "battlecharset", "ninjamana", "忍者男a" },
+		{ "backdrop", "설원", "雪原" },
+		{ "sound", "glare", "にらみ" },
+		{ "backdrop", "투기장", "闘技場" },
+		{ "sound", "wind5", "風5" },
+		{ "monster", "ghost", "ゴースト" },
+		{ "battlecharset", "여성３b", "女性３b" },
+		{ "sound", "attack1", "攻撃1" },
+		{ "monster", "lizardmen", "リザードマン" },
+		{ "battle", "2003 light pillar", "2003光柱" },
+		{ "battle", "breath1", "2003ブレス" },
+		{ "sound", "breast", "ブレス" },
+		{ "music", "jfanfare1", "jファンファーレ1" },
+		{ "battle", "bow", "矢" },
+		{ "sound", "sea2", "海2" },
+		{ "sound", "ice01", "冷気1" },
+		{ "sound", "물다", "噛む" },
+		{ "music", "2003rhinobarcity", "2003サイバーシティ" },
+		{ "sound", "cut5", "斬る5" },
+		{ "sound", "magic2", "魔法2" },
+		{ "sound", "darkness1", "暗黒1" },
+		{ "backdrop", "cave", "ダンジョン１" },
+		{ "charset", "char5", "一般5" },
+		{ "battle", "화살", "矢" },
+		{ "music", "seearthquake", "se地震" },
+		{ "sound", "flashlight1", "フラッシュ1" },
+		{ "sound", "암흑4", "暗黒4" },
+		{ "sound", "fire5", "炎5" },
+		{ "sound", "흡수2", "吸収2" },
+		{ "battlecharset", "jidadb", "男性１b" },
+		{ "music", "village 1", "村1" },
+		{ "title", "title4", "タイトル4" },
+		{ "battlecharset", "mage-m-2", "魔術師男b" },
+		{ "chipset", "basic", "基本" },
+		{ "music", "2003snow town", "2003スノータウン" },
+		{ "sound", "buzzer1", "はずれ1" },
+		{ "monster", "treant", "トレント" },
+		{ "monster", "도깨비(鬼)", "鬼" },
+		{ "backdrop", "canyon", "山道" },
+		{ "monster", "barbarian", "バーサーカー" },
+		{ "music", "dungeon3", "ダンジョン3" },
+		{ "sound", "닫는다1", "閉める1" },
+		{ "music", "2003unexploredvillage", "2003未開の集落" },
+		{ "monster", "cerebus", "ケルベロス" },
+		{ "sound", "폭발3", "爆発3" },
+		{ "monster", "crab", "クラブ" },
+		{ "monster", "hornet", "ホーネット" },
+		{ "sound", "move", "移動" },
+		{ "battle", "drop", "下降" },
+		{ "music", "게임오버1", "ゲームオーバー1" },
+		{ "sound", "strike08", "斬る8" },
+		{ "monster", "ninetail", "九尾の狐" },
+		{ "music", "점2", "店2" },
+		{ "music", "2003silence", "2003静寂" },
+		{ "sound", "flame7", "炎7" },
+		{ "battlecharset", "womanépb", "女性１b" },
+		{ "backdrop", "castle", "玉座" },
+		{ "battle", "상승", "上昇" },
+		{ "music", "2003미개한 취락", "2003未開の集落" },
+		{ "music", "2003courtparty", "2003王宮のパーティー" },
+		{ "charset", "people7", "一般2" },
+		{ "battlecharset", "manépb", "男性１b" },
+		{ "sound", "vortex", "巻き付き" },
+		{ "monster", "가고일", "ガーゴイル" },
+		{ "battlecharset", "마술사女b", "魔術師女b" },
+		{ "battlecharset", "ninja-m-2", "忍者男b" },
+		{ "battlecharset", "male monk a", "僧侶男a" },
+		{ "music", "2003살며시 다가옴", "2003忍び寄る闇" },
+		{ "battlecharset", "갑옷무사a", "鎧武者a" },
+		{ "backdrop", "donjohnu", "ダンジョン６" },
+		{ "music", "2003fairyforest", "2003妖精の森" },
+		{ "battlecharset", "승려女a", "僧侶女a" },
+		{ "battle", "2003 thunder", "2003雷" },
+		{ "sound", "타격3", "打撃3" },
+		{ "music", "2003oldcastle", "2003古城" },
+		{ "monster", "darkspirit", "リッチ" },
+		{ "sound", "buzzer3", "ブザー1" },
+		{ "music", "배1", "船1" },
+		{ "backdrop", "labyrinth", "ダンジョン５" },
+		{ "music", "필드3", "フィールド3" },
+		{ "battlecharset", "chinese-f-2", "中華女b" },
+		{ "battlecharset", "사무라이b", "侍b" },
+		{ "sound", "wave1", "音波1" },
+		{ "monster", "현무", "玄武" },
+		{ "monster", "creepingcreature", "ミドガルズオルム" },
+		{ "monster", "big foot", "ビッグフット" },
+		{ "monster", "chimera", "キメラ" },
+		{ "sound", "ice8", "冷気8" },
+		{ "sound", "스위치1", "スイッチ1" },
+		{ "monster", "리자드맨", "リザードマン" },
+		{ "battle", "2003흡수", "2003吸収" },
+		{ "music", "밝은 시장", "明るい市場" },
+		{ "music", "strangetown", "2003未開の集落" },
+		{ "monster", "토드", "トード" },
+		{ "backdrop", "grave", "お墓" },
+		{ "battle", "increase", "上昇" },
+		{ "monster", "darkknight", "ダークナイト" },
+		{ "music", "ending 1", "エンディング1" },
+		{ "sound", "darkness", "暗闇" },
+		{ "battlecharset", "siossa", "僧侶男a" },
+		{ "monster", "hero1", "ダークエルフ" },
+		{ "battlecharset", "temmada", "エルフ男a" },
+		{ "battlecharset", "격투가男a", "格闘家男a" },
+		{ "battlecharset", "elfwomana", "エルフ女a" },
+		{ "battle", "explode2", "爆発" },
+		{ "battlecharset", "irregiaa", "女性３a" },
+		{ "music", "핀치", "ピンチ" },
+		{ "music", "se-bird", "se2003鳥" },
+		{ "music", "동물", "動物" },
+		{ "monster", "seamonster", "クラーケン" },
+		{ "battleweapon", "무기", "武器" },
+		{ "sound", "blow3", "打撃3" },
+		{ "music", "2003largesaintlyhall", "2003大聖堂" },
+		{ "music", "panic", "2003パニック" },
+		{ "sound", "revival3", "蘇生3" },
+		{ "music", "inn2", "j宿2" },
+		{ "monster", "flyingfish", "レモラ" },
+		{ "battlecharset", "도적男b", "盗賊男b" },
+		{ "sound", "footstep", "移動" },
+		{ "sound", "earth03", "大地3" },
+		{ "monster", "스켈톤", "スケルトン" },
+		{ "backdrop", "신전", "神殿" },
+		{ "charset", "future2", "一般4" },
+		{ "battlecharset", "woman3-1", "女性３a" },
+		{ "music", "jfanfare 6", "jファンファーレ6" },
+		{ "monster", "jack-o-lantern", "ジャック・オー・ランタン" },
+		{ "backdrop", "empty", "空" },
+		{ "battlecharset", "rivrab", "魔術師男b" },
+		{ "battlecharset", "male elf b", "エルフ男b" },
+		{ "battle", "2003revival", "2003蘇生" },
+		{ "music", "se2003jungle", "se2003ジャングル" },
+		{ "music", "필드4", "フィールド4" },
+		{ "battle", "ice1", "2003冷気" },
+		{ "sound", "대지6", "大地6" },
+		{ "backdrop", "dungeon6", "ダンジョン６" },
+		{ "battle", "ressurection", "蘇生" },
+		{ "music", "2003dreaminess", "2003夢見心地" },
+		{ "battlecharset", "여성３a", "女性３a" },
+		{ "battle", "2003-sword", "2003剣" },
+		{ "monster", "tarantula", "タランチュラ" },
+		{ "monster", "sharpfish", "レモラ" },
+		{ "backdrop", "grass", "草原" },
+		{ "battle", "흡수", "吸収" },
+		{ "monster", "wolf", "フェンリル" },
+		{ "monster", "ryuu", "龍" },
+		{ "sound", "up", "アップ" },
+		{ "sound", "ice11", "冷気11" },
+		{ "battlecharset", "piratewomanb", "海賊女b" },
+		{ "music", "sedownpour", "se大雨" },
+		{ "music", "castle1", "城1" },
+		{ "music", "secret treasure", "秘宝" },
+		{ "monster", "shark", "シャーク" },
+		{ "monster", "bigfoot", "ビッグフット" },
+		{ "music", "2003final battleground", "2003決戦の地" },
+		{ "monster", "fairy", "シルフ" },
+		{ "charset", "protagonist2", "主人公2" },
+		{ "monster", "와이트", "ワイト" },
+		{ "monster", "엘리게이터", "アリゲーター" },
+		{ "sound", "혼란", "混乱" },
+		{ "battle", "2003-cold", "2003冷気" },
+		{ "battle", "explosion", "爆発" },
+		{ "music", "jjoke 2", "jギャグ2" },
+		{ "sound", "poison", "毒" },
+		{ "monster", "girl2", "シルフ" },
+		{ "monster", "말", "馬" },
+		{ "sound", "battle2", "戦闘2" },
+		{ "panorama", "planet2", "惑星2" },
+		{ "charset", "monster2", "モンスター2" },
+		{ "sound", "rain1", "雨1" },
+		{ "monster", "eyestalk", "ゲイザー" },
+		{ "music", "2003dance", "2003王宮のパーティー" },
+		{ "battle", "sword1", "剣1" },
+		{ "sound", "dog", "イヌ" },
+		{ "sound", "clock", "時計" },
+		{ "panorama", "혹성1", "惑星1" },
+		{ "music", "mtn-village", "2003山あいの村" },
+		{ "battlecharset", "frossa", "男性５a" },
+		{ "battlecharset", "man1 a", "男性１a" },
+		{ "sound", "explosion7", "爆発7" },
+		{ "sound", "화염5", "炎5" },
+		{ "battlecharset", "thiefwomana", "盗賊女a" },
+		{ "battle", "도끼", "斧" },
+		{ "music", "2003steady breeze", "2003穏やかな風" },
+		{ "monster", "lostshadow", "シャドウ" },
+		{ "battle", "ax", "斧" },
+		{ "battlecharset", "엘프女 a", "エルフ女a" },
+		{ "monster", "lilith", "リリス" },
+		{ "battlecharset", "male warrior b", "戦士男b" },
+		{ "music", "ghost-town1", "ゴーストタウン1" },
+		{ "battlecharset", "남성２a", "男性２a" },
+		{ "music", "2003towncrowd", "2003街の賑わい" },
+		{ "music", "SE2003혼잡", "SE2003雑踏" },
+		{ "sound", "바람9", "風9" },
+		{ "sound", "revival2", "蘇生2" },
+		{ "sound", "업", "アップ" },
+		{ "battle", "창", "槍" },
+		{ "battle", "2003recovery", "2003回復" },
+		{ "music", "gag1", "jギャグ1" },
+		{ "monster", "powerfulnecromant", "リッチ" },
+		{ "music", "fairies", "2003妖精の森" },
+		{ "music", "2003tepeated wars", "2003繰り返される戦い" },
+		{ "backdrop", "bridge", "橋" },
+		{ "battlecharset", "female monk a", "僧侶女a" },
+		{ "monster", "spectre", "スペクター" },
+		{ "monster", "odin", "オーディン" },
+		{ "sound", "냉기6", "冷気6" },
+		{ "music", "jfanfare 1", "jファンファーレ1" },
+		{ "chipset", "배", "船" },
+		{ "music", "J팡파르4", "Jファンファーレ4" },
+		{ "sound", "cansel2", "キャンセル2" },
+		{ "music", "J숙소1", "J宿1" },
+		{ "sound", "teleport1", "テレポート1" },
+		{ "battlecharset", "남성１b", "男性１b" },
+		{ "monster", "magicskull", "スペクター" },
+		{ "music", "se2003winter", "se2003風" },
+		{ "battle", "회복", "回復" },
+		{ "sound", "chicken", "にわとり" },
+		{ "backdrop", "ballseat", "玉座" },
+		{ "panorama", "새벽1", "夜明け1" },
+		{ "battle", "2003 recovery", "2003回復" },
+		{ "battle", "other", "その他" },
+		{ "monster", "harpy", "ハーピー" },
+		{ "music", "ride2", "乗り物2" },
+		{ "sound", "recovery5", "回復5" },
+		{ "faceset", "people2", "一般2" },
+		{ "music", "2003몽환의 숲", "2003夢幻の森" },
+		{ "faceset", "face1", "主人公1" },
+		{ "faceset", "actor2", "主人公2" },
+		{ "music", "hero1", "勇者1" },
+		{ "sound", "punch1", "打撃1" },
+		{ "music", "solace3", "安らぎ3" },
+		{ "monster", "frog", "トード" },
+		{ "music", "jaggressiveend2", "j戦闘終了2" },
+		{ "sound", "heal8", "回復8" },
+		{ "charset", "주인공4", "主人公4" },
+		{ "sound", "kill11", "斬る11" },
+		{ "monster", "gorgon-2", "ラミア" },
+		{ "monster", "고블린", "ゴブリン" },
+		{ "battle", "cure1", "2003治療" },
+		{ "sound", "chime1", "あたり1" },
+		{ "music", "2003극동의 땅", "2003極東の地" },
+		{ "battlecharset", "man4-2", "男性４b" },
+		{ "sound", "바람5", "風5" },
+		{ "battle", "fire2", "炎2" },
+		{ "panorama", "planetary3", "惑星3" },
+		{ "chipset", "outline", "外観" },
+		{ "sound", "전격8", "雷8" },
+		{ "monster", "세이렌", "セイレーン" },
+		{ "system2", "systeméqa", "システム２a" },
+		{ "sound", "wind11", "風11" },
+		{ "music", "2003차원의 길", "2003異次元回廊" },
+		{ "battle", "2003-arrow", "2003弓" },
+		{ "sound", "roar", "おたけび" },
+		{ "music", "fairy 2", "妖精2" },
+		{ "battlecharset", "woman5-2", "女性５b" },
+		{ "music", "opening2", "オープニング2" },
+		{ "charset", "monsters2", "モンスター2" },
+		{ "sound", "evasion2", "回避2" },
+		{ "monster", "centipede", "センチピード" },
+		{ "monster", "undead knight", "アンデッドナイト" },
+		{ "music", "jpuzzle", "j謎" },
+		{ "music", "lively market", "明るい市場" },
+		{ "monster", "트롤", "トロール" },
+		{ "sound", "slash10", "斬る10" },
+		{ "backdrop", "arena", "闘技場" },
+		{ "sound", "회복2", "回復2" },
+		{ "backdrop", "ocean", "海" },
+		{ "sound", "heal6", "回復6" },
+		{ "battle", "전격", "雷" },
+		{ "battlecharset", "chuaza", "男性３a" },
+		{ "panorama", "planetary1", "惑星1" },
+		{ "music", "peace3", "安らぎ3" },
+		{ "battle", "ground", "大地" },
+		{ "backdrop", "ship", "船上" },
+		{ "music", "victory2", "j戦闘終了2" },
+		{ "music", "liveliness", "活気" },
+		{ "sound", "음파1", "音波1" },
+		{ "monster", "oak", "トレント" },
+		{ "music", "2003otherworldly corridor", "2003異次元回廊" },
+		{ "music", "se-jungle", "se2003ジャングル" },
+		{ "sound", "thunder5", "雷5" },
+		{ "battle", "2003-poison", "2003ブレス" },
+		{ "chipset", "boat", "船" },
+		{ "sound", "movement", "移動" },
+		{ "sound", "kill2", "斬る2" },
+		{ "monster", "jackolantern", "ジャック・オー・ランタン" },
+		{ "sound", "close1", "閉める1" },
+		{ "backdrop", "icecave3", "ダンジョン３" },
+		{ "music", "tower 1", "塔1" },
+		{ "sound", "전격1", "雷1" },
+		{ "music", "mystery1", "神秘1" },
+		{ "sound", "전격7", "雷7" },
+		{ "monster", "redscorpion", "スコーピオン" },
+		{ "sound", "신성1", "神聖1" },
+		{ "sound", "battle1", "戦闘1" },
+		{ "sound", "닫는다2", "閉める2" },
+		{ "sound", "bolt03", "雷3" },
+		{ "battlecharset", "male mage a", "魔術師男a" },
+		{ "monster", "preyingmantis", "マンティス" },
+		{ "monster", "pimpskeleton", "アンデッドナイト" },
+		{ "music", "field3", "フィールド3" },
+		{ "battlecharset", "ljitib", "魔術師女b" },
+		{ "monster", "goblin", "ゴブリン" },
+		{ "monster", "크랩", "クラブ" },
+		{ "music", "gosttown1", "ゴーストタウン1" },
+		{ "sound", "earth1", "大地1" },
+		{ "sound", "wind3", "風3" },
+		{ "music", "신비1", "神秘1" },
+		{ "sound", "kill6", "暗黒6" },
+		{ "music", "촌1", "村1" },
+		{ "music", "mystery 2", "神秘2" },
+		{ "music", "hero2", "勇者2" },
+		{ "battlecharset", "soldiermanb", "戦士男b" },
+		{ "backdrop", "mountainpath", "山道" },
+		{ "sound", "slash9", "斬る9" },
+		{ "music", "village4", "2003日だまりの村" },
+		{ "music", "vehicle2", "乗り物2" },
+		{ "sound", "ice04", "冷気2" },
+		{ "music", "2003거리의 술집", "2003街の酒場" },
+		{ "battle", "2003소생", "2003蘇生" },
+		{ "monster", "genbu", "玄武" },
+		{ "sound", "아이템1", "アイテム1" },
+		{ "chipset", "main", "基本" },
+		{ "monster", "오크", "オーク" },
+		{ "music", "castle 3", "城3" },
+		{ "monster", "griffin", "グリフォン" },
+		{ "sound", "recovery3", "回復3" },
+		{ "battle", "barrier", "バリア" },
+		{ "monster", "wight", "ワイト" },
+		{ "backdrop", "city", "街中" },
+		{ "music", "hero 2", "勇者2" },
+		{ "music", "sesea", "se海" },
+		{ "sound", "cut1", "斬る1" },
+		{ "sound", "bolt08", "雷8" },
+		{ "charset", "vehicle", "乗り物" },
+		{ "sound", "sword3", "剣3" },
+		{ "music", "dungeon5", "ダンジョン5" },
+		{ "music", "2003waltz", "2003祝福ワルツ" },
+		{ "monster", "cockatrice", "コカトリス" },
+		{ "music", "2003enpire", "2003帝国〜エンパイア" },
+		{ "monster", "leviathan", "リヴァイアサン" },
+		{ "battlecharset", "male bandit b", "盗賊男b" },
+		{ "sound", "달라붙기", "巻き付き" },
+		{ "sound", "absorption1", "吸収1" },
+		{ "chipset", "내부", "内装" },
+		{ "sound", "damege2", "ダメージ2" },
+		{ "music", "tower3", "塔3" },
+		{ "battlecharset", "hero-m-2", "勇者男b" },
+		{ "battle", "2003손톱", "2003爪" },
+		{ "music", "game over 2", "ゲームオーバー2" },
+		{ "music", "2003wings to the sky", "2003大空への翼" },
+		{ "sound", "earth9", "大地9" },
+		{ "sound", "전격6", "雷6" },
+		{ "battle", "2003물", "2003水" },
+		{ "music", "2003cathedral", "2003大聖堂" },
+		{ "monster", "호넷", "ホーネット" },
+		{ "battlecharset", "elfmana", "エルフ男a" },
+		{ "sound", "holy7", "神聖7" },
+		{ "monster", "polartiger", "白虎" },
+		{ "monster", "laughingspirit", "スピリッツ" },
+		{ "monster", "nepenthe", "ネペンテス" },
+		{ "battlecharset", "man3 b", "男性３b" },
+		{ "music", "2003research", "2003カジノ三昧" },
+		{ "panorama", "석양2", "夕焼け2" },
+		{ "battle", "2003 whip", "2003鞭" },
+		{ "backdrop", "던젼５", "ダンジョン５" },
+		{ "music", "2003farmer", "2003日だまりの村" },
+		{ "charset", "protagonist1", "主人公1" },
+		{ "music", "2003반복된 싸움", "2003繰り返される戦い" },
+		{ "backdrop", "사막", "砂漠" },
+		{ "battlecharset", "남성４b", "男性４b" },
+		{ "music", "용사2", "勇者2" },
+		{ "monster", "cancer", "クラブ" },
+		{ "battle", "2003 claw", "2003爪" },
+		{ "monster", "multiarmdemon", "アスラ" },
+		{ "battlecharset", "여성４a", "女性４a" },
+		{ "battlecharset", "mage-f-1", "魔術師女a" },
+		{ "monster", "bat", "バット" },
+		{ "sound", "blow2", "打撃2" },
+		{ "monster", "lich", "リッチ" },
+		{ "monster", "아나콘다", "アナコンダ" },
+		{ "monster", "미드갈즈 오르무", "ミドガルズオルム" },
+		{ "music", "2003온화한 바람", "2003穏やかな風" },
+		{ "sound", "fire3", "炎3" },
+		{ "sound", "sandstorm", "砂けむり" },
+		{ "system", "시스템c", "システムc" },
+		{ "sound", "물5", "水5" },
+		{ "battle", "breath2", "ブレス" },
+		{ "monster", "wyvern", "ワイバーン" },
+		{ "battle", "2003주위의 빛", "2003光柱" },
+		{ "monster", "toothworm", "ワーム" },
+		{ "sound", "sea1", "海1" },
+		{ "music", "gameover3", "ゲームオーバー3" },
+		{ "sound", "sand storm", "砂けむり" },
+		{ "sound", "around2", "あたり2" },
+		{ "music", "성1", "城1" },
+		{ "battlecharset", "womanésa", "女性４a" },
+		{ "music", "bazaar", "明るい市場" },
+		{ "sound", "jingle1", "あたり1" },
+		{ "music", "2003city bustle", "2003街の賑わい" },
+		{ "battlecharset", "nysmaa", "女性４a" },
+		{ "sound", "벤다6", "斬る6" },
+		{ "music", "2003theeternalflow", "2003悠久の時の流れに" },
+		{ "sound", "thunder1", "雷1" },
+		{ "music", "battle 3", "戦闘3" },
+		{ "music", "2003스노우 타운", "2003スノータウン" },
+		{ "sound", "flashlight2", "フラッシュ2" },
+		{ "monster", "sylph", "シルフ" },
+		{ "monster", "merangel", "セイレーン" },
+		{ "backdrop", "snowfield", "雪原" },
+		{ "monster", "seabowl", "クラーケン" },
+		{ "music", "2003정적", "2003静寂" },
+		{ "panorama", "밤하늘2", "夜空2" },
+		{ "battlecharset", "garreb", "侍b" },
+		{ "faceset", "protagonist2", "主人公2" },
+		{ "music", "opening 2", "オープニング2" },
+		{ "battlecharset", "woman4-2", "女性４b" },
+		{ "monster", "magicfox", "九尾の狐" },
+		{ "backdrop", "황야", "荒地" },
+		{ "music", "serain", "se雨" },
+		{ "music", "village 2", "村2" },
+		{ "sound", "열다2", "開ける2" },
+		{ "battle", "barrier2", "バリア" },
+		{ "music", "용사1", "勇者1" },
+		{ "music", "2003memoirs", "2003孤独な旅立ち" },
+		{ "battlecharset", "엘프男 a", "エルフ男a" },
+		{ "sound", "bolt07", "雷7" },
+		{ "battlecharset", "chinese-m-1", "中華男a" },
+		{ "sound", "earth6", "大地6" },
+		{ "music", "2003ancient city", "2003古城" },
+		{ "sound", "earth07", "大地7" },
+		{ "sound", "flame4", "炎4" },
+		{ "music", "battle2", "戦闘2" },
+		{ "music", "2003panic", "2003パニック" },
+		{ "battlecharset", "남성１a", "男性１a" },
+		{ "sound", "flash1", "フラッシュ1" },
+		{ "music", "ghost town 1", "ゴーストタウン1" },
+		{ "monster", "리바이어던", "リヴァイアサン" },
+		{ "sound", "대지7", "大地7" },
+		{ "music", "shop 2", "店2" },
+		{ "battlecharset", "갑옷무사b", "鎧武者b" },
+		{ "sound", "회복7", "回復7" },
+		{ "sound", "노래", "歌" },
+		{ "music", "점3", "店3" },
+		{ "music", "차량2", "乗り物2" },
+		{ "monster", "tiamat", "ティアマット" },
+		{ "battle", "2003바람", "2003風" },
+		{ "sound", "dark3", "暗黒3" },
+		{ "music", "2003deep memory", "2003記憶の彼方に" },
+		{ "system2", "systeméqc", "システム２c" },
+		{ "sound", "회피2", "回避2" },
+		{ "battlecharset", "samuraib", "侍b" },
+		{ "music", "shop 1", "店1" },
+		{ "monster", "사라멘더", "サラマンダー" },
+		{ "monster", "witch2", "カーミラ" },
+		{ "battlecharset", "mage-m-1", "魔術師男a" },
+		{ "backdrop", "donjohns", "ダンジョン４" },
+		{ "monster", "센티피드", "センチピード" },
+		{ "monster", "berserker", "バーサーカー" },
+		{ "monster", "리자드", "リザード" },
+		{ "sound", "냉기7", "冷気7" },
+		{ "battlecharset", "male bandit a", "盗賊男a" },
+		{ "music", "2003threat", "2003忍び寄る闇" },
+		{ "sound", "마비1", "しびれ1" },
+		{ "battle", "bow2", "矢" },
+		{ "sound", "타격7", "打撃7" },
+		{ "music", "2003casino", "2003カジノ三昧" },
+		{ "battle", "브레스", "ブレス" },
+		{ "music", "mischief2", "jギャグ2" },
+		{ "sound", "heal3", "回復3" },
+		{ "battle", "채찍", "鞭" },
+		{ "monster", "parasite", "パラサイト" },
+		{ "monster", "타이탄", "タイタン" },
+		{ "system", "systemb", "システムb" },
+		{ "battlecharset", "남성３b", "男性３b" },
+		{ "battle", "2003 water", "2003水" },
+		{ "music", "2003machine fortress", "2003機械要塞" },
+		{ "sound", "jingle2", "あたり2" },
+		{ "monster", "eye", "ゲイザー" },
+		{ "music", "2003morning", "2003記憶の彼方に" },
+		{ "music", "2003ice labyrinth", "2003氷のラビリンス" },
+		{ "music", "2003tension", "2003緊迫" },
+		{ "sound", "water6", "水6" },
+		{ "sound", "cancel1", "キャンセル1" },
+		{ "sound", "fire8", "炎8" },
+		{ "music", "tension", "2003緊迫" },
+		{ "backdrop", "ruins", "遺跡," },
+		{ "battle", "2003dark", "2003暗黒" },
+		{ "backdrop", "temple1", "お寺" },
+		{ "music", "boss 2", "ボス2" },
+		{ "battlecharset", "female warrior b", "戦士女b" },
+		{ "monster", "cerberus", "ケルベロス" },
+		{ "music", "boss3", "ボス3" },
+		{ "battle", "2003breath", "2003ブレス" },
+		{ "battlecharset", "tanab", "エルフ女b" },
+		{ "battleweapon", "weapon", "武器" },
+		{ "backdrop", "mountain road", "山道" },
+		{ "music", "2003양지의 마을", "2003日だまりの村" },
+		{ "monster", "ghoul", "グール" },
+		{ "sound", "검3", "剣3" },
+		{ "sound", "활1", "弓1" },
+		{ "music", "ancient-castle", "2003古城" },
+		{ "battlecharset", "male monk b", "僧侶男b" },
+		{ "music", "2003battlefield", "2003決戦の地" },
+		{ "battlecharset", "klorib", "僧侶女b" },
+		{ "music", "dungeon 2", "ダンジョン2" },
+		{ "battle", "2003-zip", "2003雷" },
+		{ "sound", "바람8", "風8" },
+		{ "backdrop", "사구", "砂浜" },
+		{ "monster", "manticore", "マンティコア" },
+		{ "charset", "일반4", "一般4" },
+		{ "panorama", "night2", "夜空2" },
+		{ "music", "trial", "試練" },
+		{ "sound", "대지2", "大地2" },
+		{ "music", "town-square", "2003街の賑わい" },
+		{ "backdrop", "lightspeed", "異空間" },
+		{ "sound", "dark2", "暗黒2" },
+		{ "battlecharset", "chinese-f-1", "中華女a" },
+		{ "music", "spring", "2003いやしの泉" },
+		{ "monster", "midgardsormr", "ミドガルズオルム" },
+		{ "music", "편안해짐1", "安らぎ1" },
+		{ "battlecharset", "닌자男a", "忍者男a" },
+		{ "sound", "laser3", "ショット3" },
+		{ "battlecharset", "man2-2", "男性２b" },
+		{ "sound", "전투2", "戦闘2" },
+		{ "sound", "open2", "開ける2" },
+		{ "battlecharset", "temmadb", "エルフ男b" },
+		{ "monster", "horngoat", "デーモン" },
+		{ "sound", "wind01", "風1" },
+		{ "monster", "flyingwarrior", "ガルーダ" },
+		{ "sound", "caos", "混乱" },
+		{ "music", "2003fanfares", "2003大空への翼" },
+		{ "battle", "2003 other1", "2003その他1" },
+		{ "battlecharset", "monk-m-1", "格闘家男a" },
+		{ "music", "memories2", "2003記憶の彼方に" },
+		{ "monster", "behemoth", "ベヒーモス" },
+		{ "backdrop", "dungeon1", "ダンジョン１" },
+		{ "battle", "healing2", "回復" },
+		{ "sound", "quake1", "地震1" },
+		{ "backdrop", "forest1", "森１" },
+		{ "monster", "네크로맨서", "ネクロマンサー" },
+		{ "music", "2003dream-catchlotsofmoney", "2003一獲千金の夢" },
+		{ "sound", "water3", "水3" },
+		{ "gameover", "gameover", "ゲームオーバー" },
+		{ "monster", "언데드 나이트", "アンデッドナイト" },
+		{ "battle", "hit", "打撃" },
+		{ "battle", "wind1", "2003風" },
+		{ "battle", "2003holy", "2003神聖" },
+		{ "charset", "crown4", "動物" },
+		{ "monster", "death", "レイス" },
+		{ "battle", "water2", "水" },
+		{ "backdrop", "rockbed", "岩場" },
+		{ "backdrop", "building", "洋館" },
+		{ "music", "success", "勝利" },
+		{ "backdrop", "던젼６", "ダンジョン６" },
+		{ "sound", "explosion4", "爆発4" },
+		{ "battle", "2003-spear", "2003槍" },
+		{ "sound", "벤다1", "斬る1" },
+		{ "music", "2003고성", "2003古城" },
+		{ "monster", "carbuncle", "カーバンクル" },
+		{ "music", "2003flight", "2003極東の地" },
+		{ "music", "2003얼음의 래비런스", "2003氷のラビリンス" },
+		{ "battle", "earth1", "2003大地" },
+		{ "battlecharset", "man4 b", "男性４b" },
+		{ "charset", "오브젝트2", "オブジェクト2" },
+		{ "sound", "ice2", "冷気2" },
+		{ "sound", "absorb1", "吸収1" },
+		{ "monster", "hog", "オーク" },
+		{ "music", "2003deserted mansion", "2003無人の館" },
+		{ "panorama", "dusk1", "夕焼け1" },
+		{ "monster", "bahamut", "バハムート" },
+		{ "music", "peace2", "安らぎ2" },
+		{ "battlecharset", "magicteachermanb", "魔術師男b" },
+		{ "monster", "트렌트", "トレント" },
+		{ "faceset", "일반1", "一般1" },
+		{ "battlecharset", "female bandit b", "盗賊女b" },
+		{ "sound", "punch3", "打撃3" },
+		{ "music", "활기", "活気" },
+		{ "battlecharset", "noddaa", "勇者女a" },
+		{ "monster", "darkangel", "サタナエル" },
+		{ "panorama", "nightempty2", "夜空2" },
+		{ "monster", "메두사", "メデューサ" },
+		{ "monster", "auger", "オーガ" },
+		{ "music", "jfanfare 2", "jファンファーレ2" },
+		{ "battle", "lightray", "2003光柱" },
+		{ "monster", "samurai", "オーディン" },
+		{ "panorama", "strange", "異空間" },
+		{ "charset", "general1", "一般1" },
+		{ "backdrop", "숲１", "森１" },
+		{ "battlecharset", "joegob", "鎧武者b" },
+		{ "music", "2003blessingwaltz", "2003祝福ワルツ" },
+		{ "monster", "siren", "セイレーン" },
+		{ "sound", "wind08", "風8" },
+		{ "monster", "basilisk", "バジリスク" },
+		{ "monster", "dark knight", "ダークナイト" },
+		{ "panorama", "새벽2", "夜明け2" },
+		{ "battle", "화염1", "炎1" },
+		{ "monster", "troll", "トロール" },
+		{ "music", "촌3", "村3" },
+		{ "battlecharset", "chinese woman a", "中華女a" },
+		{ "panorama", "혹성3", "惑星3" },
+		{ "music", "J수수께기", "J謎" },
+		{ "charset", "char2", "一般2" },
+		{ "music", "fanfare6", "jファンファーレ6" },
+		{ "music", "shop1", "店1" },
+		{ "battle", "whip2", "鞭" },
+		{ "monster", "yto", "ワイト" },
+		{ "system", "royal", "システム" },
+		{ "backdrop", "snow field", "雪原" },
+		{ "sound", "holy8", "神聖8" },
+		{ "monster", "샤크", "シャーク" },
+		{ "sound", "damage2", "ダメージ2" },
+		{ "music", "tower 2", "塔2" },
+		{ "music", "item", "jアイテム" },
+		{ "sound", "numbness1", "しびれ1" },
+		{ "sound", "노려봄", "にらみ" },
+		{ "sound", "물6", "水6" },
+		{ "sound", "즈음하고1", "あたり1" },
+		{ "sound", "disappearance2", "消滅2" },
+		{ "music", "2003adventurers", "2003冒険者たち" },
+		{ "sound", "kill8", "斬る8" },
+		{ "monster", "scylla", "スキュラ" },
+		{ "music", "lonewolf", "2003孤独な旅立ち" },
+		{ "battlecharset", "chinese man a", "中華男a" },
+		{ "sound", "fog2", "霧2" },
+		{ "battle", "paralyze2", "麻痺" },
+		{ "music", "J팡파르1", "Jファンファーレ1" },
+		{ "sound", "소생2", "蘇生2" },
+		{ "monster", "suzaku", "朱雀" },
+		{ "sound", "water4", "水4" },
+		{ "sound", "양", "ひつじ" },
+		{ "battlecharset", "엘프男 b", "エルフ男b" },
+		{ "battlecharset", "female fighter b", "格闘家女b" },
+		{ "music", "2003terribledream", "2003緊迫" },
+		{ "sound", "chaos", "混乱" },
+		{ "battlecharset", "woman2 a", "女性２a" },
+		{ "sound", "물2", "水2" },
+		{ "monster", "자이언트", "ジャイアント" },
+		{ "music", "se2003people", "se2003雑踏" },
+		{ "monster", "슬라임", "スライム" },
+		{ "music", "밭두둑3", "町3" },
+		{ "music", "2003memoryofinfancy", "2003幼少の記憶" },
+		{ "battle", "소생", "蘇生" },
+		{ "music", "se-ocean", "se海" },
+		{ "sound", "punch4", "打撃4" },
+		{ "monster", "many-domeduglycreature", "ヒュドラ" },
+		{ "battlecharset", "남성５b", "男性５b" },
+		{ "battle", "misc2", "2003その他2" },
+		{ "sound", "kill3", "斬る3" },
+		{ "music", "지하감옥3", "ダンジョン3" },
+		{ "sound", "호흡", "ブレス" },
+		{ "monster", "levitan", "ウロボロス" },
+		{ "music", "dungeon 4", "ダンジョン4" },
+		{ "monster", "girl6", "カーミラ" },
+		{ "backdrop", "snowcanyon", "岩場" },
+		{ "sound", "wave2", "音波2" },
+		{ "battlecharset", "chinesewomanb", "中華女b" },
+		{ "battle", "revive2", "蘇生" },
+		{ "sound", "darkness4", "暗黒4" },
+		{ "battlecharset", "cikuaa", "女性２a" },
+		{ "battlecharset", "ninjawomanb", "忍者女b" },
+		{ "monster", "greendragon2", "龍" },
+		{ "monster", "레이스", "レイス" },
+		{ "monster", "carbunkle", "カーバンクル" },
+		{ "sound", "고양이", "ネコ" },
+		{ "sound", "비1", "雨1" },
+		{ "music", "2003townbar", "2003街の酒場" },
+		{ "sound", "tiger", "トラ" },
+		{ "sound", "화염7", "炎7" },
+		{ "sound", "confuse", "混乱" },
+		{ "battle", "2003addition1", "2003その他1" },
+		{ "battlecharset", "womanéqb", "女性２b" },
+		{ "charset", "actor3", "主人公3" },
+		{ "monster", "워울프", "ワーウルフ" },
+		{ "music", "march", "2003小さな兵隊のマーチ" },
+		{ "monster", "cojurer", "カーミラ" },
+		{ "music", "dungeon1", "ダンジョン1" },
+		{ "music", "field4", "フィールド4" },
+		{ "monster", "네벤테스", "ネペンテス" },
+		{ "charset", "chara2", "主人公2" },
+		{ "backdrop", "던젼３", "ダンジョン３" },
+		{ "sound", "song", "歌" },
+		{ "sound", "earth4", "大地4" },
+		{ "monster", "giant", "ジャイアント" },
+		{ "sound", "numbness3", "しびれ3" },
+		{ "sound", "fire2", "炎2" },
+		{ "battlecharset", "남성５a", "男性５a" },
+		{ "panorama", "strangespacial", "異空間" },
+		{ "backdrop", "양관(서양식집)", "洋館" },
+		{ "battlecharset", "male fighter b", "格闘家男b" },
+		{ "sound", "explode7", "爆発7" },
+		{ "battlecharset", "woman2 b", "女性２b" },
+		{ "music", "2003sunnyvillage", "2003日だまりの村" },
+		{ "battlecharset", "중화女b", "中華女b" },
+		{ "backdrop", "mansion", "洋館" },
+		{ "sound", "holy4", "神聖4" },
+		{ "music", "ship3", "船3" },
+		{ "music", "지하감옥1", "ダンジョン1" },
+		{ "battlecharset", "heromana", "勇者男a" },
+		{ "battle", "earth", "大地" },
+		{ "monster", "스콜피온", "スコーピオン" },
+		{ "backdrop", "forest2", "森２" },
+		{ "sound", "heal2", "回復2" },
+		{ "monster", "미이라 男", "ミイラ男" },
+		{ "sound", "switch2", "スイッチ2" },
+		{ "battlecharset", "pirate-f-1", "海賊女a" },
+		{ "battlecharset", "해적男b", "海賊男b" },
+		{ "music", "2003icelabyrinth", "2003氷のラビリンス" },
+		{ "music", "2003패닉", "2003パニック" },
+		{ "sound", "fire6", "炎6" },
+		{ "battle", "2003폭발", "2003爆発" },
+		{ "battle", "2003 Paralysis", "2003麻痺" },
+		{ "monster", "cloakdemon", "ネクロマンサー" },
+		{ "battle", "arrow", "矢" },
+		{ "battlecharset", "ginnyb", "忍者女b" },
+		{ "battlecharset", "herowomanb", "勇者女b" },
+		{ "monster", "mammoth", "マンモス" },
+		{ "battlecharset", "ninjamanb", "忍者男b" },
+		{ "battlecharset", "ninja-m-1", "忍者男a" },
+		{ "monster", "toad", "トード" },
+		{ "sound", "cold6", "冷気6" },
+		{ "battlecharset", "woman1-1", "女性１a" },
+		{ "sound", "explode5", "爆発5" },
+		{ "monster", "골렘", "ゴーレム" },
+		{ "monster", "flyingdemon", "デーモン" },
+		{ "sound", "ice05", "冷気3" },
+		{ "monster", "snake", "スネーク" },
+		{ "sound", "punch7", "打撃7" },
+		{ "music", "calm", "2003静寂" },
+		{ "sound", "damage1", "ダメージ1" },
+		{ "chipset", "외견", "外観" },
+		{ "battlecharset", "woman2-1", "女性２a" },
+		{ "monster", "earwig", "バジリスク" },
+		{ "monster", "crawler", "クロウラー" },
+		{ "music", "mecha-base", "2003機械要塞" },
+		{ "music", "se2003birds", "se2003鳥" },
+		{ "charset", "오브젝트1", "オブジェクト1" },
+		{ "sound", "darkness2", "暗黒2" },
+		{ "sound", "sword1", "剣1" },
+		{ "battle", "holy1", "2003神聖" },
+		{ "music", "arena", "2003コロシアム" },
+		{ "music", "탑2", "塔2" },
+		{ "sound", "shot2", "ショット2" },
+		{ "music", "배3", "船3" },
+		{ "sound", "flashlight3", "フラッシュ3" },
+		{ "monster", "carmira", "カーミラ" },
+		{ "monster", "oroboros", "ウロボロス" },
+		{ "battlecharset", "남성４a", "男性４a" },
+		{ "monster", "multihandswarrior", "リリス" },
+		{ "sound", "벤다2", "斬る2" },
+		{ "backdrop", "다리", "橋" },
+		{ "panorama", "sky2", "空2" },
+		{ "battlecharset", "priest1", "僧侶男a" },
+		{ "faceset", "hero2", "主人公2" },
+		{ "monster", "gorgon", "ゴーゴン" },
+		{ "music", "town3", "町3" },
+		{ "monster", "드래곤", "ドラゴン" },
+		{ "sound", "플래시1", "フラッシュ1" },
+		{ "battlecharset", "mage-f-2", "魔術師女b" },
+		{ "sound", "점프1", "ジャンプ1" },
+		{ "sound", "blow1", "打撃1" },
+		{ "music", "2003exploring ruins", "2003遺跡探索" },
+		{ "battlecharset", "woman3 a", "女性３a" },
+		{ "monster", "angel", "セラフィム" },
+		{ "monster", "sahagin", "サハギン" },
+		{ "chipset", "ship", "船" },
+		{ "battle", "axe2", "斧" },
+		{ "backdrop", "space", "異空間" },
+		{ "music", "SE2003정글", "SE2003ジャングル" },
+		{ "battlecharset", "grapplehousewomanb", "格闘家女b" },
+		{ "music", "전투1", "戦闘1" },
+		{ "sound", "회복3", "回復3" },
+		{ "battlecharset", "승려男a", "僧侶男a" },
+		{ "sound", "explode1", "爆発1" },
+		{ "monster", "aquamen", "マーマン" },
+		{ "battlecharset", "elf-m-1", "エルフ男a" },
+		{ "monster", "용", "龍" },
+		{ "monster", "스펙터", "スペクター" },
+		{ "sound", "fall1", "落ちる1" },
+		{ "sound", "wind4", "風4" },
+		{ "monster", "darkhorse", "馬" },
+		{ "battlecharset", "garrea", "侍a" },
+		{ "monster", "gargoyle", "ガーゴイル" },
+		{ "sound", "collapse2", "消滅2" },
+		{ "monster", "satan", "サタナエル" },
+		{ "battle", "2003 barrier", "2003バリア" },
+		{ "monster", "드래곤 나이트", "ドラゴンナイト" },
+		{ "monster", "kobold", "コボルト" },
+		{ "sound", "paralyze1", "しびれ1" },
+		{ "battlecharset", "전사女b", "戦士女b" },
+		{ "music", "2003happiness", "2003いやしの泉" },
+		{ "music", "2003palace party", "2003王宮のパーティー" },
+		{ "monster", "미믹", "ミミック" },
+		{ "sound", "cut4", "斬る4" },
+		{ "sound", "lion", "ライオン" },
+		{ "monster", "crossedbeast", "マンティコア" },
+		{ "music", "se-alarm", "se2003アラーム" },
+		{ "music", "opening 1", "オープニング1" },
+		{ "battlecharset", "eljeaa", "戦士女a" },
+		{ "title", "title3", "タイトル3" },
+		{ "system2", "system2a", "システム２a" },
+		{ "battlecharset", "chinga", "中華男a" },
+		{ "sound", "strike06", "斬る6" },
+		{ "system2", "system2c", "システム２c" },
+		{ "sound", "ice9", "冷気9" },
+		{ "battle", "misc1", "2003その他1" },
+		{ "monster", "carmilla", "カーミラ" },
+		{ "battlecharset", "manétb", "男性５b" },
+		{ "music", "2003forestoffantasy", "2003夢幻の森" },
+		{ "sound", "heal7", "回復7" },
+		{ "sound", "fire4", "炎4" },
+		{ "charset", "일반5", "一般5" },
+		{ "backdrop", "stalagmites", "ダンジョン４" },
+		{ "backdrop", "town", "街中" },
+		{ "backdrop", "westernstylebuilding", "洋館" },
+		{ "sound", "대지4", "大地4" },
+		{ "music", "끝1", "エンディング1" },
+		{ "monster", "hero2", "カーミラ" },
+		{ "sound", "failure2", "はずれ2" },
+		{ "sound", "strike04", "斬る4" },
+		{ "music", "jackpot", "2003一獲千金の夢" },
+		{ "monster", "사이클롭스", "サイクロプス" },
+		{ "sound", "decision2", "決定2" },
+		{ "music", "sad", "悲しみ" },
+		{ "sound", "폭발2", "爆発2" },
+		{ "music", "2003healing spring", "2003いやしの泉" },
+		{ "charset", "hero2", "主人公2" },
+		{ "music", "게임오버2", "ゲームオーバー2" },
+		{ "battlecharset", "female pirate b", "海賊女b" },
+		{ "backdrop", "strange", "異空間" },
+		{ "music", "church", "教会" },
+		{ "monster", "hydra", "ヒュドラ" },
+		{ "battle", "healing1", "2003回復" },
+		{ "sound", "earth8", "大地8" },
+		{ "monster", "witch1", "ソーサラー" },
+		{ "backdrop", "brickcave5", "ダンジョン５" },
+		{ "battle", "2003기타1", "2003その他1" },
+		{ "backdrop", "sea", "海" },
+		{ "sound", "지진1", "地震1" },
+		{ "monster", "quetzalcoatl", "ケツアルクアトル" },
+		{ "backdrop", "donjohn1", "ダンジョン１" },
+		{ "battle", "remedy", "治療" },
+		{ "monster", "daemon", "デーモン" },
+		{ "sound", "dark6", "暗黒6" },
+		{ "battlecharset", "전사女a", "戦士女a" },
+		{ "battlecharset", "grapplehousemanb", "格闘家男b" },
+		{ "charset", "women1", "一般5" },
+		{ "monster", "birdsnake", "ケツアルクアトル" },
+		{ "battlecharset", "siossb", "僧侶男b" },
+		{ "sound", "바다1", "海1" },
+		{ "battlecharset", "pirateb", "海賊男b" },
+		{ "battlecharset", "승려女b", "僧侶女b" },
+		{ "sound", "벤다3", "斬る3" },
+		{ "music", "fanfare1", "jファンファーレ1" },
+		{ "music", "mischief1", "jギャグ1" },
+		{ "music", "intro", "2003戦いの幕開け" },
+		{ "monster", "켈베로스", "ケルベロス" },
+		{ "monster", "necromancer", "ネクロマンサー" },
+		{ "battle", "nail", "爪" },
+		{ "monster", "zombie", "ゾンビ" },
+		{ "battle", "2003타격", "2003打撃" },
+		{ "backdrop", "sandybeach", "砂浜" },
+		{ "monster", "tree", "トレント" },
+		{ "battle", "2003브레스", "2003ブレス" },
+		{ "chipset", "village", "外観" },
+		{ "backdrop", "도로 위", "路上" },
+		{ "music", "밭두둑1", "町1" },
+		{ "sound", "대지1", "大地1" },
+		{ "monster", "demon", "デーモン" },
+		{ "sound", "vanish1", "消滅1" },
+		{ "battle", "2003-angel", "2003蘇生" },
+		{ "battlecharset", "monk-m-2", "格闘家男b" },
+		{ "music", "victory4", "j戦闘終了4" },
+		{ "sound", "바람3", "風3" },
+		{ "battlecharset", "xeoda", "忍者男a" },
+		{ "chipset", "internal2", "内装" },
+		{ "music", "2003일획천금의 꿈", "2003一獲千金の夢" },
+		{ "backdrop", "shrine", "お寺" },
+		{ "backdrop", "oldurban", "旧市街" },
+		{ "sound", "cursor2", "カーソル2" },
+		{ "charset", "crown7", "動物" },
+		{ "charset", "protagonist3", "主人公3" },
+		{ "monster", "오거", "オーガ" },
+		{ "music", "SE지진", "SE地震" },
+		{ "backdrop", "shipdeck", "船上" },
+		{ "sound", "결정2", "決定2" },
+		{ "sound", "cat", "ネコ" },
+		{ "sound", "wind07", "風7" },
+		{ "battle", "2003thunder", "2003雷" },
+		{ "sound", "전격4", "雷4" },
+		{ "battlecharset", "마술사男b", "魔術師男b" },
+		{ "battle", "whip", "鞭" },
+		{ "monster", "jack", "ジャック・オー・ランタン" },
+		{ "music", "peace1", "安らぎ1" },
+		{ "monster", "efrit", "イフリート" },
+		{ "monster", "levitanwithahorn", "リヴァイアサン" },
+		{ "sound", "dark1", "暗黒1" },
+		{ "sound", "switch1", "スイッチ1" },
+		{ "monster", "golem", "ゴーレム" },
+		{ "charset", "protagonist4", "主人公4" },
+		{ "battlecharset", "pirate-m-2", "海賊男b" },
+		{ "battlecharset", "thief-m-2", "盗賊男b" },
+		{ "sound", "바다2", "海2" },
+		{ "sound", "success2", "あたり2" },
+		{ "music", "j2003horn", "j2003ホルン" },
+		{ "faceset", "peopleanimal", "一般2" },
+		{ "panorama", "dusk2", "夕焼け2" },
+		{ "sound", "bolt05", "雷5" },
+		{ "battle", "up", "上昇" },
+		{ "battlecharset", "man4 a", "男性４a" },
+		{ "monster", "greendragon1", "ドラゴン" },
+		{ "sound", "공격1", "攻撃1" },
+		{ "sound", "전격10", "雷10" },
+		{ "music", "마왕", "魔王" },
+		{ "monster", "키메라", "キメラ" },
+		{ "backdrop", "bathhouse", "銭湯" },
+		{ "music", "2003villageofravines", "2003山あいの村" },
+		{ "music", "J팡파르5", "Jファンファーレ5" },
+		{ "music", "2003bigpalace", "2003勇者の凱旋" },
+		{ "system", "system1", "システム" },
+		{ "battle", "2003신성", "2003神聖" },
+		{ "monster", "granny", "ラクシュミ" },
+		{ "music", "2003drops", "2003氷のラビリンス" },
+		{ "battlecharset", "mjitta", "男性２a" },
+		{ "sound", "안개2", "霧2" },
+		{ "monster", "minotaur", "ミノタウロス" },
+		{ "sound", "지진2", "地震2" },
+		{ "battle", "water1", "2003水" },
+		{ "backdrop", "rocks", "岩場" },
+		{ "monster", "monitorlizard", "リザード" },
+		{ "battlecharset", "magicteacherwomana", "魔術師女a" },
+		{ "battle", "검1", "剣1" },
+		{ "backdrop", "cityhouse", "街中" },
+		{ "sound", "strike10", "斬る10" },
+		{ "music", "ride1", "乗り物1" },
+		{ "monster", "카트바", "カッパ" },
+		{ "sound", "sound wave1", "音波1" },
+		{ "music", "jend of battle 3", "j戦闘終了3" },
+		{ "battlecharset", "armored warror a", "鎧武者a" },
+		{ "battle", "earth2", "大地" },
+		{ "sound", "recovery4", "回復4" },
+		{ "battlecharset", "male elf a", "エルフ男a" },
+		{ "battlecharset", "woman3-2", "女性３b" },
+		{ "music", "fanfare2", "jファンファーレ2" },
+		{ "battle", "fire1", "炎1" },
+		{ "music", "배2", "船2" },
+		{ "battlecharset", "samurai b", "侍b" },
+		{ "monster", "만티스", "マンティス" },
+		{ "music", "보스1", "ボス1" },
+		{ "sound", "rebirth3", "蘇生3" },
+		{ "sound", "바람4", "風4" },
+		{ "sound", "gaze", "にらみ" },
+		{ "sound", "전격9", "雷9" },
+		{ "panorama", "dimension rift", "異空間" },
+		{ "monster", "medusa", "メデューサ" },
+		{ "faceset", "people", "一般1" },
+		{ "music", "J팡파르2", "Jファンファーレ2" },
+		{ "music", "dungeon 1", "ダンジョン1" },
+		{ "music", "2003dangerousfog", "2003戦いの幕開け" },
+		{ "faceset", "chara2", "主人公2" },
+		{ "battle", "fire3", "炎2" },
+		{ "charset", "monsters1", "モンスター1" },
+		{ "monster", "king", "タイタン" },
+		{ "battle", "2003 cure", "2003治療" },
+		{ "monster", "lostsoul", "スペクター" },
+		{ "sound", "choice2", "決定2" },
+		{ "music", "J의혹", "J疑惑" },
+		{ "faceset", "face2", "主人公2" },
+		{ "battlecharset", "man3-2", "男性３b" },
+		{ "battlecharset", "piratewomana", "海賊女a" },
+		{ "battlecharset", "priest2", "僧侶男b" },
+		{ "music", "ship2", "船2" },
+		{ "music", "고스트 타운1", "ゴーストタウン1" },
+		{ "sound", "텔레포트2", "テレポート2" },
+		{ "music", "2003colosseum", "2003コロシアム" },
+		{ "music", "ending1", "エンディング1" },
+		{ "music", "se2003bustle", "se2003雑踏" },
+		{ "battlecharset", "chinesewomana", "中華女a" },
+		{ "monster", "eremite", "ケットシー" },
+		{ "battlecharset", "shella", "男性４a" },
+		{ "battle", "2003채찍", "2003鞭" },
+		{ "music", "2003사이버 시티", "2003サイバーシティ" },
+		{ "music", "신비2", "神秘2" },
+		{ "chipset", "internal1", "ダンジョン" },
+		{ "music", "2003여행자 서고", "2003冒険者たち" },
+		{ "backdrop", "wasteruins", "廃墟" },
+		{ "music", "village3", "村3" },
+		{ "monster", "shadow", "シャドウ" },
+		{ "battle", "explode1", "2003爆発" },
+		{ "backdrop", "구시가지", "旧市街" },
+		{ "music", "오프닝1", "オープニング1" },
+		{ "sound", "스위치2", "スイッチ2" },
+		{ "music", "2003little army's march", "2003小さな兵隊のマーチ" },
+		{ "sound", "음파2", "音波2" },
+		{ "music", "repose 2", "安らぎ2" },
+		{ "battle", "2003-sun", "2003回復" },
+		{ "music", "보스2", "ボス2" },
+		{ "sound", "annihilation1", "消滅1" },
+		{ "music", "airborne", "2003大空への翼" },
+		{ "chipset", "world", "基本" },
+		{ "sound", "화염4", "炎4" },
+		{ "sound", "kill1", "斬る1" },
+		{ "music", "opening 3", "オープニング3" },
+		{ "monster", "코볼트", "コボルト" },
+		{ "battle", "2003sword", "2003剣" },
+		{ "battle", "2003 blow", "2003打撃" },
+		{ "sound", "laser1", "ショット1" },
+		{ "music", "village 3", "村3" },
+		{ "battlecharset", "otipab", "盗賊女b" },
+		{ "music", "jfanfare6", "jファンファーレ6" },
+		{ "monster", "리치", "リッチ" },
+		{ "sound", "raise3", "蘇生3" },
+		{ "battle", "2003-water", "2003水" },
+		{ "monster", "dragon", "ドラゴン" },
+		{ "sound", "마법2", "魔法2" },
+		{ "sound", "회피1", "回避1" },
+		{ "sound", "노크", "ノック" },
+		{ "battle", "2003검", "2003剣" },
+		{ "sound", "bite", "噛む" },
+		{ "battle", "thunder", "雷" },
+		{ "monster", "버저커", "バーサーカー" },
+		{ "battlecharset", "female ninja b", "忍者女b" },
+		{ "music", "2003기억의 저쪽에", "2003記憶の彼方に" },
+		{ "battle", "타격", "打撃" },
+		{ "sound", "absorption2", "吸収2" },
+		{ "battlecharset", "shellb", "男性４b" },
+		{ "chipset", "chipset1", "ダンジョン" },
+		{ "battlecharset", "도적男a", "盗賊男a" },
+		{ "sound", "heal5", "回復5" },
+		{ "music", "dungeon 3", "ダンジョン3" },
+		{ "monster", "griphon", "グリフォン" },
+		{ "music", "2003unmannedmansion", "2003無人の館" },
+		{ "battlecharset", "man5 b", "男性５b" },
+		{ "battle", "2003ground", "2003大地" },
+		{ "panorama", "empty2", "空2" },
+		{ "monster", "케이시아르크 아토르", "ケツアルクアトル" },
+		{ "music", "eviltown", "闇市" },
+		{ "music", "devil", "魔王" },
+		{ "battlecharset", "해적男a", "海賊男a" },
+		{ "music", "serainy", "se雨" },
+		{ "music", "2003church", "2003教会" },
+		{ "sound", "회복8", "回復8" },
+		{ "music", "vehicle1", "乗り物1" },
+		{ "backdrop", "던젼４", "ダンジョン４" },
+		{ "battle", "water", "水" },
+		{ "battle", "addition", "その他" },
+		{ "panorama", "empty1", "空1" },
+		{ "battle", "2003addition2", "2003その他2" },
+		{ "battle", "ice", "冷気" },
+		{ "monster", "주작", "朱雀" },
+		{ "monster", "flyingworm", "ケツアルクアトル" },
+		{ "battlecharset", "woman1-2", "女性１b" },
+		{ "charset", "people4", "一般4" },
+		{ "panorama", "planet1", "惑星1" },
+		{ "music", "2003travel", "2003街の酒場" },
+		{ "battlecharset", "male pirate a", "海賊男a" },
+		{ "sound", "strike05", "斬る5" },
+		{ "monster", "기린", "麒麟" },
+		{ "battle", "2003paralysis", "2003麻痺" },
+		{ "sound", "earth7", "大地7" },
+		{ "monster", "giant-2", "ジャイアント" },
+		{ "sound", "전투1", "戦闘1" },
+		{ "panorama", "sunset1", "夕焼け1" },
+		{ "monster", "페러사이트", "パラサイト" },
+		{ "monster", "실프", "シルフ" },
+		{ "monster", "fish", "レモラ" },
+		{ "system2", "시스템２c", "システム２c" },
+		{ "sound", "explode4", "爆発4" },
+		{ "music", "2003silentcrying", "2003無人の館" },
+		{ "chipset", "dungeon", "ダンジョン" },
+		{ "panorama", "galaxy", "宇宙" },
+		{ "battlecharset", "elf-m-2", "エルフ男b" },
+		{ "battle", "2003 revive", "2003蘇生" },
+		{ "battle", "holy2", "神聖" },
+		{ "music", "2003triumphalreturn", "2003勇者の凱旋" },
+		{ "battlecharset", "heromanb", "勇者男b" },
+		{ "music", "2003waltz of blessings", "2003祝福ワルツ" },
+		{ "music", "성2", "城2" },
+		{ "sound", "시계", "時計" },
+		{ "monster", "sphynx", "スフィンクス" },
+		{ "battle", "2003전격", "2003雷" },
+		{ "faceset", "주인공2", "主人公2" },
+		{ "sound", "sandmind", "砂けむり" },
+		{ "backdrop", "sanctuary", "神殿" },
+		{ "battlecharset", "rasnenb", "格闘家男b" },
+		{ "chipset", "town", "外観" },
+		{ "panorama", "하늘1", "空1" },
+		{ "sound", "disappearance1", "消滅1" },
+		{ "music", "battle 2", "戦闘2" },
+		{ "monster", "ahriman", "アーリマン" },
+		{ "music", "2003creeping darkness", "2003忍び寄る闇" },
+		{ "battlecharset", "ginnya", "忍者女a" },
+		{ "sound", "bolt04", "雷4" },
+		{ "battlecharset", "grapplehousewomana", "格闘家女a" },
+		{ "monster", "히드라", "ヒュドラ" },
+		{ "backdrop", "poisonswamp", "毒沼" },
+		{ "battle", "barrier1", "2003バリア" },
+		{ "charset", "몬스터1", "モンスター1" },
+		{ "panorama", "night1", "夜空1" },
+		{ "sound", "explode6", "爆発6" },
+		{ "sound", "wind10", "風10" },
+		{ "monster", "many-domeddragon", "ティアマット" },
+		{ "system", "시스템b", "システムb" },
+		{ "sound", "horse", "ウマ" },
+		{ "music", "field2", "フィールド2" },
+		{ "music", "serain2", "se大雨" },
+		{ "battlecharset", "chinese-m-2", "中華男b" },
+		{ "music", "2003workingmusic", "2003妖精の森" },
+		{ "battle", "2003-fire", "2003炎" },
+		{ "faceset", "protagonist1", "主人公1" },
+		{ "music", "2003grief", "2003大聖堂" },
+		{ "battlecharset", "jikuab", "女性２b" },
+		{ "sound", "blow4", "打撃4" },
+		{ "battlecharset", "womanésb", "女性４b" },
+		{ "battle", "shock", "打撃" },
+		{ "sound", "sword2", "剣2" },
+		{ "monster", "imp", "インプ" },
+		{ "music", "2003young memories", "2003幼少の記憶" },
+		{ "charset", "general4", "一般4" },
+		{ "music", "2003대혼전", "2003大混戦" },
+		{ "monster", "bee", "ホーネット" },
+		{ "music", "2003casino indulgence", "2003カジノ三昧" },
+		{ "sound", "wind6", "風6" },
+		{ "battlecharset", "thiefmanb", "盗賊男b" },
+		{ "panorama", "morning2", "空2" },
+		{ "music", "2003farewell", "2003冒険者たち" },
+		{ "sound", "thunder10", "雷10" },
+		{ "sound", "debuff", "ダウン" },
+		{ "battlecharset", "female hero b", "勇者女b" },
+		{ "panorama", "밤하늘1", "夜空1" },
+		{ "sound", "earth5", "大地5" },
+		{ "music", "승리", "勝利" },
+		{ "battle", "2003 earth", "2003大地" },
+		{ "music", "ghost town 2", "ゴーストタウン2" },
+		{ "music", "전투2", "戦闘2" },
+		{ "sound", "회복6", "回復6" },
+		{ "battlecharset", "chingb", "中華男b" },
+		{ "music", "adventure", "2003冒険者たち" },
+		{ "music", "차량3", "乗り物3" },
+		{ "sound", "cansel1", "キャンセル1" },
+		{ "sound", "cold4", "冷気4" },
+		{ "faceset", "people1", "一般1" },
+		{ "sound", "strike02", "斬る2" },
+		{ "sound", "bell", "鐘" },
+		{ "sound", "침묵", "沈黙" },
+		{ "battle", "2003absorption", "2003吸収" },
+		{ "music", "empire", "2003帝国〜エンパイア" },
+		{ "sound", "earth08", "大地8" },
+		{ "system2", "systeméqb", "システム２b" },
+		{ "monster", "ketsea", "ケットシー" },
+		{ "music", "haunted", "2003無人の館" },
+		{ "music", "ending 3", "エンディング3" },
+		{ "music", "in a pinch", "ピンチ" },
+		{ "battlecharset", "beruab", "女性５b" },
+		{ "sound", "wind7", "風7" },
+		{ "music", "2003유적 탐색", "2003遺跡探索" },
+		{ "battle", "2003베리어", "2003バリア" },
+		{ "monster", "raincoat", "カッパ" },
+		{ "music", "battleend1", "j戦闘終了1" },
+		{ "sound", "wind9", "風9" },
+		{ "sound", "wind2", "風2" },
+		{ "charset", "hero1", "主人公1" },
+		{ "sound", "암흑6", "暗黒6" },
+		{ "monster", "vainbird", "朱雀" },
+		{ "sound", "몬스터1", "モンスター1" },
+		{ "music", "casino", "2003カジノ三昧" },
+		{ "sound", "흡수1", "吸収1" },
+		{ "monster", "boy3", "ソーサラー" },
+		{ "backdrop", "donjohnr", "ダンジョン３" },
+		{ "battlecharset", "manépa", "男性１a" },
+		{ "sound", "냉기3", "冷気3" },
+		{ "sound", "downgrade", "ダウン" },
+		{ "music", "2003areaofdecisivebattles", "2003決戦の地" },
+		{ "backdrop", "grassyplain", "草原" },
+		{ "music", "2003sorrow", "2003悲しみ" },
+		{ "music", "battleend4", "j戦闘終了4" },
+		{ "battle", "flame2", "炎2" },
+		{ "sound", "explosion6", "爆発6" },
+		{ "battle", "strike", "2003打撃" },
+		{ "monster", "캐트시", "ケットシー" },
+		{ "battlecharset", "woman3 b", "女性３b" },
+		{ "music", "interlude", "2003穏やかな風" },
+		{ "sound", "fight2", "戦闘2" },
+		{ "sound", "타격4", "打撃4" },
+		{ "music", "boss 3", "ボス3" },
+		{ "music", "se2003ding", "se2003アラーム" },
+		{ "battle", "암흑", "暗黒" },
+		{ "sound", "flame1", "炎1" },
+		{ "system", "systemc", "システムc" },
+		{ "sound", "sleep", "睡眠" },
+		{ "sound", "폭발1", "爆発1" },
+		{ "music", "se-rain", "se雨" },
+		{ "music", "crisis", "ピンチ" },
+		{ "monster", "hypermedusa", "メデューサ" },
+		{ "sound", "ice09", "冷気7" },
+		{ "sound", "failure1", "はずれ1" },
+		{ "backdrop", "seabeach", "砂浜" },
+		{ "music", "SE2003알람", "SE2003アラーム" },
+		{ "sound", "flame2", "炎2" },
+		{ "music", "2003andagainpleasure", "2003帝国〜エンパイア" },
+		{ "music", "2003win", "j2003ホルン" },
+		{ "battlecharset", "hero-f-2", "勇者女b" },
+		{ "music", "se2003bird", "se2003鳥" },
+		{ "music", "jinn2", "j宿2" },
+		{ "sound", "bump1", "壁1" },
+		{ "sound", "blow5", "打撃5" },
+		{ "monster", "phantom", "レイス" },
+		{ "battle", "기타", "その他" },
+		{ "sound", "revival1", "蘇生1" },
+		{ "sound", "earth02", "大地2" },
+		{ "battlecharset", "chinese woman b", "中華女b" },
+		{ "monster", "ifrit", "イフリート" },
+		{ "music", "get", "勝利" },
+		{ "sound", "ice02", "冷気10" },
+		{ "music", "2003고독한 여행", "2003孤独な旅立ち" },
+		{ "battle", "검2", "剣2" },
+		{ "battlecharset", "ninja-f-1", "忍者女a" },
+		{ "sound", "dark5", "暗黒5" },
+		{ "charset", "vehicles", "乗り物" },
+		{ "sound", "바람10", "風10" },
+		{ "battlecharset", "man2-1", "男性２a" },
+		{ "battlecharset", "kloria", "僧侶女a" },
+		{ "monster", "gnome", "オーガ" },
+		{ "music", "요정2", "妖精2" },
+		{ "music", "doubt", "j疑惑" },
+		{ "music", "jdoubt", "j疑惑" },
+		{ "sound", "몬스터2", "モンスター2" },
+		{ "monster", "magician", "ソーサラー" },
+		{ "music", "2003대공의 날개", "2003大空への翼" },
+		{ "music", "repose 3", "安らぎ3" },
+		{ "music", "SE비", "SE雨" },
+		{ "battlecharset", "samurai2", "侍b" },
+		{ "music", "2003fairytale", "2003幼少の記憶" },
+		{ "battlecharset", "monkwomana", "僧侶女a" },
+		{ "sound", "wind1", "風1" },
+		{ "sound", "발판", "ウマ" },
+		{ "battleweapon", "weapons", "武器" },
+		{ "music", "편안해짐2", "安らぎ2" },
+		{ "faceset", "monsters", "モンスター" },
+		{ "music", "seheavyrain", "se大雨" },
+		{ "music", "J개그1", "Jギャグ1" },
+		{ "music", "2003calmwind", "2003穏やかな風" },
+		{ "sound", "monster2", "モンスター2" },
+		{ "chipset", "donjohn", "ダンジョン" },
+		{ "sound", "shot1", "ショット1" },
+		{ "sound", "wind02", "風2" },
+		{ "charset", "crown3", "モンスター1" },
+		{ "panorama", "우주", "宇宙" },
+		{ "sound", "벤다9", "斬る9" },
+		{ "backdrop", "바위", "岩場" },
+		{ "panorama", "eveningglow1", "夕焼け1" },
+		{ "monster", "nepenthes", "ネペンテス" },
+		{ "music", "J아이템", "Jアイテム" },
+		{ "backdrop", "dungeon2", "ダンジョン２" },
+		{ "monster", "옥토퍼스", "オクトパス" },
+		{ "sound", "sonic2", "音波2" },
+		{ "sound", "bloodsuck", "噛む" },
+		{ "monster", "dragonwarrior", "ドラゴンナイト" },
+		{ "system", "시스템a", "システムa" },
+		{ "music", "암시장", "闇市" },
+		{ "sound", "ice3", "冷気3" },
+		{ "sound", "바람2", "風2" },
+		{ "music", "jaggressiveend3", "j戦闘終了3" },
+		{ "sound", "ensnare", "巻き付き" },
+		{ "music", "victory3", "j戦闘終了3" },
+		{ "sound", "strike11", "斬る11" },
+		{ "sound", "buzzer4", "ブザー2" },
+		{ "battlecharset", "xeodb", "忍者男b" },
+		{ "sound", "자물쇠", "鍵" },
+		{ "sound", "점프2", "ジャンプ2" },
+		{ "battle", "rod", "鞭" },
+		{ "sound", "cut10", "斬る10" },
+		{ "sound", "explosion5", "爆発5" },
+		{ "sound", "kill10", "斬る10" },
+		{ "backdrop", "mountain", "山道" },
+		{ "battlecharset", "noddab", "勇者女b" },
+		{ "backdrop", "insidecastle", "洋館" },
+		{ "sound", "jump2", "ジャンプ2" },
+		{ "music", "2003fairy forest", "2003妖精の森" },
+		{ "monster", "켄타우르스", "ケンタウロス" },
+		{ "charset", "men1", "一般4" },
+		{ "monster", "turtlesnake", "玄武" },
+		{ "monster", "코카트리스", "コカトリス" },
+		{ "sound", "ice4", "冷気4" },
+		{ "music", "jinn 2", "j宿2" },
+		{ "battlecharset", "soldier-f-2", "戦士女b" },
+		{ "monster", "스피릿츠", "スピリッツ" },
+		{ "monster", "lizarddemon", "バハムート" },
+		{ "sound", "ice03", "冷気11" },
+		{ "battlecharset", "magicteachermana", "魔術師男a" },
+		{ "battlecharset", "jemmona", "勇者男a" },
+		{ "title", "title1", "タイトル1" },
+		{ "charset", "char3", "一般3" },
+		{ "music", "vehicle 3", "乗り物3" },
+		{ "monster", "monster", "マンティコア" },
+		{ "music", "gag2", "jギャグ2" },
+		{ "monster", "엘프", "エルフ" },
+		{ "sound", "대지9", "大地9" },
+		{ "monster", "cyclops", "サイクロプス" },
+		{ "monster", "foxofninetails", "九尾の狐" },
+		{ "music", "town1", "町1" },
+		{ "sound", "barrier1", "壁1" },
+		{ "battle", "2003-barrier", "2003バリア" },
+		{ "monster", "카방클", "カーバンクル" },
+		{ "monster", "weaponmaster", "アスラ" },
+		{ "sound", "item1", "アイテム1" },
+		{ "sound", "success1", "あたり1" },
+		{ "music", "도둑", "泥棒" },
+		{ "sound", "numbness2", "しびれ2" },
+		{ "sound", "slash11", "斬る11" },
+		{ "sound", "트럭", "トラ" },
+		{ "music", "fierce-battle", "2003マキシマム・バトル" },
+		{ "monster", "스테이크", "スネーク" },
+		{ "monster", "mermaid", "ラミア" },
+		{ "battlecharset", "manéra", "男性３a" },
+		{ "sound", "key", "鍵" },
+		{ "backdrop", "greece", "神殿" },
+		{ "battlecharset", "monk-f-1", "格闘家女a" },
+		{ "sound", "decrease", "ダウン" },
+		{ "battlecharset", "elf-f-1", "エルフ女a" },
+		{ "battle", "2003 cold", "2003冷気" },
+		{ "music", "J팡파르6", "Jファンファーレ6" },
+		{ "sound", "confusion", "混乱" },
+		{ "battlecharset", "female mage a", "魔術師女a" },
+		{ "monster", "werewolf", "ワーウルフ" },
+		{ "music", "ordeal", "試練" },
+		{ "sound", "소생1", "蘇生1" },
+		{ "music", "2003marchofsmallsoldiers", "2003小さな兵隊のマーチ" },
+		{ "title", "타이틀4", "タイトル4" },
+		{ "monster", "cait sith", "ケットシー" },
+		{ "monster", "burninglizard", "サラマンダー" },
+		{ "sound", "water5", "水5" },
+		{ "monster", "데몬", "デーモン" },
+		{ "sound", "blow6", "打撃6" },
+		{ "music", "anger", "怒り" },
+		{ "sound", "물3", "水3" },
+		{ "battlecharset", "chuzab", "中華女b" },
+		{ "sound", "ice08", "冷気6" },
+		{ "music", "fairy1", "妖精1" },
+		{ "sound", "신성9", "神聖9" },
+		{ "music", "J전투종료2", "J戦闘終了2" },
+		{ "sound", "fog1", "霧1" },
+		{ "monster", "infernalbull", "ゴーゴン" },
+		{ "music", "jgag1", "jギャグ1" },
+		{ "monster", "horse", "馬" },
+		{ "music", "parting 2", "別れ2" },
+		{ "battle", "2003explosive", "2003爆発" },
+		{ "music", "memories", "2003幼少の記憶" },
+		{ "monster", "byakko", "白虎" },
+		{ "chipset", "chipset2", "内装" },
+		{ "battle", "misc3", "その他" },
+		{ "monster", "dendrid", "トレント" },
+		{ "battle", "2003-absorption", "2003吸収" },
+		{ "sound", "down", "ダウン" },
+		{ "sound", "벽2", "壁2" },
+		{ "music", "foreboding", "2003忍び寄る闇" },
+		{ "monster", "cannibal", "ジャイアント" },
+		{ "sound", "darkness5", "暗黒5" },
+		{ "battle", "하강", "下降" },
+		{ "sound", "벽1", "壁1" },
+		{ "monster", "all-knowing", "パラサイト" },
+		{ "backdrop", "plains", "草原" },
+		{ "music", "2003결전의 땅", "2003決戦の地" },
+		{ "monster", "lamia", "ラミア" },
+		{ "battlecharset", "soldierwomanb", "戦士女b" },
+		{ "sound", "kill9", "斬る9" },
+		{ "music", "2003꿈을 꾸는 기분", "2003夢見心地" },
+		{ "monster", "sephiroth", "セラフィム" },
+		{ "charset", "chubby2", "一般2" },
+		{ "music", "game over 3", "ゲームオーバー3" },
+		{ "battlecharset", "여성５a", "女性５a" },
+		{ "monster", "boy1", "インプ" },
+		{ "sound", "teleport2", "テレポート2" },
+		{ "battlecharset", "man5 a", "男性５a" },
+		{ "battlecharset", "중화女a", "中華女a" },
+		{ "monster", "스쿨라", "スキュラ" },
+		{ "music", "castle 2", "城2" },
+		{ "battlecharset", "monk-f-2", "格闘家女b" },
+		{ "charset", "chara4", "主人公4" },
+		{ "monster", "구미호", "九尾の狐" },
+		{ "sound", "thunder2", "雷2" },
+		{ "music", "ending2", "エンディング2" },
+		{ "battlecharset", "frossb", "男性５b" },
+		{ "sound", "냉기5", "冷気5" },
+		{ "backdrop", "lavacave", "ダンジョン２" },
+		{ "music", "2003왕궁의 파티", "2003王宮のパーティー" },
+		{ "backdrop", "forestq", "森２" },
+		{ "sound", "즈음하고2", "あたり2" },
+		{ "backdrop", "숲２", "森２" },
+		{ "monster", "아리맨", "アーリマン" },
+		{ "sound", "전격3", "雷3" },
+		{ "sound", "마법1", "魔法1" },
+		{ "monster", "worm", "ワーム" },
+		{ "music", "parting2", "別れ2" },
+		{ "chipset", "inner", "内装" },
+		{ "monster", "seraph", "セラフィム" },
+		{ "music", "신비3", "神秘3" },
+		{ "music", "jitem", "jアイテム" },
+		{ "panorama", "planetary2", "惑星2" },
+		{ "sound", "earth3", "大地3" },
+		{ "system", "system", "システム" },
+		{ "monster", "anaconda", "アナコンダ" },
+		{ "music", "2003strangedimensionalcorridor", "2003異次元回廊" },
+		{ "monster", "griffon", "グリフォン" },
+		{ "music", "탑3", "塔3" },
+		{ "battle", "2003spear", "2003槍" },
+		{ "monster", "horned", "バジリスク" },
+		{ "battle", "2003 bow", "2003弓" },
+		{ "music", "church1", "2003教会" },
+		{ "monster", "타란튤라", "タランチュラ" },
+		{ "monster", "poisonzombie", "ゾンビ" },
+		{ "battle", "recovery", "回復" },
+		{ "monster", "vampire", "ヴァンパイア" },
+		{ "music", "2003silentpleasure", "2003一獲千金の夢" },
+		{ "music", "2003serenity", "2003夢見心地" },
+		{ "music", "2003기계 요새", "2003機械要塞" },
+		{ "music", "2003lullaby", "2003スノータウン" },
+		{ "music", "tightspot", "ピンチ" },
+		{ "battlecharset", "male hero a", "勇者男a" },
+		{ "monster", "rakashimi", "ラクシュミ" },
+		{ "battlecharset", "thief-f-2", "盗賊女b" },
+		{ "sound", "공격2", "攻撃2" },
+		{ "monster", "maliciousflower", "アーリマン" },
+		{ "music", "treasure", "秘宝" },
+		{ "charset", "crown6", "モンスター1" },
+		{ "battle", "2003 absorb", "2003吸収" },
+		{ "sound", "검1", "剣1" },
+		{ "battlecharset", "thief-f-1", "盗賊女a" },
+		{ "battle", "bolt2", "雷" },
+		{ "charset", "people3", "一般3" },
+		{ "music", "field 3", "フィールド3" },
+		{ "music", "sadness", "2003悲しみ" },
+		{ "battle", "2003창", "2003槍" },
+		{ "battlecharset", "woman4 a", "女性４a" },
+		{ "sound", "벤다8", "斬る8" },
+		{ "faceset", "주인공1", "主人公1" },
+		{ "sound", "대지3", "大地3" },
+		{ "sound", "cold5", "冷気5" },
+		{ "music", "SE호우", "SE大雨" },
+		{ "sound", "explode2", "爆発2" },
+		{ "battle", "치료", "治療" },
+		{ "music", "battle 1", "戦闘1" },
+		{ "music", "지하감옥5", "ダンジョン5" },
+		{ "sound", "close2", "閉める2" },
+		{ "battle", "베리어", "バリア" },
+		{ "sound", "bolt09", "雷9" },
+		{ "music", "eternal", "2003悠久の時の流れに" },
+		{ "monster", "fenrir", "フェンリル" },
+		{ "monster", "caitsith", "ケットシー" },
+		{ "music", "2003altarofdarkness", "2003暗黒の祭壇" },
+		{ "monster", "monster-2", "ミドガルズオルム" },
+		{ "monster", "spider", "タランチュラ" },
+		{ "sound", "fall2", "落ちる2" },
+		{ "faceset", "monster", "モンスター" },
+		{ "sound", "darkness3", "暗黒3" },
+		{ "sound", "결정1", "決定1" },
+		{ "sound", "thunder9", "雷9" },
+		{ "sound", "cut3", "斬る3" },
+		{ "battlecharset", "man1-2", "男性１b" },
+		{ "music", "2003villageball", "2003日だまりの村" },
+		{ "music", "icecave", "2003氷のラビリンス" },
+		{ "sound", "fire7", "炎7" },
+		{ "sound", "choice1", "決定1" },
+		{ "sound", "독", "毒" },
+		{ "battle", "2003bow", "2003弓" },
+		{ "battlecharset", "samurai1", "侍a" },
+		{ "sound", "sound wave2", "音波2" },
+		{ "music", "field 4", "フィールド4" },
+		{ "backdrop", "forestp", "森１" },
+		{ "music", "thief", "泥棒" },
+		{ "monster", "grell", "グレル" },
+		{ "charset", "일반2", "一般2" },
+		{ "battle", "spear2", "槍" },
+		{ "music", "2003콜로세움", "2003コロシアム" },
+		{ "music", "끝2", "エンディング2" },
+		{ "backdrop", "ruins2", "遺跡" },
+		{ "music", "오프닝2", "オープニング2" },
+		{ "battlecharset", "thiefwomanb", "盗賊女b" },
+		{ "battle", "2003 dark", "2003暗黒" },
+		{ "music", "2003제국", "2003帝国～エンパイア" },
+		{ "sound", "cold8", "冷気8" },
+		{ "monster", "pigsoldier", "オーク" },
+		{ "battlecharset", "man5-2", "男性５b" },
+		{ "music", "화내다", "怒り" },
+		{ "panorama", "night sky1", "夜空1" },
+		{ "music", "sorrow", "悲しみ" },
+		{ "monster", "morloc", "カッパ" },
+		{ "monster", "littledemon", "インプ" },
+		{ "battlecharset", "woman5 b", "女性５b" },
+		{ "sound", "attack2", "攻撃2" },
+		{ "monster", "rubyfox", "カーバンクル" },
+		{ "music", "2003fareasternarea", "2003極東の地" },
+		{ "battle", "dark2", "暗黒" },
+		{ "monster", "라미아", "ラミア" },
+		{ "music", "mystery 3", "神秘3" },
+		{ "battlecharset", "man2 a", "男性２a" },
+		{ "charset", "people5", "一般5" },
+		{ "sound", "sonic1", "音波1" },
+		{ "sound", "벤다4", "斬る4" },
+		{ "music", "2003subterranean maze", "2003地下迷宮" },
+		{ "monster", "lizardsoldier", "リザードマン" },
+		{ "battle", "2003remedy", "2003治療" },
+		{ "sound", "냉기4", "冷気4" },
+		{ "sound", "타격1", "打撃1" },
+		{ "battle", "폭발", "爆発" },
+		{ "battle", "paralysis", "麻痺" },
+		{ "music", "boat2", "船2" },
+		{ "battle", "breath", "ブレス" },
+		{ "music", "2003pursuit", "2003マキシマム・バトル" },
+		{ "panorama", "dawn2", "夜明け2" },
+		{ "sound", "사자", "ライオン" },
+		{ "sound", "종", "鐘" },
+		{ "battlecharset", "armored warror b", "鎧武者b" },
+		{ "music", "필드1", "フィールド1" },
+		{ "sound", "shatter", "ガシャン" },
+		{ "monster", "맘모스", "マンモス" },
+		{ "music", "jfanfare4", "jファンファーレ4" },
+		{ "sound", "cold3", "冷気3" },
+		{ "music", "jfanfare3", "jファンファーレ3" },
+		{ "sound", "strike01", "斬る1" },
+		{ "battlecharset", "armourwarriorb", "鎧武者b" },
+		{ "music", "2003카지노", "2003カジノ三昧" },
+		{ "music", "battleend3", "j戦闘終了3" },
+		{ "battlecharset", "pirate-f-2", "海賊女b" },
+		{ "monster", "scorpion", "スコーピオン" },
+		{ "music", "hero 1", "勇者1" },
+		{ "monster", "이프리트", "イフリート" },
+		{ "sound", "flame5", "炎5" },
+		{ "battle", "2003암흑", "2003暗黒" },
+		{ "sound", "thunder7", "雷7" },
+		{ "sound", "버저2", "ブザー2" },
+		{ "backdrop", "strangespacial", "異空間" },
+		{ "sound", "대지5", "大地5" },
+		{ "music", "2003작은 군대의 행진곡", "2003小さな兵隊のマーチ" },
+		{ "battlecharset", "female hero a", "勇者女a" },
+		{ "music", "explore", "探索" },
+		{ "sound", "소멸2", "消滅2" },
+		{ "music", "2003calm2", "2003悲しみ" },
+		{ "music", "2003village in the valley", "2003山あいの村" },
+		{ "music", "2003hero's return", "2003勇者の凱旋" },
+		{ "panorama", "evening2", "夜明け2" },
+		{ "music", "2003calmness", "2003静寂" },
+		{ "battlecharset", "rennaa", "海賊女a" },
+		{ "music", "2003회복의 샘", "2003いやしの泉" },
+		{ "sound", "다운", "ダウン" },
+		{ "monster", "라쿠슈미", "ラクシュミ" },
+		{ "charset", "objects2", "オブジェクト2" },
+		{ "music", "요정1", "妖精1" },
+		{ "monster", "mantis", "マンティス" },
+		{ "battlecharset", "woman1 b", "女性１b" },
+		{ "music", "J개그2", "Jギャグ2" },
+		{ "sound", "마비2", "しびれ2" },
+		{ "monster", "dragon-2", "ドラゴン" },
+		{ "battle", "2003기타2", "2003その他2" },
+		{ "sound", "explosion3", "爆発3" },
+		{ "sound", "monster1", "モンスター1" },
+		{ "battlecharset", "man5-1", "男性５a" },
+		{ "sound", "화염8", "炎8" },
+		{ "music", "jfanfare 4", "jファンファーレ4" },
+		{ "sound", "폭발5", "爆発5" },
+		{ "battlecharset", "female mage b", "魔術師女b" },
+		{ "battle", "2003-paralysis", "2003麻痺" },
+		{ "battle", "claw", "爪" },
+		{ "sound", "heal1", "回復1" },
+		{ "monster", "피닉스", "フェニックス" },
+		{ "monster", "빅풋", "ビッグフット" },
+		{ "battle", "sword3", "剣2" },
+		{ "sound", "wind06", "風6" },
+		{ "battlecharset", "elfmanb", "エルフ男b" },
+		{ "music", "showdown", "2003決戦の地" },
+		{ "music", "2003thefightwhichisrepeated", "2003繰り返される戦い" },
+		{ "battle", "2003회복", "2003回復" },
+		{ "battlecharset", "hero-f-1", "勇者女a" },
+		{ "battle", "2003 explosion", "2003爆発" },
+		{ "battlecharset", "남성３a", "男性３a" },
+		{ "battlecharset", "mjittb", "男性２b" },
+		{ "monster", "hellhound", "ケルベロス" },
+		{ "backdrop", "산길", "山道" },
+		{ "battle", "마비", "麻痺" },
+		{ "battle", "2003-claws", "2003爪" },
+		{ "battle", "dark1", "2003暗黒" },
+		{ "music", "snowtown", "2003スノータウン" },
+		{ "monster", "girl4", "エルフ" },
+		{ "battle", "axe", "斧" },
+		{ "music", "게임오버3", "ゲームオーバー3" },
+		{ "battlecharset", "thief-m-1", "盗賊男a" },
+		{ "music", "battle1", "戦闘1" },
+		{ "backdrop", "옥좌", "玉座" },
+		{ "sound", "화염3", "炎3" },
+		{ "sound", "annihilation2", "消滅2" },
+		{ "battle", "물", "水" },
+		{ "music", "SE2003새", "SE2003鳥" },
+		{ "battlecharset", "manésa", "男性４a" },
+		{ "monster", "crowera", "クロウラー" },
+		{ "battlecharset", "여성２b", "女性２b" },
+		{ "music", "jfanfare 3", "jファンファーレ3" },
+		{ "monster", "레모라", "レモラ" },
+		{ "music", "ghost-town2", "ゴーストタウン2" },
+		{ "music", "parting 1", "別れ1" },
+		{ "sound", "revive2", "蘇生2" },
+		{ "system", "시스템", "システム" },
+		{ "music", "malice", "怒り" },
+		{ "music", "2003calm", "2003悠久の時の流れに" },
+		{ "backdrop", "donjohnq", "ダンジョン２" },
+		{ "sound", "플래시3", "フラッシュ3" },
+		{ "battlecharset", "닌자女b", "忍者女b" },
+		{ "music", "2003무인 저택", "2003無人の館" },
+		{ "music", "boat3", "船3" },
+		{ "sound", "jump1", "ジャンプ1" },
+		{ "music", "defeat", "敗北" },
+		{ "charset", "주인공1", "主人公1" },
+		{ "monster", "crocodile", "アリゲーター" },
+		{ "sound", "explosion1", "爆発1" },
+		{ "sound", "holy6", "神聖6" },
+		{ "battle", "holy", "神聖" },
+		{ "sound", "취소1", "キャンセル1" },
+		{ "sound", "잘라내기1", "はずれ1" },
+		{ "music", "boss4", "ボス4" },
+		{ "backdrop", "snow", "雪原" },
+		{ "music", "exploration", "探索" },
+		{ "sound", "냉기10", "冷気10" },
+		{ "sound", "신성3", "神聖3" },
+		{ "music", "2003교회", "2003教会" },
+		{ "monster", "wizard", "ソーサラー" },
+		{ "sound", "cold9", "冷気9" },
+		{ "music", "labyrinth", "2003地下迷宮" },
+		{ "battle", "2003도끼", "2003斧" },
+		{ "faceset", "general2", "一般2" },
+		{ "monster", "quezal", "ケツアルクアトル" },
+		{ "music", "ship 3", "船3" },
+		{ "battlecharset", "piratemana", "海賊男a" },
+		{ "music", "J숙소2", "J宿2" },
+		{ "music", "촌2", "村2" },
+		{ "battle", "cure2", "治療" },
+		{ "sound", "냉기1", "冷気1" },
+		{ "sound", "item2", "アイテム2" },
+		{ "sound", "water1", "水1" },
+		{ "chipset", "exterior", "外観" },
+		{ "monster", "warrior", "ワイト" },
+		{ "battlecharset", "otipaa", "盗賊女a" },
+		{ "monster", "lakshmi", "ラクシュミ" },
+		{ "sound", "안개1", "霧1" },
+		{ "music", "animal", "動物" },
+		{ "monster", "ouroboros", "ウロボロス" },
+		{ "monster", "monster-3", "玄武" },
+		{ "battlecharset", "unnona", "盗賊男a" },
+		{ "music", "J팡파르3", "Jファンファーレ3" },
+		{ "music", "2003colloseum", "2003コロシアム" },
+		{ "battle", "claw1", "2003爪" },
+		{ "music", "2003맥시멈·전투", "2003マキシマム・バトル" },
+		{ "monster", "lizard", "リザード" },
+		{ "music", "2003venturepeople", "2003冒険者たち" },
+		{ "sound", "bow2", "弓2" },
+		{ "battlecharset", "격투가男b", "格闘家男b" },
+		{ "music", "jend of battle 2", "j戦闘終了2" },
+		{ "battlecharset", "여성１a", "女性１a" },
+		{ "sound", "냉기2", "冷気2" },
+		{ "sound", "recovery7", "回復7" },
+		{ "monster", "firescull", "スピリッツ" },
+		{ "monster", "고곤", "ゴーゴン" },
+		{ "music", "fanfare3", "jファンファーレ3" },
+		{ "sound", "slash4", "斬る4" },
+		{ "battle", "2003 other2", "2003その他2" },
+		{ "music", "2003maximumsbattle", "2003マキシマム・バトル" },
+		{ "music", "교회", "教会" },
+		{ "battlecharset", "armor2", "鎧武者b" },
+		{ "sound", "rebirth2", "蘇生2" },
+		{ "battlecharset", "jemmonb", "勇者男b" },
+		{ "battlecharset", "격투가女b", "格闘家女b" },
+		{ "music", "farewell1", "別れ1" },
+		{ "battlecharset", "chuzaa", "中華女a" },
+		{ "music", "jgag2", "jギャグ2" },
+		{ "music", "지하감옥4", "ダンジョン4" },
+		{ "sound", "물1", "水1" },
+		{ "sound", "punch6", "打撃6" },
+		{ "monster", "mimic", "ミミック" },
+		{ "monster", "alligator", "アリゲーター" },
+		{ "music", "2003far eastern land", "2003極東の地" },
+		{ "monster", "dark elf", "ダークエルフ" },
+		{ "battlecharset", "monkmanb", "僧侶男b" },
+		{ "backdrop", "clouds", "空" },
+		{ "sound", "냉기8", "冷気8" },
+		{ "sound", "evade1", "回避1" },
+		{ "music", "village2", "村2" },
+		{ "music", "mystery3", "神秘3" },
+		{ "battlecharset", "man3-1", "男性３a" },
+		{ "monster", "remora", "レモラ" },
+		{ "panorama", "dawn1", "夜明け1" },
+		{ "battle", "2003냉기", "2003冷気" },
+		{ "battle", "spear", "槍" },
+		{ "charset", "chubby1", "一般3" },
+		{ "monster", "바하무트", "バハムート" },
+		{ "battlecharset", "사무라이a", "侍a" },
+		{ "backdrop", "이공간", "異空間" },
+		{ "music", "2003glory", "2003古城" },
+		{ "monster", "하피", "ハーピー" },
+		{ "music", "gameover1", "ゲームオーバー1" },
+		{ "sound", "laser2", "ショット2" },
+		{ "backdrop", "우주", "宇宙" },
+		{ "battle", "2003-sphere", "2003治療" },
+		{ "sound", "소생3", "蘇生3" },
+		{ "sound", "heal4", "回復4" },
+		{ "music", "inn1", "j宿1" },
+		{ "battlecharset", "용자男a", "勇者男a" },
+		{ "music", "2003onthefarsideofmemories", "2003記憶の彼方に" },
+		{ "monster", "jellyfish", "グレル" },
+		{ "battlecharset", "monkwomanb", "僧侶女b" },
+		{ "music", "bar", "2003街の酒場" },
+		{ "battlecharset", "womanétb", "女性５b" },
+		{ "music", "2003gangster", "2003大混戦" },
+		{ "sound", "explosion2", "爆発2" },
+		{ "battlecharset", "female elf a", "エルフ女a" },
+		{ "music", "mystery 1", "神秘1" },
+		{ "sound", "열다1", "開ける1" },
+		{ "sound", "화염2", "炎2" },
+		{ "music", "fairy2", "妖精2" },
+		{ "sound", "신성4", "神聖4" },
+		{ "music", "town 1", "町1" },
+		{ "battle", "2003flame", "2003炎" },
+		{ "monster", "orc", "オーク" },
+		{ "battlecharset", "female fighter a", "格闘家女a" },
+		{ "music", "opening1", "オープニング1" },
+		{ "sound", "recovery1", "回復1" },
+		{ "monster", "dragon knight", "ドラゴンナイト" },
+		{ "monster", "thief", "ケットシー" },
+		{ "battlecharset", "thiefmana", "盗賊男a" },
+		{ "battle", "2003ax", "2003斧" },
+		{ "sound", "earthquake1", "地震1" },
+		{ "sound", "raise2", "蘇生2" },
+		{ "monster", "werwolf", "ワーウルフ" },
+		{ "music", "2003summer", "2003穏やかな風" },
+		{ "music", "J전투종료4", "J戦闘終了4" },
+		{ "music", "2003대성당", "2003大聖堂" },
+		{ "monster", "유니콘", "ユニコーン" },
+		{ "system", "system2", "システムa" },
+		{ "battle", "revivial", "蘇生" },
+		{ "backdrop", "ghost-town", "旧市街" },
+		{ "sound", "물4", "水4" },
+		{ "monster", "아수라", "アスラ" },
+		{ "battlecharset", "raglea", "戦士男a" },
+		{ "sound", "cut8", "斬る8" },
+		{ "music", "오프닝3", "オープニング3" },
+		{ "sound", "kill4", "斬る4" },
+		{ "sound", "absorb2", "吸収2" },
+		{ "backdrop", "traininghall", "ダンジョン６" },
+		{ "charset", "animals", "動物" },
+		{ "backdrop", "유적", "遺跡" },
+		{ "battlecharset", "여성５b", "女性５b" },
+		{ "monster", "게이져", "ゲイザー" },
+		{ "monster", "바실리크스", "バジリスク" },
+		{ "music", "church2", "教会" },
+		{ "sound", "thunder3", "雷3" },
+		{ "monster", "archer", "エルフ" },
+		{ "battlecharset", "man2 b", "男性２b" },
+		{ "battlecharset", "도적女a", "盗賊女a" },
+		{ "backdrop", "cave4", "ダンジョン４" },
+		{ "system2", "system2b", "システム２b" },
+		{ "battlecharset", "중화男a", "中華男a" },
+		{ "music", "2003infiniteidea", "2003遺跡探索" },
+		{ "music", "town 2", "町2" },
+		{ "battle", "2003 wind", "2003風" },
+		{ "chipset", "기본", "基本" },
+		{ "music", "jmystery", "j謎" },
+		{ "backdrop", "graveyard", "お墓" },
+		{ "battlecharset", "manérb", "男性３b" },
+		{ "charset", "몬스터2", "モンスター2" },
+		{ "music", "이별1", "別れ1" },
+		{ "battlecharset", "manéqb", "男性２b" },
+		{ "music", "패배", "敗北" },
+		{ "sound", "ice6", "冷気6" },
+		{ "music", "horns", "j2003ホルン" },
+		{ "backdrop", "insidepyramid", "遺跡" },
+		{ "backdrop", "절", "お寺" },
+		{ "sound", "blow7", "打撃7" },
+		{ "music", "탐색", "探索" },
+		{ "sound", "폭발7", "爆発7" },
+		{ "monster", "flyingmermaid", "セイレーン" },
+		{ "sound", "gong", "鐘" },
+		{ "monster", "darkrider", "トルーパー" },
+		{ "charset", "general5", "一般5" },
+		{ "sound", "wall2", "壁2" },
+		{ "music", "ship 1", "船1" },
+		{ "monster", "kyuubi", "九尾の狐" },
+		{ "music", "endless-fight", "2003繰り返される戦い" },
+		{ "battle", "wind2", "風" },
+		{ "monster", "다크 엘프", "ダークエルフ" },
+		{ "music", "전투3", "戦闘3" },
+		{ "monster", "demonhorsething", "カトブレパス" },
+		{ "battlecharset", "전사男a", "戦士男a" },
+		{ "sound", "paralyze2", "しびれ2" },
+		{ "battlecharset", "samurai a", "侍a" },
+		{ "sound", "대지10", "大地10" },
+		{ "sound", "recovery6", "回復6" },
+		{ "sound", "암흑2", "暗黒2" },
+		{ "sound", "소멸1", "消滅1" },
+		{ "monster", "mamont", "マンモス" },
+		{ "monster", "mummy", "ミイラ男" },
+		{ "monster", "catterpillar", "センチピード" },
+		{ "music", "se-clock", "se時計" },
+		{ "music", "game over 1", "ゲームオーバー1" },
+		{ "music", "2003사신과의 싸움", "2003邪神との戦い" },
+		{ "sound", "ice7", "冷気7" },
+		{ "sound", "암흑5", "暗黒5" },
+		{ "battlecharset", "jidada", "男性１a" },
+		{ "battlecharset", "phesaa", "格闘家女a" },
+		{ "battle", "spear1", "2003槍" },
+		{ "music", "2003dream forest", "2003夢幻の森" },
+		{ "monster", "wolfman", "コボルト" },
+		{ "battle", "flame1", "炎1" },
+		{ "sound", "플래시2", "フラッシュ2" },
+		{ "monster", "kappa", "カッパ" },
+		{ "music", "boss 4", "ボス4" },
+		{ "monster", "triton", "サハギン" },
+		{ "monster", "catoblepas", "カトブレパス" },
+		{ "sound", "떨어진다1", "落ちる1" },
+		{ "battlecharset", "armor1", "鎧武者a" },
+		{ "music", "field 2", "フィールド2" },
+		{ "chipset", "interior", "内装" },
+		{ "sound", "검2", "剣2" },
+		{ "battlecharset", "solider-m-2", "戦士男b" },
+		{ "battle", "2003-dark", "2003暗黒" },
+		{ "music", "field1", "フィールド1" },
+		{ "music", "2003snowtown", "2003スノータウン" },
+		{ "sound", "end2", "はずれ2" },
+		{ "battlecharset", "man1-1", "男性１a" },
+		{ "backdrop", "old town", "旧市街" },
+		{ "sound", "ice06", "冷気4" },
+		{ "sound", "increase", "アップ" },
+		{ "battle", "2003shock", "2003打撃" },
+		{ "panorama", "sunset2", "夕焼け2" },
+		{ "charset", "actor2", "主人公2" },
+		{ "monster", "카토부레바트", "カトブレパス" },
+		{ "charset", "actor1", "主人公1" },
+		{ "charset", "char4", "一般4" },
+		{ "sound", "decision1", "決定1" },
+		{ "battle", "2003barrier", "2003バリア" },
+		{ "battle", "2003치료", "2003治療" },
+		{ "battle", "paralyze1", "2003麻痺" },
+		{ "battlecharset", "herowomana", "勇者女a" },
+		{ "music", "2003chaos", "2003邪神との戦い" },
+		{ "sound", "shot3", "ショット3" },
+		{ "music", "2003lonesome journey", "2003孤独な旅立ち" },
+		{ "charset", "future1", "一般1" },
+		{ "battlecharset", "woman2-2", "女性２b" },
+		{ "battlecharset", "male ninja b", "忍者男b" },
+		{ "battlecharset", "woman5 a", "女性５a" },
+		{ "music", "castle3", "城3" },
+		{ "sound", "flame3", "炎3" },
+		{ "music", "seclock", "se時計" },
+		{ "monster", "좀비", "ゾンビ" },
+		{ "monster", "스핑크스", "スフィンクス" },
+		{ "monster", "seraphim", "セラフィム" },
+		{ "backdrop", "donjohnt", "ダンジョン５" },
+		{ "music", "jend of battle 4", "j戦闘終了4" },
+		{ "sound", "쇼트3", "ショット3" },
+		{ "battlecharset", "priestess2", "僧侶女b" },
+		{ "sound", "earth05", "大地5" },
+		{ "sound", "cold7", "冷気7" },
+		{ "battlecharset", "ninja-f-2", "忍者女b" },
+		{ "battle", "ray", "蘇生" },
+		{ "monster", "garuda", "ガルーダ" },
+		{ "sound", "신성6", "神聖6" },
+		{ "backdrop", "dungeon4", "ダンジョン４" },
+		{ "music", "ship1", "船1" },
+		{ "sound", "타격2", "打撃2" },
+		{ "sound", "flame6", "炎6" },
+		{ "battlecharset", "woman5-1", "女性５a" },
+		{ "sound", "kill5", "斬る5" },
+		{ "sound", "dark4", "暗黒4" },
+		{ "monster", "whitetiger", "白虎" },
+		{ "battlecharset", "cletob", "女性１b" },
+		{ "backdrop", "road", "路上" },
+		{ "sound", "quake2", "地震2" },
+		{ "battle", "attack", "打撃" },
+		{ "monster", "kirin", "麒麟" },
+		{ "sound", "벤다7", "斬る7" },
+		{ "sound", "wind8", "風8" },
+		{ "music", "점1", "店1" },
+		{ "monster", "펜릴", "フェンリル" },
+		{ "battlecharset", "womanéqa", "女性２a" },
+		{ "backdrop", "선상", "船上" },
+		{ "music", "se-quake", "se地震" },
+		{ "battle", "cold", "冷気" },
+		{ "charset", "crown2", "モンスター2" },
+		{ "sound", "run", "移動" },
+		{ "battlecharset", "해적女a", "海賊女a" },
+		{ "monster", "slime", "スライム" },
+		{ "sound", "떨어진다2", "落ちる2" },
+		{ "monster", "titan", "タイタン" },
+		{ "music", "farewell2", "別れ2" },
+		{ "monster", "necromant", "ネクロマンサー" },
+		{ "backdrop", "cave1", "ダンジョン１" },
+		{ "music", "demon lord", "魔王" },
+		{ "panorama", "eveningglow2", "夕焼け2" },
+		{ "music", "se2003wind", "se2003風" },
+		{ "battle", "2003 holy", "2003神聖" },
+		{ "battlecharset", "도적女b", "盗賊女b" },
+		{ "sound", "refer book", "巻き付き" },
+		{ "music", "energy", "活気" },
+		{ "sound", "신성8", "神聖8" },
+		{ "sound", "combat1", "戦闘1" },
+		{ "panorama", "evening1", "夜明け1" },
+		{ "sound", "sheep", "ひつじ" },
+		{ "battlecharset", "pirate-m-1", "海賊男a" },
+		{ "music", "dark", "闇市" },
+		{ "battle", "decrease", "下降" },
+		{ "battle", "2003water", "2003水" },
+		{ "battle", "2003nail", "2003爪" },
+		{ "sound", "쇼트1", "ショット1" },
+		{ "title", "타이틀2", "タイトル2" },
+		{ "backdrop", "icecave", "ダンジョン３" },
+		{ "music", "gosttown2", "ゴーストタウン2" },
+		{ "music", "dungeon4", "ダンジョン4" },
+		{ "battlecharset", "woman1 a", "女性１a" },
+		{ "battlecharset", "womanéra", "女性３a" },
+		{ "battlecharset", "beruaa", "女性５a" },
+		{ "battlecharset", "irregiab", "女性３b" },
+		{ "sound", "cut11", "斬る11" },
+		{ "battlecharset", "ljitia", "魔術師女a" },
+		{ "battlecharset", "rennab", "海賊女b" },
+		{ "sound", "rain2", "雨2" },
+		{ "music", "jfanfare5", "jファンファーレ5" },
+		{ "sound", "wind05", "風5" },
+		{ "battlecharset", "chinesemana", "中華男a" },
+		{ "sound", "ice5", "冷気5" },
+		{ "battle", "손톱", "爪" },
+		{ "music", "boss1", "ボス1" },
+		{ "title", "타이틀1", "タイトル1" },
+		{ "monster", "크라켄", "クラーケン" },
+		{ "music", "godslayer", "2003邪神との戦い" },
+		{ "sound", "earth04", "大地4" },
+		{ "title", "title2", "タイトル2" },
+		{ "music", "mystery2", "神秘2" },
+		{ "charset", "future3", "一般5" },
+		{ "music", "2003beginning of a war", "2003戦いの幕開け" },
+		{ "monster", "oni", "鬼" },
+		{ "music", "2003free for all", "2003大混戦" },
+		{ "sound", "barrier2", "壁2" },
+		{ "battle", "bite", "吸収" },
+		{ "sound", "flame8", "炎8" },
+		{ "battle", "buff", "上昇" },
+		{ "battle", "2003-explosion", "2003爆発" },
+		{ "battlecharset", "male mage b", "魔術師男b" },
+		{ "backdrop", "beach", "砂浜" },
+		{ "battlecharset", "닌자女a", "忍者女a" },
+		{ "sound", "holy1", "神聖1" },
+		{ "sound", "cold11", "冷気11" },
+		{ "sound", "취소2", "キャンセル2" },
+		{ "music", "victory", "勝利" },
+		{ "music", "2003maximum battle", "2003マキシマム・バトル" },
+		{ "monster", "ifreet", "イフリート" },
+		{ "battle", "2003-holy", "2003神聖" },
+		{ "music", "2003largeconfoundcombat", "2003大混戦" },
+		{ "music", "triumph", "2003勇者の凱旋" },
+		{ "music", "편안해짐3", "安らぎ3" },
+		{ "sound", "cow", "ウシ" },
+		{ "sound", "holy3", "神聖3" },
+		{ "sound", "ice10", "冷気10" },
+		{ "monster", "insect", "マンティス" },
+		{ "music", "shop2", "店2" },
+		{ "music", "castle2", "城2" },
+		{ "monster", "curvebull", "カトブレパス" },
+		{ "music", "ride3", "乗り物3" },
+		{ "panorama", "morning1", "空1" },
+		{ "music", "armyclash", "2003大混戦" },
+		{ "music", "solace2", "安らぎ2" },
+		{ "faceset", "hero1", "主人公1" },
+		{ "music", "solace1", "安らぎ1" },
+		{ "battlecharset", "female bandit a", "盗賊女a" },
+		{ "backdrop", "폐허", "廃墟" },
+		{ "backdrop", "dungeon3", "ダンジョン３" },
+		{ "music", "2003유구의 흐름", "2003悠久の時の流れに" },
+		{ "music", "jjoke 1", "jギャグ1" },
+		{ "music", "SE2003바람", "SE2003風" },
+		{ "sound", "커서1", "カーソル1" },
+		{ "battle", "2003-hit", "2003打撃" },
+		{ "system2", "시스템２b", "システム２b" },
+		{ "panorama", "planet3", "惑星3" },
+		{ "battle", "wind", "風" },
+		{ "sound", "이동", "移動" },
+		{ "battlecharset", "womanépa", "女性１a" },
+		{ "charset", "일반1", "一般1" },
+		{ "monster", "rooster", "コカトリス" },
+		{ "sound", "닭", "にわとり" },
+		{ "music", "strength", "活気" },
+		{ "battle", "2003-whip", "2003鞭" },
+		{ "music", "2003in the eternal flow of time", "2003悠久の時の流れに" },
+		{ "battlecharset", "grapplehousemana", "格闘家男a" },
+		{ "battlecharset", "man1 b", "男性１b" },
+		{ "sound", "wind03", "風3" },
+		{ "charset", "object2", "オブジェクト2" },
+		{ "monster", "리리스", "リリス" },
+		{ "sound", "glassshatter", "ガシャン" },
+		{ "music", "2003globalfrustration", "2003暗黒の祭壇" },
+		{ "sound", "전격2", "雷2" },
+		{ "music", "tower1", "塔1" },
+		{ "sound", "evasion1", "回避1" },
+		{ "battle", "2003-axe", "2003斧" },
+		{ "music", "bustling-city", "2003サイバーシティ" },
+		{ "sound", "slash5", "斬る5" },
+		{ "chipset", "basis", "基本" },
+		{ "music", "jinn 1", "j宿1" },
+		{ "sound", "활2", "弓2" },
+		{ "battlecharset", "여성１b", "女性１b" },
+		{ "sound", "화염1", "炎1" },
+		{ "monster", "구렐", "グレル" },
+		{ "battlecharset", "격투가女a", "格闘家女a" },
+		{ "battle", "2003 sword", "2003剣" },
+		{ "backdrop", "swamp", "毒沼" },
+		{ "music", "surprise", "j疑惑" },
+		{ "monster", "sphinx", "スフィンクス" },
+		{ "gameover", "게임오버", "ゲームオーバー" },
+		{ "monster", "realwolf", "フェンリル" },
+		{ "battle", "2003-other1", "2003その他1" },
+		{ "sound", "대지8", "大地8" },
+		{ "music", "jinn1", "j宿1" },
+		{ "monster", "카미라", "カーミラ" },
+		{ "music", "town2", "町2" },
+		{ "music", "2003undergroundlabyrinth", "2003地下迷宮" },
+		{ "battlecharset", "용자男b", "勇者男b" },
+		{ "monster", "seizedsoldier", "ワイト" },
+		{ "charset", "general3", "一般3" },
+		{ "music", "성3", "城3" },
+		{ "battle", "whip1", "2003鞭" },
+		{ "music", "ending3", "エンディング3" },
+		{ "music", "2003용사의 개선", "2003勇者の凱旋" },
+		{ "monster", "ogrechest", "ミミック" },
+		{ "monster", "dragonknight", "ドラゴンナイト" },
+		{ "backdrop", "하늘", "空" },
+		{ "monster", "임프", "インプ" },
+		{ "battle", "etc", "その他" },
+		{ "music", "jend of battle 1", "j戦闘終了1" },
+		{ "battlecharset", "ragleb", "戦士男b" },
+		{ "battlecharset", "soldier-f-1", "戦士女a" },
+		{ "music", "필드2", "フィールド2" },
+		{ "music", "town 3", "町3" },
+		{ "battlecharset", "soldiermana", "戦士男a" },
+		{ "music", "fanfare4", "jファンファーレ4" },
+		{ "monster", "elf", "エルフ" },
+		{ "sound", "꽃가루", "花粉" },
+		{ "music", "lose", "敗北" },
+		{ "monster", "specter", "スペクター" },
+		{ "battlecharset", "전사男b", "戦士男b" },
+		{ "sound", "rebirth1", "蘇生1" },
+		{ "music", "2003parade", "2003小さな兵隊のマーチ" },
+		{ "monster", "가루다", "ガルーダ" },
+		{ "battlecharset", "남성２b", "男性２b" },
+		{ "battle", "2003 breath", "2003ブレス" },
+		{ "backdrop", "grassland", "草原" },
+		{ "battlecharset", "woman4-1", "女性４a" },
+		{ "monster", "octopus", "オクトパス" },
+		{ "battle", "2003화염", "2003炎" },
+		{ "battlecharset", "man4-1", "男性４a" },
+		{ "sound", "damege1", "ダメージ1" },
+		{ "battle", "zip", "雷" },
+		{ "battlecharset", "중화男b", "中華男b" },
+		{ "music", "2003mooniness", "2003夢見心地" },
+		{ "music", "J전투종료1", "J戦闘終了1" },
+		{ "monster", "소서러", "ソーサラー" },
+		{ "sound", "evade2", "回避2" },
+		{ "battlecharset", "마술사男a", "魔術師男a" },
+		{ "backdrop", "temple", "お寺" },
+		{ "sound", "bolt01", "雷1" },
+		{ "sound", "glass", "ガシャン" },
+		{ "sound", "upgrade", "アップ" },
+		{ "music", "2003fastbattle", "2003異次元回廊" },
+		{ "system", "system3", "システムb" },
+		{ "battle", "2003-earth", "2003大地" },
+		{ "battlecharset", "rasnena", "格闘家男a" },
+		{ "battlecharset", "manéta", "男性５a" },
+		{ "monster", "man5", "ダークエルフ" },
+		{ "monster", "salamander", "サラマンダー" },
+		{ "sound", "우렁찬 외침", "おたけび" },
+		{ "battlecharset", "닌자男b", "忍者男b" },
+		{ "battlecharset", "priestess1", "僧侶女a" },
+		{ "battlecharset", "woman4 b", "女性４b" },
+		{ "sound", "bump2", "壁2" },
+		{ "monster", "features", "インプ" },
+		{ "battlecharset", "female elf b", "エルフ女b" },
+		{ "music", "2003지하미궁", "2003地下迷宮" },
+		{ "battlecharset", "chuazb", "男性３b" },
+		{ "sound", "buff", "アップ" },
+		{ "music", "2003worldsound", "2003夢幻の森" },
+		{ "chipset", "던젼", "ダンジョン" },
+		{ "monster", "lizardman", "リザードマン" },
+		{ "monster", "centaur", "ケンタウロス" },
+		{ "battlecharset", "soldier-m-1", "戦士男a" },
+		{ "sound", "타격6", "打撃6" },
+		{ "sound", "slash3", "斬る3" },
+		{ "battlecharset", "여성２a", "女性２a" },
+		{ "chipset", "building", "内装" },
+		{ "sound", "thunder4", "雷4" },
+		{ "music", "2003sadend", "2003機械要塞" },
+		{ "music", "castle 1", "城1" },
+		{ "charset", "actor4", "主人公4" },
+		{ "monster", "wraith", "レイス" },
+		{ "monster", "bull", "ゴーゴン" },
+		{ "sound", "회복1", "回復1" },
+		{ "battlecharset", "soldierwomana", "戦士女a" },
+		{ "sound", "open1", "開ける1" },
+		{ "battle", "2003rod", "2003鞭" },
+		{ "charset", "hero3", "主人公3" },
+		{ "battle", "2003coldair", "2003冷気" },
+		{ "battlecharset", "female ninja a", "忍者女a" },
+		{ "monster", "redsparrow", "朱雀" },
+		{ "sound", "earth10", "大地10" },
+		{ "backdrop", "roughforging", "荒地" },
+		{ "battlecharset", "manéqa", "男性２a" },
+		{ "battlecharset", "마술사女a", "魔術師女a" },
+		{ "monster", "데어 매트", "ティアマット" },
+		{ "monster", "pumpkin", "ジャック・オー・ランタン" },
+		{ "sound", "power", "にらみ" },
+		{ "music", "2003fastbattle2", "2003繰り返される戦い" },
+		{ "monster", "그리폰", "グリフォン" },
+		{ "music", "차량1", "乗り物1" },
+		{ "sound", "strike07", "斬る7" },
+		{ "sound", "earth2", "大地2" },
+		{ "music", "2003축복 왈츠", "2003祝福ワルツ" },
+		{ "sound", "강아지", "イヌ" },
+		{ "sound", "kill7", "斬る7" },
+		{ "backdrop", "dungeon5", "ダンジョン５" },
+		{ "monster", "phoenix", "フェニックス" },
+		{ "sound", "wind04", "風4" },
+		{ "charset", "일반3", "一般3" },
+		{ "monster", "deathgaze", "ゲイザー" },
+		{ "sound", "slash8", "斬る8" },
+		{ "monster", "와이번", "ワイバーン" },
+		{ "music", "vehicle3", "乗り物3" },
+		{ "sound", "ice07", "冷気5" },
+		{ "sound", "collapse1", "消滅1" },
+		{ "music", "끝3", "エンディング3" },
+		{ "monster", "fairytalehorse", "麒麟" },
+		{ "sound", "아이템2", "アイテム2" },
+		{ "monster", "고스트", "ゴースト" },
+		{ "backdrop", "ruins1", "廃墟" },
+		{ "monster", "longdragon", "龍" },
+		{ "sound", "폭발4", "爆発4" },
+		{ "sound", "recovery2", "回復2" },
+		{ "music", "se-gale", "se2003風" },
+		{ "faceset", "general1", "一般1" },
+		{ "music", "바보", "秘宝" },
+		{ "music", "2003fast", "2003地下迷宮" },
+		{ "monster", "infernaldog", "ベヒーモス" },
+		{ "monster", "efreet", "イフリート" },
+		{ "monster", "fencer", "ダークエルフ" },
+		{ "music", "고스트 타운2", "ゴーストタウン2" },
+		{ "charset", "people2", "一般2" },
+		{ "battlecharset", "samuraia", "侍a" },
+		{ "music", "forest", "2003夢幻の森" },
+		{ "music", "jaggressiveend4", "j戦闘終了4" },
+		{ "sound", "cold10", "冷気10" },
+		{ "music", "2003approachingdarkness", "2003忍び寄る闇" },
+		{ "monster", "asura", "アスラ" },
+		{ "music", "royal-ball", "2003王宮のパーティー" },
+		{ "monster", "deadpirate", "アンデッドナイト" },
+		{ "monster", "오딘", "オーディン" },
+		{ "sound", "explode3", "爆発3" },
+		{ "gameover", "game over", "ゲームオーバー" },
+		{ "backdrop", "바닥", "お墓" },
+		{ "backdrop", "공중 목욕탕", "銭湯" },
+		{ "system2", "시스템２a", "システム２a" },
+		{ "sound", "punch5", "打撃5" },
+		{ "music", "boss 1", "ボス1" },
+		{ "music", "boat1", "船1" },
+		{ "music", "2003village of savages", "2003未開の集落" },
+		{ "sound", "텔레포트1", "テレポート1" },
+		{ "battlecharset", "elf-f-2", "エルフ女b" },
+		{ "monster", "뱀파이어", "ヴァンパイア" },
+		{ "music", "waltz", "2003祝福ワルツ" },
+		{ "system", "systema", "システムa" },
+		{ "monster", "prophet", "ラクシュミ" },
+		{ "sound", "쇼트2", "ショット2" },
+		{ "battlecharset", "man3 a", "男性３a" },
+		{ "sound", "around1", "あたり1" },
+		{ "monster", "darkelf", "ダークエルフ" },
+		{ "music", "wrath", "怒り" },
+		{ "backdrop", "onboat", "船上" },
+		{ "sound", "cancel2", "キャンセル2" },
+		{ "sound", "cold1", "冷気1" },
+		{ "battlecharset", "male ninja a", "忍者男a" },
+		{ "battlecharset", "female warrior a", "戦士女a" },
+		{ "music", "2003warning", "2003パニック" },
+		{ "monster", "skeleton", "スケルトン" },
+		{ "monster", "mystic", "ラクシュミ" },
+		{ "music", "2003tavern", "2003街の酒場" },
+		{ "music", "far-east", "2003極東の地" },
+		{ "sound", "buzzer2", "はずれ2" },
+		{ "monster", "셰도우", "シャドウ" },
+		{ "sound", "blind", "暗闇" },
+		{ "backdrop", "바다", "海" },
+		{ "battlecharset", "cletoa", "女性１a" },
+		{ "music", "SE바다", "SE海" },
+		{ "monster", "세라핌", "セラフィム" },
+		{ "monster", "ninja", "シャドウ" },
+		{ "battlecharset", "male fighter a", "格闘家男a" },
+		{ "sound", "fight1", "戦闘1" },
+		{ "battle", "sphere", "治療" },
+		{ "music", "parting1", "別れ1" },
+		{ "battlecharset", "joegoa", "鎧武者a" },
+		{ "battle", "revive1", "2003蘇生" },
+		{ "sound", "cut2", "斬る2" },
+		{ "panorama", "night sky2", "夜空2" },
+		{ "sound", "벤다11", "斬る11" },
+		{ "battle", "화염2", "炎2" },
+		{ "monster", "lillith", "リリス" },
+		{ "system", "system4", "システムc" },
+		{ "backdrop", "lavacave2", "ダンジョン２" },
+		{ "monster", "배트", "バット" },
+		{ "music", "jfanfare2", "jファンファーレ2" },
+		{ "battleweapon", "standart", "武器" },
+		{ "monster", "쿠로우라", "クロウラー" },
+		{ "music", "shop3", "店3" },
+		{ "battle", "2003-other2", "2003その他2" },
+		{ "music", "2003piracy", "2003コロシアム" },
+		{ "sound", "cut6", "斬る6" },
+		{ "charset", "crown5", "一般5" },
+		{ "music", "riddle", "j謎" },
+		{ "sound", "vanish2", "消滅2" },
+		{ "sound", "수면", "睡眠" },
+		{ "panorama", "cosmos1", "宇宙" },
+		{ "battle", "absorption", "吸収" },
+		{ "sound", "모래 연기", "砂けむり" },
+		{ "sound", "paralyze3", "しびれ3" },
+		{ "battlecharset", "용자女a", "勇者女a" },
+		{ "battlecharset", "manésb", "男性４b" },
+		{ "sound", "가샨", "ガシャン" },
+		{ "battle", "ice2", "冷気" },
+		{ "sound", "암흑1", "暗黒1" },
+		{ "music", "2003spring", "2003いやしの泉" },
+		{ "battle", "bolt1", "2003雷" },
+		{ "music", "2003ruinssearch", "2003遺跡探索" },
+		{ "backdrop", "rocky road", "岩場" },
+		{ "monster", "knight", "ダークナイト" },
+		{ "sound", "earth09", "大地9" },
+		{ "sound", "cold2", "冷気2" },
+		{ "sound", "안보임", "暗闇" },
+		{ "sound", "darkness6", "暗黒6" },
+		{ "sound", "cut9", "斬る9" },
+		{ "battle", "sword2", "剣2" },
+		{ "sound", "ice1", "冷気1" },
+		{ "charset", "objects1", "オブジェクト1" },
+		{ "sound", "earth06", "大地6" },
+		{ "sound", "combat2", "戦闘2" },
+		{ "music", "battle3", "戦闘3" },
+		{ "music", "victory1", "j戦闘終了1" },
+		{ "music", "moonlight", "2003夢見心地" },
 	};
 
-	RTP_TABLE_2000["gameover"] = {
-	 // Official English translation names
-	 {"game over", "ゲームオーバー"},
-
-	 // Don Miguel's English translation names
-	 {"gameover", "ゲームオーバー"}
+	const int32_t seeds_2003_japanese[2528] = {
+		-2527, 0, 2, 0, 1, -2525, 1, -2522, 1, -2521, 0, 2, 0, -2513, 0, 0,
+		0, 0, 0, 2, -2508, 1, -2498, 0, -2496, -2493, 2, 1, 1, 0, 1, 0,
+		-2491, 0, 0, 0, -2485, 1, 1, 0, 0, -2481, 0, 0, -2473, 5, 1, 0,
+		-2471, 0, 4, -2470, -2467, 0, 1, -2466, 1, -2465, -2464, 0, 0, 0, 1, 0,
+		1, 0, 0, -2463, -2462, 2, 0, -2459, -2453, 1, 0, -2452, 1, -2447, 0, 1,
+		1, 0, -2446, -2445, 3, 0, 2, 1, 1, -2442, -2441, 2, 0, 1, -2436, 2,
+		1, 1, -2433, 0, 1, 1, 0, -2430, 0, -2428, 1, -2427, 0, -2425, 2, -2419,
+		3, 1, 2, 0, 3, 1, -2417, 1, 2, -2413, 0, 1, 6, -2407, 0, -2406,
+		0, 2, -2401, 0, 1, 3, -2396, 0, 1, 6, 1, 0, -2395, 0, 2, 1,
+		0, 0, 0, -2392, -2390, 0, 0, -2387, 1, 3, 2, -2385, 0, -2384, 0, 3,
+		0, 1, -2380, 0, 0, 1, 0, -2379, -2369, -2361, -2358, 0, 0, -2357, 1, 2,
+		0, 1, 1, 2, 0, 0, 0, 0, -2356, -2353, -2350, -2347, 0, -2345, 0, 2,
+		0, 1, 0, 3, 0, 0, 0, -2337, 3, 0, 0, 0, 1, 2, 1, 0,
+		1, 2, 0, -2336, 0, 0, -2334, -2330, 0, 0, 0, 0, 1, 0, 0, -2329,
+		8, 0, 0, 1, 0, 0, 0, 0, 0, -2322, 0, 1, 1, 2, 2, -2319,
+		1, 0, 0, 1, 0, -2317, 0, -2312, 0, 0, -2309, -2307, 0, 0, -2301, -2298,
+		-2293, 0, 1, 0, -2291, 1, -2288, -2287, -2286, -2282, 0, 3, 1, -2281, -2280, -2279,
+		2, 0, 0, 0, 1, -2278, -2274, -2254, -2252, 2, 0, -2251, -2249, 0, -2248, 2,
+		0, -2247, 4, 0, 0, 0, 0, 0, -2245, 0, 2, 0, 0, -2242, 2, 0,
+		0, 3, -2241, 4, -2238, -2235, 4, 0, -2234, -2233, -2232, 0, -2230, 0, -2228, 0,
+		-2227, 1, 3, -2226, 2, -2225, 1, 2, 0, -2223, -2220, 0, 5, 0, -2218, 1,
+		-2215, 3, -2214, -2212, 1, 0, 0, 0, 2, 3, 1, -2207, -2205, 7, 0, -2203,
+		0, 0, 1, -2201, 1, 0, 0, 2, 2, -2200, 4, 0, 0, -2197, 0, 0,
+		-2196, 0, -2194, 0, 0, -2192, -2189, 0, -2185, 1, 0, 1, -2184, -2182, -2180, -2178,
+		2, 1, 2, 0, -2177, 0, 2, 1, 0, 3, -2176, 3, -2174, 0, -2167, -2166,
+		1, 0, -2165, 0, -2163, 1, -2161, 0, 0, 1, 0, -2157, 0, 0, 0, 1,
+		-2155, 0, 0, 1, 4, -2153, 0, -2151, -2147, 2, -2141, 3, -2139, 0, 2, -2136,
+		-2135, -2134, 0, 9, -2132, -2130, 0, 1, 0, 1, 0, 3, -2128, -2127, -2119, -2111,
+		0, -2110, 0, -2108, -2097, 0, 5, 2, -2096, 1, 2, 1, -2094, 2, -2091, 0,
+		-2088, 2, 0, 0, 0, 1, 0, -2086, 1, 1, 1, 0, 0, 2, -2085, 1,
+		0, 0, 0, 3, 0, -2083, 0, 1, -2082, 0, -2081, 1, 0, 0, -2077, 0,
+		0, -2072, -2070, 1, 2, 0, 2, -2069, -2068, 0, 3, 0, 0, 1, 2, 0,
+		-2066, 0, 1, -2062, -2060, 0, -2056, 0, 0, 0, 0, 1, 0, -2050, 0, 0,
+		0, 4, 4, -2049, -2048, -2046, 0, -2043, 1, 0, -2034, 1, -2033, 0, 2, 2,
+		2, 1, 0, 0, 0, -2032, 1, 3, 0, -2031, -2026, 0, 0, -2023, -2022, 0,
+		0, 2, 1, 0, 0, 0, -2019, 0, -2018, 0, 0, 0, 2, -2016, 0, -2015,
+		0, -2014, 0, 0, 0, 1, 3, -2010, 2, 2, 1, 1, -2002, -1992, -1987, -1985,
+		1, -1981, 0, 0, 0, 5, -1980, -1978, 0, 1, 0, 2, 0, -1974, 0, 0,
+		-1973, 0, -1971, 0, 0, 1, 0, -1966, 2, 1, 1, 0, 5, 0, -1963, -1962,
+		-1960, 0, 0, -1957, 0, -1955, 0, 4, -1954, 0, 4, 0, -1953, 0, 1, 0,
+		0, -1938, 1, 2, 0, 3, -1932, 0, 0, 1, -1931, -1929, 0, 1, 0, -1928,
+		6, -1925, 1, -1923, -1920, 6, 0, 0, -1918, 0, 1, -1917, -1913, 0, -1911, -1910,
+		0, -1909, 0, 0, 0, 0, 0, 1, 0, 0, -1905, 0, -1904, 0, 0, 1,
+		2, -1903, 0, -1901, 0, -1898, 0, -1896, -1891, -1888, -1882, 2, 0, 1, 0, -1877,
+		0, -1876, -1875, 4, 0, -1872, -1869, 0, -1865, 1, 0, 1, -1860, 0, -1858, -1857,
+		-1856, 2, 1, -1855, -1853, -1850, -1849, 0, 0, 0, 0, -1848, 0, 1, 0, -1845,
+		0, 0, 0, 1, -1838, 0, -1835, 0, -1833, -1832, -1831, -1830, 0, 0, -1826, 0,
+		5, 0, -1824, 14, 2, -1823, -1822, 0, 0, -1817, 2, -1814, 0, 0, 1, 0,
+		5, 3, -1813, 2, 0, -1811, -1809, 0, 0, 1, -1808, -1807, 0, 0, -1804, 0,
+		0, 0, -1799, 0, 0, 0, 1, 0, 0, 2, -1797, 0, 1, 1, 0, -1789,
+		-1787, -1786, 2, 3, 1, 2, 0, -1782, 2, 0, 1, 0, 1, 0, -1779, -1777,
+		0, -1776, -1775, -1773, 0, -1771, -1766, 0, -1764, 1, 0, 3, 3, 4, -1762, -1759,
+		6, 0, 7, -1758, 2, 0, -1757, 0, 0, -1755, 0, 0, -1754, 0, 0, -1752,
+		0, 2, 0, -1751, 0, -1747, -1744, 4, 0, -1743, 0, -1742, -1740, -1736, 8, 0,
+		0, 2, -1735, -1734, 1, -1728, 0, -1726, -1724, 0, 2, 12, 1, 2, 1, 4,
+		-1718, 0, -1717, 0, 0, 0, 3, -1716, 2, 0, -1715, -1711, 0, 0, -1709, -1705,
+		0, 0, 0, 0, 2, 0, -1703, 0, 0, -1702, 0, -1700, 0, 2, 2, -1694,
+		-1693, 1, -1692, 0, 0, -1691, 0, 3, 0, 1, 0, -1690, -1688, -1687, 2, 0,
+		0, 0, 0, 5, 2, 0, 0, -1686, -1683, 0, -1680, -1678, 0, 0, 3, 0,
+		2, 0, 0, 0, 0, 1, 0, 0, 1, -1675, 1, 0, 0, 0, 0, -1673,
+		3, -1671, 1, -1667, 2, 0, 0, 1, -1664, 0, 0, 0, -1662, -1661, 1, -1657,
+		0, 0, 3, 0, 1, 0, 5, 0, -1655, -1651, 1, 0, -1649, -1644, -1642, 0,
+		0, -1640, 0, 0, -1639, 5, 3, 0, -1638, -1633, -1630, 2, 2, 0, -1629, 4,
+		0, -1626, 2, 0, -1625, -1619, 2, -1618, 0, -1615, 1, -1614, 0, 0, 0, 0,
+		1, -1612, -1609, -1606, -1604, 0, 0, 0, -1598, 1, 0, 2, -1594, 3, -1591, -1589,
+		2, -1588, 0, 2, 4, -1585, 1, -1584, 0, -1582, 0, 0, -1577, 0, -1576, 2,
+		0, -1575, 5, 0, 3, -1571, 0, 9, -1566, 2, -1565, 0, 0, 4, 0, -1563,
+		-1561, -1560, -1558, -1557, -1556, 0, -1554, 0, 0, 0, 4, 0, 0, 0, 3, 3,
+		0, 0, 1, 0, -1550, 4, -1547, 0, 0, 0, 1, -1546, 1, -1543, 5, -1541,
+		0, -1540, 0, 2, 1, -1539, -1537, -1533, 0, 0, 0, -1532, -1529, -1525, 0, -1524,
+		2, -1523, -1522, 3, 0, 0, 0, 0, 1, -1518, -1514, 0, 4, 6, 0, -1510,
+		1, 0, -1503, 0, -1500, 0, 0, -1499, -1494, -1492, -1490, -1489, 3, 0, 3, 0,
+		0, -1485, -1481, 0, 5, 1, -1479, 2, 0, 0, 0, 7, 0, 0, 0, 0,
+		-1473, -1471, -1469, 0, 0, 4, 3, 0, 2, -1467, -1466, -1459, -1458, 0, 0, 0,
+		-1454, 1, -1451, 0, 0, -1450, 1, 1, -1447, 3, 0, -1445, 2, 0, 0, -1440,
+		2, -1439, 0, -1438, -1437, 1, 3, -1434, 0, -1431, -1428, 3, -1427, 3, 2, 0,
+		1, -1421, 0, -1418, -1417, 2, -1416, -1415, 0, -1414, -1413, 1, -1409, 0, 5, 0,
+		-1401, -1400, 0, -1395, -1394, -1393, -1392, -1388, 3, 0, -1381, 0, -1378, -1377, -1375, 1,
+		-1373, -1371, 0, 0, 0, 1, -1366, -1365, 1, -1364, 5, 2, -1363, 0, -1360, -1359,
+		2, 2, 4, 2, -1356, 1, 0, 1, -1347, -1346, 1, 1, -1345, -1344, 2, -1341,
+		-1334, 0, -1333, 0, 1, 0, 0, -1327, 0, -1326, 3, 0, 0, -1324, 0, 0,
+		-1321, 0, 6, 2, 4, 0, -1311, -1309, 0, 3, -1307, -1306, -1304, -1300, -1293, 0,
+		3, 0, 0, -1289, -1286, 0, 0, 0, -1283, -1279, 0, 0, 0, 0, -1275, -1272,
+		0, 1, -1270, 0, -1269, 0, -1265, -1263, -1260, 1, 0, 0, 5, 1, 0, 0,
+		1, -1258, 2, 1, -1257, 0, 0, 0, 0, 0, 0, -1254, 2, 5, -1250, 1,
+		1, 4, -1249, -1247, 0, -1245, -1244, 4, -1239, 0, -1238, 0, 0, -1235, 9, -1233,
+		1, 0, -1229, 1, 0, -1224, 0, 4, -1219, -1218, 0, 0, 2, 0, -1217, 0,
+		0, 0, 2, 0, 2, 0, -1211, 1, -1205, 1, 0, 0, 1, -1200, 1, -1199,
+		0, 0, 0, 0, 1, -1196, -1183, 1, -1182, 0, 0, 0, -1177, 5, 0, 3,
+		-1176, -1175, 0, 3, -1173, 1, 0, -1171, 4, 0, 1, 2, 0, 1, 0, 1,
+		0, 2, -1170, -1169, -1168, 0, 2, 1, 0, 0, 1, -1167, 0, -1164, 0, 1,
+		-1163, 0, 2, -1161, 0, 0, 0, -1160, 0, 10, 1, 0, 0, -1157, 2, -1155,
+		2, 0, 2, 0, -1154, -1152, 0, 1, 6, 1, 0, 10, -1150, -1149, 0, 1,
+		1, 0, -1147, 0, 5, 0, 1, 7, 0, 4, 0, 0, 0, 0, 0, 0,
+		0, -1146, 0, 0, -1141, 8, 3, -1139, -1137, -1136, 0, -1130, 7, -1126, -1125, -1123,
+		0, -1122, 2, 0, 3, 0, 0, -1120, -1117, -1116, 10, 0, 4, -1115, -1114, 1,
+		3, 1, 0, 0, -1112, 0, -1110, 0, 4, -1107, -1104, 1, 7, 0, 0, -1102,
+		0, 5, 4, -1099, -1095, 0, 0, 0, 0, -1094, 0, 0, 0, 0, 1, 0,
+		4, 1, 0, -1093, 4, -1089, 3, 0, -1080, -1076, -1074, -1072, -1064, -1062, 3, -1061,
+		0, -1060, 1, -1059, 0, 0, 3, 4, 0, -1056, 0, 2, -1054, -1053, 2, 0,
+		0, 0, -1049, 0, -1048, -1047, 0, -1046, 0, -1044, 1, 3, -1043, 0, 0, 0,
+		-1041, -1040, 0, 2, -1039, 0, -1037, 1, 0, 0, 0, 10, -1035, 0, 4, 0,
+		0, 4, -1034, 0, -1032, -1029, 2, -1026, 0, -1025, -1024, 0, -1023, -1022, 0, -1015,
+		0, 0, -1011, 0, 5, 2, 0, 0, -1007, -1004, -1002, -999, 1, 0, -998, 0,
+		0, -996, 8, 0, 0, -994, -991, 1, 8, -989, 2, -986, 8, 2, 1, -985,
+		-983, 0, 0, 0, 0, 4, -980, -975, -964, 6, 2, -962, -957, 0, 0, 1,
+		0, -951, 0, 1, -950, 0, -948, 1, -947, -946, -943, 3, 0, 0, -941, 7,
+		6, -939, -931, 0, 0, 0, -930, -928, 0, -927, -926, 0, 2, 0, -925, 6,
+		0, 0, 0, 3, -919, -915, -913, 0, -912, 0, 0, 0, 3, 0, 0, -910,
+		0, -909, -906, 9, 0, 19, -904, -903, 10, -901, 0, -897, 0, 0, 6, 0,
+		-895, 3, 0, -891, 15, 0, 0, 0, -889, 0, 0, 0, -888, 1, -885, 2,
+		-884, -883, 3, 0, -881, 0, 1, -873, -867, 0, -863, 0, 0, 4, 0, -861,
+		0, -860, -857, 0, 0, -856, 1, 16, 0, -854, 0, 0, 1, 9, 11, 0,
+		7, -852, 0, -851, -850, 4, 0, 5, 0, 0, -848, 1, -846, 4, 0, -844,
+		2, -842, -841, -839, -836, 0, 0, 0, -832, -831, 0, -827, 0, 0, 5, -823,
+		0, 0, 0, 9, 9, 0, 0, 12, 0, -821, 4, 0, -818, -816, 0, -806,
+		-800, -799, 0, -797, 0, -796, 1, -795, 0, 1, 0, -788, -785, 2, -784, 2,
+		0, -776, 0, 0, 0, -774, -773, 2, 0, -768, -763, -761, 0, 0, -756, -754,
+		-753, -751, 1, 0, 1, 0, 1, -748, 0, 1, -747, 2, 0, 2, -746, 6,
+		-738, -737, -735, 4, 1, 1, 0, 0, 0, 0, -734, 0, 0, 0, 0, 0,
+		0, 0, 1, 11, 7, -733, -732, -731, 11, 0, 3, 0, 0, 3, -727, 1,
+		-724, -720, 0, -719, -718, -716, 0, -711, 0, -710, 0, -708, 2, -703, 0, 0,
+		1, -698, 4, -697, 0, -696, 0, 2, -694, -693, 0, 3, 1, -692, -687, 0,
+		0, 0, 3, 7, -686, 0, -685, 0, -684, 5, 0, -678, 0, 0, -675, -673,
+		9, 0, -665, -664, 8, -661, 0, 11, 1, -659, -657, 4, 0, -649, 0, 0,
+		2, 0, 4, 0, 3, 7, -648, 2, 0, 0, 0, 0, -636, 6, 0, 2,
+		-635, 0, 0, 2, 0, 0, -628, -626, 0, 0, 0, 0, 0, -624, 0, -622,
+		0, 0, -621, 0, -617, 7, 4, -612, 3, 0, 0, -610, -606, -602, 4, -601,
+		0, -598, -595, -590, -575, -572, 1, 0, 0, 0, 2, 0, -565, 6, 0, 0,
+		1, 0, 1, -560, -553, 0, 0, -551, 2, 0, 6, 1, 2, 0, 7, -546,
+		0, -543, -540, -539, -536, 0, 0, 1, -530, 1, -529, 1, -525, -516, 1, 1,
+		-515, -513, -512, 0, -510, 4, 0, -508, -507, 0, 0, -505, 3, 2, 0, 1,
+		9, 9, -504, -497, 0, 4, 2, 0, 1, 0, -491, 1, 0, 0, 0, 14,
+		0, 0, 0, 6, 0, 0, 0, -490, 0, 9, -488, 0, -479, 14, 0, -477,
+		3, 0, -476, 5, 2, 4, 0, -468, 0, -467, 0, -457, 2, 0, 5, 15,
+		-454, 0, -451, -448, -447, -445, 9, 0, -442, -439, -438, 2, 0, 0, 0, 4,
+		-435, 0, -433, 0, -428, -427, 0, 4, 0, 3, 0, -421, 5, 7, 1, -420,
+		3, 0, 3, 0, -417, 2, 0, 0, 0, -416, -415, -413, -408, -404, 0, -401,
+		-396, 0, 1, 2, 8, 5, 18, 0, 0, 0, -395, 0, 13, -385, -381, -376,
+		3, -372, 4, -371, 0, 0, 2, -369, -368, -363, 0, -356, 0, 0, 3, 1,
+		0, 2, -353, -352, -351, -349, 3, -348, -343, 3, 6, -342, 3, -340, -338, 0,
+		6, -336, 6, -332, -328, 0, -327, -326, -325, 0, -324, 0, 2, 1, -323, 0,
+		0, 3, 0, 0, -321, -320, 2, -317, 1, -315, -312, 1, -311, 2, 0, 0,
+		-310, -309, -308, 4, -307, -304, -301, 0, -299, 0, -287, -284, -277, 6, -275, -267,
+		10, 0, 0, -266, -264, 0, 2, 0, 2, -262, 0, 2, 0, -256, 0, -250,
+		17, 0, -241, -239, 1, 2, 0, 4, 5, 2, -238, 0, 0, 0, 0, 14,
+		0, 0, 0, 0, -235, 0, -230, 2, -226, 0, 0, -224, 0, 7, -222, -220,
+		-211, -210, 1, 5, 7, 0, 12, -208, 1, 4, 3, 0, 0, 6, 0, 0,
+		0, 1, 10, 0, 0, 0, 0, 0, 0, -204, 0, 11, -201, 0, 0, -199,
+		0, 0, -197, -195, -192, 0, 0, -191, 0, -184, -182, 1, 1, -178, -173, 0,
+		0, 0, 11, -172, 0, -171, 0, 0, -166, 9, -163, -159, 1, -155, -150, -148,
+		-144, 2, 0, -141, -137, 1, 1, -135, -127, 0, -126, 0, -123, 0, -121, -117,
+		-112, 0, -111, 4, -107, 0, 1, 6, 0, 7, 4, -100, -97, 3, 6, 5,
+		-95, 5, -92, 0, 2, -89, -83, 0, -81, 2, -77, 0, 10, -74, 0, -71,
+		-64, 1, 1, -63, 1, -62, -61, 0, -60, -59, 0, 13, 1, -56, 12, 0,
+		0, 6, 3, -54, 0, 0, -52, 0, -50, -49, 1, -47, 0, -45, -42, 2,
+		6, -41, -40, 1, 0, -39, 0, -38, -36, 0, -35, 0, 0, -19, -18, -16,
+		0, 0, 9, -14, 3, -10, 11, 0, 0, 0, -4, -2, 21, 1, 0, 0,
 	};
 
-	RTP_TABLE_2000["monster"] = {
-	 // Official English translation names
-	 {"vampire", "ヴァンパイア"},
-	 {"orc", "オーク"},
-	 {"gargoyle", "ガーゴイル"},
-	 {"chimera", "キマイラ"},
-	 {"kraken", "クラーケン"},
-	 {"griffon", "グリフォン"},
-	 {"cerberus", "ケルベロス"},
-	 {"bat", "こうもり"},
-	 {"ghost", "ゴースト"},
-	 {"golem", "ゴーレム"},
-	 {"cockatorice", "コカトリス"},
-	 {"goblin", "ゴブリン"},
-	 {"kobold", "コボルト"},
-	 {"skeleton", "スケルトン"},
-	 {"slime", "スライム"},
-	 {"zombie", "ゾンビ"},
-	 {"dark elf", "ダークエルフ"},
-	 {"demon", "デーモン"},
-	 {"dragona", "ドラゴン"},
-	 {"dragon knight", "ドラゴンナイト"},
-	 {"knight", "トルーパー"},
-	 {"treant", "トレント"},
-	 {"harpy", "ハーピー"},
-	 {"hydra", "ヒュドラ"},
-	 {"black knight", "ブラックナイト"},
-	 {"hornet", "ホーネット"},
-	 {"merman", "マーマン"},
-	 {"mummy", "マミー"},
-	 {"minotaur", "ミノタウロス"},
-	 {"mimic", "ミミック"},
-	 {"medusa", "メデューサ"},
-	 {"lizardman", "リザードマン"},
-	 {"lich", "リッチ"},
-	 {"werewolf", "ワーウルフ"},
-	 {"wyvern", "ワイバーン"},
-	 {"people1", "一般人1"},
-	 {"people2", "一般人2"},
-	 {"people3", "一般人3"},
-	 {"people4", "一般人4"},
-	 {"people5", "一般人5"},
-	 {"people6", "一般人6"},
-	 {"people7", "一般人7"},
-	 {"people8", "一般人8"},
-	 {"familiar", "使い魔"},
-	 {"soldier", "兵士"},
-	 {"giant spider", "大グモ"},
-	 {"giant scorpion", "大サソリ"},
-	 {"snake", "大蛇"},
-	 {"angel", "天使"},
-	 {"queen", "女王"},
-	 {"ninja", "忍者"},
-	 {"monster fish", "怪魚"},
-	 {"warrior1", "戦士1"},
-	 {"warrior2", "戦士2"},
-	 {"warrior", "武者"},
-	 {"reaper", "死神"},
-	 {"pirate", "海賊"},
-	 {"king", "王"},
-	 {"thief", "盗賊"},
-	 {"wisp", "鬼火"},
-	 {"demon lord", "魔王"},
-	 {"demon god", "魔神"},
-	 {"magician1", "魔術師1"},
-	 {"magician2", "魔術師2"},
-	 {"dragonb", "龍"},
+	const Table table_2003_japanese = { entries_2003_japanese, seeds_2003_japanese, 2528 };
 
-	 // Don Miguel's English translation names
-	 {"hog", "オーク"},
-	 {"octopus", "クラーケン"},
-	 {"griphon", "グリフォン"},
-	 {"hellhound", "ケルベロス"},
-	 {"rooster", "コカトリス"},
-	 {"troll", "ゴブリン"},
-	 {"wolfman", "コボルト"},
-	 {"darkelf", "ダークエルフ"},
-	 {"flyingdemon", "デーモン"},
-	 {"greendragon1", "ドラゴン"},
-	 {"dragonknight", "ドラゴンナイト"},
-	 {"darkrider", "トルーパー"},
-	 {"oak", "トレント"},
-	 {"darkknight", "ブラックナイト"},
-	 {"bee", "ホーネット"},
-	 {"aquamen", "マーマン"},
-	 {"ogrechest", "ミミック"},
-	 {"lizardmen", "リザードマン"},
-	 {"darkspirit", "リッチ"},
-	 {"wolf", "ワーウルフ"},
-	 {"bluedragon", "ワイバーン"},
-	 {"boy1", "一般人1"},
-	 {"girl2", "一般人2"},
-	 {"boy3", "一般人3"},
-	 {"girl4", "一般人4"},
-	 {"man5", "一般人5"},
-	 {"girl6", "一般人6"},
-	 {"oldman7", "一般人7"},
-	 {"granny", "一般人8"},
-	 {"imp", "使い魔"},
-	 {"warrior", "兵士"},
-	 {"spider", "大グモ"},
-	 {"redscorpion", "大サソリ"},
-	 {"princess", "女王"},
-	 {"fish", "怪魚"},
-	 {"hero1", "戦士1"},
-	 {"hero2", "戦士2"},
-	 {"samurai", "武者"},
-	 {"death", "死神"},
-	 {"gnome", "海賊"},
-	 {"firescull", "鬼火"},
-	 {"cloakdemon", "魔王"},
-	 {"satan", "魔神"},
-	 {"witch1", "魔術師1"},
-	 {"witch2", "魔術師2"},
-	 {"greendragon2", "龍"}
+	const Entry entries_2003_english[679] = {
+		{ "title", "タイトル2", "title2" },
+		{ "music", "神秘3", "mystery 3" },
+		{ "music", "ダンジョン3", "dungeon 3" },
+		{ "sound", "スイッチ2", "switch2" },
+		{ "monster", "ワイト", "seizedsoldier" },
+		{ "music", "2003異次元回廊", "2003fastbattle" },
+		{ "sound", "時計", "clock" },
+		{ "monster", "ユニコーン", "unicorn" },
+		{ "sound", "水6", "water6" },
+		{ "sound", "大地2", "earth02" },
+		{ "sound", "炎1", "fire1" },
+		{ "sound", "フラッシュ3", "flash3" },
+		{ "music", "泥棒", "thief" },
+		{ "music", "2003祝福ワルツ", "2003blessingwaltz" },
+		{ "battlecharset", "盗賊女a", "female bandit a" },
+		{ "battle", "2003打撃", "2003 blow" },
+		{ "music", "城2", "castle 2" },
+		{ "charset", "動物", "animal" },
+		{ "monster", "スフィンクス", "sphinx" },
+		{ "battlecharset", "僧侶男a", "male monk a" },
+		{ "sound", "アップ", "buff" },
+		{ "music", "妖精2", "fairy 2" },
+		{ "system", "システムc", "system4" },
+		{ "music", "塔3", "tower 3" },
+		{ "battlecharset", "勇者女a", "female hero a" },
+		{ "battlecharset", "格闘家男b", "grapplehousemanb" },
+		{ "music", "se海", "se-ocean" },
+		{ "music", "j戦闘終了2", "battleend2" },
+		{ "monster", "フェニックス", "phoenix" },
+		{ "music", "j疑惑", "doubt" },
+		{ "sound", "風9", "wind09" },
+		{ "sound", "神聖6", "holy6" },
+		{ "music", "ゲームオーバー3", "game over 3" },
+		{ "battle", "2003爆発", "2003 explosion" },
+		{ "sound", "海1", "sea1" },
+		{ "monster", "デーモン", "daemon" },
+		{ "sound", "弓2", "bow2" },
+		{ "monster", "ベヒーモス", "behemoth" },
+		{ "battlecharset", "男性５a", "frossa" },
+		{ "music", "2003冒険者たち", "2003adventurers" },
+		{ "monster", "ホーネット", "bea" },
+		{ "monster", "スペクター", "lostsoul" },
+		{ "monster", "ケットシー", "cait sith" },
+		{ "backdrop", "岩場", "rockbed" },
+		{ "sound", "冷気11", "cold11" },
+		{ "music", "ゲームオーバー2", "game over 2" },
+		{ "music", "ボス4", "boss 4" },
+		{ "battle", "2003暗黒", "2003 dark" },
+		{ "monster", "カーバンクル", "carbuncle" },
+		{ "sound", "雷5", "bolt05" },
+		{ "chipset", "ダンジョン", "chipset1" },
+		{ "music", "2003遺跡探索", "2003exploring ruins" },
+		{ "battle", "2003水", "2003 water" },
+		{ "battlecharset", "勇者女b", "female hero b" },
+		{ "battle", "神聖", "holy" },
+		{ "battle", "2003治療", "2003 cure" },
+		{ "battlecharset", "盗賊女b", "female bandit b" },
+		{ "sound", "爆発4", "explode4" },
+		{ "sound", "斬る4", "cut4" },
+		{ "sound", "冷気4", "cold4" },
+		{ "sound", "キャンセル1", "cancel1" },
+		{ "sound", "大地8", "earth08" },
+		{ "sound", "冷気1", "cold1" },
+		{ "sound", "水1", "water1" },
+		{ "monster", "トロール", "troll" },
+		{ "music", "2003極東の地", "2003far eastern land" },
+		{ "monster", "スケルトン", "skeleton" },
+		{ "sound", "炎4", "fire4" },
+		{ "backdrop", "砂浜", "beach" },
+		{ "sound", "回避1", "evade1" },
+		{ "monster", "シルフ", "fairy" },
+		{ "system2", "システム２c", "system2c" },
+		{ "music", "jファンファーレ4", "fanfare4" },
+		{ "sound", "風3", "wind03" },
+		{ "panorama", "夕焼け1", "dusk1" },
+		{ "sound", "落ちる1", "fall1" },
+		{ "battlecharset", "海賊男b", "goxanb" },
+		{ "battlecharset", "女性４b", "nysmab" },
+		{ "monster", "オーガ", "auger" },
+		{ "monster", "ヒュドラ", "hydra" },
+		{ "battle", "斧", "ax" },
+		{ "battlecharset", "女性１b", "cletob" },
+		{ "music", "町1", "town 1" },
+		{ "battlecharset", "エルフ女a", "elf-f-1" },
+		{ "music", "村3", "village 3" },
+		{ "monster", "クラーケン", "kraken" },
+		{ "music", "2003夢幻の森", "2003dream forest" },
+		{ "title", "タイトル1", "title1" },
+		{ "monster", "サタナエル", "darkangel" },
+		{ "music", "船1", "boat1" },
+		{ "battle", "爆発", "explode2" },
+		{ "sound", "暗黒2", "dark2" },
+		{ "sound", "戦闘1", "battle1" },
+		{ "battlecharset", "僧侶女a", "female monk a" },
+		{ "sound", "ダメージ2", "damage2" },
+		{ "music", "2003サイバーシティ", "2003cyber city" },
+		{ "backdrop", "草原", "grass" },
+		{ "music", "秘宝", "secret treasure" },
+		{ "sound", "しびれ2", "numbness2" },
+		{ "music", "明るい市場", "bazaar" },
+		{ "battlecharset", "女性３a", "irregiaa" },
+		{ "battlecharset", "女性５b", "beruab" },
+		{ "sound", "打撃7", "blow7" },
+		{ "chipset", "内装", "building" },
+		{ "monster", "キメラ", "chimera" },
+		{ "sound", "回復3", "heal3" },
+		{ "monster", "ミイラ男", "mummy" },
+		{ "backdrop", "異空間", "lightspeed" },
+		{ "monster", "オーディン", "dangeroussoldier" },
+		{ "sound", "神聖3", "holy3" },
+		{ "sound", "海2", "sea2" },
+		{ "backdrop", "毒沼", "poisonswamp" },
+		{ "sound", "大地4", "earth04" },
+		{ "charset", "主人公4", "actor4" },
+		{ "music", "j戦闘終了3", "battleend3" },
+		{ "battlecharset", "男性５b", "frossb" },
+		{ "sound", "テレポート2", "teleport2" },
+		{ "sound", "風10", "wind10" },
+		{ "backdrop", "ダンジョン５", "brickcave5" },
+		{ "sound", "回復2", "heal2" },
+		{ "sound", "モンスター1", "monster1" },
+		{ "sound", "攻撃1", "attack1" },
+		{ "sound", "地震1", "earthquake1" },
+		{ "battle", "ブレス", "breath" },
+		{ "music", "別れ2", "farewell2" },
+		{ "sound", "ダウン", "debuff" },
+		{ "backdrop", "闘技場", "arena" },
+		{ "sound", "ショット1", "laser1" },
+		{ "sound", "ジャンプ1", "jump1" },
+		{ "chipset", "船", "boat" },
+		{ "battle", "2003回復", "2003 recovery" },
+		{ "monster", "インプ", "boy1" },
+		{ "music", "ボス2", "boss 2" },
+		{ "charset", "主人公1", "actor1" },
+		{ "battlecharset", "女性１a", "cletoa" },
+		{ "battlecharset", "忍者男b", "male ninja b" },
+		{ "battle", "2003バリア", "2003 barrier" },
+		{ "monster", "ラクシュミ", "granny" },
+		{ "backdrop", "砂漠", "desert" },
+		{ "music", "店2", "shop 2" },
+		{ "sound", "回復7", "heal7" },
+		{ "monster", "リザード", "lizard" },
+		{ "sound", "戦闘2", "battle2" },
+		{ "battle", "剣1", "sword1" },
+		{ "monster", "カーミラ", "carmilla" },
+		{ "sound", "大地1", "earth01" },
+		{ "music", "2003氷のラビリンス", "2003drops" },
+		{ "panorama", "惑星2", "planet2" },
+		{ "monster", "シャーク", "shark" },
+		{ "sound", "暗黒1", "dark1" },
+		{ "sound", "テレポート1", "teleport1" },
+		{ "music", "ゴーストタウン2", "ghost town 2" },
+		{ "battle", "2003鞭", "2003 whip" },
+		{ "monster", "アリゲーター", "alligator" },
+		{ "music", "フィールド3", "field 3" },
+		{ "sound", "ショット3", "laser3" },
+		{ "battlecharset", "女性５a", "beruaa" },
+		{ "sound", "あたり1", "around1" },
+		{ "battlecharset", "戦士男a", "male warrior a" },
+		{ "battle", "炎1", "fire1" },
+		{ "sound", "ショット2", "laser2" },
+		{ "battle", "水", "water" },
+		{ "sound", "歌", "song" },
+		{ "sound", "大地10", "earth10" },
+		{ "battlecharset", "格闘家女a", "female fighter a" },
+		{ "music", "jファンファーレ1", "fanfare1" },
+		{ "music", "se2003アラーム", "se-alarm" },
+		{ "sound", "しびれ1", "numbness1" },
+		{ "monster", "スライム", "slime" },
+		{ "battlecharset", "忍者女a", "female ninja a" },
+		{ "monster", "玄武", "blackturtle" },
+		{ "monster", "ケルベロス", "cerberus" },
+		{ "sound", "開ける2", "open2" },
+		{ "music", "エンディング3", "ending 3" },
+		{ "sound", "蘇生1", "raise1" },
+		{ "sound", "吸収2", "absorb2" },
+		{ "sound", "暗黒3", "dark3" },
+		{ "panorama", "惑星1", "planet1" },
+		{ "music", "教会", "church" },
+		{ "sound", "攻撃2", "attack2" },
+		{ "battlecharset", "海賊男a", "goxana" },
+		{ "sound", "風7", "wind07" },
+		{ "monster", "ケツアルクアトル", "birdsnake" },
+		{ "sound", "風5", "wind05" },
+		{ "music", "2003街の酒場", "2003tavern" },
+		{ "backdrop", "海", "ocean" },
+		{ "music", "se2003雑踏", "se-crowd" },
+		{ "battle", "2003雷", "2003 thunder" },
+		{ "sound", "はずれ1", "buzzer1" },
+		{ "music", "神秘2", "mystery 2" },
+		{ "monster", "ダークエルフ", "dark elf" },
+		{ "monster", "サハギン", "merman" },
+		{ "monster", "ワーム", "toothworm" },
+		{ "monster", "リヴァイアサン", "leviathan" },
+		{ "music", "j宿1", "inn1" },
+		{ "backdrop", "船上", "onboat" },
+		{ "monster", "カッパ", "kappa" },
+		{ "music", "ダンジョン1", "dungeon 1" },
+		{ "battle", "剣2", "sword2" },
+		{ "monster", "マーマン", "aquamen" },
+		{ "sound", "アイテム2", "item2" },
+		{ "music", "se時計", "se-clock" },
+		{ "monster", "タイタン", "king" },
+		{ "charset", "モンスター2", "crown2" },
+		{ "music", "se2003鳥", "se-bird" },
+		{ "faceset", "モンスター", "monster" },
+		{ "sound", "霧2", "fog2" },
+		{ "charset", "モンスター1", "crown3" },
+		{ "backdrop", "廃墟", "ruins1" },
+		{ "music", "乗り物2", "ride2" },
+		{ "monster", "レイス", "death" },
+		{ "battle", "2003斧", "2003 axe" },
+		{ "monster", "メデューサ", "hypermedusa" },
+		{ "battlecharset", "戦士男b", "male warrior b" },
+		{ "monster", "シャドウ", "lostshadow" },
+		{ "sound", "閉める1", "close1" },
+		{ "sound", "水5", "water5" },
+		{ "monster", "リリス", "lilith" },
+		{ "battleweapon", "武器", "standart" },
+		{ "battlecharset", "僧侶女b", "female monk b" },
+		{ "monster", "マンティコア", "crossedbeast" },
+		{ "backdrop", "ダンジョン３", "donjohnr" },
+		{ "music", "se雨", "se-rain" },
+		{ "sound", "冷気5", "cold5" },
+		{ "music", "戦闘1", "battle 1" },
+		{ "backdrop", "遺跡", "insidepyramid" },
+		{ "monster", "ミドガルズオルム", "creepingcreature" },
+		{ "music", "敗北", "defeat" },
+		{ "battle", "バリア", "barrier" },
+		{ "music", "2003日だまりの村", "2003farmer" },
+		{ "sound", "決定1", "choice1" },
+		{ "music", "乗り物3", "ride3" },
+		{ "sound", "神聖9", "holy9" },
+		{ "battlecharset", "エルフ男b", "elf-m-2" },
+		{ "monster", "ウロボロス", "levitan" },
+		{ "battle", "2003大地", "2003 earth" },
+		{ "sound", "暗闇", "blind" },
+		{ "battle", "その他", "addition" },
+		{ "battlecharset", "男性２a", "man2 a" },
+		{ "monster", "ミミック", "mimic" },
+		{ "sound", "水2", "water2" },
+		{ "music", "村1", "village 1" },
+		{ "panorama", "宇宙", "cosmos1" },
+		{ "monster", "サラマンダー", "burninglizard" },
+		{ "monster", "アナコンダ", "anaconda" },
+		{ "music", "探索", "exploration" },
+		{ "music", "ダンジョン2", "dungeon 2" },
+		{ "sound", "暗黒6", "dark6" },
+		{ "music", "2003地下迷宮", "2003fast" },
+		{ "battle", "麻痺", "paralysis" },
+		{ "battlecharset", "女性２a", "cikuaa" },
+		{ "battle", "暗黒", "dark" },
+		{ "music", "城3", "castle 3" },
+		{ "sound", "混乱", "caos" },
+		{ "system", "システム", "royal" },
+		{ "monster", "白虎", "byakko" },
+		{ "battlecharset", "鎧武者b", "armor2" },
+		{ "sound", "地震2", "earthquake2" },
+		{ "backdrop", "遺跡,", "ruins" },
+		{ "panorama", "空2", "empty2" },
+		{ "monster", "ハーピー", "harpy" },
+		{ "music", "悲しみ", "sad" },
+		{ "battle", "2003槍", "2003 spear" },
+		{ "music", "闇市", "black market" },
+		{ "sound", "花粉", "pollen" },
+		{ "sound", "斬る8", "cut8" },
+		{ "sound", "あたり2", "around2" },
+		{ "sound", "爆発6", "explode6" },
+		{ "music", "j謎", "jmystery" },
+		{ "panorama", "夜空1", "night sky1" },
+		{ "sound", "鐘", "bell" },
+		{ "music", "j戦闘終了1", "battleend1" },
+		{ "monster", "ゴーゴン", "bull" },
+		{ "backdrop", "玉座", "ballseat" },
+		{ "sound", "冷気9", "cold9" },
+		{ "battlecharset", "エルフ男a", "elf-m-1" },
+		{ "monster", "ソーサラー", "boy3" },
+		{ "music", "jアイテム", "item" },
+		{ "sound", "風2", "wind02" },
+		{ "system2", "システム２b", "system2b" },
+		{ "monster", "タランチュラ", "spider" },
+		{ "sound", "打撃2", "blow2" },
+		{ "panorama", "夕焼け2", "dusk2" },
+		{ "battle", "打撃", "attack" },
+		{ "music", "試練", "ordeal" },
+		{ "sound", "砂けむり", "sand storm" },
+		{ "sound", "炎7", "fire7" },
+		{ "battlecharset", "男性３b", "chuazb" },
+		{ "battlecharset", "女性２b", "jikuab" },
+		{ "music", "ゴーストタウン1", "ghost town 1" },
+		{ "sound", "冷気3", "cold3" },
+		{ "battle", "2003吸収", "2003 absorb" },
+		{ "monster", "ゲイザー", "deathgaze" },
+		{ "battle", "下降", "debuff" },
+		{ "backdrop", "荒地", "barren" },
+		{ "battle", "炎2", "fire2" },
+		{ "sound", "雷9", "bolt09" },
+		{ "monster", "セイレーン", "flyingmermaid" },
+		{ "battlecharset", "侍a", "garrea" },
+		{ "sound", "沈黙", "silence" },
+		{ "battlecharset", "男性４b", "man4 b" },
+		{ "panorama", "夜明け2", "dawn2" },
+		{ "sound", "暗黒5", "dark5" },
+		{ "music", "勝利", "get" },
+		{ "battlecharset", "僧侶男b", "male monk b" },
+		{ "monster", "グリフォン", "griffin" },
+		{ "battle", "2003剣", "2003 sword" },
+		{ "battle", "吸収", "absorb2" },
+		{ "backdrop", "お墓", "grave" },
+		{ "battlecharset", "海賊女a", "female pirate a" },
+		{ "sound", "打撃6", "blow6" },
+		{ "charset", "一般1", "char1" },
+		{ "sound", "神聖2", "holy2" },
+		{ "monster", "スピリッツ", "firescull" },
+		{ "monster", "ゴースト", "ghost" },
+		{ "monster", "ゴーレム", "golem" },
+		{ "battle", "大地", "earth" },
+		{ "battle", "2003爪", "2003 claw" },
+		{ "monster", "ドラゴン", "dragon" },
+		{ "sound", "ブザー1", "buzzer3" },
+		{ "battlecharset", "男性２b", "man2 b" },
+		{ "charset", "主人公2", "actor2" },
+		{ "music", "2003悲しみ", "2003calm2" },
+		{ "sound", "おたけび", "roar" },
+		{ "battle", "矢", "arrow" },
+		{ "music", "2003静寂", "2003calmness" },
+		{ "sound", "ブレス", "breast" },
+		{ "monster", "センチピード", "catterpillar" },
+		{ "battle", "2003炎", "2003 fire" },
+		{ "battlecharset", "忍者男a", "male ninja a" },
+		{ "music", "2003教会", "2003church" },
+		{ "battle", "回復", "healing2" },
+		{ "monster", "トルーパー", "darkrider" },
+		{ "sound", "消滅1", "annihilation1" },
+		{ "battlecharset", "海賊女b", "female pirate b" },
+		{ "sound", "剣1", "sword1" },
+		{ "sound", "風1", "wind01" },
+		{ "music", "2003一獲千金の夢", "2003dream of striking it rich" },
+		{ "music", "安らぎ2", "peace2" },
+		{ "monster", "カトブレパス", "catoblepas" },
+		{ "monster", "ワーウルフ", "werewolf" },
+		{ "monster", "グール", "ghoul" },
+		{ "monster", "オクトパス", "octopus" },
+		{ "monster", "鬼", "oni" },
+		{ "sound", "雷8", "bolt08" },
+		{ "music", "町3", "town 3" },
+		{ "music", "2003大空への翼", "2003fanfares" },
+		{ "battlecharset", "忍者女b", "female ninja b" },
+		{ "panorama", "空1", "empty1" },
+		{ "music", "2003帝国〜エンパイア", "2003andagainpleasure" },
+		{ "sound", "水4", "water4" },
+		{ "sound", "雷4", "bolt04" },
+		{ "sound", "神聖5", "holy5" },
+		{ "sound", "キャンセル2", "cancel2" },
+		{ "sound", "開ける1", "open1" },
+		{ "panorama", "惑星3", "planet3" },
+		{ "sound", "大地9", "earth09" },
+		{ "battle", "2003麻痺", "2003 Paralysis" },
+		{ "monster", "ヴァンパイア", "vampire" },
+		{ "battle", "上昇", "buff" },
+		{ "music", "2003いやしの泉", "2003happiness" },
+		{ "sound", "はずれ2", "buzzer2" },
+		{ "music", "2003妖精の森", "2003fairy forest" },
+		{ "title", "タイトル4", "title4" },
+		{ "sound", "斬る5", "cut5" },
+		{ "music", "se地震", "se-quake" },
+		{ "sound", "神聖7", "holy7" },
+		{ "music", "2003邪神との戦い", "2003battle with an evil god" },
+		{ "charset", "主人公3", "actor3" },
+		{ "music", "2003勇者の凱旋", "2003bigpalace" },
+		{ "sound", "斬る11", "cut11" },
+		{ "music", "2003決戦の地", "2003areaofdecisivebattles" },
+		{ "sound", "蘇生3", "raise3" },
+		{ "monster", "ミノタウロス", "minotaur" },
+		{ "backdrop", "雪原", "snow" },
+		{ "system2", "システム２a", "system2a" },
+		{ "sound", "雷2", "bolt02" },
+		{ "music", "2003戦いの幕開け", "2003beginning of a war" },
+		{ "system", "システムa", "system2" },
+		{ "monster", "バット", "bat" },
+		{ "sound", "消滅2", "annihilation2" },
+		{ "battle", "槍", "spear" },
+		{ "music", "2003山あいの村", "2003eaststyle" },
+		{ "sound", "吸収1", "absorb1" },
+		{ "music", "2003暗黒の祭壇", "2003altarofdarkness" },
+		{ "sound", "雨1", "rain1" },
+		{ "battlecharset", "魔術師男b", "mage-m-2" },
+		{ "charset", "乗り物", "vehicle" },
+		{ "monster", "レモラ", "fish" },
+		{ "music", "勇者1", "hero 1" },
+		{ "battlecharset", "男性１a", "jidada" },
+		{ "sound", "風4", "wind04" },
+		{ "music", "2003帝国～エンパイア", "2003제국" },
+		{ "music", "2003幼少の記憶", "2003fairytale" },
+		{ "battle", "鞭", "rod" },
+		{ "sound", "音波2", "sonic2" },
+		{ "monster", "馬", "darkhorse" },
+		{ "sound", "ブザー2", "buzzer4" },
+		{ "music", "魔王", "demon lord" },
+		{ "sound", "鍵", "key" },
+		{ "music", "フィールド1", "field 1" },
+		{ "sound", "音波1", "sonic1" },
+		{ "music", "ボス3", "boss 3" },
+		{ "sound", "打撃5", "blow5" },
+		{ "sound", "大地7", "earth07" },
+		{ "sound", "睡眠", "sleep" },
+		{ "sound", "にらみ", "gaze" },
+		{ "faceset", "一般1", "faces1" },
+		{ "battlecharset", "男性４a", "man4 a" },
+		{ "sound", "巻き付き", "ensnare" },
+		{ "sound", "毒", "poison" },
+		{ "sound", "爆発3", "explode3" },
+		{ "sound", "ひつじ", "sheep" },
+		{ "battlecharset", "男性３a", "chuaza" },
+		{ "sound", "霧1", "fog1" },
+		{ "music", "フィールド2", "field 2" },
+		{ "monster", "ジャック・オー・ランタン", "jack" },
+		{ "music", "船2", "boat2" },
+		{ "sound", "回復4", "heal4" },
+		{ "sound", "斬る6", "cut6" },
+		{ "sound", "冷気6", "cold6" },
+		{ "music", "オープニング2", "opening 2" },
+		{ "music", "2003孤独な旅立ち", "2003lonelyjourney" },
+		{ "sound", "魔法2", "magic2" },
+		{ "charset", "一般3", "char3" },
+		{ "battlecharset", "勇者男b", "hero-m-2" },
+		{ "monster", "ダークナイト", "dark knight" },
+		{ "music", "2003悠久の時の流れに", "2003calm" },
+		{ "music", "jファンファーレ3", "fanfare3" },
+		{ "backdrop", "ダンジョン４", "cave4" },
+		{ "sound", "炎3", "fire3" },
+		{ "music", "jギャグ2", "gag2" },
+		{ "music", "戦闘2", "battle 2" },
+		{ "music", "se大雨", "se-torrent" },
+		{ "battlecharset", "魔術師男a", "mage-m-1" },
+		{ "sound", "ネコ", "cat" },
+		{ "faceset", "主人公2", "actor2" },
+		{ "monster", "リザードマン", "lizardman" },
+		{ "monster", "ガルーダ", "flyingwarrior" },
+		{ "music", "塔1", "tower 1" },
+		{ "sound", "神聖8", "holy8" },
+		{ "music", "2003小さな兵隊のマーチ", "2003little army's march" },
+		{ "sound", "ウシ", "cow" },
+		{ "music", "塔2", "tower 2" },
+		{ "music", "フィールド4", "field 4" },
+		{ "music", "2003マキシマム・バトル", "2003maximum battle" },
+		{ "music", "神秘1", "mystery 1" },
+		{ "sound", "打撃4", "blow4" },
+		{ "music", "j2003ホルン", "2003win" },
+		{ "sound", "移動", "footstep" },
+		{ "monster", "ガーゴイル", "gargoyle" },
+		{ "monster", "コボルト", "kobold" },
+		{ "music", "2003パニック", "2003panic" },
+		{ "music", "戦闘3", "battle 3" },
+		{ "music", "jファンファーレ6", "fanfare6" },
+		{ "music", "2003街の賑わい", "2003city bustle" },
+		{ "music", "2003未開の集落", "2003unexploredvillage" },
+		{ "faceset", "一般2", "faces2" },
+		{ "battle", "雷", "bolt2" },
+		{ "battlecharset", "魔術師女b", "female mage b" },
+		{ "backdrop", "お寺", "shrine" },
+		{ "sound", "斬る9", "cut9" },
+		{ "sound", "雷7", "bolt07" },
+		{ "monster", "スネーク", "dangeroussnake" },
+		{ "monster", "サイクロプス", "cyclops" },
+		{ "sound", "弓1", "bow1" },
+		{ "monster", "朱雀", "redsparrow" },
+		{ "sound", "雷10", "bolt10" },
+		{ "backdrop", "山道", "canyon" },
+		{ "sound", "モンスター2", "monster2" },
+		{ "music", "2003コロシアム", "2003colloseum" },
+		{ "monster", "トード", "frog" },
+		{ "music", "ピンチ", "crisis" },
+		{ "monster", "ビッグフット", "big foot" },
+		{ "sound", "斬る3", "cut3" },
+		{ "monster", "イフリート", "efreet" },
+		{ "battlecharset", "中華男a", "chinese man a" },
+		{ "battlecharset", "勇者男a", "hero-m-1" },
+		{ "sound", "壁1", "barrier1" },
+		{ "music", "オープニング3", "opening 3" },
+		{ "sound", "大地3", "earth03" },
+		{ "battlecharset", "盗賊男a", "male bandit a" },
+		{ "chipset", "基本", "basic" },
+		{ "music", "2003記憶の彼方に", "2003deep memory" },
+		{ "backdrop", "ダンジョン１", "cave" },
+		{ "battle", "2003ブレス", "2003 breath" },
+		{ "sound", "壁2", "barrier2" },
+		{ "music", "ダンジョン4", "dungeon 4" },
+		{ "sound", "斬る1", "cut1" },
+		{ "sound", "大地5", "earth05" },
+		{ "music", "j戦闘終了4", "battleend4" },
+		{ "battlecharset", "鎧武者a", "armor1" },
+		{ "monster", "グレル", "grell" },
+		{ "system", "システムb", "system3" },
+		{ "music", "2003王宮のパーティー", "2003courtparty" },
+		{ "backdrop", "森１", "forest1" },
+		{ "charset", "オブジェクト2", "object2" },
+		{ "sound", "イヌ", "dog" },
+		{ "sound", "炎6", "fire6" },
+		{ "battlecharset", "格闘家男a", "grapplehousemana" },
+		{ "battle", "2003神聖", "2003 holy" },
+		{ "sound", "フラッシュ2", "flash2" },
+		{ "sound", "風6", "wind06" },
+		{ "battle", "2003冷気", "2003 cold" },
+		{ "music", "エンディング1", "ending 1" },
+		{ "battlecharset", "男性１b", "jidadb" },
+		{ "battlecharset", "侍b", "garreb" },
+		{ "music", "2003機械要塞", "2003machine fortress" },
+		{ "monster", "ワイバーン", "browndragon" },
+		{ "backdrop", "橋", "bridge" },
+		{ "sound", "暗黒4", "dark4" },
+		{ "sound", "スイッチ1", "switch1" },
+		{ "faceset", "主人公1", "actor1" },
+		{ "music", "店3", "shop 3" },
+		{ "music", "2003穏やかな風", "2003calmwind" },
+		{ "music", "安らぎ1", "peace1" },
+		{ "monster", "ケンタウロス", "centaur" },
+		{ "monster", "パラサイト", "all-knowing" },
+		{ "monster", "ドラゴンナイト", "dragon knight" },
+		{ "monster", "スコーピオン", "redscorpion" },
+		{ "music", "j宿2", "inn2" },
+		{ "battle", "風", "wind" },
+		{ "battle", "爪", "claw" },
+		{ "monster", "バジリスク", "basilisk" },
+		{ "battle", "冷気", "cold" },
+		{ "backdrop", "街中", "city" },
+		{ "music", "2003古城", "2003ancient city" },
+		{ "monster", "ゾンビ", "poisonzombie" },
+		{ "backdrop", "路上", "road" },
+		{ "sound", "爆発5", "explode5" },
+		{ "sound", "回避2", "evade2" },
+		{ "music", "船3", "boat3" },
+		{ "sound", "爆発7", "explode7" },
+		{ "music", "jファンファーレ5", "fanfare5" },
+		{ "charset", "一般5", "char5" },
+		{ "backdrop", "旧市街", "ghost-town" },
+		{ "charset", "一般4", "char4" },
+		{ "music", "2003大聖堂", "2003cathedral" },
+		{ "music", "2003繰り返される戦い", "2003fastbattle2" },
+		{ "monster", "ラミア", "gorgon-2" },
+		{ "backdrop", "宇宙", "galaxy" },
+		{ "sound", "冷気8", "cold8" },
+		{ "sound", "ダメージ1", "damage1" },
+		{ "sound", "しびれ3", "numbness3" },
+		{ "sound", "カーソル1", "cursor1" },
+		{ "monster", "アスラ", "asura" },
+		{ "music", "安らぎ3", "peace3" },
+		{ "monster", "マンティス", "insect" },
+		{ "battle", "蘇生", "ray" },
+		{ "monster", "セラフィム", "angel" },
+		{ "battlecharset", "女性３b", "irregiab" },
+		{ "charset", "オブジェクト1", "object1" },
+		{ "monster", "スキュラ", "scylla" },
+		{ "music", "町2", "town 2" },
+		{ "music", "se2003ジャングル", "se-jungle" },
+		{ "monster", "エルフ", "archer" },
+		{ "backdrop", "神殿", "greece" },
+		{ "music", "2003夢見心地", "2003dreaminess" },
+		{ "battlecharset", "戦士女b", "eljeab" },
+		{ "sound", "斬る2", "cut2" },
+		{ "monster", "トレント", "dendrid" },
+		{ "battlecharset", "中華女b", "chinese woman b" },
+		{ "battle", "2003風", "2003 wind" },
+		{ "monster", "ネペンテス", "killerplant" },
+		{ "monster", "ティアマット", "many-domeddragon" },
+		{ "battle", "治療", "cure2" },
+		{ "sound", "噛む", "bite" },
+		{ "panorama", "夜明け1", "dawn1" },
+		{ "battle", "2003弓", "2003 bow" },
+		{ "sound", "決定2", "choice2" },
+		{ "monster", "フェンリル", "fenrir" },
+		{ "music", "ダンジョン5", "dungeon 5" },
+		{ "battlecharset", "中華女a", "chinese woman a" },
+		{ "monster", "九尾の狐", "foxofninetails" },
+		{ "music", "オープニング1", "opening 1" },
+		{ "sound", "魔法1", "magic1" },
+		{ "sound", "回復8", "heal8" },
+		{ "sound", "閉める2", "close2" },
+		{ "battlecharset", "魔術師女a", "female mage a" },
+		{ "battlecharset", "中華男b", "chinese man b" },
+		{ "sound", "ノック", "knock" },
+		{ "sound", "フラッシュ1", "flash1" },
+		{ "backdrop", "洋館", "building" },
+		{ "battlecharset", "盗賊男b", "male bandit b" },
+		{ "panorama", "異空間", "dimension rift" },
+		{ "sound", "風8", "wind08" },
+		{ "music", "2003スノータウン", "2003lullaby" },
+		{ "music", "se2003風", "se-gale" },
+		{ "sound", "蘇生2", "raise2" },
+		{ "music", "2003カジノ三昧", "2003casino" },
+		{ "sound", "回復1", "heal1" },
+		{ "music", "ボス1", "boss 1" },
+		{ "music", "2003緊迫", "2003tension" },
+		{ "monster", "バーサーカー", "barbarian" },
+		{ "monster", "ジャイアント", "cannibal" },
+		{ "sound", "雷3", "bolt03" },
+		{ "sound", "冷気10", "cold10" },
+		{ "music", "活気", "energy" },
+		{ "sound", "剣3", "sword3" },
+		{ "monster", "クラブ", "cancer" },
+		{ "gameover", "ゲームオーバー", "game over" },
+		{ "panorama", "夜空2", "night sky2" },
+		{ "music", "エンディング2", "ending 2" },
+		{ "sound", "雨2", "rain2" },
+		{ "battle", "2003その他1", "2003 other1" },
+		{ "sound", "神聖1", "holy1" },
+		{ "monster", "マンモス", "mammoth" },
+		{ "sound", "水3", "water3" },
+		{ "music", "別れ1", "farewell1" },
+		{ "music", "ゲームオーバー1", "game over 1" },
+		{ "battlecharset", "格闘家女b", "female fighter b" },
+		{ "sound", "打撃1", "blow1" },
+		{ "monster", "クロウラー", "crawler" },
+		{ "battlecharset", "戦士女a", "eljeaa" },
+		{ "sound", "ウマ", "horse" },
+		{ "sound", "大地6", "earth06" },
+		{ "monster", "麒麟", "fairytalehorse" },
+		{ "sound", "カーソル2", "cursor2" },
+		{ "sound", "落ちる2", "fall2" },
+		{ "chipset", "外観", "appearance" },
+		{ "music", "2003忍び寄る闇", "2003approachingdarkness" },
+		{ "music", "店1", "shop 1" },
+		{ "battle", "2003蘇生", "2003 revive" },
+		{ "sound", "爆発2", "explode2" },
+		{ "monster", "リッチ", "darkspirit" },
+		{ "title", "タイトル3", "title3" },
+		{ "monster", "ネクロマンサー", "cloakdemon" },
+		{ "sound", "斬る7", "cut7" },
+		{ "backdrop", "森２", "forest2" },
+		{ "sound", "冷気7", "cold7" },
+		{ "sound", "斬る10", "cut10" },
+		{ "sound", "にわとり", "chicken" },
+		{ "music", "2003無人の館", "2003deserted mansion" },
+		{ "battlecharset", "エルフ女b", "elf-f-2" },
+		{ "sound", "風11", "wind11" },
+		{ "backdrop", "空", "clouds" },
+		{ "music", "jファンファーレ2", "fanfare2" },
+		{ "sound", "ジャンプ2", "jump2" },
+		{ "sound", "トラ", "tiger" },
+		{ "sound", "回復5", "heal5" },
+		{ "backdrop", "ダンジョン２", "donjohnq" },
+		{ "music", "勇者2", "hero 2" },
+		{ "charset", "一般2", "char2" },
+		{ "sound", "炎2", "fire2" },
+		{ "sound", "ガシャン", "glass" },
+		{ "monster", "アーリマン", "ahriman" },
+		{ "music", "jギャグ1", "gag1" },
+		{ "music", "城1", "castle 1" },
+		{ "sound", "アイテム1", "item1" },
+		{ "backdrop", "ダンジョン６", "donjohnu" },
+		{ "monster", "龍", "bluedragon" },
+		{ "music", "村2", "village 2" },
+		{ "battle", "2003その他2", "2003 other2" },
+		{ "sound", "逃走", "escape" },
+		{ "music", "乗り物1", "ride1" },
+		{ "monster", "バハムート", "bahamut" },
+		{ "monster", "ゴブリン", "goblin" },
+		{ "sound", "打撃3", "blow3" },
+		{ "backdrop", "銭湯", "bath" },
+		{ "monster", "アンデッドナイト", "deadpirate" },
+		{ "sound", "神聖4", "holy4" },
+		{ "sound", "ライオン", "lion" },
+		{ "music", "2003大混戦", "2003free for all" },
+		{ "monster", "オーク", "hog" },
+		{ "battle", "2003光柱", "2003 light pillar" },
+		{ "sound", "雷6", "bolt06" },
+		{ "sound", "炎8", "fire8" },
+		{ "sound", "バリア", "barrier" },
+		{ "sound", "爆発1", "explode1" },
+		{ "sound", "雷1", "bolt01" },
+		{ "monster", "コカトリス", "cockatorice" },
+		{ "music", "怒り", "anger" },
+		{ "music", "妖精1", "fairy 1" },
+		{ "sound", "剣2", "sword2" },
+		{ "sound", "冷気2", "cold2" },
+		{ "battlecharset", "女性４a", "nysmaa" },
+		{ "music", "動物", "animal" },
+		{ "sound", "回復6", "heal6" },
+		{ "sound", "炎5", "fire5" },
 	};
 
-	RTP_TABLE_2000["music"] = {
-	 // Official English translation names
-	 {"items", "jアイテム"},
-	 {"gag1", "jギャグ1"},
-	 {"gag2", "jギャグ2"},
-	 {"fanfare1", "jファンファーレ1"},
-	 {"fanfare2", "jファンファーレ2"},
-	 {"fanfare3", "jファンファーレ3"},
-	 {"fanfare4", "jファンファーレ4"},
-	 {"fanfare5", "jファンファーレ5"},
-	 {"fanfare6", "jファンファーレ6"},
-	 {"inn1", "j宿1"},
-	 {"inn2", "j宿2"},
-	 {"battleend1", "j戦闘終了1"},
-	 {"battleend2", "j戦闘終了2"},
-	 {"battleend3", "j戦闘終了3"},
-	 {"battleend4", "j戦闘終了4"},
-	 {"suspicion", "j疑惑"},
-	 {"mystery", "j謎"},
-	 {"earthquake", "se地震"},
-	 {"rain2", "se大雨"},
-	 {"clock", "se時計"},
-	 {"sea", "se海"},
-	 {"rain1", "se雨"},
-	 {"ending1", "エンディング1"},
-	 {"ending2", "エンディング2"},
-	 {"ending3", "エンディング3"},
-	 {"opening1", "オープニング1"},
-	 {"opening2", "オープニング2"},
-	 {"opening3", "オープニング3"},
-	 {"gameover1", "ゲームオーバー1"},
-	 {"gameover2", "ゲームオーバー2"},
-	 {"gameover3", "ゲームオーバー3"},
-	 {"ghosttown1", "ゴーストタウン1"},
-	 {"ghosttown2", "ゴーストタウン2"},
-	 {"dungeon1", "ダンジョン1"},
-	 {"dungeon2", "ダンジョン2"},
-	 {"dungeon3", "ダンジョン3"},
-	 {"dungeon4", "ダンジョン4"},
-	 {"dungeon5", "ダンジョン5"},
-	 {"crisis", "ピンチ"},
-	 {"field1", "フィールド1"},
-	 {"field2", "フィールド2"},
-	 {"field3", "フィールド3"},
-	 {"field4", "フィールド4"},
-	 {"boss1", "ボス1"},
-	 {"boss2", "ボス2"},
-	 {"boss3", "ボス3"},
-	 {"boss4", "ボス4"},
-	 {"vehicle1", "乗り物1"},
-	 {"vehicle2", "乗り物2"},
-	 {"vehicle3", "乗り物3"},
-	 {"farewell1", "別れ1"},
-	 {"farewell2", "別れ2"},
-	 {"hero1", "勇者1"},
-	 {"hero2", "勇者2"},
-	 {"animal", "動物"},
-	 {"victory", "勝利"},
-	 {"castle1", "城1"},
-	 {"castle2", "城2"},
-	 {"castle3", "城3"},
-	 {"tower1", "塔1"},
-	 {"tower2", "塔2"},
-	 {"tower3", "塔3"},
-	 {"fairy1", "妖精1"},
-	 {"fairy2", "妖精2"},
-	 {"peace1", "安らぎ1"},
-	 {"peace2", "安らぎ2"},
-	 {"peace3", "安らぎ3"},
-	 {"store1", "店1"},
-	 {"store2", "店2"},
-	 {"store3", "店3"},
-	 {"anger", "怒り"},
-	 {"sorrow", "悲しみ"},
-	 {"battle1", "戦闘1"},
-	 {"battle2", "戦闘2"},
-	 {"battle3", "戦闘3"},
-	 {"search", "探索"},
-	 {"defeat", "敗北"},
-	 {"church", "教会"},
-	 {"marketplace", "明るい市場"},
-	 {"village1", "村1"},
-	 {"village2", "村2"},
-	 {"village3", "村3"},
-	 {"thief", "泥棒"},
-	 {"energy", "活気"},
-	 {"town1", "町1"},
-	 {"town2", "町2"},
-	 {"town3", "町3"},
-	 {"mystery1", "神秘1"},
-	 {"mystery2", "神秘2"},
-	 {"mystery3", "神秘3"},
-	 {"treasure", "秘宝"},
-	 {"ship1", "船1"},
-	 {"ship2", "船2"},
-	 {"ship3", "船3"},
-	 {"trial", "試練"},
-	 {"blackmarket", "闇市"},
-	 {"devil", "魔王"},
-
-	 // Don Miguel's English translation names
-	 {"item", "jアイテム"},
-	 {"doubt", "j疑惑"},
-	 {"riddle", "j謎"},
-	 {"seearthquake", "se地震"},
-	 {"serain2", "se大雨"},
-	 {"seclock", "se時計"},
-	 {"sesea", "se海"},
-	 {"serain", "se雨"},
-	 {"gosttown1", "ゴーストタウン1"},
-	 {"gosttown2", "ゴーストタウン2"},
-	 {"ride1", "乗り物1"},
-	 {"ride2", "乗り物2"},
-	 {"ride3", "乗り物3"},
-	 {"get", "勝利"},
-	 {"shop1", "店1"},
-	 {"shop2", "店2"},
-	 {"shop3", "店3"},
-	 {"sad", "悲しみ"},
-	 {"lose", "敗北"},
-	 {"fiesta", "明るい市場"},
-	 {"dark", "闇市"}
-
-	 // Orphaned Don Miguel's 2000 RTP extras with no match
-	 // inn3 shop4 night dungeon6/7 snow
-	 // ride4 mystery4 farewell3/4 pirate1-4
-	};
-
-	RTP_TABLE_2000["panorama"] = {
-	 // Official English translation names
-	 {"sunset1", "夕焼け1"},
-	 {"sunset2", "夕焼け2"},
-	 {"dawn1", "夜明け1"},
-	 {"dawn2", "夜明け2"},
-	 {"night sky1", "夜空1"},
-	 {"night sky2", "夜空2"},
-	 {"cosmos1", "宇宙"},
-	 {"planet1", "惑星1"},
-	 {"planet2", "惑星2"},
-	 {"planet3", "惑星3"},
-	 {"dimension rift", "異空間"},
-	 {"sky1", "空1"},
-	 {"sky2", "空2"},
-
-	 // Don Miguel's English translation names
-	 {"dawn1", "夕焼け1"},
-	 {"dawn2", "夕焼け2"},
-	 {"evening1", "夜明け1"},
-	 {"evening2", "夜明け2"},
-	 {"night1", "夜空1"},
-	 {"night2", "夜空2"},
-	 {"galaxy", "宇宙"},
-	 {"weird", "異空間"},
-	 {"morning1", "空1"},
-	 {"morning2", "空2"}
-	};
-
-	RTP_TABLE_2000["sound"] = {
-	 // Official English translation names
-	 {"item1", "アイテム1"},
-	 {"item2", "アイテム2"},
-	 {"chime1", "あたり1"},
-	 {"chime2", "あたり2"},
-	 {"buff", "アップ"},
-	 {"dog", "イヌ"},
-	 {"cow", "ウシ"},
-	 {"horse", "ウマ"},
-	 {"roar", "おたけび"},
-	 {"cursor1", "カーソル1"},
-	 {"cursor2", "カーソル2"},
-	 {"glassshatter", "ガシャン"},
-	 {"cancel1", "キャンセル1"},
-	 {"cancel2", "キャンセル2"},
-	 {"paralyze1", "しびれ1"},
-	 {"paralyze2", "しびれ2"},
-	 {"paralyze3", "しびれ3"},
-	 {"jump1", "ジャンプ1"},
-	 {"jump2", "ジャンプ2"},
-	 {"shot1", "ショット1"},
-	 {"shot2", "ショット2"},
-	 {"shot3", "ショット3"},
-	 {"switch1", "スイッチ1"},
-	 {"switch2", "スイッチ2"},
-	 {"debuff", "ダウン"},
-	 {"damage1", "ダメージ1"},
-	 {"damage2", "ダメージ2"},
-	 {"teleport1", "テレポート1"},
-	 {"teleport2", "テレポート2"},
-	 {"tiger", "トラ"},
-	 {"glare", "にらみ"},
-	 {"chicken", "にわとり"},
-	 {"cat", "ネコ"},
-	 {"knock", "ノック"},
-	 {"buzzer1", "はずれ1"},
-	 {"buzzer2", "はずれ2"},
-	 {"barrier", "バリア"},
-	 {"sheep", "ひつじ"},
-	 {"buzzer3", "ブザー1"},
-	 {"buzzer4", "ブザー2"},
-	 {"flash1", "フラッシュ1"},
-	 {"flash2", "フラッシュ2"},
-	 {"flash3", "フラッシュ3"},
-	 {"breath", "ブレス"},
-	 {"monster1", "モンスター1"},
-	 {"monster2", "モンスター2"},
-	 {"lion", "ライオン"},
-	 {"ice1", "冷気1"},
-	 {"ice2", "冷気2"},
-	 {"ice3", "冷気3"},
-	 {"ice4", "冷気4"},
-	 {"ice5", "冷気5"},
-	 {"ice6", "冷気6"},
-	 {"ice7", "冷気7"},
-	 {"ice8", "冷気8"},
-	 {"ice9", "冷気9"},
-	 {"ice10", "冷気10"},
-	 {"ice11", "冷気11"},
-	 {"sword1", "剣1"},
-	 {"sword2", "剣2"},
-	 {"sword3", "剣3"},
-	 {"absorb1", "吸収1"},
-	 {"absorb2", "吸収2"},
-	 {"bite", "噛む"},
-	 {"recovery1", "回復1"},
-	 {"recovery2", "回復2"},
-	 {"recovery3", "回復3"},
-	 {"recovery4", "回復4"},
-	 {"recovery5", "回復5"},
-	 {"recovery6", "回復6"},
-	 {"recovery7", "回復7"},
-	 {"recovery8", "回復8"},
-	 {"evade1", "回避1"},
-	 {"evade2", "回避2"},
-	 {"earthquake1", "地震1"},
-	 {"earthquake2", "地震2"},
-	 {"barrier1", "壁1"},
-	 {"barrier2", "壁2"},
-	 {"earth1", "大地1"},
-	 {"earth2", "大地2"},
-	 {"earth3", "大地3"},
-	 {"earth4", "大地4"},
-	 {"earth5", "大地5"},
-	 {"earth6", "大地6"},
-	 {"earth7", "大地7"},
-	 {"earth8", "大地8"},
-	 {"earth9", "大地9"},
-	 {"earth10", "大地10"},
-	 {"ensnare", "巻き付き"},
-	 {"bow1", "弓1"},
-	 {"bow2", "弓2"},
-	 {"combat1", "戦闘1"},
-	 {"combat2", "戦闘2"},
-	 {"blow1", "打撃1"},
-	 {"blow2", "打撃2"},
-	 {"blow3", "打撃3"},
-	 {"blow4", "打撃4"},
-	 {"blow5", "打撃5"},
-	 {"blow6", "打撃6"},
-	 {"blow7", "打撃7"},
-	 {"attack1", "攻撃1"},
-	 {"attack2", "攻撃2"},
-	 {"slash1", "斬る1"},
-	 {"slash2", "斬る2"},
-	 {"slash3", "斬る3"},
-	 {"slash4", "斬る4"},
-	 {"slash5", "斬る5"},
-	 {"slash6", "斬る6"},
-	 {"slash7", "斬る7"},
-	 {"slash8", "斬る8"},
-	 {"slash9", "斬る9"},
-	 {"slash10", "斬る10"},
-	 {"slash11", "斬る11"},
-	 {"clock", "時計"},
-	 {"blind", "暗闇"},
-	 {"darkness1", "暗黒1"},
-	 {"darkness2", "暗黒2"},
-	 {"darkness3", "暗黒3"},
-	 {"darkness4", "暗黒4"},
-	 {"darkness5", "暗黒5"},
-	 {"darkness6", "暗黒6"},
-	 {"song", "歌"},
-	 {"poison", "毒"},
-	 {"water1", "水1"},
-	 {"water2", "水2"},
-	 {"water3", "水3"},
-	 {"water4", "水4"},
-	 {"water5", "水5"},
-	 {"water6", "水6"},
-	 {"decision1", "決定1"},
-	 {"decision2", "決定2"},
-	 {"silence", "沈黙"},
-	 {"sea1", "海1"},
-	 {"sea2", "海2"},
-	 {"collapse1", "消滅1"},
-	 {"collapse2", "消滅2"},
-	 {"confusion", "混乱"},
-	 {"fire1", "炎1"},
-	 {"fire2", "炎2"},
-	 {"fire3", "炎3"},
-	 {"fire4", "炎4"},
-	 {"fire5", "炎5"},
-	 {"fire6", "炎6"},
-	 {"fire7", "炎7"},
-	 {"fire8", "炎8"},
-	 {"explosion1", "爆発1"},
-	 {"explosion2", "爆発2"},
-	 {"explosion3", "爆発3"},
-	 {"explosion4", "爆発4"},
-	 {"explosion5", "爆発5"},
-	 {"explosion6", "爆発6"},
-	 {"explosion7", "爆発7"},
-	 {"sleep", "睡眠"},
-	 {"sandstorm", "砂けむり"},
-	 {"holy1", "神聖1"},
-	 {"holy2", "神聖2"},
-	 {"holy3", "神聖3"},
-	 {"holy4", "神聖4"},
-	 {"holy5", "神聖5"},
-	 {"holy6", "神聖6"},
-	 {"holy7", "神聖7"},
-	 {"holy8", "神聖8"},
-	 {"holy9", "神聖9"},
-	 {"move", "移動"},
-	 {"pollen", "花粉"},
-	 {"fall1", "落ちる1"},
-	 {"fall2", "落ちる2"},
-	 {"raise1", "蘇生1"},
-	 {"raise2", "蘇生2"},
-	 {"raise3", "蘇生3"},
-	 {"escape", "逃走"},
-	 {"key", "鍵"},
-	 {"bell", "鐘"},
-	 {"close1", "閉める1"},
-	 {"close2", "閉める2"},
-	 {"open1", "開ける1"},
-	 {"open2", "開ける2"},
-	 {"rain1", "雨1"},
-	 {"rain2", "雨2"},
-	 {"thunder1", "雷1"},
-	 {"thunder2", "雷2"},
-	 {"thunder3", "雷3"},
-	 {"thunder4", "雷4"},
-	 {"thunder5", "雷5"},
-	 {"thunder6", "雷6"},
-	 {"thunder7", "雷7"},
-	 {"thunder8", "雷8"},
-	 {"thunder9", "雷9"},
-	 {"thunder10", "雷10"},
-	 {"fog1", "霧1"},
-	 {"fog2", "霧2"},
-	 {"wave1", "音波1"},
-	 {"wave2", "音波2"},
-	 {"wind1", "風1"},
-	 {"wind2", "風2"},
-	 {"wind3", "風3"},
-	 {"wind4", "風4"},
-	 {"wind5", "風5"},
-	 {"wind6", "風6"},
-	 {"wind7", "風7"},
-	 {"wind8", "風8"},
-	 {"wind9", "風9"},
-	 {"wind10", "風10"},
-	 {"wind11", "風11"},
-	 {"magic1", "魔法1"},
-	 {"magic2", "魔法2"},
-
-	 // Don Miguel's English translation names
-	 {"success1", "あたり1"},
-	 {"success2", "あたり2"},
-	 {"up", "アップ"},
-	 {"glass", "ガシャン"},
-	 {"cansel1", "キャンセル1"},
-	 {"cansel2", "キャンセル2"},
-	 {"numbness1", "しびれ1"},
-	 {"numbness2", "しびれ2"},
-	 {"numbness3", "しびれ3"},
-	 {"down", "ダウン"},
-	 {"power", "にらみ"},
-	 {"failure1", "はずれ1"},
-	 {"failure2", "はずれ2"},
-	 {"buzzer1", "ブザー1"},
-	 {"buzzer2", "ブザー2"},
-	 {"breast", "ブレス"},
-	 {"cold1", "冷気1"},
-	 {"cold2", "冷気2"},
-	 {"cold3", "冷気3"},
-	 {"cold4", "冷気4"},
-	 {"cold5", "冷気5"},
-	 {"cold6", "冷気6"},
-	 {"cold7", "冷気7"},
-	 {"cold8", "冷気8"},
-	 {"cold9", "冷気9"},
-	 {"cold10", "冷気10"},
-	 {"cold11", "冷気11"},
-	 {"absorption1", "吸収1"},
-	 {"absorption2", "吸収2"},
-	 {"evasion1", "回避1"},
-	 {"evasion2", "回避2"},
-	 {"knock", "壁1"}, // does not contain barrier1
-	 {"knock", "壁2"}, // does not contain barrier2
-	 {"refer book", "巻き付き"},
-	 {"fight1", "戦闘1"},
-	 {"fight2", "戦闘2"},
-	 {"kill1", "斬る1"},
-	 {"kill2", "斬る2"},
-	 {"kill3", "斬る3"},
-	 {"kill4", "斬る4"},
-	 {"kill5", "斬る5"},
-	 {"kill9", "斬る6"}, // does not contain slash6
-	 {"kill7", "斬る7"},
-	 {"kill8", "斬る8"},
-	 {"kill9", "斬る9"},
-	 {"kill10", "斬る10"},
-	 {"kill11", "斬る11"},
-	 {"darkness", "暗闇"},
-	 {"dark1", "暗黒1"},
-	 {"dark2", "暗黒2"},
-	 {"dark3", "暗黒3"},
-	 {"dark4", "暗黒4"},
-	 {"dark5", "暗黒5"},
-	 {"kill6", "暗黒6"},
-	 {"annihilation1", "消滅1"},
-	 {"annihilation2", "消滅2"},
-	 {"chaos", "混乱"},
-	 {"flame1", "炎1"},
-	 {"flame2", "炎2"},
-	 {"flame3", "炎3"},
-	 {"flame4", "炎4"},
-	 {"flame5", "炎5"},
-	 {"flame6", "炎6"},
-	 {"flame7", "炎7"},
-	 {"flame8", "炎8"},
-	 {"sand storm", "砂けむり"},
-	 {"movement", "移動"},
-	 {"rebirth1", "蘇生1"},
-	 {"rebirth2", "蘇生2"},
-	 {"rebirth3", "蘇生3"},
-	 {"sonic1", "音波1"},
-	 {"sonic2", "音波2"},
-	 {"wall1", "魔法1"},
-	 {"wall2", "魔法2"}
+	const int32_t seeds_2003_english[679] = {
+		-678, 0, -676, 1, 0, 0, 0, 1, -675, 1, -669, 1, 0, -668, -666, 1,
+		-665, -664, 0, 0, 0, 5, -662, 3, -659, 0, -658, -655, -654, 3, 0, -653,
+		0, 1, 9, -650, 0, 0, -649, 0, -648, -647, 0, -644, -643, 1, 2, 0,
+		0, 0, 0, 1, 0, 0, 0, -640, -636, -635, 1, -634, 0, 0, -631, -630,
+		1, -624, 0, 0, 0, 2, -623, 0, 0, 0, -619, 0, -616, -615, -613, -609,
+		0, 2, 0, 0, -608, 0, -605, 0, 0, 0, 3, 0, 0, 0, 0, 0,
+		-604, -595, -593, 0, -592, -589, 0, 0, 0, -585, -584, 0, -581, -578, -577, 0,
+		0, 1, 0, 0, 0, -575, 0, 2, 2, 0, 0, -567, 1, 0, 0, -562,
+		1, -561, -555, -553, 2, -548, 1, -544, 1, 0, 0, 2, 0, 1, 0, 6,
+		-543, 2, 0, -541, 7, 0, -540, -539, -538, 1, -537, 1, -534, -531, 1, 1,
+		0, 2, 2, -530, 1, -525, -523, 0, 1, 0, 0, -522, 0, 0, 0, -519,
+		-516, -514, 0, 1, -510, 1, 0, 1, -508, 0, 0, 1, 0, 0, -506, -505,
+		-504, 0, 0, -502, -499, -492, -488, -487, 2, 1, -486, -478, 0, 0, 0, -474,
+		1, 0, 0, 2, 0, -471, -466, 0, 1, 0, 6, 3, 10, -465, -463, -462,
+		-461, 1, -459, 0, -458, 1, -457, -454, 3, 3, -449, 0, -445, 0, 2, 1,
+		-442, 0, -437, 0, 0, 1, 5, -435, -434, -432, 1, -431, 1, 1, 0, 3,
+		-428, -427, -426, 4, 0, 0, 0, -419, 0, 5, 1, 1, 0, 0, 1, 3,
+		-418, -412, 0, 1, 0, -411, 0, 0, -409, 0, 3, -408, -405, 0, 0, 0,
+		0, -404, 1, -401, 3, 0, -399, 0, -394, -393, 1, 0, -390, -388, -387, 0,
+		-386, 0, -385, 0, -379, -373, 0, 1, 0, -372, -368, -366, -362, 1, 0, -361,
+		2, 5, 1, 0, 0, 2, 0, -357, 0, 0, 0, -355, -353, 0, -350, 1,
+		-349, -348, 0, 3, -344, 0, -343, 0, 1, 1, 7, 2, 0, 1, -341, -335,
+		0, 1, 0, 0, -334, -332, -330, 0, -326, -322, 1, 6, 0, 0, -321, 2,
+		0, 0, 3, -320, 0, 0, 0, 2, -318, -317, 0, -315, 2, 0, 0, 0,
+		0, 7, -314, -313, -309, 0, -302, -298, 7, -295, 0, -294, 1, 0, -293, 6,
+		-288, 0, 0, 0, -287, -285, 0, -281, -279, 7, 0, -278, 0, 0, 0, 1,
+		-277, 2, 9, 0, 0, -271, -270, 0, 0, 6, 1, 1, -269, 0, 1, -266,
+		0, -265, -264, 0, 1, 1, -263, 1, 0, 0, 5, 0, -262, 2, 10, 4,
+		-259, 0, -256, 3, 0, 0, 3, 0, -253, 0, 12, -250, -249, -247, 2, 0,
+		-246, -245, -244, -242, -240, 0, -236, 5, -235, -231, 1, 0, 2, -229, 4, -224,
+		5, 0, 0, -220, 0, 1, 1, -219, 0, -215, -212, 0, 0, -211, 1, 0,
+		0, 10, -210, 2, 2, -206, -205, -204, 0, 0, 1, 0, -203, -201, 0, -200,
+		0, 6, 0, 11, -198, -197, 0, 0, 0, 0, -196, -193, -189, -181, 0, -180,
+		0, 6, 4, 0, -179, 1, 7, 0, -178, 0, 16, -173, 6, 0, 0, 0,
+		0, -170, 0, 12, 0, -169, 0, -168, 1, -158, -155, -152, -149, 0, 4, 2,
+		0, 2, -143, -142, -138, -137, -136, 0, -135, -134, 0, -133, -132, -131, 0, -128,
+		-124, 0, 0, 0, 0, 0, -122, 0, 9, 0, 0, -121, -117, 0, -116, 2,
+		-112, 3, -111, -110, 0, 0, 5, 0, 0, 5, -109, -107, -104, -101, -99, 0,
+		3, -98, 0, -97, 14, 0, 0, -95, 1, -93, 0, -91, -87, 0, 0, -82,
+		6, 0, -78, -73, -70, 0, 6, -67, -63, 8, -58, -57, -55, -51, -50, -45,
+		0, -44, 1, 0, 7, -39, 0, 1, 0, -35, 2, 0, -34, 0, -28, 8,
+		-25, -22, -21, 1, 0, 11, 1, -18, -17, -14, -12, -11, 0, 1, 7, 6,
+		0, -7, 0, 0, 0, 0, 0,
 	};
 
-	RTP_TABLE_2000["system"] = {
-	 // Official English translation names
-	 {"system", "システム"},
+	const Table table_2003_english = { entries_2003_english, seeds_2003_english, 679 };
+}
 
-	 // Orphaned Don Miguel's 2000 RTP extras pointing to nearest match
-	 {"royal", "システム"}
-	};
+const char* RTP::FindJapaneseName(bool rpg2k, const std::string& folder, const std::string& name) {
+	return Lookup(rpg2k ? table_2000_japanese : table_2003_japanese, folder, name);
+}
 
-	RTP_TABLE_2000["title"] = {
-	 // Official English translation names
-	 {"title1", "タイトル1"},
-	 {"title2", "タイトル2"},
-	 {"title3", "タイトル3"},
-	 {"title4", "タイトル4"}
-	};
+const char* RTP::FindEnglishName(bool rpg2k, const std::string& folder, const std::string& name) {
+	return Lookup(rpg2k ? table_2000_english : table_2003_english, folder, name);
 }
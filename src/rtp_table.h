@@ -18,26 +18,35 @@
 #ifndef EP_RTP_TABLE_H
 #define EP_RTP_TABLE_H
 
-#include <map>
 #include <string>
-#include <cstring>
 
+/**
+ * Translation of file names between the Japanese RTP and the translated
+ * RTPs (English, Russian, Korean...).
+ *
+ * The tables are generated by resources/rtp_table/gen_rtp_table.py.
+ * Folder and file names are case insensitive.
+ */
 namespace RTP {
-	struct rtp_table_cmp {
-		bool operator()(char const* a, char const* b) const {
-			return std::strcmp(a, b) < 0;
-		}
-	};
-
-	using rtp_table_type = std::map<const char*, std::map<const char*, const char*, rtp_table_cmp>, rtp_table_cmp>;
-
-	void Init();
+	/**
+	 * Gets the Japanese name of a file of a translated RTP.
+	 *
+	 * @param rpg2k whether the RPG Maker 2000 RTP is used, otherwise 2003.
+	 * @param folder folder of the file, e.g. "charset".
+	 * @param name file name without extension.
+	 * @return Japanese name, null when the file is not in the table.
+	 */
+	const char* FindJapaneseName(bool rpg2k, const std::string& folder, const std::string& name);
 
 	/**
-	 * { folder: { ASCII, UTF-8 } }
+	 * Gets the name of a Japanese RTP file in a translated RTP.
+	 *
+	 * @param rpg2k whether the RPG Maker 2000 RTP is used, otherwise 2003.
+	 * @param folder folder of the file, e.g. "charset".
+	 * @param name Japanese file name without extension.
+	 * @return translated name, null when the file is not in the table.
 	 */
-	extern rtp_table_type RTP_TABLE_2003;
-	extern rtp_table_type RTP_TABLE_2000;
+	const char* FindEnglishName(bool rpg2k, const std::string& folder, const std::string& name);
 }
 
 #endif
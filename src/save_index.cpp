@@ -0,0 +1,456 @@
+/*
+ * This file is part of EasyRPG Player.
+ *
+ * EasyRPG Player is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * EasyRPG Player is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with EasyRPG Player. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Headers
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include "lsd_reader.h"
+#include "output.h"
+#include "player.h"
+#include "reader_util.h"
+#include "save_index.h"
+#include "utils.h"
+
+namespace {
+	const char index_name[] = "SaveIndex.easyrpg";
+	const char index_magic[] = "EPSI";
+	const uint32_t index_version = 1;
+
+	// Chunk ids of the savegame format (see lsd_chunks.h of liblcf)
+	const uint32_t chunk_save_title = 0x64;
+	enum TitleChunk {
+		title_timestamp = 0x01,
+		title_hero_name = 0x0B,
+		title_hero_level = 0x0C,
+		title_hero_hp = 0x0D,
+		title_face1_name = 0x15,
+		title_face1_id = 0x16,
+		title_face2_name = 0x17,
+		title_face2_id = 0x18,
+		title_face3_name = 0x19,
+		title_face3_id = 0x1A,
+		title_face4_name = 0x1B,
+		title_face4_id = 0x1C
+	};
+
+	// A title chunk is a few hundred bytes, larger ones are not trusted
+	const uint32_t max_title_size = 64 * 1024;
+
+	// Workers reading the titles of the uncached savegames
+	const unsigned max_workers = 4;
+
+	// LcfReader keeps its error state in globals
+	std::mutex lcf_mutex;
+
+	bool ReadBer(FILE* file, uint32_t& value) {
+		value = 0;
+		for (int i = 0; i < 5; ++i) {
+			int c = fgetc(file);
+			if (c == EOF) {
+				return false;
+			}
+			value = (value << 7) | (c & 0x7F);
+			if (!(c & 0x80)) {
+				return true;
+			}
+		}
+		return false;
+	}
+
+	bool ReadBer(const uint8_t*& it, const uint8_t* end, uint32_t& value) {
+		value = 0;
+		for (int i = 0; i < 5 && it != end; ++i) {
+			uint8_t c = *it++;
+			value = (value << 7) | (c & 0x7F);
+			if (!(c & 0x80)) {
+				return true;
+			}
+		}
+		return false;
+	}
+
+	bool ParseTitle(const std::vector<uint8_t>& data, const std::string& encoding, RPG::SaveTitle& title) {
+		const uint8_t* it = data.data();
+		const uint8_t* end = it + data.size();
+
+		while (it != end) {
+			uint32_t id, size;
+			if (!ReadBer(it, end, id)) {
+				return false;
+			}
+			if (id == 0) {
+				break;
+			}
+			if (!ReadBer(it, end, size) || size > (uint32_t)(end - it)) {
+				return false;
+			}
+
+			const uint8_t* chunk = it;
+			const uint8_t* chunk_end = it + size;
+			it = chunk_end;
+
+			uint32_t number = 0;
+			std::string str;
+			switch (id) {
+				case title_timestamp:
+					if (size != sizeof(double)) {
+						return false;
+					}
+					memcpy(&title.timestamp, chunk, sizeof(double));
+					Utils::SwapByteOrder(title.timestamp);
+					continue;
+				case title_hero_name:
+				case title_face1_name:
+				case title_face2_name:
+				case title_face3_name:
+				case title_face4_name:
+					str = ReaderUtil::Recode(std::string(chunk, chunk_end), encoding);
+					break;
+				case title_hero_level:
+				case title_hero_hp:
+				case title_face1_id:
+				case title_face2_id:
+				case title_face3_id:
+				case title_face4_id:
+					if (!ReadBer(chunk, chunk_end, number)) {
+						return false;
+					}
+					break;
+				default:
+					continue;
+			}
+
+			switch (id) {
+				case title_hero_name: title.hero_name = str; break;
+				case title_face1_name: title.face1_name = str; break;
+				case title_face2_name: title.face2_name = str; break;
+				case title_face3_name: title.face3_name = str; break;
+				case title_face4_name: title.face4_name = str; break;
+				case title_hero_level: title.hero_level = (int32_t)number; break;
+				case title_hero_hp: title.hero_hp = (int32_t)number; break;
+				case title_face1_id: title.face1_id = (int32_t)number; break;
+				case title_face2_id: title.face2_id = (int32_t)number; break;
+				case title_face3_id: title.face3_id = (int32_t)number; break;
+				case title_face4_id: title.face4_id = (int32_t)number; break;
+			}
+		}
+
+		return true;
+	}
+
+	/** Reads the title by parsing the chunks in front of it */
+	bool ReadTitleChunk(const std::string& file, const std::string& encoding, RPG::SaveTitle& title) {
+		std::shared_ptr<FILE> stream(FileFinder::fopenUTF8(file, "rb"), [](FILE* f) {
+			if (f) {
+				fclose(f);
+			}
+		});
+		if (!stream) {
+			return false;
+		}
+		FILE* f = stream.get();
+
+		uint32_t header_size;
+		char header[11];
+		if (!ReadBer(f, header_size) || header_size != sizeof(header) ||
+			fread(header, 1, sizeof(header), f) != sizeof(header) ||
+			memcmp(header, "LcfSaveData", sizeof(header)) != 0) {
+			return false;
+		}
+
+		for (;;) {
+			uint32_t id, size;
+			if (!ReadBer(f, id) || id == 0 || !ReadBer(f, size)) {
+				return false;
+			}
+
+			if (id != chunk_save_title) {
+				if (fseek(f, size, SEEK_CUR) != 0) {
+					return false;
+				}
+				continue;
+			}
+
+			if (size > max_title_size) {
+				return false;
+			}
+			std::vector<uint8_t> data(size);
+			if (fread(data.data(), 1, size, f) != size) {
+				return false;
+			}
+			return ParseTitle(data, encoding, title);
+		}
+	}
+
+	class IndexWriter {
+	public:
+		void U32(uint32_t value) {
+			Utils::SwapByteOrder(value);
+			Append(&value, sizeof(value));
+		}
+		void I64(int64_t value) {
+			U32((uint32_t)((uint64_t)value & 0xFFFFFFFF));
+			U32((uint32_t)((uint64_t)value >> 32));
+		}
+		void Double(double value) {
+			Utils::SwapByteOrder(value);
+			Append(&value, sizeof(value));
+		}
+		void String(const std::string& value) {
+			U32(value.size());
+			Append(value.data(), value.size());
+		}
+
+		std::vector<uint8_t> data;
+
+	private:
+		void Append(const void* src, size_t size) {
+			const uint8_t* bytes = reinterpret_cast<const uint8_t*>(src);
+			data.insert(data.end(), bytes, bytes + size);
+		}
+	};
+
+	class IndexReader {
+	public:
+		IndexReader(const std::vector<uint8_t>& data, size_t offset) :
+			it(data.data() + std::min(offset, data.size())), end(data.data() + data.size()) {}
+
+		bool U32(uint32_t& value) {
+			if (!Take(&value, sizeof(value))) {
+				return false;
+			}
+			Utils::SwapByteOrder(value);
+			return true;
+		}
+		bool I32(int& value) {
+			uint32_t v;
+			if (!U32(v)) {
+				return false;
+			}
+			value = (int32_t)v;
+			return true;
+		}
+		bool I64(int64_t& value) {
+			uint32_t low, high;
+			if (!U32(low) || !U32(high)) {
+				return false;
+			}
+			value = (int64_t)(((uint64_t)high << 32) | low);
+			return true;
+		}
+		bool Double(double& value) {
+			if (!Take(&value, sizeof(value))) {
+				return false;
+			}
+			Utils::SwapByteOrder(value);
+			return true;
+		}
+		bool String(std::string& value) {
+			uint32_t size;
+			if (!U32(size) || size > (uint32_t)(end - it)) {
+				return false;
+			}
+			value.assign(it, it + size);
+			it += size;
+			return true;
+		}
+
+	private:
+		bool Take(void* dst, size_t size) {
+			if (size > (size_t)(end - it)) {
+				return false;
+			}
+			memcpy(dst, it, size);
+			it += size;
+			return true;
+		}
+
+		const uint8_t* it;
+		const uint8_t* end;
+	};
+}
+
+SaveIndex::SaveIndex(const std::string& directory, std::vector<std::string> files) :
+	index_file(FileFinder::MakePath(directory, index_name)),
+	encoding(Player::encoding),
+	files(std::move(files)) {
+
+	cached.resize(this->files.size());
+	entries.resize(this->files.size());
+
+	LoadIndex();
+
+	workers.Start(this->files.size(), max_workers, false,
+		[this](int i) { return Read(i); }, [this]() { WriteIndex(); });
+}
+
+SaveIndex::~SaveIndex() {
+	workers.Stop();
+}
+
+bool SaveIndex::Poll(std::vector<int>& read) {
+	return workers.Poll(read);
+}
+
+const SaveIndex::Slot& SaveIndex::GetSlot(int slot) const {
+	return entries[slot].slot;
+}
+
+bool SaveIndex::ReadTitle(const std::string& file, const std::string& encoding, RPG::SaveTitle& title) {
+	if (ReadTitleChunk(file, encoding, title)) {
+		return true;
+	}
+
+	// Unusual layout, let liblcf handle it
+	std::lock_guard<std::mutex> lock(lcf_mutex);
+	std::unique_ptr<RPG::Save> savegame = LSD_Reader::Load(file, encoding);
+	if (!savegame) {
+		return false;
+	}
+	title = savegame->title;
+	return true;
+}
+
+bool SaveIndex::Read(int i) {
+	Entry& entry = entries[i];
+	if (files[i].empty()) {
+		return cached[i].valid;
+	}
+
+	entry.valid = true;
+	entry.mtime = FileFinder::GetFileModifiedTime(files[i]);
+	entry.size = FileFinder::GetFileSize(files[i]);
+
+	const Entry& old = cached[i];
+	if (old.valid && entry.mtime >= 0 && old.mtime == entry.mtime && old.size == entry.size) {
+		entry.slot = old.slot;
+		return false;
+	}
+
+	entry.slot.has_save = true;
+	entry.slot.corrupted = !ReadTitle(files[i], encoding, entry.slot.title);
+	return true;
+}
+
+void SaveIndex::LoadIndex() {
+	std::shared_ptr<FILE> stream(FileFinder::fopenUTF8(index_file, "rb"), [](FILE* f) {
+		if (f) {
+			fclose(f);
+		}
+	});
+	if (!stream) {
+		return;
+	}
+
+	std::vector<uint8_t> data;
+	uint8_t buffer[4096];
+	size_t len;
+	while ((len = fread(buffer, 1, sizeof(buffer), stream.get())) > 0) {
+		data.insert(data.end(), buffer, buffer + len);
+	}
+
+	const size_t magic_size = sizeof(index_magic) - 1;
+	if (data.size() < magic_size || memcmp(data.data(), index_magic, magic_size) != 0) {
+		return;
+	}
+
+	IndexReader reader(data, magic_size);
+	std::vector<Entry> loaded(cached.size());
+	uint32_t version, count;
+	std::string file_encoding;
+	if (!reader.U32(version) || version != index_version ||
+		!reader.String(file_encoding) || file_encoding != encoding ||
+		!reader.U32(count)) {
+		return;
+	}
+
+	for (uint32_t i = 0; i < count; ++i) {
+		uint32_t slot, flags;
+		int64_t size;
+		Entry entry;
+		RPG::SaveTitle& title = entry.slot.title;
+		if (!reader.U32(slot) || !reader.I64(entry.mtime) || !reader.I64(size) ||
+			!reader.U32(flags) || !reader.Double(title.timestamp) ||
+			!reader.String(title.hero_name) || !reader.I32(title.hero_level) || !reader.I32(title.hero_hp) ||
+			!reader.String(title.face1_name) || !reader.I32(title.face1_id) ||
+			!reader.String(title.face2_name) || !reader.I32(title.face2_id) ||
+			!reader.String(title.face3_name) || !reader.I32(title.face3_id) ||
+			!reader.String(title.face4_name) || !reader.I32(title.face4_id)) {
+			Output::Debug("Ignoring broken savegame index %s", index_file.c_str());
+			return;
+		}
+		if (slot >= loaded.size()) {
+			continue;
+		}
+		entry.valid = true;
+		entry.size = (Offset)size;
+		entry.slot.has_save = true;
+		entry.slot.corrupted = (flags & 1) != 0;
+		loaded[slot] = std::move(entry);
+	}
+
+	cached = std::move(loaded);
+}
+
+void SaveIndex::WriteIndex() const {
+	// Writes to the save directory must be synced explicitly on Emscripten,
+	// not worth it for the index
+#ifndef EMSCRIPTEN
+	IndexWriter writer;
+	writer.data.insert(writer.data.end(), index_magic, index_magic + sizeof(index_magic) - 1);
+	writer.U32(index_version);
+	writer.String(encoding);
+	writer.U32(std::count_if(entries.begin(), entries.end(), [](const Entry& entry) {
+		return entry.valid;
+	}));
+
+	for (size_t i = 0; i < entries.size(); ++i) {
+		const Entry& entry = entries[i];
+		if (!entry.valid) {
+			continue;
+		}
+		const RPG::SaveTitle& title = entry.slot.title;
+		writer.U32(i);
+		writer.I64(entry.mtime);
+		writer.I64(entry.size);
+		writer.U32(entry.slot.corrupted ? 1 : 0);
+		writer.Double(title.timestamp);
+		writer.String(title.hero_name);
+		writer.U32(title.hero_level);
+		writer.U32(title.hero_hp);
+		writer.String(title.face1_name);
+		writer.U32(title.face1_id);
+		writer.String(title.face2_name);
+		writer.U32(title.face2_id);
+		writer.String(title.face3_name);
+		writer.U32(title.face3_id);
+		writer.String(title.face4_name);
+		writer.U32(title.face4_id);
+	}
+
+	FILE* f = FileFinder::fopenUTF8(index_file, "wb");
+	if (!f) {
+		// Read-only save directory, the titles are read again next time
+		return;
+	}
+	if (fwrite(writer.data.data(), 1, writer.data.size(), f) != writer.data.size()) {
+		Output::Debug("Could not write savegame index %s", index_file.c_str());
+	}
+	fclose(f);
+#endif
+}
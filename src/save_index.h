@@ -0,0 +1,112 @@
+/*
+ * This file is part of EasyRPG Player.
+ *
+ * EasyRPG Player is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * EasyRPG Player is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with EasyRPG Player. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef EP_SAVE_INDEX_H
+#define EP_SAVE_INDEX_H
+
+// Headers
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "filefinder.h"
+#include "index_workers.h"
+#include "rpg_savetitle.h"
+
+/**
+ * Reads the title blocks of the savegames listed by the save and load scenes.
+ *
+ * Only the title chunk of a savegame is parsed, this happens on worker
+ * threads (inline on Emscripten). The titles are cached in an index file in the save directory,
+ * a savegame is only opened again when its modification time or size
+ * changed.
+ */
+class SaveIndex {
+public:
+	struct Slot {
+		/** The slot has a savegame */
+		bool has_save = false;
+		/** The title of the savegame could not be read */
+		bool corrupted = false;
+		RPG::SaveTitle title;
+	};
+
+	/**
+	 * Starts reading the titles.
+	 *
+	 * @param directory save directory, the index file is stored there.
+	 * @param files path of the savegame of every slot, empty when the slot
+	 *              has no savegame.
+	 */
+	SaveIndex(const std::string& directory, std::vector<std::string> files);
+
+	/**
+	 * Stops the workers, titles not read yet are discarded.
+	 */
+	~SaveIndex();
+
+	/**
+	 * Gets the slots that were read since the last call.
+	 *
+	 * @param read receives the numbers of the slots.
+	 * @return whether all slots were read.
+	 */
+	bool Poll(std::vector<int>& read);
+
+	/**
+	 * Gets a slot returned by Poll.
+	 *
+	 * @param slot slot number.
+	 * @return the slot.
+	 */
+	const Slot& GetSlot(int slot) const;
+
+	/**
+	 * Reads the title chunk of a savegame.
+	 *
+	 * @param file path of the savegame.
+	 * @param encoding encoding of the strings in the savegame.
+	 * @param title receives the title.
+	 * @return whether the title was read.
+	 */
+	static bool ReadTitle(const std::string& file, const std::string& encoding, RPG::SaveTitle& title);
+
+private:
+	struct Entry {
+		bool valid = false;
+		int64_t mtime = -1;
+		Offset size = -1;
+		Slot slot;
+	};
+
+	bool Read(int i);
+	void LoadIndex();
+	void WriteIndex() const;
+
+	std::string index_file;
+	std::string encoding;
+	std::vector<std::string> files;
+
+	/** Content of the index file */
+	std::vector<Entry> cached;
+	/** Current state of the savegames, written by the workers */
+	std::vector<Entry> entries;
+
+	/** Last member: Destroyed first, the workers use the other members */
+	IndexWorkers workers;
+};
+
+#endif
@@ -0,0 +1,140 @@
+/*
+ * This file is part of EasyRPG Player.
+ *
+ * EasyRPG Player is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * EasyRPG Player is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with EasyRPG Player. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Headers
+#include <condition_variable>
+#include <cstdio>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include "filefinder.h"
+#include "lsd_reader.h"
+#include "save_writer.h"
+
+#if !(defined(_WIN32) || defined(PSP2) || defined(GEKKO) || defined(_3DS) || defined(__SWITCH__) || defined(EMSCRIPTEN))
+#  define SAVE_WRITER_FSYNC
+#  include <fcntl.h>
+#  include <unistd.h>
+#endif
+
+namespace {
+	struct Job {
+		std::string filename;
+		std::unique_ptr<RPG::Save> save;
+		std::string encoding;
+		std::shared_ptr<std::atomic<SaveWriter::State> > state;
+	};
+
+	class Writer {
+	public:
+		~Writer();
+
+		void Run();
+
+		std::mutex mutex;
+		std::condition_variable cv;
+		std::thread thread;
+		std::deque<Job> jobs;
+		bool quit = false;
+	};
+
+	Writer writer;
+
+	/** Makes sure the data is on the disk before the old savegame is replaced */
+	void Sync(const std::string& filename) {
+#ifdef SAVE_WRITER_FSYNC
+		int fd = open(filename.c_str(), O_RDONLY);
+		if (fd >= 0) {
+			fsync(fd);
+			close(fd);
+		}
+#else
+		(void)filename;
+#endif
+	}
+
+	void Execute(Job& job) {
+		std::string tmp_filename = job.filename + ".tmp";
+
+		bool success = LSD_Reader::Save(tmp_filename, *job.save, job.encoding);
+		job.save.reset();
+
+		if (success) {
+			Sync(tmp_filename);
+			success = FileFinder::Rename(tmp_filename, job.filename);
+		}
+
+		if (!success) {
+			std::remove(tmp_filename.c_str());
+		}
+
+		*job.state = success ? SaveWriter::State::Written : SaveWriter::State::Failed;
+	}
+}
+
+Writer::~Writer() {
+	if (thread.joinable()) {
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			quit = true;
+		}
+		cv.notify_one();
+		thread.join();
+	}
+}
+
+void Writer::Run() {
+	std::unique_lock<std::mutex> lock(mutex);
+	for (;;) {
+		if (jobs.empty()) {
+			// Queued savegames are written before quitting
+			if (quit) {
+				return;
+			}
+			cv.wait(lock);
+			continue;
+		}
+
+		Job job = std::move(jobs.front());
+		jobs.pop_front();
+		lock.unlock();
+
+		Execute(job);
+
+		lock.lock();
+	}
+}
+
+SaveWriter::Handle SaveWriter::Write(const std::string& filename, std::unique_ptr<RPG::Save> save, const std::string& encoding) {
+	auto state = std::make_shared<std::atomic<State> >(State::Writing);
+	Job job { filename, std::move(save), encoding, state };
+
+#ifdef EMSCRIPTEN
+	// No threads, the savegame is written to memory and synced later anyway
+	Execute(job);
+#else
+	std::lock_guard<std::mutex> lock(writer.mutex);
+	writer.jobs.push_back(std::move(job));
+
+	if (!writer.thread.joinable()) {
+		writer.thread = std::thread(&Writer::Run, &writer);
+	}
+	writer.cv.notify_one();
+#endif
+
+	return state;
+}
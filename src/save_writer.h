@@ -0,0 +1,56 @@
+/*
+ * This file is part of EasyRPG Player.
+ *
+ * EasyRPG Player is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * EasyRPG Player is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with EasyRPG Player. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef EP_SAVE_WRITER_H
+#define EP_SAVE_WRITER_H
+
+// Headers
+#include <atomic>
+#include <memory>
+#include <string>
+#include "rpg_save.h"
+
+/**
+ * Writes savegames on a background thread.
+ *
+ * The savegame is serialized into a temporary file next to the target which
+ * replaces the target when it was written completely. An interrupted write
+ * never damages an existing savegame.
+ */
+namespace SaveWriter {
+	enum class State {
+		Writing,
+		Written,
+		Failed
+	};
+
+	/** Progress of a write, updated by the writer thread */
+	typedef std::shared_ptr<const std::atomic<State> > Handle;
+
+	/**
+	 * Queues a savegame for writing. Queued savegames are still written when
+	 * the Player exits.
+	 *
+	 * @param filename path of the savegame.
+	 * @param save snapshot of the savegame, owned by the writer.
+	 * @param encoding encoding of the strings in the savegame.
+	 * @return progress of the write.
+	 */
+	Handle Write(const std::string& filename, std::unique_ptr<RPG::Save> save, const std::string& encoding);
+}
+
+#endif
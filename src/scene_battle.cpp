@@ -51,6 +51,7 @@ Scene_Battle::Scene_Battle() :
 
 Scene_Battle::~Scene_Battle() {
 	Game_Battle::Quit();
+	Game_System::ReleaseAnimationSe();
 }
 
 void Scene_Battle::Start() {
@@ -90,6 +91,8 @@ void Scene_Battle::Start() {
 	enemy_action = NULL;
 
 	Game_System::BgmPlay(Game_System::GetSystemBGM(Game_System::BGM_Battle));
+	Game_System::BgmPrefetch(Game_System::GetSystemBGM(Game_System::BGM_Victory));
+	PrefetchAnimationSe();
 
 	CreateUi();
 
@@ -118,6 +121,21 @@ void Scene_Battle::DrawBackground() {
 	DisplayUi->CleanDisplay();
 }
 
+void Scene_Battle::PrefetchAnimationSe() {
+	for (Game_Actor* actor : Main_Data::game_party->GetActors()) {
+		for (const RPG::Item* weapon : { actor->GetWeapon(), actor->Get2ndWeapon() }) {
+			if (!weapon) {
+				continue;
+			}
+
+			const RPG::Animation* animation = ReaderUtil::GetElement(Data::animations, weapon->animation_id);
+			if (animation) {
+				Game_System::SePrefetch(*animation);
+			}
+		}
+	}
+}
+
 void Scene_Battle::CreateUi() {
 	std::vector<std::string> commands;
 	commands.push_back(Data::terms.battle_fight);
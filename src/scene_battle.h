@@ -105,6 +105,12 @@ protected:
 
 	virtual void CreateUi();
 
+	/**
+	 * Decodes the sounds of the weapon animations of the party in advance.
+	 * They are released when the battle ends.
+	 */
+	void PrefetchAnimationSe();
+
 	virtual void ProcessActions() = 0;
 	virtual void ProcessInput() = 0;
 
@@ -40,6 +40,7 @@
 #include "game_party.h"
 #include "game_player.h"
 #include "data.h"
+#include "interpreter_profiler.h"
 
 Scene_Debug::Scene_Debug() {
 	Scene::type = Scene::Debug;
@@ -89,6 +90,10 @@ void Scene_Debug::Update() {
 					prev_troop_range_index = range_index;
 					prev_troop_range_page = range_page;
 					range_index = 6;
+				} else if (mode == eProfiler) {
+					prev_profiler_range_index = range_index;
+					prev_profiler_range_page = range_page;
+					range_index = 7;
 				} else {
 					range_index = 0;
 				}
@@ -197,6 +202,19 @@ void Scene_Debug::Update() {
 							var_window->Refresh();
 						}
 						break;
+					case 7:
+						Game_System::SePlay(Game_System::GetSystemSE(Game_System::SFX_Decision));
+						// Starts collecting when the profiler was not enabled on the command line
+						InterpreterProfiler::SetEnabled(true);
+						range_index = prev_profiler_range_index;
+						range_page = prev_profiler_range_page;
+						mode = eProfiler;
+						var_window->SetMode(Window_VarList::eProfiler);
+						var_window->UpdateList(range_page * 100 + range_index * 10 + 1);
+						range_window->SetIndex(range_index);
+						UpdateRangeListWindow();
+						var_window->Refresh();
+						break;
 					default:
 						break;
 				}
@@ -333,6 +351,7 @@ void Scene_Debug::UpdateRangeListWindow() {
 				addItem(i++, Data::terms.gold.c_str(), true);
 				addItem(i++, "Items", true);
 				addItem(i++, "Battle", false);
+				addItem(i++, "Profiler", true);
 				while (i < 10) {
 					addItem(i++, "", true);
 				}
@@ -343,6 +362,7 @@ void Scene_Debug::UpdateRangeListWindow() {
 		case eVariable:
 		case eItem:
 		case eBattle:
+		case eProfiler:
 			{
 				const char* prefix = "???";
 				switch (mode) {
@@ -358,6 +378,9 @@ void Scene_Debug::UpdateRangeListWindow() {
 					case eBattle:
 						prefix = "Tp[";
 						break;
+					case eProfiler:
+						prefix = "Pf[";
+						break;
 					default:
 						break;
 				}
@@ -427,6 +450,9 @@ int Scene_Debug::GetLastPage() {
 		case eBattle:
 			num_elements = Data::troops.size();
 			break;
+		case eProfiler:
+			num_elements = InterpreterProfiler::GetSourceStats().size();
+			break;
 		default: break;
 	}
 
@@ -25,7 +25,6 @@
 #include "game_system.h"
 #include "game_party.h"
 #include "input.h"
-#include "lsd_reader.h"
 #include "player.h"
 #include "rpg_save.h"
 #include "scene_file.h"
@@ -33,7 +32,7 @@
 #include "reader_util.h"
 
 Scene_File::Scene_File(std::string message) :
-	message(message), latest_time(0), latest_slot(0) {
+	message(message), latest_time(0), latest_slot(0), cursor_moved(false) {
 	top_index = 0;
 	index = 0;
 }
@@ -60,6 +59,7 @@ void Scene_File::Start() {
 	// Refresh File Finder Save Folder
 	tree = FileFinder::CreateSaveDirectoryTree();
 
+	std::vector<std::string> files;
 	for (int i = 0; i < 15; i++) {
 		std::shared_ptr<Window_SaveFile>
 			w(new Window_SaveFile(0, 40 + i * 64, SCREEN_TARGET_WIDTH, 64));
@@ -70,54 +70,7 @@ void Scene_File::Start() {
 		std::stringstream ss;
 		ss << "Save" << (i <= 8 ? "0" : "") << (i+1) << ".lsd";
 
-		std::string file = FileFinder::FindDefault(*tree, ss.str());
-
-		if (!file.empty()) {
-			// File found
-			std::unique_ptr<RPG::Save> savegame =
-				LSD_Reader::Load(file, Player::encoding);
-
-			if (savegame.get())	{
-				std::vector<std::pair<int, std::string> > party;
-
-				// When a face_name is empty the party list ends
-				int party_size =
-					savegame->title.face1_name.empty() ? 0 :
-					savegame->title.face2_name.empty() ? 1 :
-					savegame->title.face3_name.empty() ? 2 :
-					savegame->title.face4_name.empty() ? 3 : 4;
-
-				party.resize(party_size);
-
-				if (party_size > 3) {
-					party[3].first = savegame->title.face4_id;
-					party[3].second = savegame->title.face4_name;
-				}
-				if (party_size > 2) {
-					party[2].first = savegame->title.face3_id;
-					party[2].second = savegame->title.face3_name;
-				}
-				if (party_size > 1) {
-					party[1].first = savegame->title.face2_id;
-					party[1].second = savegame->title.face2_name;
-				}
-				if (party_size > 0) {
-					party[0].first = savegame->title.face1_id;
-					party[0].second = savegame->title.face1_name;
-				}
-
-				w->SetParty(party, savegame->title.hero_name, savegame->title.hero_hp,
-					savegame->title.hero_level);
-				w->SetHasSave(true);
-
-				if (savegame->title.timestamp > latest_time) {
-					latest_time = savegame->title.timestamp;
-					latest_slot = i;
-				}
-			} else {
-				w->SetCorrupted(true);
-			}
-		}
+		files.push_back(FileFinder::FindDefault(*tree, ss.str()));
 
 		w->Refresh();
 
@@ -126,13 +79,85 @@ void Scene_File::Start() {
 
 	border_bottom = makeBorderSprite(232);
 
-	index = latest_slot;
-	top_index = std::max(0, index - 2);
+	// The titles are filled in by Update when they were read
+	save_index.reset(new SaveIndex(tree->directory_path, std::move(files)));
 
 	Refresh();
 	Update();
 }
 
+void Scene_File::UpdateSaveTitles() {
+	if (!save_index) {
+		return;
+	}
+
+	std::vector<int> slots;
+	bool done = save_index->Poll(slots);
+
+	for (int i : slots) {
+		const SaveIndex::Slot& slot = save_index->GetSlot(i);
+		Window_SaveFile* w = file_windows[i].get();
+
+		if (!slot.has_save) {
+			continue;
+		}
+
+		if (slot.corrupted) {
+			w->SetCorrupted(true);
+			w->Refresh();
+			continue;
+		}
+
+		const RPG::SaveTitle& title = slot.title;
+		std::vector<std::pair<int, std::string> > party;
+
+		// When a face_name is empty the party list ends
+		int party_size =
+			title.face1_name.empty() ? 0 :
+			title.face2_name.empty() ? 1 :
+			title.face3_name.empty() ? 2 :
+			title.face4_name.empty() ? 3 : 4;
+
+		party.resize(party_size);
+
+		if (party_size > 3) {
+			party[3].first = title.face4_id;
+			party[3].second = title.face4_name;
+		}
+		if (party_size > 2) {
+			party[2].first = title.face3_id;
+			party[2].second = title.face3_name;
+		}
+		if (party_size > 1) {
+			party[1].first = title.face2_id;
+			party[1].second = title.face2_name;
+		}
+		if (party_size > 0) {
+			party[0].first = title.face1_id;
+			party[0].second = title.face1_name;
+		}
+
+		w->SetParty(party, title.hero_name, title.hero_hp, title.hero_level);
+		w->SetHasSave(true);
+		w->Refresh();
+
+		if (title.timestamp > latest_time) {
+			latest_time = title.timestamp;
+			latest_slot = i;
+		}
+	}
+
+	if (done) {
+		save_index.reset();
+
+		if (!cursor_moved && !IsWindowMoving() && index != latest_slot) {
+			index = latest_slot;
+			top_index = std::max(0, index - 2);
+			Refresh();
+		}
+	}
+}
+
 void Scene_File::Refresh() {
 	for (int i = 0; i < (int)file_windows.size(); i++) {
 		Window_SaveFile *w = file_windows[i].get();
@@ -143,6 +168,8 @@ void Scene_File::Refresh() {
 }
 
 void Scene_File::Update() {
+	UpdateSaveTitles();
+
 	if (IsWindowMoving()) {
 		for (auto& fw: file_windows) {
 			fw->Update();
@@ -206,6 +233,9 @@ void Scene_File::Update() {
 
 	//top_index = std::min(top_index, std::max(top_index, index - 3 + 1));
 
+	if (index != old_index)
+		cursor_moved = true;
+
 	if (top_index != old_top_index || index != old_index)
 		Refresh();
 
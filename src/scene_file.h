@@ -22,6 +22,7 @@
 #include <vector>
 #include "scene.h"
 #include "filefinder.h"
+#include "save_index.h"
 #include "window_help.h"
 #include "window_savefile.h"
 
@@ -51,6 +52,11 @@ protected:
 	void Refresh();
 	void MoveFileWindows(int dy, int dt);
 
+	/**
+	 * Fills the windows of the slots whose savegame title was read.
+	 */
+	void UpdateSaveTitles();
+
 	int index;
 	int top_index;
 	std::unique_ptr<Window_Help> help_window;
@@ -60,9 +66,12 @@ protected:
 	std::string message;
 
 	std::shared_ptr<FileFinder::DirectoryTree> tree;
+	std::unique_ptr<SaveIndex> save_index;
 
 	double latest_time;
 	int latest_slot;
+	/** The cursor is not moved to the latest savegame after the user moved it */
+	bool cursor_moved;
 };
 
 #endif
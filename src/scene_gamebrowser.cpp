@@ -17,10 +17,13 @@
 
 // Headers
 #include "scene_gamebrowser.h"
+#include "audio_midicache.h"
 #include "audio_secache.h"
 #include "cache.h"
 #include "game_system.h"
 #include "input.h"
+#include "map_cache.h"
+#include "output.h"
 #include "player.h"
 #include "scene_title.h"
 #include "bitmap.h"
@@ -54,6 +57,10 @@ void Scene_GameBrowser::Continue() {
 
 	Cache::Clear();
 	AudioSeCache::Clear();
+#ifdef WANT_FMMIDI
+	AudioMidiCache::Clear();
+#endif
+	MapCache::Clear();
 	Data::Clear();
 	Main_Data::Cleanup();
 
@@ -74,6 +81,13 @@ void Scene_GameBrowser::Update() {
 	command_window->Update();
 	gamelist_window->Update();
 
+	if (!scan_finished && gamelist_window->IsScanFinished()) {
+		scan_finished = true;
+		if (!gamelist_window->HasValidGames()) {
+			command_window->DisableItem(0);
+		}
+	}
+
 	if (command_window->GetActive()) {
 		UpdateCommand();
 	}
@@ -97,10 +111,6 @@ void Scene_GameBrowser::CreateWindows() {
 	gamelist_window.reset(new Window_GameList(60, 32, SCREEN_TARGET_WIDTH - 60, SCREEN_TARGET_HEIGHT - 32));
 	gamelist_window->Refresh();
 
-	if (!gamelist_window->HasValidGames()) {
-		command_window->DisableItem(0);
-	}
-
 	help_window.reset(new Window_Help(0, 0, SCREEN_TARGET_WIDTH, 32));
 	help_window->SetText("EasyRPG Player - RPG Maker 2000/2003 interpreter");
 
@@ -166,6 +176,12 @@ void Scene_GameBrowser::UpdateGameListSelection() {
 }
 
 void Scene_GameBrowser::BootGame() {
+	// Reuses the listing of the game directory made by the game search
+	std::shared_ptr<FileFinder::DirectoryTree> tree = gamelist_window->GetGameTree();
+	if (!tree) {
+		Output::Error("%s is not a valid path", gamelist_window->GetGamePath().c_str());
+	}
+
 #ifdef _WIN32
 	SetCurrentDirectory(Utils::ToWideString(gamelist_window->GetGamePath()).c_str());
 	const std::string& path = ".";
@@ -177,7 +193,8 @@ void Scene_GameBrowser::BootGame() {
 		browser_dir = Main_Data::GetProjectPath();
 	Main_Data::SetProjectPath(path);
 
-	std::shared_ptr<FileFinder::DirectoryTree> tree = FileFinder::CreateDirectoryTree(path);
+	// Relative to the new working directory on Windows
+	tree->directory_path = path;
 	FileFinder::SetDirectoryTree(tree);
 
 	Player::CreateGameObjects();
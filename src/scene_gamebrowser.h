@@ -84,6 +84,8 @@ private:
 
 	bool game_loading = false;
 
+	bool scan_finished = false;
+
 	int old_gamelist_index = 0;
 };
 
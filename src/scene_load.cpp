@@ -18,6 +18,7 @@
 // Headers
 #include <sstream>
 #include "filefinder.h"
+#include "game_system.h"
 #include "game_temp.h"
 #include "output.h"
 #include "player.h"
@@ -39,7 +40,13 @@ void Scene_Load::Action(int index) {
 
 	std::string save_name = FileFinder::FindDefault(*tree, ss.str());
 
-	Player::LoadSavegame(save_name);
+	if (!Player::LoadSavegame(save_name)) {
+		// Only the title was read when listing the savegames
+		Game_System::SePlay(Game_System::GetSystemSE(Game_System::SFX_Buzzer));
+		file_windows[index]->SetCorrupted(true);
+		file_windows[index]->Refresh();
+		return;
+	}
 
 	auto title_scene = Scene::Find(Scene::Title);
 	if (title_scene) {
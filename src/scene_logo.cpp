@@ -28,8 +28,8 @@
 #include "output.h"
 #include "logo.h"
 
-Scene_Logo::Scene_Logo() :
-	frame_counter(0) {
+Scene_Logo::Scene_Logo(bool reuse_game) :
+	frame_counter(0), reuse_game(reuse_game), is_valid(reuse_game) {
 	type = Scene::Logo;
 }
 
@@ -42,16 +42,13 @@ void Scene_Logo::Start() {
 }
 
 void Scene_Logo::Update() {
-	static bool is_valid = false;
-
-	if (frame_counter == 0) {
+	if (frame_counter == 0 && !reuse_game) {
 #ifdef EMSCRIPTEN
-		static bool once = true;
-		if (once) {
+		if (!index_requested) {
 			FileRequestAsync* index = AsyncHandler::RequestFile("index.json");
 			index->SetImportantFile(true);
 			request_id = index->Bind(&Scene_Logo::OnIndexReady, this);
-			once = false;
+			index_requested = true;
 			index->Start();
 			return;
 		}
@@ -68,7 +65,9 @@ void Scene_Logo::Update() {
 		}
 
 		if (FileFinder::IsValidProject(*tree)) {
-			FileFinder::SetDirectoryTree(FileFinder::CreateDirectoryTree(Main_Data::GetProjectPath()));
+			// The subdirectories are listed on first use
+			tree->lazy = true;
+			FileFinder::SetDirectoryTree(tree);
 			Player::CreateGameObjects();
 			is_valid = true;
 		}
@@ -92,8 +91,9 @@ void Scene_Logo::Update() {
 				Output::Debug("Loading Save %s", ss.str().c_str());
 
 				std::string save_name = FileFinder::FindDefault(*tree, ss.str());
-				Player::LoadSavegame(save_name);
-				Scene::Push(std::make_shared<Scene_Map>(true));
+				if (Player::LoadSavegame(save_name)) {
+					Scene::Push(std::make_shared<Scene_Map>(true));
+				}
 			}
 		}
 		else {
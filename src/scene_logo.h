@@ -35,8 +35,11 @@ class Scene_Logo : public Scene {
 public:
 	/**
 	 * Constructor.
+	 *
+	 * @param reuse_game keep the game loaded by a previous logo scene
+	 *                   instead of loading it again.
 	 */
-	Scene_Logo();
+	Scene_Logo(bool reuse_game = false);
 
 	void Start() override;
 	void Update() override;
@@ -45,9 +48,13 @@ private:
 	std::unique_ptr<Sprite> logo;
 	BitmapRef logo_img;
 	int frame_counter;
+	bool reuse_game;
+	/** Whether the game was loaded, a reused game is always valid */
+	bool is_valid;
 
 	void OnIndexReady(FileRequestResult* result);
 	FileRequestBinding request_id;
+	bool index_requested = false;
 	bool async_ready = false;
 };
 
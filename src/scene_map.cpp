@@ -35,6 +35,7 @@
 #include "game_temp.h"
 #include "rpg_system.h"
 #include "player.h"
+#include "rewind.h"
 #include "transition.h"
 #include "audio.h"
 #include "input.h"
@@ -64,6 +65,8 @@ void Scene_Map::Start() {
 
 	Game_Map::Update(true);
 	spriteset->Update();
+
+	Game_System::BgmPrefetch(Game_System::GetSystemBGM(Game_System::BGM_Battle));
 }
 
 void Scene_Map::Continue() {
@@ -75,6 +78,8 @@ void Scene_Map::Continue() {
 		Game_Map::PlayBgm();
 	}
 	spriteset->Update();
+
+	Game_System::BgmPrefetch(Game_System::GetSystemBGM(Game_System::BGM_Battle));
 }
 
 void Scene_Map::Resume() {
@@ -188,6 +193,15 @@ void Scene_Map::Update() {
 		else if (Input::IsTriggered(Input::DEBUG_SAVE)) {
 			CallSave();
 		}
+		else if (Input::IsTriggered(Input::DEBUG_REWIND)) {
+			if (Rewind::Restore()) {
+				Scene::Push(std::make_shared<Scene_Map>(true));
+				return;
+			}
+		}
+		else if (!Main_Data::game_player->IsTeleporting()) {
+			Rewind::Update();
+		}
 	}
 
 	if (!Main_Data::game_player->IsMoving() || Game_Interpreter::IsImmediateCall() || force_menu_calling) {
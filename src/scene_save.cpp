@@ -27,9 +27,11 @@
 #include "game_actor.h"
 #include "game_map.h"
 #include "game_party.h"
+#include "game_system.h"
 #include "lsd_reader.h"
 #include "output.h"
 #include "player.h"
+#include "save_writer.h"
 #include "scene_save.h"
 #include "scene_file.h"
 #include "reader_util.h"
@@ -54,6 +56,9 @@ void Scene_Save::Action(int index) {
 
 	Output::Debug("Saving to %s", ss.str().c_str());
 
+	// Don't read the savegame while it is written
+	save_index.reset();
+
 	// TODO: Maybe find a better place to setup the save file?
 	RPG::SaveTitle title;
 
@@ -98,24 +103,49 @@ void Scene_Save::Action(int index) {
 	}
 
 	LSD_Reader::PrepareSave(Main_Data::game_data);
-	auto data_copy = LSD_Reader::ClearDefaults(Main_Data::game_data, Game_Map::GetMapInfo(), Game_Map::GetMap());
+	// Snapshot of the game state, the game continues while it is written
+	std::unique_ptr<RPG::Save> data_copy(new RPG::Save(
+		LSD_Reader::ClearDefaults(Main_Data::game_data, Game_Map::GetMapInfo(), Game_Map::GetMap())));
 	// RPG_RT saves always have the scene set to this.
-	data_copy.system.scene = RPG::SaveSystem::Scene_file;
+	data_copy->system.scene = RPG::SaveSystem::Scene_file;
 	// RPG_RT always stores SaveMapEvent with map_id == 0.
-	for (auto& sme: data_copy.map_info.events) {
+	for (auto& sme: data_copy->map_info.events) {
 		sme.map_id = 0;
 	}
-	LSD_Reader::Save(filename, data_copy, Player::encoding);
+
+	save_filename = filename;
+	save_write = SaveWriter::Write(filename, std::move(data_copy), Player::encoding);
+}
+
+void Scene_Save::Update() {
+	if (!save_write) {
+		Scene_File::Update();
+		return;
+	}
+
+	switch (save_write->load()) {
+		case SaveWriter::State::Writing:
+			return;
+		case SaveWriter::State::Written:
+			save_write.reset();
 
 #ifdef EMSCRIPTEN
-	// Save changed file system
-	EM_ASM({
-		FS.syncfs(function(err) {
-		});
-	});
+			// Save changed file system
+			EM_ASM({
+				FS.syncfs(function(err) {
+				});
+			});
 #endif
 
-	Scene::Pop();
+			Scene::Pop();
+			return;
+		case SaveWriter::State::Failed:
+			save_write.reset();
+
+			Output::Warning("Saving to %s failed", save_filename.c_str());
+			Game_System::SePlay(Game_System::GetSystemSE(Game_System::SFX_Buzzer));
+			return;
+	}
 }
 
 bool Scene_Save::IsSlotValid(int) {
@@ -22,6 +22,7 @@
 #include <vector>
 #include "scene.h"
 #include "scene_file.h"
+#include "save_writer.h"
 
 /**
  * Scene_Item class.
@@ -35,9 +36,15 @@ public:
 	Scene_Save();
 
 	void Start() override;
+	void Update() override;
 
 	void Action(int index) override;
 	bool IsSlotValid(int index) override;
+
+private:
+	/** Write of the savegame, the scene is closed when it finished */
+	SaveWriter::Handle save_write;
+	std::string save_filename;
 };
 
 #endif
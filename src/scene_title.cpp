@@ -33,6 +33,7 @@
 #include "scene_battle.h"
 #include "scene_load.h"
 #include "scene_map.h"
+#include "startup_graph.h"
 #include "window_command.h"
 
 Scene_Title::Scene_Title() {
@@ -47,7 +48,11 @@ void Scene_Title::Start() {
 		PlayTitleMusic();
 	}
 
+	Game_System::PrefetchSystemSe();
+
 	CreateCommandWindow();
+
+	StartupGraph::PrintProfile();
 }
 
 void Scene_Title::Continue() {
@@ -51,6 +51,7 @@
 #include "audio.h"
 
 #ifdef SUPPORT_AUDIO
+#  include "audio_offline.h"
 
 #  ifdef HAVE_SDL_MIXER
 #    include "audio_sdl_mixer.h"
@@ -129,6 +130,11 @@ Sdl2Ui::Sdl2Ui(long width, long height, bool fullscreen, int zoom) :
 #endif
 
 #ifdef SUPPORT_AUDIO
+	if (!Player::no_audio_flag && !Player::audio_output.empty()) {
+		audio_.reset(new OfflineAudio(Player::audio_output == "null" ? "" : Player::audio_output));
+		return;
+	}
+
 #  ifdef HAVE_SDL_MIXER
 	if (!Player::no_audio_flag) {
 		audio_.reset(new SdlMixerAudio());
@@ -39,6 +39,7 @@
 #include "audio.h"
 
 #ifdef SUPPORT_AUDIO
+#  include "audio_offline.h"
 
 #  ifdef HAVE_SDL_MIXER
 #    include "audio_sdl_mixer.h"
@@ -129,6 +130,11 @@ SdlUi::SdlUi(long width, long height, bool fs_flag) :
 	ShowCursor(false);
 
 #ifdef SUPPORT_AUDIO
+	if (!Player::no_audio_flag && !Player::audio_output.empty()) {
+		audio_.reset(new OfflineAudio(Player::audio_output == "null" ? "" : Player::audio_output));
+		return;
+	}
+
 #  ifdef HAVE_SDL_MIXER
 	if (!Player::no_audio_flag) {
 		audio_.reset(new SdlMixerAudio());
@@ -0,0 +1,88 @@
+/*
+ * This file is part of EasyRPG Player.
+ *
+ * EasyRPG Player is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * EasyRPG Player is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with EasyRPG Player. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef EP_SPSC_QUEUE_H
+#define EP_SPSC_QUEUE_H
+
+// Headers
+#include <atomic>
+#include <cstddef>
+#include <utility>
+
+/**
+ * Bounded lock-free queue for exactly one producer and one consumer thread.
+ *
+ * Push must only be called by the producer and Pop only by the consumer.
+ * Elements are moved in and out, a popped slot is reset to T() so that
+ * resources held by the element are released by the consumer.
+ */
+template <typename T, size_t Capacity>
+class SpscQueue {
+public:
+	/**
+	 * Adds an element to the queue.
+	 *
+	 * @param value element, only moved from when it was added
+	 * @return whether the element was added, false when the queue is full
+	 */
+	bool Push(T&& value) {
+		size_t t = tail.load(std::memory_order_relaxed);
+		size_t next = (t + 1) % size;
+		if (next == head.load(std::memory_order_acquire)) {
+			return false;
+		}
+
+		slots[t] = std::move(value);
+		tail.store(next, std::memory_order_release);
+		return true;
+	}
+
+	/**
+	 * Removes the oldest element from the queue.
+	 *
+	 * @param value receives the element
+	 * @return whether an element was removed, false when the queue is empty
+	 */
+	bool Pop(T& value) {
+		size_t h = head.load(std::memory_order_relaxed);
+		if (h == tail.load(std::memory_order_acquire)) {
+			return false;
+		}
+
+		value = std::move(slots[h]);
+		slots[h] = T();
+		head.store((h + 1) % size, std::memory_order_release);
+		return true;
+	}
+
+	/**
+	 * @return whether the queue is empty, only reliable on the consumer thread
+	 */
+	bool Empty() const {
+		return head.load(std::memory_order_acquire) == tail.load(std::memory_order_acquire);
+	}
+
+private:
+	// One slot always stays unused to tell a full from an empty queue
+	static const size_t size = Capacity + 1;
+
+	T slots[size];
+	std::atomic<size_t> head{0};
+	std::atomic<size_t> tail{0};
+};
+
+#endif
@@ -0,0 +1,186 @@
+/*
+ * This file is part of EasyRPG Player.
+ *
+ * EasyRPG Player is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * EasyRPG Player is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with EasyRPG Player. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Headers
+#include <algorithm>
+#include <cassert>
+#include <thread>
+#include "output.h"
+#include "startup_graph.h"
+
+namespace {
+	typedef std::chrono::steady_clock Clock;
+
+	/** Close enough to the start of the process */
+	const Clock::time_point process_start = Clock::now();
+
+	constexpr unsigned max_workers = 4;
+
+	struct Record {
+		const char* name;
+		double start;
+		double duration;
+		bool worker;
+	};
+
+	bool profile = false;
+	std::mutex profile_mutex;
+	std::vector<Record> records;
+
+	double ToMs(Clock::duration duration) {
+		return std::chrono::duration<double, std::milli>(duration).count();
+	}
+
+	void AddRecord(const char* name, Clock::time_point start, bool worker) {
+		Clock::time_point end = Clock::now();
+
+		std::lock_guard<std::mutex> lock(profile_mutex);
+		records.push_back({ name, ToMs(start - process_start), ToMs(end - start), worker });
+	}
+}
+
+StartupGraph::Step StartupGraph::Add(const char* name, std::function<void()> func,
+		std::vector<Step> dependencies, Thread thread) {
+	Step step = nodes.size();
+
+	Node node;
+	node.name = name;
+	node.func = std::move(func);
+	node.pending = dependencies.size();
+	node.thread = thread;
+
+	for (Step dependency : dependencies) {
+		assert(dependency >= 0 && dependency < step);
+		nodes[dependency].dependents.push_back(step);
+	}
+
+	nodes.push_back(std::move(node));
+	return step;
+}
+
+void StartupGraph::Run() {
+#ifdef EMSCRIPTEN
+	// No threads, the steps were added in a valid order
+	for (Step step = 0; step < (int)nodes.size(); ++step) {
+		Execute(step);
+	}
+#else
+	unstarted_workers = std::count_if(nodes.begin(), nodes.end(), [](const Node& node) {
+		return node.thread == Thread::Worker;
+	});
+
+	unsigned count = std::min<unsigned>(unstarted_workers,
+		std::min(max_workers, std::max(1u, std::thread::hardware_concurrency())));
+
+	std::vector<std::thread> workers;
+	for (unsigned i = 0; i < count; ++i) {
+		workers.emplace_back(&StartupGraph::RunWorker, this);
+	}
+
+	for (Step step = 0; step < (int)nodes.size(); ++step) {
+		if (nodes[step].thread != Thread::Main) {
+			continue;
+		}
+
+		{
+			std::unique_lock<std::mutex> lock(mutex);
+			cv.wait(lock, [this, step]() { return nodes[step].pending == 0; });
+		}
+
+		Execute(step);
+	}
+
+	for (std::thread& worker : workers) {
+		worker.join();
+	}
+#endif
+
+	nodes.clear();
+}
+
+void StartupGraph::RunWorker() {
+	std::unique_lock<std::mutex> lock(mutex);
+	while (unstarted_workers > 0) {
+		auto it = std::find_if(nodes.begin(), nodes.end(), [](const Node& node) {
+			return node.thread == Thread::Worker && !node.started && node.pending == 0;
+		});
+
+		if (it == nodes.end()) {
+			cv.wait(lock);
+			continue;
+		}
+
+		it->started = true;
+		--unstarted_workers;
+		Step step = it - nodes.begin();
+
+		lock.unlock();
+		Execute(step);
+		lock.lock();
+	}
+}
+
+void StartupGraph::Execute(Step step) {
+	Node& node = nodes[step];
+
+	Clock::time_point start = Clock::now();
+	node.func();
+	if (profile) {
+		AddRecord(node.name, start, node.thread == Thread::Worker);
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		for (Step dependent : node.dependents) {
+			--nodes[dependent].pending;
+		}
+	}
+	cv.notify_all();
+}
+
+StartupGraph::ScopedStep::ScopedStep(const char* name) :
+	name(name), start(Clock::now()) {
+}
+
+StartupGraph::ScopedStep::~ScopedStep() {
+	if (profile) {
+		AddRecord(name, start, false);
+	}
+}
+
+void StartupGraph::EnableProfile() {
+	profile = true;
+}
+
+void StartupGraph::PrintProfile() {
+	if (!profile) {
+		return;
+	}
+	profile = false;
+
+	std::lock_guard<std::mutex> lock(profile_mutex);
+	std::stable_sort(records.begin(), records.end(), [](const Record& a, const Record& b) {
+		return a.start < b.start;
+	});
+
+	Output::Debug("Startup: Title screen after %.1f ms", ToMs(Clock::now() - process_start));
+	for (const Record& record : records) {
+		Output::Debug("Startup: %-20s %8.1f ms, started at %8.1f ms%s", record.name,
+			record.duration, record.start, record.worker ? " (worker)" : "");
+	}
+	records.clear();
+}
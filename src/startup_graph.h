@@ -0,0 +1,112 @@
+/*
+ * This file is part of EasyRPG Player.
+ *
+ * EasyRPG Player is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * EasyRPG Player is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with EasyRPG Player. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef EP_STARTUP_GRAPH_H
+#define EP_STARTUP_GRAPH_H
+
+// Headers
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <vector>
+
+/**
+ * Runs the steps of loading a game as a small dependency graph.
+ *
+ * A step starts as soon as all steps it depends on finished. Worker steps
+ * run on a small thread pool, main thread steps run on the thread calling
+ * Run in the order they were added. Worker steps must not use Output or
+ * any other state that is not thread-safe, errors are reported by a later
+ * main thread step.
+ *
+ * The duration of every step is recorded for --startup-profile.
+ */
+class StartupGraph {
+public:
+	typedef int Step;
+
+	enum class Thread {
+		Worker,
+		Main
+	};
+
+	/**
+	 * Adds a step.
+	 *
+	 * @param name name shown in the profile.
+	 * @param func work of the step.
+	 * @param dependencies steps that must finish before this step starts,
+	 *                     only steps added before are allowed.
+	 * @param thread where the step runs.
+	 * @return the step.
+	 */
+	Step Add(const char* name, std::function<void()> func,
+		std::vector<Step> dependencies = {}, Thread thread = Thread::Worker);
+
+	/**
+	 * Runs all steps and returns when they finished.
+	 */
+	void Run();
+
+	/**
+	 * Measures a step that does not run in a graph, the step ends when the
+	 * object is destroyed.
+	 */
+	class ScopedStep {
+	public:
+		explicit ScopedStep(const char* name);
+		~ScopedStep();
+
+	private:
+		const char* name;
+		std::chrono::steady_clock::time_point start;
+	};
+
+	/**
+	 * Enables recording the duration of the steps.
+	 */
+	static void EnableProfile();
+
+	/**
+	 * Prints the recorded steps once, called when the title screen appears.
+	 */
+	static void PrintProfile();
+
+private:
+	struct Node {
+		const char* name;
+		std::function<void()> func;
+		std::vector<Step> dependents;
+		/** Dependencies that did not finish yet */
+		int pending = 0;
+		Thread thread;
+		bool started = false;
+	};
+
+	void RunWorker();
+	void Execute(Step step);
+
+	std::vector<Node> nodes;
+
+	std::mutex mutex;
+	std::condition_variable cv;
+	int unstarted_workers = 0;
+};
+
+#endif
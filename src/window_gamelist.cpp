@@ -16,6 +16,7 @@
  */
 
 // Headers
+#include <algorithm>
 #include <iomanip>
 #include <sstream>
 #include "window_gamelist.h"
@@ -29,23 +30,49 @@ Window_GameList::Window_GameList(int ix, int iy, int iwidth, int iheight) :
 }
 
 void Window_GameList::Refresh() {
-	tree = FileFinder::CreateDirectoryTree(Main_Data::GetProjectPath(), false);
+	path = Main_Data::GetProjectPath();
 	game_directories.clear();
+	scan_finished = false;
+	scanner.reset(new GameScanner(path));
 
-	// Find valid game diectories
-	for (auto dir : tree.get()->directories) {
-		std::shared_ptr<FileFinder::DirectoryTree> subtree = FileFinder::CreateDirectoryTree(FileFinder::MakePath(Main_Data::GetProjectPath(), dir.second), false);
-		if (FileFinder::IsValidProject(*subtree)) {
-			game_directories.push_back(dir.second);
-		}
+	Draw();
+}
+
+void Window_GameList::Update() {
+	Window_Selectable::Update();
+
+	if (scan_finished) {
+		return;
 	}
-	
+
+	std::vector<std::string> found;
+	scan_finished = scanner->Poll(found);
+	if (found.empty() && !scan_finished) {
+		return;
+	}
+
+	std::string selected;
+	if (index >= 0 && index < (int)game_directories.size()) {
+		selected = game_directories[index];
+	}
+
+	game_directories.insert(game_directories.end(), found.begin(), found.end());
+
 	// Sort game list in place
 	std::sort(game_directories.begin(), game_directories.end(),
 			  [](const std::string& s, const std::string& s2) {
-				  return strcmp(Utils::LowerCase(s).c_str(), Utils::LowerCase(s2).c_str()) <= 0;
+				  return strcmp(Utils::LowerCase(s).c_str(), Utils::LowerCase(s2).c_str()) < 0;
 			  });
-	
+
+	// The selection stays on the same game while the list grows
+	if (!selected.empty()) {
+		index = std::find(game_directories.begin(), game_directories.end(), selected) - game_directories.begin();
+	}
+
+	Draw();
+}
+
+void Window_GameList::Draw() {
 	if (HasValidGames()) {
 		item_max = game_directories.size();
 
@@ -60,7 +87,11 @@ void Window_GameList::Refresh() {
 	else {
 		SetContents(Bitmap::Create(width - 16, height - 16));
 
-		DrawErrorText();
+		if (scan_finished) {
+			DrawErrorText();
+		} else {
+			contents->TextDraw(0, 0, Font::ColorDefault, "Searching for games...");
+		}
 	}
 }
 
@@ -113,6 +144,14 @@ bool Window_GameList::HasValidGames()
 	return !game_directories.empty();
 }
 
+bool Window_GameList::IsScanFinished() const {
+	return scan_finished;
+}
+
 std::string Window_GameList::GetGamePath() {
-	return FileFinder::MakePath(tree.get()->directory_path, game_directories[GetIndex()]);
+	return FileFinder::MakePath(path, game_directories[GetIndex()]);
+}
+
+std::shared_ptr<FileFinder::DirectoryTree> Window_GameList::GetGameTree() {
+	return scanner->GetGameTree(game_directories[GetIndex()]);
 }
@@ -23,6 +23,7 @@
 #include "window_help.h"
 #include "window_selectable.h"
 #include "filefinder.h"
+#include "game_scanner.h"
 
 /**
  * Window_GameList class.
@@ -36,10 +37,12 @@ public:
 	Window_GameList(int ix, int iy, int iwidth, int iheight);
 
 	/**
-	 * Refreshes the item list.
+	 * Starts searching for games, the list is filled by Update.
 	 */
 	void Refresh();
 
+	void Update() override;
+
 	/**
 	 * Draws an item together with the quantity.
 	 *
@@ -54,13 +57,27 @@ public:
 	 */
 	bool HasValidGames();
 
+	/**
+	 * @return true when all directories were searched for games
+	 */
+	bool IsScanFinished() const;
+
 	/**
 	 * @return path to the selected game
 	 */
 	std::string GetGamePath();
 
+	/**
+	 * @return directory tree of the selected game
+	 */
+	std::shared_ptr<FileFinder::DirectoryTree> GetGameTree();
+
 private:
-	std::shared_ptr<FileFinder::DirectoryTree> tree;
+	void Draw();
+
+	std::string path;
+	std::unique_ptr<GameScanner> scanner;
+	bool scan_finished = false;
 	std::vector<std::string> game_directories;
 };
 
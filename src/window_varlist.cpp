@@ -80,12 +80,28 @@ void Window_VarList::DrawItemValue(int index){
 				contents->TextDraw(GetWidth() - 16, 16 * index + 2, Font::ColorDefault, "", Text::AlignRight);
 			}
 			break;
+		case eProfiler:
+			{
+				const auto& stats = profiler_stats[first_var + index - 1];
+				// Events which hit the execution limit are highlighted
+				auto font = (stats.limit_hits > 0) ? Font::ColorCritical : Font::ColorDefault;
+				std::stringstream ss;
+				ss << std::fixed << std::setprecision(1) << stats.self_ms << "ms";
+				DrawItem(index, Font::ColorDefault);
+				contents->TextDraw(GetWidth() - 16, 16 * index + 2, font, ss.str(), Text::AlignRight);
+			}
+			break;
+		default:
+			break;
 	}
 }
 
 void Window_VarList::UpdateList(int first_value){
 	static std::stringstream ss;
 	first_var = first_value;
+	if (mode == eProfiler) {
+		profiler_stats = InterpreterProfiler::GetSourceStats();
+	}
 	for (int i = 0; i < 10; i++){
 		if (!DataIsValid(first_var+i)) {
 			continue;
@@ -105,6 +121,9 @@ void Window_VarList::UpdateList(int first_value){
 			case eTroop:
 				ss << ReaderUtil::GetElement(Data::troops, first_value+i)->name;
 				break;
+			case eProfiler:
+				ss << InterpreterProfiler::GetSourceLabel(profiler_stats[first_value + i - 1]);
+				break;
 			default:
 				break;
 		}
@@ -144,6 +163,8 @@ bool Window_VarList::DataIsValid(int range_index) {
 			return range_index > 0 && range_index <= Data::items.size();
 		case eTroop:
 			return range_index > 0 && range_index <= Data::troops.size();
+		case eProfiler:
+			return range_index > 0 && range_index <= (int)profiler_stats.size();
 		default:
 			break;
 	}
@@ -20,6 +20,7 @@
 
 // Headers
 #include "window_command.h"
+#include "interpreter_profiler.h"
 
 class Window_VarList : public Window_Command
 {
@@ -30,6 +31,7 @@ public:
 		eVariable,
 		eItem,
 		eTroop,
+		eProfiler,
 	};
 
 	/**
@@ -87,6 +89,8 @@ private:
 
 	Mode mode = eNone;
 	int first_var = 0;
+	/** Snapshot of the profiler data displayed in eProfiler mode */
+	std::vector<InterpreterProfiler::SourceStats> profiler_stats;
 	int hidden_index = 0;
 
 	bool DataIsValid(int range_index);
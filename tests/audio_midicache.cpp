@@ -0,0 +1,70 @@
+#include <cmath>
+#include <cstdlib>
+#include <vector>
+#include "system.h"
+#include "audio_midicache.h"
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "doctest.h"
+
+#ifdef WANT_FMMIDI
+
+namespace {
+	const double pi = 3.14159265358979323846;
+
+	std::vector<int16_t> RoundTrip(const std::vector<int16_t>& samples) {
+		AudioMidiCache::Track track;
+		AudioMidiCache::AdpcmState state[2];
+		AudioMidiCache::EncodeBlock(samples.data(), state, track.data);
+		track.frames = AudioMidiCache::block_frames;
+		REQUIRE_EQ(track.GetBlockCount(), 1);
+
+		std::vector<int16_t> output(samples.size());
+		track.DecodeBlock(0, output.data());
+		return output;
+	}
+}
+
+TEST_CASE("silence") {
+	std::vector<int16_t> samples(AudioMidiCache::block_frames * 2);
+	REQUIRE(RoundTrip(samples) == samples);
+}
+
+TEST_CASE("sine") {
+	// Left and right channel have a different frequency and amplitude
+	std::vector<int16_t> samples(AudioMidiCache::block_frames * 2);
+	for (int i = 0; i < AudioMidiCache::block_frames; ++i) {
+		samples[i * 2] = (int16_t)(12000 * std::sin(i * 2 * pi / 128));
+		samples[i * 2 + 1] = (int16_t)(-3000 * std::sin(i * 2 * pi / 50));
+	}
+
+	std::vector<int16_t> output = RoundTrip(samples);
+
+	// The step size needs a few samples to adapt to the signal
+	const int adapt_frames = 32;
+	for (int i = adapt_frames * 2; i < (int)samples.size(); ++i) {
+		INFO("sample " << i);
+		REQUIRE_LE(std::abs(output[i] - samples[i]), 128);
+	}
+}
+
+TEST_CASE("block state") {
+	// The second block starts with the encoder state the first block ended with
+	std::vector<int16_t> samples(AudioMidiCache::block_frames * 2, 20000);
+
+	AudioMidiCache::Track track;
+	AudioMidiCache::AdpcmState state[2];
+	AudioMidiCache::EncodeBlock(samples.data(), state, track.data);
+	AudioMidiCache::EncodeBlock(samples.data(), state, track.data);
+	track.frames = AudioMidiCache::block_frames * 2;
+	REQUIRE_EQ(track.GetBlockCount(), 2);
+
+	std::vector<int16_t> output(samples.size());
+	track.DecodeBlock(1, output.data());
+	for (int i = 0; i < (int)samples.size(); ++i) {
+		INFO("sample " << i);
+		REQUIRE_LE(std::abs(output[i] - samples[i]), 64);
+	}
+}
+
+#endif
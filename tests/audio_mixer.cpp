@@ -0,0 +1,127 @@
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+#include "audio_mixer.h"
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "doctest.h"
+
+namespace {
+	// Frame counts around the SIMD block sizes (2, 4 and 8 frames)
+	const int max_frames = 37;
+	const float volume = 0.7f;
+
+	/** Scalar reference of a mixing kernel */
+	template <typename T>
+	void MixReference(float* mix, const T* src, int frames, int channels, float scale, float offset) {
+		for (int i = 0; i < frames; ++i) {
+			float left = src[i * channels] * scale + offset;
+			float right = channels == 1 ? left : src[i * channels + 1] * scale + offset;
+			mix[i * 2] += left * volume;
+			mix[i * 2 + 1] += right * volume;
+		}
+	}
+
+	/** Scalar reference of PackS16 */
+	int16_t PackReference(float sample, float total_volume) {
+		const float threshold = 0.8f;
+		float a = std::fabs(sample);
+		if (total_volume > 1.0f && a > threshold) {
+			a = threshold + (a - threshold) * (1.0f - threshold) / (total_volume - threshold);
+		}
+		float val = (sample < 0 ? -a : a) * 32768.0f;
+		return static_cast<int16_t>(std::max(-32768.0f, std::min(32767.0f, val)));
+	}
+
+	/** Deterministic samples covering the whole range of T */
+	template <typename T>
+	std::vector<T> MakeSamples(int count, T min, T max) {
+		std::vector<T> samples(count);
+		for (int i = 0; i < count; ++i) {
+			double pos = (i * 7919 % 1009) / 1008.0;
+			samples[i] = static_cast<T>(min + (static_cast<double>(max) - min) * pos);
+		}
+		return samples;
+	}
+
+	template <typename T>
+	void CheckKernel(AudioDecoder::Format format, const std::vector<T>& samples, float scale, float offset) {
+		AudioMixer::MixFunction mix_func = AudioMixer::GetMixFunction(format);
+
+		for (int channels = 1; channels <= 3; ++channels) {
+			for (int frames = 0; frames <= max_frames; ++frames) {
+				// The start of the samples and of the mix buffer is moved to test
+				// unaligned loads and stores
+				for (int shift = 0; shift < 4; ++shift) {
+					INFO("channels " << channels << ", frames " << frames << ", shift " << shift);
+
+					std::vector<uint8_t> input((max_frames * 3 + shift) * sizeof(T));
+					memcpy(input.data() + shift * sizeof(T), samples.data(), frames * channels * sizeof(T));
+					const T* src = reinterpret_cast<const T*>(input.data()) + shift;
+
+					// Mixing adds to the buffer, start with non-zero values.
+					// One extra float after the frames detects writes past the end.
+					std::vector<float> mix(max_frames * 2 + shift + 1);
+					for (size_t i = 0; i < mix.size(); ++i) {
+						mix[i] = 0.25f - (i % 5) * 0.1f;
+					}
+					std::vector<float> expected = mix;
+
+					mix_func(mix.data() + shift, reinterpret_cast<const uint8_t*>(src), frames, channels, volume);
+					MixReference(expected.data() + shift, src, frames, channels, scale, offset);
+
+					for (size_t i = 0; i < mix.size(); ++i) {
+						REQUIRE_EQ(mix[i], doctest::Approx(expected[i]).epsilon(1e-5));
+					}
+				}
+			}
+		}
+	}
+}
+
+TEST_CASE("S16 kernel") {
+	CheckKernel<int16_t>(AudioDecoder::Format::S16, MakeSamples<int16_t>(max_frames * 3, -32768, 32767), 1.0f / 32768.0f, 0.0f);
+}
+
+TEST_CASE("F32 kernel") {
+	CheckKernel<float>(AudioDecoder::Format::F32, MakeSamples<float>(max_frames * 3, -1.5f, 1.5f), 1.0f, 0.0f);
+}
+
+TEST_CASE("generic kernels") {
+	CheckKernel<int8_t>(AudioDecoder::Format::S8, MakeSamples<int8_t>(max_frames * 3, -128, 127), 1.0f / 128.0f, 0.0f);
+	CheckKernel<uint8_t>(AudioDecoder::Format::U8, MakeSamples<uint8_t>(max_frames * 3, 0, 255), 1.0f / 128.0f, -1.0f);
+	CheckKernel<uint16_t>(AudioDecoder::Format::U16, MakeSamples<uint16_t>(max_frames * 3, 0, 65535), 1.0f / 32768.0f, -1.0f);
+	CheckKernel<int32_t>(AudioDecoder::Format::S32, MakeSamples<int32_t>(max_frames * 3, INT32_MIN, INT32_MAX), 1.0f / 2147483648.0f, 0.0f);
+}
+
+TEST_CASE("PackS16") {
+	// Includes samples far outside of [-1, 1] which must be clipped
+	std::vector<float> samples = MakeSamples<float>(max_frames * 2 + 4, -2.5f, 2.5f);
+	samples[0] = 1.0f;
+	samples[1] = -1.0f;
+	samples[2] = 0.8f;
+	samples[3] = -0.8f;
+
+	for (float total_volume : { 0.5f, 1.0f, 1.5f, 4.0f }) {
+		for (int count = 0; count <= max_frames * 2; ++count) {
+			for (int shift = 0; shift < 4; ++shift) {
+				INFO("total volume " << total_volume << ", samples " << count << ", shift " << shift);
+
+				// One extra sample after the end detects writes past the end
+				std::vector<int16_t> output(count + shift + 1, 12345);
+				AudioMixer::PackS16(output.data() + shift, samples.data() + shift, count, total_volume);
+
+				for (int i = 0; i < shift; ++i) {
+					REQUIRE_EQ(output[i], 12345);
+				}
+				for (int i = 0; i < count; ++i) {
+					// Rounding differences of the vector and scalar math
+					REQUIRE_LE(std::abs(output[shift + i] - PackReference(samples[shift + i], total_volume)), 1);
+				}
+				REQUIRE_EQ(output[shift + count], 12345);
+			}
+		}
+	}
+}
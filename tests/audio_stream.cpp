@@ -0,0 +1,88 @@
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <memory>
+#include <thread>
+#include <vector>
+#include "audio_stream.h"
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "doctest.h"
+
+namespace {
+	/** Endless silence, 44100 Hz stereo */
+	class SilenceDecoder : public AudioDecoder {
+	public:
+		bool Open(FILE*) override { return true; }
+		bool IsFinished() const override { return false; }
+		void GetFormat(int& frequency, Format& format, int& channels) const override {
+			frequency = 44100;
+			format = Format::S16;
+			channels = 2;
+		}
+		int FillBuffer(uint8_t* buffer, int size) override {
+			memset(buffer, 0, size);
+			return size;
+		}
+	};
+
+	void WaitFor(const std::atomic<bool>& flag) {
+		while (!flag) {
+			std::this_thread::sleep_for(std::chrono::milliseconds(1));
+		}
+	}
+}
+
+TEST_CASE("slow task does not underrun a stream") {
+	AudioStreamWorker worker;
+	auto stream = std::make_shared<AudioStream>(200);
+	worker.Add(stream);
+	worker.Post([stream]() {
+		stream->Open(std::unique_ptr<AudioDecoder>(new SilenceDecoder()));
+	});
+	worker.Sync();
+	REQUIRE(stream->IsReady());
+
+	// Like a BGM open or loading the WildMIDI patches
+	std::atomic<bool> slow_done(false);
+	worker.Post([&slow_done]() {
+		std::this_thread::sleep_for(std::chrono::milliseconds(600));
+		slow_done = true;
+	});
+
+	// Play 10 ms every 10 ms for longer than the ring buffer lasts
+	std::vector<uint8_t> buffer(441 * 4);
+	auto start = std::chrono::steady_clock::now();
+	int chunks = 0;
+	while (!slow_done) {
+		INFO("chunk " << chunks);
+		REQUIRE_EQ(stream->Read(buffer.data(), (int)buffer.size()), (int)buffer.size());
+		++chunks;
+		std::this_thread::sleep_until(start + std::chrono::milliseconds(10 * chunks));
+	}
+	REQUIRE_GT(chunks, 40);
+
+	worker.Stop();
+}
+
+TEST_CASE("urgent tasks run first") {
+	AudioStreamWorker worker;
+	std::vector<int> order;
+	std::atomic<bool> started(false);
+	std::atomic<bool> release(false);
+
+	worker.Post([&]() {
+		started = true;
+		WaitFor(release);
+		order.push_back(0);
+	});
+	WaitFor(started);
+
+	worker.Post([&]() { order.push_back(1); });
+	worker.Post([&]() { order.push_back(2); });
+	worker.Post([&]() { order.push_back(3); }, true);
+	release = true;
+	worker.Sync();
+
+	REQUIRE(order == std::vector<int>({ 0, 3, 1, 2 }));
+}
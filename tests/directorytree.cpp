@@ -1,13 +1,40 @@
+#include <cassert>
 #include <cstdlib>
 #include "filefinder.h"
 #include "player.h"
 #include "main_data.h"
 
+namespace {
+	void CheckLazySubdirectories(const std::string& path) {
+		std::shared_ptr<FileFinder::DirectoryTree> tree = FileFinder::CreateDirectoryTree(path);
+		assert(tree && tree->lazy);
+		assert(!tree->directories.empty());
+		assert(tree->sub_members.empty());
+
+		// A subdirectory is listed on first lookup
+		for (auto& dir : tree->directories) {
+			const FileFinder::string_map* files = FileFinder::GetSubMembers(*tree, dir.first);
+			assert(files);
+			assert(tree->sub_members.count(dir.first) == 1);
+			assert(FileFinder::GetSubMembers(*tree, dir.first) == files);
+
+			std::shared_ptr<FileFinder::DirectoryTree> subtree =
+				FileFinder::CreateDirectoryTree(FileFinder::MakePath(path, dir.second), false);
+			assert(subtree);
+			for (auto& file : subtree->files) {
+				assert(files->count(file.first) == 1);
+			}
+		}
+
+		assert(!FileFinder::GetSubMembers(*tree, "easyrpg_missing_directory"));
+	}
+}
+
 int main(int argc, char** argv) {
 	Player::ParseCommandLine(argc, argv);
 	Main_Data::Init();
 
-	FileFinder::CreateDirectoryTree(Main_Data::GetProjectPath());
+	CheckLazySubdirectories(Main_Data::GetProjectPath());
 	FileFinder::Quit();
 
 	return EXIT_SUCCESS;
@@ -20,6 +20,45 @@ namespace {
 	void CheckEnglishFilename() {
 		assert(!FileFinder::FindImage("CharSet", "Chara1").empty());
 	}
+
+	void CheckMissingFileCache() {
+		std::shared_ptr<FileFinder::DirectoryTree> tree = FileFinder::CreateDirectoryTree(".");
+		FileFinder::SetDirectoryTree(tree);
+		assert(!tree->directories.empty());
+
+		const std::string dir = tree->directories.begin()->second;
+		const std::string name = "EasyRPG_missing_file";
+		assert(FileFinder::FindDefault(dir, name).empty());
+
+		// The miss is cached, the file is not looked up again
+		FileFinder::GetSubMembers(*tree, tree->directories.begin()->first);
+		tree->sub_members[tree->directories.begin()->first][ReaderUtil::Normalize(name)] = name;
+		assert(FileFinder::FindDefault(dir, name).empty());
+
+		// Setting a tree clears the cache
+		FileFinder::SetDirectoryTree(tree);
+		assert(!FileFinder::FindDefault(dir, name).empty());
+	}
+
+	void CheckIsMajorUpdatedLazyTree() {
+		std::shared_ptr<FileFinder::DirectoryTree> tree = FileFinder::CreateDirectoryTree(".");
+		assert(tree->lazy && tree->sub_members.empty());
+		FileFinder::SetDirectoryTree(tree);
+		bool major_updated = FileFinder::IsMajorUpdatedTree();
+
+		// The MP3 check lists the Music folder on first use
+		assert(tree->sub_members.count("music") == tree->directories.count("music"));
+
+		// Same result as with all folders listed
+		std::shared_ptr<FileFinder::DirectoryTree> listed = FileFinder::CreateDirectoryTree(".");
+		for (auto& dir : listed->directories) {
+			assert(FileFinder::GetSubMembers(*listed, dir.first));
+		}
+		FileFinder::SetDirectoryTree(listed);
+		assert(FileFinder::IsMajorUpdatedTree() == major_updated);
+
+		FileFinder::SetDirectoryTree(tree);
+	}
 }
 
 int main(int, char**) {
@@ -34,6 +73,8 @@ int main(int, char**) {
 	FileFinder::InitRtpPaths();
 
 	CheckEnglishFilename();
+	CheckMissingFileCache();
+	CheckIsMajorUpdatedLazyTree();
 
 	FileFinder::Quit();
 
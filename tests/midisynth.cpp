@@ -0,0 +1,73 @@
+#include <algorithm>
+#include <vector>
+#include "system.h"
+#include "midisynth.h"
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "doctest.h"
+
+#ifdef WANT_FMMIDI
+
+namespace {
+	const int rate = 44100;
+	const int frames = 8192;
+
+	/**
+	 * Plays a decaying note with vibrato and tremolo and renders it in chunks
+	 * of the passed sizes, repeated until all frames are rendered.
+	 */
+	std::vector<int_least16_t> Render(const std::vector<int>& chunks) {
+		static const midisynth::FMPARAMETER param = {
+			4, 3, 5,    // ALG FB LFO
+			//AR DR SR RR SL  TL KS ML DT AMS
+			{ 31, 9, 4, 8, 6, 20, 1, 2, 0, 2 },
+			{ 28, 6, 2, 7, 4,  0, 1, 1, 0, 1 },
+			{ 31, 8, 5, 8, 5, 24, 0, 3, 1, 2 },
+			{ 25, 5, 3, 6, 3,  0, 0, 1, 0, 1 }
+		};
+
+		midisynth::fm_note_factory factory;
+		REQUIRE(factory.set_program(0, param));
+		midisynth::synthesizer synth(&factory);
+
+		// Modulation wheel, enables the vibrato
+		synth.control_change(0, 1, 100);
+		synth.note_on(0, 60, 100);
+		synth.note_on(0, 67, 90);
+
+		std::vector<int_least16_t> output(frames * 2);
+		int pos = 0;
+		for (size_t i = 0; pos < frames; ++i) {
+			int n = std::min(chunks[i % chunks.size()], frames - pos);
+			if (pos < frames / 2 && pos + n >= frames / 2) {
+				// Key off, the release starts in the middle of a control step
+				n = frames / 2 - pos;
+				synth.synthesize(&output[pos * 2], n, rate);
+				synth.note_off(0, 60, 64);
+				synth.note_off(0, 67, 64);
+			} else {
+				synth.synthesize(&output[pos * 2], n, rate);
+			}
+			pos += n;
+		}
+
+		return output;
+	}
+}
+
+TEST_CASE("output does not depend on the block size") {
+	std::vector<int_least16_t> reference = Render({ frames });
+
+	bool silent = true;
+	for (int_least16_t sample : reference) {
+		silent = silent && sample == 0;
+	}
+	REQUIRE_FALSE(silent);
+
+	for (const std::vector<int>& chunks : std::vector<std::vector<int>>({ { 1 }, { 7 }, { 15 }, { 17 }, { 3, 16, 29, 100 } })) {
+		INFO("first chunk size " << chunks[0]);
+		REQUIRE(Render(chunks) == reference);
+	}
+}
+
+#endif
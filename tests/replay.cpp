@@ -0,0 +1,111 @@
+#include <bitset>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "input_buttons.h"
+#include "player.h"
+
+#ifndef _WIN32
+#  include <sys/wait.h>
+#  include <unistd.h>
+#endif
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "doctest.h"
+
+#ifndef _WIN32
+namespace {
+	const std::vector<int> marks = { 100, 150, 200, 230 };
+
+	/** New game, then walk right, down and left */
+	void WriteInputLog(const std::string& path) {
+		std::ofstream log(path, std::ios::out | std::ios::trunc);
+
+		for (int frame = 0; frame < 240; ++frame) {
+			std::bitset<Input::BUTTON_COUNT> pressed;
+			pressed[Input::RIGHT] = frame >= 70 && frame < 110;
+			pressed[Input::DOWN] = frame >= 120 && frame < 160;
+			pressed[Input::LEFT] = frame >= 170 && frame < 200;
+			log << pressed << '\n';
+		}
+	}
+
+	/** Runs the Player in a new process, the game state starts fresh */
+	bool RunPlayer(std::vector<std::string> args) {
+		pid_t pid = fork();
+		if (pid < 0) {
+			return false;
+		}
+
+		if (pid == 0) {
+			setenv("SDL_VIDEODRIVER", "dummy", 1);
+
+			std::vector<char*> argv;
+			for (std::string& arg : args) {
+				argv.push_back(&arg[0]);
+			}
+			argv.push_back(nullptr);
+
+			Player::Init(argv.size() - 1, argv.data());
+			Player::Run();
+			_exit(0);
+		}
+
+		int status;
+		waitpid(pid, &status, 0);
+		return WIFEXITED(status) && WEXITSTATUS(status) == 0;
+	}
+
+	std::vector<std::string> ReplayArgs(const std::string& dump_path) {
+		std::stringstream mark_list;
+		for (size_t i = 0; i < marks.size(); ++i) {
+			mark_list << (i > 0 ? "," : "") << marks[i];
+		}
+
+		return {
+			"easyrpg-player", "--window", "--new-game", "--seed", "1",
+			"--replay-turbo", "0", "--replay-mark", mark_list.str(),
+			"--replay-dump", dump_path
+		};
+	}
+
+	std::string ReadFile(const std::string& path) {
+		std::ifstream file(path, std::ios::in | std::ios::binary);
+		std::stringstream ss;
+		ss << file.rdbuf();
+		return ss.str();
+	}
+
+	std::string MakeTempDir() {
+		char path[] = "/tmp/easyrpg_replay_XXXXXX";
+		REQUIRE(mkdtemp(path));
+		return path;
+	}
+}
+
+TEST_CASE("replaying a log twice matches a single replay") {
+	std::string single_path = MakeTempDir();
+	std::string double_path = MakeTempDir();
+	std::string log_path = single_path + "/input.log";
+	WriteInputLog(log_path);
+
+	std::vector<std::string> args = ReplayArgs(single_path);
+	args.insert(args.end(), { "--replay-input", log_path });
+	REQUIRE(RunPlayer(args));
+
+	// The second replay overwrites the screenshots of the first one
+	args = ReplayArgs(double_path);
+	args.insert(args.end(), { "--replay-input", log_path, "--replay-input", log_path });
+	REQUIRE(RunPlayer(args));
+
+	for (int frame : marks) {
+		INFO("frame " << frame);
+		std::string name = "/frame_" + std::to_string(frame) + ".png";
+		std::string single_dump = ReadFile(single_path + name);
+		REQUIRE_FALSE(single_dump.empty());
+		REQUIRE(single_dump == ReadFile(double_path + name));
+	}
+}
+#endif
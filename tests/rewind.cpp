@@ -0,0 +1,88 @@
+#include <memory>
+#include "audio.h"
+#include "data.h"
+#include "filefinder.h"
+#include "game_map.h"
+#include "game_player.h"
+#include "game_system.h"
+#include "main_data.h"
+#include "options.h"
+#include "player.h"
+#include "reader_util.h"
+#include "rewind.h"
+#include "rpg_music.h"
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "doctest.h"
+
+namespace {
+	RPG::Music MakeMusic(const std::string& name) {
+		RPG::Music music;
+		music.name = name;
+		return music;
+	}
+
+	/** Loads the test game and starts on its start map, the audio is EmptyAudio */
+	void SetupGame() {
+		Main_Data::Init();
+
+		std::shared_ptr<FileFinder::DirectoryTree> tree = FileFinder::CreateDirectoryTree(Main_Data::GetProjectPath());
+		REQUIRE(tree);
+
+		// Two music files, they are never opened
+		if (!FileFinder::GetSubMembers(*tree, "music")) {
+			tree->directories["music"] = "Music";
+		}
+		tree->sub_members["music"]["easyrpg_test_a.wav"] = "EasyRPG_Test_A.wav";
+		tree->sub_members["music"]["easyrpg_test_b.wav"] = "EasyRPG_Test_B.wav";
+		FileFinder::SetDirectoryTree(tree);
+
+		Player::GetEncoding();
+		Player::escape_symbol = ReaderUtil::Recode("\\", Player::encoding);
+		Player::LoadDatabase();
+		Player::DetectEngine();
+		Player::ResetGameObjects();
+
+		Game_Map::Setup(Data::treemap.start.party_map_id);
+		Main_Data::game_player->MoveTo(Data::treemap.start.party_x, Data::treemap.start.party_y);
+	}
+
+	void TakeSnapshot() {
+		for (int i = 0; i < REWIND_INTERVAL; ++i) {
+			Rewind::Update();
+		}
+	}
+}
+
+TEST_CASE("restored BGM continues at the snapshot position") {
+	SetupGame();
+
+	Game_System::BgmPlay(MakeMusic("EasyRPG_Test_A"));
+	Audio().BGM_Seek(5000);
+	REQUIRE_EQ(Audio().BGM_GetPosition(), 5000);
+	TakeSnapshot();
+
+	// The game continues with another music
+	Audio().BGM_Seek(9000);
+	Game_System::BgmPlay(MakeMusic("EasyRPG_Test_B"));
+	REQUIRE_EQ(Audio().BGM_GetPosition(), 0);
+
+	REQUIRE(Rewind::Restore());
+	REQUIRE_EQ(Main_Data::game_data.system.current_music.name, "EasyRPG_Test_A");
+	REQUIRE_EQ(Audio().BGM_GetPosition(), 5000);
+
+	// The next music starts at the beginning
+	Game_System::BgmPlay(MakeMusic("EasyRPG_Test_B"));
+	REQUIRE_EQ(Audio().BGM_GetPosition(), 0);
+}
+
+TEST_CASE("resume position is discarded by another music") {
+	SetupGame();
+
+	Game_System::BgmResumeAt("EasyRPG_Test_A", 5000);
+	Game_System::BgmPlay(MakeMusic("EasyRPG_Test_B"));
+	REQUIRE_EQ(Audio().BGM_GetPosition(), 0);
+
+	Game_System::BgmPlay(MakeMusic("EasyRPG_Test_A"));
+	REQUIRE_EQ(Audio().BGM_GetPosition(), 0);
+}
@@ -0,0 +1,35 @@
+#include <string>
+#include "rtp_table.h"
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "doctest.h"
+
+namespace {
+	std::string ToString(const char* name) {
+		return name ? name : "(null)";
+	}
+}
+
+TEST_CASE("japanese name") {
+	REQUIRE_EQ(ToString(RTP::FindJapaneseName(true, "charset", "chara1")), "主人公1");
+	REQUIRE_EQ(ToString(RTP::FindJapaneseName(true, "faceset", "chara1")), "主人公1");
+}
+
+TEST_CASE("case insensitive") {
+	REQUIRE_EQ(ToString(RTP::FindJapaneseName(true, "CharSet", "Chara1")), "主人公1");
+	REQUIRE_EQ(ToString(RTP::FindJapaneseName(true, "CHARSET", "CHARA1")), "主人公1");
+}
+
+TEST_CASE("english name") {
+	REQUIRE_EQ(ToString(RTP::FindEnglishName(true, "CharSet", "主人公1")), "actor1");
+	REQUIRE_EQ(ToString(RTP::FindEnglishName(false, "CharSet", "主人公1")), "actor1");
+}
+
+TEST_CASE("miss") {
+	REQUIRE_FALSE(RTP::FindJapaneseName(true, "CharSet", "NoSuchFile"));
+	// Known name in the wrong folder
+	REQUIRE_FALSE(RTP::FindJapaneseName(true, "Music", "Chara1"));
+	// English names are not in the Japanese to English table
+	REQUIRE_FALSE(RTP::FindEnglishName(true, "CharSet", "Chara1"));
+	REQUIRE_FALSE(RTP::FindEnglishName(true, "", ""));
+}
@@ -0,0 +1,68 @@
+#include <memory>
+#include "spsc_queue.h"
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "doctest.h"
+
+TEST_CASE("empty") {
+	SpscQueue<int, 4> queue;
+	REQUIRE(queue.Empty());
+
+	int value = -1;
+	REQUIRE_FALSE(queue.Pop(value));
+	REQUIRE_EQ(value, -1);
+}
+
+TEST_CASE("full") {
+	SpscQueue<int, 4> queue;
+	for (int i = 0; i < 4; ++i) {
+		REQUIRE(queue.Push(int(i)));
+	}
+	REQUIRE_FALSE(queue.Push(4));
+
+	int value;
+	REQUIRE(queue.Pop(value));
+	REQUIRE_EQ(value, 0);
+	REQUIRE(queue.Push(4));
+	REQUIRE_FALSE(queue.Push(5));
+}
+
+TEST_CASE("wraparound") {
+	SpscQueue<int, 3> queue;
+	int next_push = 0;
+	int next_pop = 0;
+
+	// Head and tail pass the end of the storage several times
+	for (int round = 0; round < 10; ++round) {
+		while (queue.Push(int(next_push))) {
+			++next_push;
+		}
+		REQUIRE_EQ(next_push - next_pop, 3);
+
+		int value;
+		for (int i = 0; i < 2; ++i) {
+			REQUIRE(queue.Pop(value));
+			REQUIRE_EQ(value, next_pop++);
+		}
+	}
+
+	int value;
+	while (queue.Pop(value)) {
+		REQUIRE_EQ(value, next_pop++);
+	}
+	REQUIRE_EQ(next_pop, next_push);
+	REQUIRE(queue.Empty());
+}
+
+TEST_CASE("popped slot is released") {
+	SpscQueue<std::shared_ptr<int>, 2> queue;
+	auto ptr = std::make_shared<int>(1);
+
+	REQUIRE(queue.Push(std::shared_ptr<int>(ptr)));
+	REQUIRE_EQ(ptr.use_count(), 2);
+
+	std::shared_ptr<int> value;
+	REQUIRE(queue.Pop(value));
+	value.reset();
+	REQUIRE_EQ(ptr.use_count(), 1);
+}